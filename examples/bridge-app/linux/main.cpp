@@ -45,6 +45,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <thread>
 
 using namespace chip;
 using namespace chip::Credentials;
@@ -288,35 +289,43 @@ void EncodeFixedLabel(const char * label, const char * value, uint8_t * buffer,
     // TODO: Need to set up an AttributeAccessInterface to handle the lists here.
 }
 
+// The thread running the CHIP event loop.
+std::thread::id gChipThreadId;
+
+// Bridged devices may change from their own threads. Rather than each of them taking the CHIP stack lock, their changes are
+// queued for the CHIP event loop to report.
+void ReportAttributeChange(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+    if (std::this_thread::get_id() == gChipThreadId)
+    {
+        MatterReportingAttributeChangeCallback(endpoint, clusterId, attributeId);
+        return;
+    }
+
+    if (MatterReportingAttributeChangeCallbackFromAnyThread(endpoint, clusterId, attributeId) != CHIP_NO_ERROR)
+    {
+        // The queue is full, wait for the CHIP stack instead.
+        PlatformMgr().LockChipStack();
+        MatterReportingAttributeChangeCallback(endpoint, clusterId, attributeId);
+        PlatformMgr().UnlockChipStack();
+    }
+}
+
 void HandleDeviceStatusChanged(Device * dev, Device::Changed_t itemChangedMask)
 {
     if (itemChangedMask & Device::kChanged_Reachable)
     {
-        uint8_t reachable = dev->IsReachable() ? 1 : 0;
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_BRIDGED_DEVICE_BASIC_CLUSTER_ID,
-                                               ZCL_REACHABLE_ATTRIBUTE_ID, ZCL_BOOLEAN_ATTRIBUTE_TYPE, &reachable);
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_BRIDGED_DEVICE_BASIC_CLUSTER_ID, ZCL_REACHABLE_ATTRIBUTE_ID);
     }
 
     if (itemChangedMask & Device::kChanged_Name)
     {
-        uint8_t zclName[kNodeLabelSize];
-        MutableByteSpan zclNameSpan(zclName);
-        MakeZclCharString(zclNameSpan, dev->GetName());
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_BRIDGED_DEVICE_BASIC_CLUSTER_ID,
-                                               ZCL_NODE_LABEL_ATTRIBUTE_ID, ZCL_CHAR_STRING_ATTRIBUTE_TYPE, zclNameSpan.data());
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_BRIDGED_DEVICE_BASIC_CLUSTER_ID, ZCL_NODE_LABEL_ATTRIBUTE_ID);
     }
 
     if (itemChangedMask & Device::kChanged_Location)
     {
-        uint8_t buffer[kFixedLabelAttributeArraySize];
-        EmberAfAttributeMetadata am = { .attributeId  = ZCL_LABEL_LIST_ATTRIBUTE_ID,
-                                        .size         = kFixedLabelAttributeArraySize,
-                                        .defaultValue = static_cast<uint16_t>(0) };
-
-        EncodeFixedLabel("room", dev->GetLocation(), buffer, sizeof(buffer), &am);
-
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_FIXED_LABEL_CLUSTER_ID, ZCL_LABEL_LIST_ATTRIBUTE_ID,
-                                               ZCL_ARRAY_ATTRIBUTE_TYPE, buffer);
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_FIXED_LABEL_CLUSTER_ID, ZCL_LABEL_LIST_ATTRIBUTE_ID);
     }
 }
 
@@ -329,9 +338,7 @@ void HandleDeviceOnOffStatusChanged(DeviceOnOff * dev, DeviceOnOff::Changed_t it
 
     if (itemChangedMask & DeviceOnOff::kChanged_OnOff)
     {
-        uint8_t isOn = dev->IsOn() ? 1 : 0;
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_ON_OFF_CLUSTER_ID, ZCL_ON_OFF_ATTRIBUTE_ID,
-                                               ZCL_BOOLEAN_ATTRIBUTE_TYPE, &isOn);
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_ON_OFF_CLUSTER_ID, ZCL_ON_OFF_ATTRIBUTE_ID);
     }
 }
 
@@ -344,23 +351,17 @@ void HandleDeviceSwitchStatusChanged(DeviceSwitch * dev, DeviceSwitch::Changed_t
 
     if (itemChangedMask & DeviceSwitch::kChanged_NumberOfPositions)
     {
-        uint8_t numberOfPositions = dev->GetNumberOfPositions();
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_SWITCH_CLUSTER_ID, ZCL_NUMBER_OF_POSITIONS_ATTRIBUTE_ID,
-                                               ZCL_INT8U_ATTRIBUTE_TYPE, &numberOfPositions);
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_SWITCH_CLUSTER_ID, ZCL_NUMBER_OF_POSITIONS_ATTRIBUTE_ID);
     }
 
     if (itemChangedMask & DeviceSwitch::kChanged_CurrentPosition)
     {
-        uint8_t currentPosition = dev->GetCurrentPosition();
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_SWITCH_CLUSTER_ID, ZCL_CURRENT_POSITION_ATTRIBUTE_ID,
-                                               ZCL_INT8U_ATTRIBUTE_TYPE, &currentPosition);
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_SWITCH_CLUSTER_ID, ZCL_CURRENT_POSITION_ATTRIBUTE_ID);
     }
 
     if (itemChangedMask & DeviceSwitch::kChanged_MultiPressMax)
     {
-        uint8_t multiPressMax = dev->GetMultiPressMax();
-        MatterReportingAttributeChangeCallback(dev->GetEndpointId(), ZCL_SWITCH_CLUSTER_ID, ZCL_MULTI_PRESS_MAX_ATTRIBUTE_ID,
-                                               ZCL_INT8U_ATTRIBUTE_TYPE, &multiPressMax);
+        ReportAttributeChange(dev->GetEndpointId(), ZCL_SWITCH_CLUSTER_ID, ZCL_MULTI_PRESS_MAX_ATTRIBUTE_ID);
     }
 }
 
@@ -614,6 +615,9 @@ int main(int argc, char * argv[])
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+    // The CHIP event loop runs on this thread, see RunEventLoop() below.
+    gChipThreadId = std::this_thread::get_id();
+
     // Clear out the device database
     memset(gDevices, 0, sizeof(gDevices));
 
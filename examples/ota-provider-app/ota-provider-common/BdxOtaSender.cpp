@@ -24,17 +24,10 @@
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
-#include <fstream>
-
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
-BdxOtaSender::BdxOtaSender()
-{
-    memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
-}
-
 CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
 {
     if (mInitialized)
@@ -73,6 +66,8 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     switch (event.EventType)
     {
     case TransferSession::OutputEventType::kNone:
+        // Also how the first Block gets sent, once the ReceiveAccept has been acknowledged
+        SendNextAsyncBlock();
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
         chip::Messaging::SendFlags sendFlags;
@@ -88,69 +83,55 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(BDX, "SendMessage failed: %s", chip::ErrorStr(err));
+            break;
+        }
+        if (sendFlags.Has(chip::Messaging::SendMessageFlags::kExpectResponse))
+        {
+            // More Blocks may fit in the window
+            SendNextAsyncBlock();
         }
         break;
     }
     case TransferSession::OutputEventType::kInitReceived: {
-        // TransferSession will automatically reject a transfer if there are no
-        // common supported control modes. It will also default to the smaller
-        // block size.
-        TransferSession::TransferAcceptData acceptData;
-        acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
-        acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
-        acceptData.StartOffset  = mTransfer.GetStartOffset();
-        acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "%s: %s", __FUNCTION__, chip::ErrorStr(err)));
-
-        // Store the file designator used during block query
+        // Open the image before accepting the transfer: it stays open, and shared with any other transfer of the same image,
+        // until the transfer ends.
         uint16_t fdl       = 0;
         const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
+        char fileDesignator[chip::bdx::kMaxFileDesignatorLen];
         VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
                        ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
-        memcpy(mFileDesignator, fd, fdl);
-        mFileDesignator[fdl] = 0;
+        memcpy(fileDesignator, fd, fdl);
+        fileDesignator[fdl] = 0;
 
-        break;
-    }
-    case TransferSession::OutputEventType::kQueryReceived: {
-        TransferSession::BlockData blockData;
-        uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
-
-        // TODO: This should be a utility function in TransferSession
-        if (mTransfer.GetTransferLength() > 0 && mNumBytesSent + blockSize > mTransfer.GetTransferLength())
-        {
-            // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
-        }
-
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
+        err = mFileSource.Open(fileDesignator);
+        if (err != CHIP_NO_ERROR)
         {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
+            ChipLogError(BDX, "%s: cannot open %s: %s", __FUNCTION__, fileDesignator, chip::ErrorStr(err));
+            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
             return;
         }
 
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        VerifyOrReturn(otaFile.good(), ChipLogError(BDX, "%s: file read failed", __FUNCTION__));
-        otaFile.seekg(mNumBytesSent);
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        VerifyOrReturn(otaFile.good() || otaFile.eof(), ChipLogError(BDX, "%s: file read failed", __FUNCTION__));
-
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
-        otaFile.close();
-
-        VerifyOrReturn(CHIP_NO_ERROR == mTransfer.PrepareBlock(blockData),
-                       ChipLogError(BDX, "%s: PrepareBlock failed: %s", __FUNCTION__, chip::ErrorStr(err)));
+        // TransferSession will automatically reject a transfer if there are no
+        // common supported control modes. It will also default to the smaller
+        // block size.
+        // OTA uses receiver drive, or asynchronous mode if the requestor proposes it.
+        const chip::BitFlags<TransferControlFlags> proposedModes(event.transferInitData.TransferCtlFlags);
+        mIsAsync = proposedModes.Has(TransferControlFlags::kAsync);
+
+        TransferSession::TransferAcceptData acceptData;
+        acceptData.ControlMode  = mIsAsync ? TransferControlFlags::kAsync : TransferControlFlags::kReceiverDrive;
+        acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
+        acceptData.StartOffset  = mTransfer.GetStartOffset();
+        acceptData.Length       = mTransfer.GetTransferLength();
+        err                     = mTransfer.AcceptTransfer(acceptData);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "%s: %s", __FUNCTION__, chip::ErrorStr(err)));
         break;
     }
+    case TransferSession::OutputEventType::kQueryReceived:
+        PrepareNextBlock();
+        break;
     case TransferSession::OutputEventType::kAckReceived:
+        SendNextAsyncBlock();
         break;
     case TransferSession::OutputEventType::kAckEOFReceived:
         ChipLogDetail(BDX, "Transfer completed, got AckEOF");
@@ -176,6 +157,64 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     }
 }
 
+void BdxOtaSender::PrepareNextBlock()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    TransferSession::BlockData blockData;
+    uint16_t blockSize   = mTransfer.GetTransferBlockSize();
+    uint16_t bytesToRead = blockSize;
+
+    // TODO: This should be a utility function in TransferSession
+    if (mTransfer.GetTransferLength() > 0 && mNumBytesSent + blockSize > mTransfer.GetTransferLength())
+    {
+        // cast should be safe because of condition above
+        bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
+    }
+
+    // The block is read into a buffer of the file source, reused for every block: PrepareBlock() copies it into the outgoing
+    // message.
+    chip::ByteSpan block;
+    bool isEof = false;
+    err        = mFileSource.GetBlock(mNumBytesSent, bytesToRead, block, isEof);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "%s: file read failed: %s", __FUNCTION__, chip::ErrorStr(err));
+        // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+        return;
+    }
+
+    blockData.Data   = block.data();
+    blockData.Length = block.size();
+    blockData.IsEof  = (blockData.Length < blockSize) ||
+        (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || isEof);
+    mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
+
+    err = mTransfer.PrepareBlock(blockData);
+    VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "%s: PrepareBlock failed: %s", __FUNCTION__, chip::ErrorStr(err)));
+    mIsEofSent = blockData.IsEof;
+}
+
+void BdxOtaSender::SendNextAsyncBlock()
+{
+    VerifyOrReturn(mIsAsync && !mIsEofSent && (mExchangeCtx != nullptr) && mExchangeCtx->HasSessionHandle());
+
+    // An exchange carries a single message awaiting acknowledgement at a time.
+    VerifyOrReturn(!mExchangeCtx->GetReliableMessageContext()->IsMessageNotAcked());
+
+    // Over MRP, the same goes for the receiver's BlockAcks: sending a Block only once the previous one has been acknowledged
+    // ensures that each BlockAck is acknowledged by the next Block, before the receiver sends another one. The full window is
+    // only used on transports without MRP.
+    const uint32_t window = mExchangeCtx->GetSessionHandle()->RequireMRP() ? 1 : mTransfer.GetMaxBlocksInFlight();
+    VerifyOrReturn(mTransfer.GetNumBlocksInFlight() < window);
+
+    PrepareNextBlock();
+
+    // Send it right away, rather than at the next regular poll
+    ScheduleImmediatePoll();
+}
+
 void BdxOtaSender::Reset()
 {
     mFabricIndex.ClearValue();
@@ -187,7 +226,14 @@ void BdxOtaSender::Reset()
         mExchangeCtx = nullptr;
     }
 
+    if (mFileSource.IsOpen())
+    {
+        mFileSource.LogStats();
+        mFileSource.Close();
+    }
+
     mInitialized  = false;
+    mIsAsync      = false;
+    mIsEofSent    = false;
     mNumBytesSent = 0;
-    memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
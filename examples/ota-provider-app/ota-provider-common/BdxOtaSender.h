@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include <protocols/bdx/BdxFileSource.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
 
@@ -23,8 +24,6 @@
 class BdxOtaSender : public chip::bdx::Responder
 {
 public:
-    BdxOtaSender();
-
     // Initializes BDX transfer-related metadata. Should always be called first.
     CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
 
@@ -32,15 +31,25 @@ private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
+    // Prepares the Block following the ones already sent
+    void PrepareNextBlock();
+
+    // In asynchronous mode, sends the next Block if the window allows it
+    void SendNextAsyncBlock();
+
     void Reset();
 
-    // Null-terminated string representing file designator
-    char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
+    // Image being transferred, open from the init message until the transfer ends
+    chip::bdx::FileBlockSource mFileSource;
 
     uint32_t mNumBytesSent = 0;
 
     bool mInitialized = false;
 
+    bool mIsAsync = false;
+
+    bool mIsEofSent = false;
+
     chip::Optional<chip::FabricIndex> mFabricIndex;
 
     chip::Optional<chip::NodeId> mNodeId;
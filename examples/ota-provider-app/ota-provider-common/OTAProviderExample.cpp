@@ -270,7 +270,7 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
 
         // Initialize the transfer session in prepartion for a BDX transfer
         BitFlags<TransferControlFlags> bdxFlags;
-        bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+        bdxFlags.Set(TransferControlFlags::kReceiverDrive).Set(TransferControlFlags::kAsync);
         if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
                                              commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
         {
@@ -41,6 +41,10 @@
 #include <platform/CommissionableDataProvider.h>
 #include <platform/DiagnosticDataProvider.h>
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <platform/Linux/AsyncLogging.h>
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 #if CHIP_DEVICE_CONFIG_ENABLE_BOTH_COMMISSIONER_AND_COMMISSIONEE
 #include "CommissionerMain.h"
 #include <ControllerShellCommands.h>
@@ -68,6 +72,7 @@
 
 #include "AppMain.h"
 #include "CommissionableInit.h"
+#include "CryptoWorkerPool.h"
 
 using namespace chip;
 using namespace chip::ArgParser;
@@ -212,6 +217,15 @@ int ChipLinuxAppInit(int argc, char ** argv, OptionSet * customOptions)
     err = ParseArguments(argc, argv, customOptions);
     SuccessOrExit(err);
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    // Pending log lines are written at exit.
+    if (LinuxDeviceOptions::GetInstance().asyncLogging)
+    {
+        err = Logging::Platform::StartAsyncLogging();
+        SuccessOrExit(err);
+    }
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 #ifdef CHIP_CONFIG_KVS_PATH
     if (LinuxDeviceOptions::GetInstance().KVS == nullptr)
     {
@@ -341,6 +355,13 @@ void ChipLinuxAppMainLoop()
 
     initParams.interfaceId = LinuxDeviceOptions::GetInstance().interfaceId;
 
+    static CryptoWorkerPool cryptoWorkerPool;
+    if (LinuxDeviceOptions::GetInstance().cryptoWorkerThreads > 0 &&
+        cryptoWorkerPool.Init(LinuxDeviceOptions::GetInstance().cryptoWorkerThreads) == CHIP_NO_ERROR)
+    {
+        initParams.sessionCryptoWorker = &cryptoWorkerPool;
+    }
+
     // Init ZCL Data Model and CHIP App Server
     Server::GetInstance().Init(initParams);
 
@@ -380,6 +401,8 @@ void ChipLinuxAppMainLoop()
 
     Server::GetInstance().Shutdown();
 
+    cryptoWorkerPool.Shutdown();
+
     DeviceLayer::PlatformMgr().Shutdown();
 
     Cleanup();
@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "CryptoWorkerPool.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+
+using namespace chip;
+
+CHIP_ERROR CryptoWorkerPool::Init(size_t threadCount)
+{
+    VerifyOrReturnError(threadCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mThreads.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    mShuttingDown = false;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        mThreads.emplace_back([this]() { RunJobs(); });
+    }
+
+    ChipLogProgress(AppServer, "Running CASE crypto on %u worker threads", static_cast<unsigned>(threadCount));
+    return CHIP_NO_ERROR;
+}
+
+void CryptoWorkerPool::Shutdown()
+{
+    std::deque<Job *> cancelledJobs;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShuttingDown = true;
+        cancelledJobs.swap(mJobs);
+    }
+    mJobAvailable.notify_all();
+
+    for (auto & thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    // The event loop may never run the completions scheduled by the threads: complete the jobs here, so
+    // that their sessions fail cleanly and the jobs are freed.
+    for (Job * job : cancelledJobs)
+    {
+        job->Cancel();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCompletedJobs.insert(mCompletedJobs.end(), cancelledJobs.begin(), cancelledJobs.end());
+    }
+    CompleteJobs();
+}
+
+CHIP_ERROR CryptoWorkerPool::Post(Job & job)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        VerifyOrReturnError(!mThreads.empty() && !mShuttingDown, CHIP_ERROR_INCORRECT_STATE);
+        mJobs.push_back(&job);
+    }
+    mJobAvailable.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+void CryptoWorkerPool::CompleteJobs(intptr_t arg)
+{
+    reinterpret_cast<CryptoWorkerPool *>(arg)->CompleteJobs();
+}
+
+void CryptoWorkerPool::CompleteJobs()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (!mCompletedJobs.empty())
+    {
+        Job * job = mCompletedJobs.front();
+        mCompletedJobs.pop_front();
+
+        lock.unlock();
+        job->Complete();
+        lock.lock();
+    }
+}
+
+void CryptoWorkerPool::RunJobs()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mJobAvailable.wait(lock, [this]() { return mShuttingDown || !mJobs.empty(); });
+        if (mJobs.empty())
+        {
+            return;
+        }
+
+        Job * job = mJobs.front();
+        mJobs.pop_front();
+
+        lock.unlock();
+        job->Run();
+        lock.lock();
+
+        mCompletedJobs.push_back(job);
+        lock.unlock();
+        DeviceLayer::PlatformMgr().ScheduleWork(CompleteJobs, reinterpret_cast<intptr_t>(this));
+        lock.lock();
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+#include <protocols/secure_channel/SessionCryptoWorker.h>
+
+/**
+ * Runs session establishment crypto jobs on a pool of threads, and completes them on the CHIP event loop
+ * through PlatformMgr().ScheduleWork().
+ */
+class CryptoWorkerPool : public chip::SessionCryptoWorker
+{
+public:
+    CryptoWorkerPool() {}
+    ~CryptoWorkerPool() override { Shutdown(); }
+
+    CHIP_ERROR Init(size_t threadCount);
+
+    /**
+     * Cancels the jobs still queued, stops the threads, and completes all the jobs whose completion has not
+     * run yet. Must be called on the CHIP event loop, or once it has stopped.
+     */
+    void Shutdown();
+
+    CHIP_ERROR Post(Job & job) override;
+
+private:
+    static void CompleteJobs(intptr_t arg);
+
+    void RunJobs();
+    void CompleteJobs();
+
+    std::mutex mMutex;
+    std::condition_variable mJobAvailable;
+    std::deque<Job *> mJobs;
+    // Jobs that have run or were cancelled, waiting for CompleteJobs() on the event loop.
+    std::deque<Job *> mCompletedJobs;
+    std::vector<std::thread> mThreads;
+    bool mShuttingDown = false;
+};
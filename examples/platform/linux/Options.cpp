@@ -27,6 +27,7 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/Base64.h>
+#include <platform/CHIPDeviceConfig.h>
 
 #include <credentials/examples/DeviceAttestationCredsExample.h>
 
@@ -61,6 +62,8 @@ enum
     kDeviceOption_Spake2pIterations         = 0x1013,
     kDeviceOption_TraceFile                 = 0x1014,
     kDeviceOption_TraceLog                  = 0x1015,
+    kDeviceOption_CryptoWorkerThreads       = 0x1016,
+    kDeviceOption_AsyncLogging              = 0x1017,
 };
 
 constexpr unsigned kAppUsageLength = 64;
@@ -92,6 +95,10 @@ OptionDef sDeviceOptionDefs[] = {
     { "PICS", kArgumentRequired, kDeviceOption_PICS },
     { "KVS", kArgumentRequired, kDeviceOption_KVS },
     { "interface-id", kArgumentRequired, kDeviceOption_InterfaceId },
+    { "crypto-worker-threads", kArgumentRequired, kDeviceOption_CryptoWorkerThreads },
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    { "async-logging", kNoArgument, kDeviceOption_AsyncLogging },
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
     { "trace_file", kArgumentRequired, kDeviceOption_TraceFile },
     { "trace_log", kArgumentRequired, kDeviceOption_TraceLog },
@@ -172,6 +179,16 @@ const char * sDeviceOptionHelp =
     "\n"
     "  --interface-id <interface>\n"
     "       A interface id to advertise on.\n"
+    "\n"
+    "  --crypto-worker-threads <count>\n"
+    "       Number of threads running the expensive crypto of incoming CASE session establishments, so that\n"
+    "       it does not stall the event loop. If omitted or 0, that crypto runs on the event loop.\n"
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    "\n"
+    "  --async-logging\n"
+    "       Write log lines from a background thread rather than from the logging threads. Lines logged faster\n"
+    "       than they can be written are dropped and counted.\n"
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
     "\n"
     "  --trace_file <file>\n"
@@ -364,6 +381,16 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
             Inet::InterfaceId(static_cast<chip::Inet::InterfaceId::PlatformType>(atoi(aValue)));
         break;
 
+    case kDeviceOption_CryptoWorkerThreads:
+        LinuxDeviceOptions::GetInstance().cryptoWorkerThreads = static_cast<uint32_t>(atoi(aValue));
+        break;
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    case kDeviceOption_AsyncLogging:
+        LinuxDeviceOptions::GetInstance().asyncLogging = true;
+        break;
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 #if CHIP_CONFIG_TRANSPORT_TRACE_ENABLED
     case kDeviceOption_TraceFile:
         LinuxDeviceOptions::GetInstance().traceStreamFilename.SetValue(std::string{ aValue });
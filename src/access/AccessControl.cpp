@@ -179,6 +179,14 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+        // First in the list, so that other listeners get up to date decisions.
+        mDecisionCache.Invalidate();
+        RemoveEntryListener(mDecisionCacheInvalidator);
+        mDecisionCacheInvalidator.mNext = mEntryListener;
+        mEntryListener                  = &mDecisionCacheInvalidator;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
     }
 
     return retval;
@@ -190,6 +198,10 @@ CHIP_ERROR AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     CHIP_ERROR retval = mDelegate->Finish();
     mDelegate         = nullptr;
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+    RemoveEntryListener(mDecisionCacheInvalidator);
+    mDecisionCache.Release();
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
     return retval;
 }
 
@@ -283,6 +295,54 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
         return CHIP_NO_ERROR;
     }
 
+    CHIP_ERROR result = CHIP_ERROR_NOT_IMPLEMENTED;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+    if (mDecisionCache.IsStale() && CompileEntries() != CHIP_NO_ERROR)
+    {
+        ChipLogProgress(DataManagement, "AccessControl: cannot compile entries, checking them directly");
+    }
+
+    auto deviceTypeMatcher = [](void * context, DeviceTypeId deviceType, EndpointId endpoint) {
+        return static_cast<DeviceTypeResolver *>(context)->IsDeviceTypeOnEndpoint(deviceType, endpoint);
+    };
+    switch (mDecisionCache.Check(subjectDescriptor, requestPath, requestPrivilege, deviceTypeMatcher, mDeviceTypeResolver))
+    {
+    case AccessDecisionCache::Result::kAllowed:
+        result = CHIP_NO_ERROR;
+        break;
+    case AccessDecisionCache::Result::kDenied:
+        result = CHIP_ERROR_ACCESS_DENIED;
+        break;
+    case AccessDecisionCache::Result::kNotCompiled:
+        break;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+
+    if (result == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        result = CheckEntries(subjectDescriptor, requestPath, requestPrivilege);
+    }
+
+    if (result == CHIP_NO_ERROR)
+    {
+        // An entry passed all checks: access is allowed.
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+    }
+    else if (result == CHIP_ERROR_ACCESS_DENIED)
+    {
+        // No entry was found which passed all checks: access is denied.
+        ChipLogProgress(DataManagement, "AccessControl: denied");
+    }
+
+    return result;
+}
+
+CHIP_ERROR AccessControl::CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                       Privilege requestPrivilege)
+{
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -383,20 +443,83 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
                 continue;
             }
         }
-        // Entry passed all checks: access is allowed.
-
-#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
-        ChipLogProgress(DataManagement, "AccessControl: allowed");
-#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
-
         return CHIP_NO_ERROR;
     }
 
-    // No entry was found which passed all checks: access is denied.
-    ChipLogProgress(DataManagement, "AccessControl: denied");
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+CHIP_ERROR AccessControl::CompileEntries()
+{
+    mDecisionCache.BeginCompilation();
+
+    EntryIterator iterator;
+    ReturnErrorOnFailure(Entries(iterator));
+
+    Entry entry;
+    CHIP_ERROR err;
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        AuthMode authMode       = AuthMode::kNone;
+        Privilege privilege     = Privilege::kView;
+        size_t subjectCount     = 0;
+        size_t targetCount      = 0;
+        ReturnErrorOnFailure(entry.GetFabricIndex(fabricIndex));
+        ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+        ReturnErrorOnFailure(entry.GetSubjectCount(subjectCount));
+        ReturnErrorOnFailure(entry.GetTargetCount(targetCount));
+        // Operational PASE not supported for v1.0.
+        VerifyOrReturnError(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+
+        // An entry without subjects (or targets) applies to any subject (or target): compile it as one
+        // missing subject (or empty target).
+        for (size_t i = 0; i < subjectCount || (i == 0 && subjectCount == 0); ++i)
+        {
+            Optional<NodeId> subject;
+            if (subjectCount > 0)
+            {
+                NodeId nodeId = kUndefinedNodeId;
+                ReturnErrorOnFailure(entry.GetSubject(i, nodeId));
+                VerifyOrReturnError(((IsOperationalNodeId(nodeId) || IsCASEAuthTag(nodeId)) && authMode == AuthMode::kCase) ||
+                                        (IsGroupId(nodeId) && authMode == AuthMode::kGroup),
+                                    CHIP_ERROR_INCORRECT_STATE);
+                subject.SetValue(nodeId);
+            }
+
+            for (size_t j = 0; j < targetCount || (j == 0 && targetCount == 0); ++j)
+            {
+                AccessDecisionCache::Target compiledTarget;
+                if (targetCount > 0)
+                {
+                    Entry::Target target;
+                    ReturnErrorOnFailure(entry.GetTarget(j, target));
+                    if (target.flags & Entry::Target::kCluster)
+                    {
+                        compiledTarget.cluster.SetValue(target.cluster);
+                    }
+                    if (target.flags & Entry::Target::kEndpoint)
+                    {
+                        compiledTarget.endpoint.SetValue(target.endpoint);
+                    }
+                    if (target.flags & Entry::Target::kDeviceType)
+                    {
+                        compiledTarget.deviceType.SetValue(target.deviceType);
+                    }
+                }
+                ReturnErrorOnFailure(mDecisionCache.AddRule(fabricIndex, authMode, privilege, subject, compiledTarget));
+            }
+        }
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+
+    mDecisionCache.EndCompilation();
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
 CHIP_ERROR AccessControl::Dump(const Entry & entry)
 {
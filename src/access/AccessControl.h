@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "AccessDecisionCache.h"
 #include "Privilege.h"
 #include "RequestPath.h"
 #include "SubjectDescriptor.h"
@@ -482,6 +483,7 @@ public:
     {
         ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisionCache();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -539,6 +541,7 @@ public:
     {
         ReturnErrorCodeIf(!IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisionCache();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -580,6 +583,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisionCache();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -628,6 +632,24 @@ public:
 #endif
 
 private:
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+    // Invalidates the decision cache whenever an entry changes.
+    class DecisionCacheInvalidator : public EntryListener
+    {
+    public:
+        explicit DecisionCacheInvalidator(AccessDecisionCache & cache) : mCache(cache) {}
+
+        void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
+                            ChangeType changeType) override
+        {
+            mCache.Invalidate();
+        }
+
+    private:
+        AccessDecisionCache & mCache;
+    };
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
     bool IsValid(const Entry & entry);
@@ -635,12 +657,34 @@ private:
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
+    // Checks against the entries themselves.
+    CHIP_ERROR CheckEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege);
+
+    // For changes that are not notified to entry listeners.
+    void InvalidateDecisionCache()
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+        mDecisionCache.Invalidate();
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+    // Compiles the entries of all fabrics into the decision cache.
+    CHIP_ERROR CompileEntries();
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+
 private:
     Delegate * mDelegate = nullptr;
 
     DeviceTypeResolver * mDeviceTypeResolver = nullptr;
 
     EntryListener * mEntryListener = nullptr;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+    AccessDecisionCache mDecisionCache;
+    DecisionCacheInvalidator mDecisionCacheInvalidator{ mDecisionCache };
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
 };
 
 /**
@@ -0,0 +1,323 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "AccessDecisionCache.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Access {
+
+namespace {
+
+constexpr size_t kInitialRuleCapacity = 16;
+
+// Target key layout: target kind, endpoint, whether there is a cluster, cluster.
+constexpr unsigned kTargetKindShift = 49;
+constexpr unsigned kEndpointShift   = 33;
+constexpr uint64_t kHasClusterBit   = UINT64_C(1) << 32;
+constexpr uint64_t kClusterMask     = kHasClusterBit - 1;
+
+// Request privileges granted by an entry privilege.
+uint8_t GrantedPrivileges(Privilege entryPrivilege)
+{
+    constexpr uint8_t kView       = to_underlying(Privilege::kView);
+    constexpr uint8_t kProxyView  = to_underlying(Privilege::kProxyView);
+    constexpr uint8_t kOperate    = to_underlying(Privilege::kOperate);
+    constexpr uint8_t kManage     = to_underlying(Privilege::kManage);
+    constexpr uint8_t kAdminister = to_underlying(Privilege::kAdminister);
+
+    switch (entryPrivilege)
+    {
+    case Privilege::kView:
+        return kView;
+    case Privilege::kProxyView:
+        return kProxyView | kView;
+    case Privilege::kOperate:
+        return kOperate | kView;
+    case Privilege::kManage:
+        return kManage | kOperate | kView;
+    case Privilege::kAdminister:
+        return kAdminister | kManage | kOperate | kView | kProxyView;
+    }
+    return 0;
+}
+
+} // namespace
+
+void AccessDecisionCache::BeginCompilation()
+{
+    Invalidate();
+    mState = State::kCompiling;
+}
+
+CHIP_ERROR AccessDecisionCache::AddRule(FabricIndex fabric, AuthMode authMode, Privilege privilege,
+                                        const Optional<NodeId> & subject, const Target & target)
+{
+    VerifyOrReturnError(mState == State::kCompiling, CHIP_ERROR_INCORRECT_STATE);
+    // Targets with both an endpoint and a device type are invalid: leave them to the entries.
+    VerifyOrReturnError(!(target.endpoint.HasValue() && target.deviceType.HasValue()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (mRuleCount == mRuleCapacity)
+    {
+        size_t capacity = (mRuleCapacity == 0) ? kInitialRuleCapacity : 2 * mRuleCapacity;
+        auto rules      = static_cast<Rule *>(Platform::MemoryRealloc(mRules, capacity * sizeof(Rule)));
+        VerifyOrReturnError(rules != nullptr, CHIP_ERROR_NO_MEMORY);
+        mRules        = rules;
+        mRuleCapacity = capacity;
+    }
+
+    const SubjectKind subjectKind =
+        !subject.HasValue() ? kAnySubject : (IsCASEAuthTag(subject.Value()) ? kCaseAuthTagSubject : kNodeOrGroupSubject);
+    const TargetKind targetKind =
+        target.deviceType.HasValue() ? kDeviceTypeTarget : (target.endpoint.HasValue() ? kEndpointTarget : kAnyEndpointTarget);
+
+    Rule & rule     = mRules[mRuleCount++];
+    rule.scope      = Scope(fabric, authMode, subjectKind);
+    rule.subject    = subject.ValueOr(0);
+    rule.target     = TargetKey(targetKind, target.endpoint.ValueOr(0), target.cluster);
+    rule.deviceType = target.deviceType.ValueOr(0);
+    rule.privileges = GrantedPrivileges(privilege);
+
+    return CHIP_NO_ERROR;
+}
+
+void AccessDecisionCache::EndCompilation()
+{
+    std::sort(mRules, mRules + mRuleCount, KeyLess);
+
+    // Merge the rules of entries that only differ by privilege.
+    size_t count = 0;
+    for (size_t i = 0; i < mRuleCount; i++)
+    {
+        if (count > 0 && !KeyLess(mRules[count - 1], mRules[i]))
+        {
+            mRules[count - 1].privileges |= mRules[i].privileges;
+        }
+        else
+        {
+            mRules[count++] = mRules[i];
+        }
+    }
+    mRuleCount = count;
+    mState     = State::kCompiled;
+}
+
+void AccessDecisionCache::Invalidate()
+{
+    mRuleCount = 0;
+    mState     = State::kStale;
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+    for (auto & decision : mDecisions)
+    {
+        decision.used = false;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+}
+
+void AccessDecisionCache::Release()
+{
+    Invalidate();
+    if (mRules != nullptr)
+    {
+        Platform::MemoryFree(mRules);
+        mRules        = nullptr;
+        mRuleCapacity = 0;
+    }
+}
+
+uint32_t AccessDecisionCache::Scope(FabricIndex fabric, AuthMode authMode, SubjectKind subjectKind)
+{
+    return static_cast<uint32_t>(fabric) << 16 | static_cast<uint32_t>(to_underlying(authMode)) << 8 | subjectKind;
+}
+
+uint64_t AccessDecisionCache::TargetKey(TargetKind targetKind, EndpointId endpoint, const Optional<ClusterId> & cluster)
+{
+    return static_cast<uint64_t>(targetKind) << kTargetKindShift | static_cast<uint64_t>(endpoint) << kEndpointShift |
+        (cluster.HasValue() ? kHasClusterBit | cluster.Value() : 0);
+}
+
+bool AccessDecisionCache::SubjectLess(const Rule & a, const Rule & b)
+{
+    return (a.scope != b.scope) ? (a.scope < b.scope) : (a.subject < b.subject);
+}
+
+bool AccessDecisionCache::KeyLess(const Rule & a, const Rule & b)
+{
+    if (a.scope != b.scope)
+    {
+        return a.scope < b.scope;
+    }
+    if (a.subject != b.subject)
+    {
+        return a.subject < b.subject;
+    }
+    return (a.target != b.target) ? (a.target < b.target) : (a.deviceType < b.deviceType);
+}
+
+bool AccessDecisionCache::HasRule(const Rule * first, const Rule * last, const Rule & key, uint8_t privilege)
+{
+    const Rule * rule = std::lower_bound(first, last, key, KeyLess);
+    return rule != last && !KeyLess(key, *rule) && (rule->privileges & privilege) != 0;
+}
+
+bool AccessDecisionCache::SubjectAllows(const Rule * first, const Rule * last, const Rule & key, const RequestPath & requestPath,
+                                        uint8_t privilege, DeviceTypeMatcher deviceTypeMatcher, void * deviceTypeMatcherContext,
+                                        bool & resolvedDeviceType) const
+{
+    Rule target       = key;
+    target.deviceType = 0;
+
+    // The endpoint, with or without the cluster, then any endpoint, with or without the cluster.
+    target.target = TargetKey(kEndpointTarget, requestPath.endpoint, NullOptional);
+    VerifyOrReturnError(!HasRule(first, last, target, privilege), true);
+    target.target = TargetKey(kEndpointTarget, requestPath.endpoint, MakeOptional(requestPath.cluster));
+    VerifyOrReturnError(!HasRule(first, last, target, privilege), true);
+    target.target = TargetKey(kAnyEndpointTarget, 0, NullOptional);
+    VerifyOrReturnError(!HasRule(first, last, target, privilege), true);
+    target.target = TargetKey(kAnyEndpointTarget, 0, MakeOptional(requestPath.cluster));
+    VerifyOrReturnError(!HasRule(first, last, target, privilege), true);
+
+    // Device type targets come last, and need resolving.
+    target.target = TargetKey(kDeviceTypeTarget, 0, NullOptional);
+    for (const Rule * rule = std::lower_bound(first, last, target, KeyLess); rule != last; rule++)
+    {
+        if ((rule->privileges & privilege) != 0 &&
+            (!(rule->target & kHasClusterBit) || (rule->target & kClusterMask) == requestPath.cluster))
+        {
+            resolvedDeviceType = true;
+            VerifyOrReturnError(!deviceTypeMatcher(deviceTypeMatcherContext, rule->deviceType, requestPath.endpoint), true);
+        }
+    }
+    return false;
+}
+
+bool AccessDecisionCache::SubjectAllows(const Rule & key, const RequestPath & requestPath, uint8_t privilege,
+                                        DeviceTypeMatcher deviceTypeMatcher, void * deviceTypeMatcherContext,
+                                        bool & resolvedDeviceType) const
+{
+    auto range = std::equal_range(mRules, mRules + mRuleCount, key, SubjectLess);
+    return range.first != range.second &&
+        SubjectAllows(range.first, range.second, key, requestPath, privilege, deviceTypeMatcher, deviceTypeMatcherContext,
+                      resolvedDeviceType);
+}
+
+AccessDecisionCache::Result AccessDecisionCache::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                                       Privilege requestPrivilege, DeviceTypeMatcher deviceTypeMatcher,
+                                                       void * deviceTypeMatcherContext)
+{
+    VerifyOrReturnError(mState == State::kCompiled, Result::kNotCompiled);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+    Decision & decision = mDecisions[DecisionSlot(subjectDescriptor, requestPath, requestPrivilege)];
+    if (decision.used && decision.Matches(subjectDescriptor, requestPath, requestPrivilege))
+    {
+        return decision.allowed ? Result::kAllowed : Result::kDenied;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+
+    const uint8_t privilege = to_underlying(requestPrivilege);
+    bool resolvedDeviceType = false;
+
+    Rule key     = {};
+    key.scope    = Scope(subjectDescriptor.fabricIndex, subjectDescriptor.authMode, kAnySubject);
+    bool allowed = SubjectAllows(key, requestPath, privilege, deviceTypeMatcher, deviceTypeMatcherContext, resolvedDeviceType);
+
+    if (!allowed)
+    {
+        key.scope   = Scope(subjectDescriptor.fabricIndex, subjectDescriptor.authMode, kNodeOrGroupSubject);
+        key.subject = subjectDescriptor.subject;
+        allowed     = SubjectAllows(key, requestPath, privilege, deviceTypeMatcher, deviceTypeMatcherContext, resolvedDeviceType);
+    }
+
+    // A CAT subject matches CATs with the same identifier, and the same or a later version. CAT subjects sort by
+    // identifier then version, so the rules of those matching a CAT are contiguous.
+    const Rule * const begin = mRules;
+    const Rule * const end   = mRules + mRuleCount;
+    key.scope                = Scope(subjectDescriptor.fabricIndex, subjectDescriptor.authMode, kCaseAuthTagSubject);
+    for (size_t i = 0; !allowed && subjectDescriptor.authMode == AuthMode::kCase && i < ArraySize(subjectDescriptor.cats.values) &&
+         subjectDescriptor.cats.values[i] != kUndefinedCAT;
+         i++)
+    {
+        const CASEAuthTag cat = subjectDescriptor.cats.values[i];
+        Rule lastKey          = key;
+        key.subject           = NodeIdFromCASEAuthTag(static_cast<CASEAuthTag>(cat & kTagIdentifierMask));
+        lastKey.subject       = NodeIdFromCASEAuthTag(cat);
+
+        const Rule * rule = std::lower_bound(begin, end, key, SubjectLess);
+        const Rule * last = std::upper_bound(rule, end, lastKey, SubjectLess);
+        while (!allowed && rule != last)
+        {
+            const Rule * subjectLast = std::upper_bound(rule, last, *rule, SubjectLess);
+            allowed = SubjectAllows(rule, subjectLast, *rule, requestPath, privilege, deviceTypeMatcher, deviceTypeMatcherContext,
+                                    resolvedDeviceType);
+            rule    = subjectLast;
+        }
+    }
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+    if (!resolvedDeviceType)
+    {
+        decision.subject   = subjectDescriptor.subject;
+        decision.cats      = subjectDescriptor.cats;
+        decision.cluster   = requestPath.cluster;
+        decision.endpoint  = requestPath.endpoint;
+        decision.fabric    = subjectDescriptor.fabricIndex;
+        decision.authMode  = subjectDescriptor.authMode;
+        decision.privilege = requestPrivilege;
+        decision.allowed   = allowed;
+        decision.used      = true;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+
+    return allowed ? Result::kAllowed : Result::kDenied;
+}
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+bool AccessDecisionCache::Decision::Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                            Privilege requestPrivilege) const
+{
+    if (subject != subjectDescriptor.subject || cluster != requestPath.cluster || endpoint != requestPath.endpoint ||
+        fabric != subjectDescriptor.fabricIndex || authMode != subjectDescriptor.authMode || privilege != requestPrivilege)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < ArraySize(cats.values); i++)
+    {
+        VerifyOrReturnError(cats.values[i] == subjectDescriptor.cats.values[i], false);
+    }
+    return true;
+}
+
+size_t AccessDecisionCache::DecisionSlot(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                         Privilege requestPrivilege)
+{
+    uint64_t hash = (subjectDescriptor.subject ^ (static_cast<uint64_t>(requestPath.cluster) << 16) ^ requestPath.endpoint) *
+        UINT64_C(0x9E3779B97F4A7C15);
+    hash ^=
+        (static_cast<uint64_t>(subjectDescriptor.fabricIndex) << 8 | to_underlying(requestPrivilege)) * UINT64_C(0xFF51AFD7ED558CCD);
+    return static_cast<size_t>((hash >> 32) % CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE);
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+
+} // namespace Access
+} // namespace chip
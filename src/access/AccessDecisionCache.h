@@ -0,0 +1,190 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "Privilege.h"
+#include "RequestPath.h"
+#include "SubjectDescriptor.h"
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/Optional.h>
+
+namespace chip {
+namespace Access {
+
+/**
+ * Compiled form of the access control entries of all fabrics, used by AccessControl::Check instead
+ * of walking the entries through their delegates.
+ *
+ * Each entry is expanded into one rule per (subject, target) pair, and the rules are sorted by fabric,
+ * auth mode, subject, then target endpoint and cluster. A check then looks up the few (subject,
+ * target) combinations that can match the request, instead of evaluating every entry of the fabric.
+ * Rules with a device type target are still resolved at check time, since endpoints may come and go.
+ *
+ * Recent decisions that do not depend on a device type are also remembered, up to
+ * CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE of them.
+ */
+class AccessDecisionCache
+{
+public:
+    enum class Result : uint8_t
+    {
+        kAllowed,
+        kDenied,
+        kNotCompiled, // Entries must be compiled, or checked some other way
+    };
+
+    struct Target
+    {
+        Optional<ClusterId> cluster;
+        Optional<EndpointId> endpoint;
+        Optional<DeviceTypeId> deviceType;
+    };
+
+    // Returns whether the device type is on the endpoint.
+    using DeviceTypeMatcher = bool (*)(void * context, DeviceTypeId deviceType, EndpointId endpoint);
+
+    AccessDecisionCache() = default;
+    ~AccessDecisionCache() { Release(); }
+
+    AccessDecisionCache(const AccessDecisionCache &) = delete;
+    AccessDecisionCache & operator=(const AccessDecisionCache &) = delete;
+
+    /**
+     * Whether the entries changed since the cache was last compiled. A compilation that was begun but not
+     * ended (e.g. because an entry could not be compiled) leaves the cache unused until then.
+     */
+    bool IsStale() const { return mState == State::kStale; }
+
+    /**
+     * Starts a new compilation, forgetting the previous rules. Rules are then added with AddRule, and
+     * the compilation completed with EndCompilation.
+     */
+    void BeginCompilation();
+
+    /**
+     * Adds a rule granting the privilege (and those it implies) to the subject on the target. A missing
+     * subject stands for any subject. Fails with CHIP_ERROR_NO_MEMORY if the rules cannot grow.
+     */
+    CHIP_ERROR AddRule(FabricIndex fabric, AuthMode authMode, Privilege privilege, const Optional<NodeId> & subject,
+                       const Target & target);
+
+    void EndCompilation();
+
+    /**
+     * Forgets the compiled rules and remembered decisions, e.g. because the entries changed. The memory
+     * holding the rules is kept for the next compilation.
+     */
+    void Invalidate();
+
+    /**
+     * Forgets the compiled rules and remembered decisions, and frees the memory holding the rules.
+     */
+    void Release();
+
+    /**
+     * Decides whether the subject may access the path with the privilege, according to the compiled
+     * rules. Returns Result::kNotCompiled if there are none.
+     */
+    Result Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                 DeviceTypeMatcher deviceTypeMatcher, void * deviceTypeMatcherContext);
+
+    size_t RuleCount() const { return mRuleCount; }
+
+private:
+    enum class State : uint8_t
+    {
+        kStale,
+        kCompiling,
+        kCompiled,
+    };
+
+    enum SubjectKind : uint8_t
+    {
+        kAnySubject,
+        kNodeOrGroupSubject,
+        kCaseAuthTagSubject,
+    };
+
+    enum TargetKind : uint8_t
+    {
+        kEndpointTarget,    // Endpoint, and maybe cluster
+        kAnyEndpointTarget, // Cluster or nothing
+        kDeviceTypeTarget,  // Device type, and maybe cluster
+    };
+
+    struct Rule
+    {
+        uint32_t scope;          // Fabric, auth mode and subject kind, see Scope()
+        NodeId subject;          // 0 for any subject
+        uint64_t target;         // Target kind, endpoint and cluster, see TargetKey()
+        DeviceTypeId deviceType; // 0 unless kDeviceTypeTarget
+        uint8_t privileges;      // Bit set of the request privileges granted
+    };
+
+    // Packed so that rules compare as integers.
+    static uint32_t Scope(FabricIndex fabric, AuthMode authMode, SubjectKind subjectKind);
+    static uint64_t TargetKey(TargetKind targetKind, EndpointId endpoint, const Optional<ClusterId> & cluster);
+
+    // Orders rules by scope and subject only.
+    static bool SubjectLess(const Rule & a, const Rule & b);
+    // Orders rules by scope and subject, then target.
+    static bool KeyLess(const Rule & a, const Rule & b);
+
+    // Checks the rules of the subject in the range [first, last), i.e. whose subject is the one of key.
+    bool SubjectAllows(const Rule * first, const Rule * last, const Rule & key, const RequestPath & requestPath,
+                       uint8_t privilege, DeviceTypeMatcher deviceTypeMatcher, void * deviceTypeMatcherContext,
+                       bool & resolvedDeviceType) const;
+    // Checks the rules of the subject of key, found by a lookup in the whole table.
+    bool SubjectAllows(const Rule & key, const RequestPath & requestPath, uint8_t privilege, DeviceTypeMatcher deviceTypeMatcher,
+                       void * deviceTypeMatcherContext, bool & resolvedDeviceType) const;
+    static bool HasRule(const Rule * first, const Rule * last, const Rule & key, uint8_t privilege);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+    struct Decision
+    {
+        NodeId subject;
+        CATValues cats;
+        ClusterId cluster;
+        EndpointId endpoint;
+        FabricIndex fabric;
+        AuthMode authMode;
+        Privilege privilege;
+        bool used;
+        bool allowed;
+
+        bool Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                     Privilege requestPrivilege) const;
+    };
+
+    static size_t DecisionSlot(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                               Privilege requestPrivilege);
+
+    Decision mDecisions[CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE] = {};
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE > 0
+
+    Rule * mRules        = nullptr;
+    size_t mRuleCount    = 0;
+    size_t mRuleCapacity = 0;
+    State mState         = State::kStale;
+};
+
+} // namespace Access
+} // namespace chip
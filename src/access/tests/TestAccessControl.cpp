@@ -20,10 +20,15 @@
 #include "access/examples/ExampleAccessControlDelegate.h"
 
 #include <lib/core/CHIPCore.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
 #include <lib/support/UnitTestRegistration.h>
 
 #include <nlunit-test.h>
 
+#include <chrono>
+#include <stdio.h>
+
 namespace {
 
 using namespace chip;
@@ -1727,6 +1732,266 @@ void TestCheck(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Decides by walking the entries, like AccessControl::Check did before it compiled them into a decision cache.
+CHIP_ERROR ScanEntries(AccessControl & ac, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                       Privilege requestPrivilege)
+{
+    VerifyOrReturnError(subjectDescriptor.authMode != AuthMode::kPase, CHIP_NO_ERROR);
+
+    EntryIterator iterator;
+    ReturnErrorOnFailure(ac.Entries(iterator, &subjectDescriptor.fabricIndex));
+
+    Entry entry;
+    while (iterator.Next(entry) == CHIP_NO_ERROR)
+    {
+        AuthMode authMode   = AuthMode::kNone;
+        Privilege privilege = Privilege::kView;
+        size_t subjectCount = 0;
+        size_t targetCount  = 0;
+        ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+        ReturnErrorOnFailure(entry.GetSubjectCount(subjectCount));
+        ReturnErrorOnFailure(entry.GetTargetCount(targetCount));
+        if (authMode != subjectDescriptor.authMode ||
+            !(privilege == requestPrivilege || privilege == Privilege::kAdminister || requestPrivilege == Privilege::kView ||
+              (privilege == Privilege::kManage && requestPrivilege == Privilege::kOperate)))
+        {
+            continue;
+        }
+
+        bool subjectMatched = (subjectCount == 0);
+        for (size_t i = 0; i < subjectCount && !subjectMatched; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            subjectMatched = IsCASEAuthTag(subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subject)
+                                                    : (subject == subjectDescriptor.subject);
+        }
+
+        bool targetMatched = (targetCount == 0);
+        for (size_t i = 0; i < targetCount && !targetMatched; ++i)
+        {
+            Target target;
+            ReturnErrorOnFailure(entry.GetTarget(i, target));
+            targetMatched = !(target.flags & Target::kDeviceType) &&
+                !((target.flags & Target::kCluster) && target.cluster != requestPath.cluster) &&
+                !((target.flags & Target::kEndpoint) && target.endpoint != requestPath.endpoint);
+        }
+
+        if (subjectMatched && targetMatched)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    return CHIP_ERROR_ACCESS_DENIED;
+}
+
+void TestCheckCached(nlTestSuite * inSuite, void * inContext)
+{
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+
+    // Once to compile the entries, then again to hit remembered decisions.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            NL_TEST_ASSERT(inSuite,
+                           accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) ==
+                               expectedResult);
+        }
+    }
+
+    // Every combination of the subjects and paths used in the checks decides like the entries themselves.
+    constexpr RequestPath requestPaths[] = { { .cluster = kOnOffCluster, .endpoint = 1 },
+                                             { .cluster = kOnOffCluster, .endpoint = 2 },
+                                             { .cluster = kLevelControlCluster, .endpoint = 1 },
+                                             { .cluster = kLevelControlCluster, .endpoint = 2 },
+                                             { .cluster = kColorControlCluster, .endpoint = 2 } };
+    for (const auto & checkData : checkData1)
+    {
+        for (const auto & requestPath : requestPaths)
+        {
+            for (auto privilege : privileges)
+            {
+                NL_TEST_ASSERT(inSuite,
+                               accessControl.Check(checkData.subjectDescriptor, requestPath, privilege) ==
+                                   ScanEntries(accessControl, checkData.subjectDescriptor, requestPath, privilege));
+            }
+        }
+    }
+}
+
+void TestCheckAfterChange(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr SubjectDescriptor subjectDescriptor = { .fabricIndex = 2,
+                                                      .authMode    = AuthMode::kCase,
+                                                      .subject     = kOperationalNodeId4 };
+    constexpr RequestPath requestPath             = { .cluster = kAccessControlCluster, .endpoint = 0 };
+
+    NL_TEST_ASSERT(inSuite,
+                   accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister) == CHIP_ERROR_ACCESS_DENIED);
+
+    // Entry 2 of entryData1 makes the subject administrator of fabric 2.
+    NL_TEST_ASSERT(inSuite, LoadAccessControl(accessControl, entryData1, 3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister) == CHIP_NO_ERROR);
+
+    // Downgraded to view.
+    EntryData updateData = entryData1[2];
+    updateData.privilege = Privilege::kView;
+    {
+        Entry entry;
+        NL_TEST_ASSERT(inSuite, accessControl.PrepareEntry(entry) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, LoadEntry(entry, updateData) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, accessControl.UpdateEntry(2, entry) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite,
+                   accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister) == CHIP_ERROR_ACCESS_DENIED);
+    NL_TEST_ASSERT(inSuite, accessControl.Check(subjectDescriptor, requestPath, Privilege::kView) == CHIP_NO_ERROR);
+
+    // Through a fabric-scoped, notified change.
+    NL_TEST_ASSERT(inSuite, accessControl.DeleteEntry(nullptr, 2, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, accessControl.Check(subjectDescriptor, requestPath, Privilege::kView) == CHIP_ERROR_ACCESS_DENIED);
+}
+
+// Times the given checks, each repeated consecutively (like for the attributes of a wildcard read).
+void RunCheckPerformance(nlTestSuite * inSuite, const CheckData * checks, size_t checkCount, size_t entryCount, int repeats)
+{
+    constexpr int kRounds = 1000;
+
+    size_t mismatches = 0;
+    auto start        = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; ++round)
+    {
+        for (const CheckData & checkData : Span<const CheckData>(checks, checkCount))
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            for (int i = 0; i < repeats; ++i)
+            {
+                mismatches += (accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) !=
+                               expectedResult);
+            }
+        }
+    }
+    auto cached = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; ++round)
+    {
+        for (const CheckData & checkData : Span<const CheckData>(checks, checkCount))
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            for (int i = 0; i < repeats; ++i)
+            {
+                mismatches +=
+                    (ScanEntries(accessControl, checkData.subjectDescriptor, checkData.requestPath, checkData.privilege) !=
+                     expectedResult);
+            }
+        }
+    }
+    auto scanned = std::chrono::steady_clock::now() - start;
+    NL_TEST_ASSERT(inSuite, mismatches == 0);
+
+    const double totalChecks = static_cast<double>(kRounds) * static_cast<double>(checkCount) * repeats;
+    printf("%3u entries, %2d repeats: cached %6.1f ns/check, scan %6.1f ns/check\n", static_cast<unsigned>(entryCount), repeats,
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(cached).count()) / totalChecks,
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(scanned).count()) / totalChecks);
+}
+
+constexpr size_t kFullAclEntriesPerFabric  = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC;
+constexpr size_t kFullAclSubjectsPerEntry  = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_SUBJECTS_PER_ENTRY;
+constexpr size_t kFullAclTargetsPerEntry   = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_TARGETS_PER_ENTRY;
+constexpr size_t kFullAclEntryCount        = CHIP_CONFIG_MAX_FABRICS * kFullAclEntriesPerFabric;
+constexpr size_t kFullAclChecksPerFabric   = 3;
+constexpr NodeId kFullAclUnknownSubject    = 0xFFFF'FFEF'0000'0001;
+constexpr EndpointId kFullAclUnknownTarget = 0xFFFE;
+
+NodeId FullAclSubject(size_t entry, size_t subject)
+{
+    return 0x0000'0001'0000'0000 + entry * kFullAclSubjectsPerEntry + subject;
+}
+
+Target FullAclTarget(size_t entry, size_t target)
+{
+    return { .flags    = Target::kCluster | Target::kEndpoint,
+             .cluster  = static_cast<ClusterId>(1 + entry * kFullAclTargetsPerEntry + target),
+             .endpoint = static_cast<EndpointId>(1 + target) };
+}
+
+// Fills the access control list to capacity: every fabric gets as many entries as it can hold, each with as many subjects and
+// targets as it can hold.
+CHIP_ERROR LoadFullAccessControl(AccessControl & ac)
+{
+    Entry entry;
+    for (size_t fabric = 0; fabric < CHIP_CONFIG_MAX_FABRICS; ++fabric)
+    {
+        for (size_t i = 0; i < kFullAclEntriesPerFabric; ++i)
+        {
+            ReturnErrorOnFailure(ac.PrepareEntry(entry));
+            ReturnErrorOnFailure(entry.SetFabricIndex(static_cast<FabricIndex>(fabric + 1)));
+            ReturnErrorOnFailure(entry.SetPrivilege(Privilege::kOperate));
+            ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+            for (size_t subject = 0; subject < kFullAclSubjectsPerEntry; ++subject)
+            {
+                ReturnErrorOnFailure(entry.AddSubject(nullptr, FullAclSubject(i, subject)));
+            }
+            for (size_t target = 0; target < kFullAclTargetsPerEntry; ++target)
+            {
+                ReturnErrorOnFailure(entry.AddTarget(nullptr, FullAclTarget(i, target)));
+            }
+            ReturnErrorOnFailure(ac.CreateEntry(nullptr, entry));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+// For every fabric of the full list: a check allowed by the last subject and target of its last entry, one denied for its
+// target after matching its subject, and one denied for an unknown subject. They all go through most of the entries.
+void MakeFullAclChecks(CheckData (&checks)[CHIP_CONFIG_MAX_FABRICS * kFullAclChecksPerFabric])
+{
+    constexpr size_t kLastEntry   = kFullAclEntriesPerFabric - 1;
+    constexpr size_t kLastSubject = kFullAclSubjectsPerEntry - 1;
+    const Target lastTarget       = FullAclTarget(kLastEntry, kFullAclTargetsPerEntry - 1);
+
+    for (size_t fabric = 0; fabric < CHIP_CONFIG_MAX_FABRICS; ++fabric)
+    {
+        CheckData * fabricChecks            = &checks[fabric * kFullAclChecksPerFabric];
+        const SubjectDescriptor lastSubject = { .fabricIndex = static_cast<FabricIndex>(fabric + 1),
+                                                .authMode    = AuthMode::kCase,
+                                                .subject     = FullAclSubject(kLastEntry, kLastSubject) };
+
+        fabricChecks[0] = { .subjectDescriptor = lastSubject,
+                            .requestPath       = { .cluster = lastTarget.cluster, .endpoint = lastTarget.endpoint },
+                            .privilege         = Privilege::kOperate,
+                            .allow             = true };
+        fabricChecks[1] = { .subjectDescriptor = lastSubject,
+                            .requestPath       = { .cluster = lastTarget.cluster, .endpoint = kFullAclUnknownTarget },
+                            .privilege         = Privilege::kOperate,
+                            .allow             = false };
+        fabricChecks[2]                           = fabricChecks[0];
+        fabricChecks[2].subjectDescriptor.subject = kFullAclUnknownSubject;
+        fabricChecks[2].allow                     = false;
+    }
+}
+
+void TestCheckPerformance(nlTestSuite * inSuite, void * inContext)
+{
+    LoadAccessControl(accessControl, entryData1, entryData1Count);
+    RunCheckPerformance(inSuite, checkData1, ArraySize(checkData1), entryData1Count, 1);
+    RunCheckPerformance(inSuite, checkData1, ArraySize(checkData1), entryData1Count, 16);
+
+    // The largest list the delegate can hold, checked by subjects and targets of its last entries.
+    static CheckData fullAclChecks[CHIP_CONFIG_MAX_FABRICS * kFullAclChecksPerFabric];
+    MakeFullAclChecks(fullAclChecks);
+    NL_TEST_ASSERT(inSuite, ClearAccessControl(accessControl) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, LoadFullAccessControl(accessControl) == CHIP_NO_ERROR);
+    size_t entryCount = 0;
+    NL_TEST_ASSERT(inSuite, accessControl.GetEntryCount(entryCount) == CHIP_NO_ERROR && entryCount == kFullAclEntryCount);
+    RunCheckPerformance(inSuite, fullAclChecks, ArraySize(fullAclChecks), kFullAclEntryCount, 1);
+    RunCheckPerformance(inSuite, fullAclChecks, ArraySize(fullAclChecks), kFullAclEntryCount, 16);
+}
+
 void TestCreateReadEntry(nlTestSuite * inSuite, void * inContext)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
@@ -2137,6 +2402,7 @@ void TestUpdateEntry(nlTestSuite * inSuite, void * inContext)
 
 int Setup(void * inContext)
 {
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
     AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
     SetAccessControl(accessControl);
     VerifyOrDie(GetAccessControl().Init(delegate, testDeviceTypeResolver) == CHIP_NO_ERROR);
@@ -2146,6 +2412,7 @@ int Setup(void * inContext)
 int Teardown(void * inContext)
 {
     GetAccessControl().Finish();
+    Platform::MemoryShutdown();
     return SUCCESS;
 }
 
@@ -2179,6 +2446,9 @@ int TestAccessControl()
         NL_TEST_DEF("TestFabricFilteredReadEntry", TestFabricFilteredReadEntry),
         NL_TEST_DEF("TestFabricFilteredCreateEntry", TestFabricFilteredCreateEntry),
         NL_TEST_DEF("TestCheck", TestCheck),
+        NL_TEST_DEF("TestCheckCached", TestCheckCached),
+        NL_TEST_DEF("TestCheckAfterChange", TestCheckAfterChange),
+        NL_TEST_DEF("TestCheckPerformance", TestCheckPerformance),
         NL_TEST_SENTINEL()
     };
     // clang-format on
@@ -55,6 +55,13 @@ CHIP_ERROR AttributeReportBuilder::FinishAttribute(AttributeReportIBs::Builder &
     return aAttributeReportIBsBuilder.GetAttributeReport().EndOfAttributeReportIB().GetError();
 }
 
+CHIP_ERROR AttributeValueEncoder::CheckAttributeReportIBLength(uint32_t aStartLength)
+{
+    const uint32_t length = mAttributeReportIBsBuilder.GetWriter()->GetLengthWritten() - aStartLength;
+    VerifyOrReturnError(length <= mEncodeState.mMaxAttributeReportIBLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR AttributeValueEncoder::EnsureListStarted()
 {
     if (mCurrentEncodingListIndex == kInvalidListIndex)
@@ -68,12 +75,14 @@ CHIP_ERROR AttributeValueEncoder::EnsureListStarted()
             // Spec 10.5.4.3.1, 10.5.4.6 (Replace a list w/ Multiple IBs)
             // Put an empty array before encoding the first array element for list chunking.
             AttributeReportBuilder builder;
+            const uint32_t startLength = mAttributeReportIBsBuilder.GetWriter()->GetLengthWritten();
 
             mPath.mListOp = ConcreteDataAttributePath::ListOperation::ReplaceAll;
             ReturnErrorOnFailure(builder.PrepareAttribute(mAttributeReportIBsBuilder, mPath, mDataVersion));
             ReturnErrorOnFailure(builder.EncodeValue(mAttributeReportIBsBuilder, DataModel::List<uint8_t>()));
 
             ReturnErrorOnFailure(builder.FinishAttribute(mAttributeReportIBsBuilder));
+            ReturnErrorOnFailure(CheckAttributeReportIBLength(startLength));
             mEncodeState.mCurrentEncodingListIndex = 0;
         }
         mCurrentEncodingListIndex = 0;
@@ -137,6 +137,13 @@ public:
         AttributeEncodeState() : mAllowPartialData(false), mCurrentEncodingListIndex(kInvalidListIndex) {}
         bool AllowPartialData() const { return mAllowPartialData; }
 
+        /**
+         * Limit the length of every AttributeReportIB encoded with this state, e.g. each list item of a chunked list, so that
+         * each of them fits in a report message on its own. Longer AttributeReportIBs fail with CHIP_ERROR_BUFFER_TOO_SMALL.
+         */
+        void SetMaxAttributeReportIBLength(uint32_t aLength) { mMaxAttributeReportIBLength = aLength; }
+        uint32_t GetMaxAttributeReportIBLength() const { return mMaxAttributeReportIBLength; }
+
     private:
         friend class AttributeValueEncoder;
         /**
@@ -160,6 +167,7 @@ public:
          * encoded (i.e. the count of items encoded so far).
          */
         ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
+        uint32_t mMaxAttributeReportIBLength = UINT32_MAX;
     };
 
     AttributeValueEncoder(AttributeReportIBs::Builder & aAttributeReportIBsBuilder, FabricIndex aAccessingFabricIndex,
@@ -288,13 +296,20 @@ private:
     CHIP_ERROR EncodeAttributeReportIB(Ts &&... aArgs)
     {
         AttributeReportBuilder builder;
+        const uint32_t startLength = mAttributeReportIBsBuilder.GetWriter()->GetLengthWritten();
 
         ReturnErrorOnFailure(builder.PrepareAttribute(mAttributeReportIBsBuilder, mPath, mDataVersion));
         ReturnErrorOnFailure(builder.EncodeValue(mAttributeReportIBsBuilder, std::forward<Ts>(aArgs)...));
+        ReturnErrorOnFailure(builder.FinishAttribute(mAttributeReportIBsBuilder));
 
-        return builder.FinishAttribute(mAttributeReportIBsBuilder);
+        return CheckAttributeReportIBLength(startLength);
     }
 
+    /**
+     * Check that the AttributeReportIB encoded since aStartLength bytes were written is within the limit of mEncodeState.
+     */
+    CHIP_ERROR CheckAttributeReportIBLength(uint32_t aStartLength);
+
     /**
      * EnsureListStarted encodes the first item of one report with lists (an
      * empty list), as needed.
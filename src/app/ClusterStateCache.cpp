@@ -19,30 +19,52 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <algorithm>
 #include <tuple>
 
 namespace chip {
 namespace app {
 
+namespace {
+
+// Approximate size of the bookkeeping of a std::map node besides its value: the color and three links.
+constexpr size_t kMapNodeOverhead = 4 * sizeof(void *);
+
+// Encoded size of a StatusIB, as counted in the size of the cached data of a cluster.
+uint32_t EncodedStatusSize(const StatusIB & status)
+{
+    // 1 byte: anonymous tag control byte for struct. 1 byte: control byte for uint8 value. 1 byte:
+    // context-specific tag for uint8 value.1 byte: the uint8 value. 1 byte: end of container.
+    uint32_t size = 5;
+    if (status.mClusterStatus.HasValue())
+    {
+        // 1 byte: control byte for uint8 value. 1 byte: context-specific tag for uint8 value. 1 byte: the uint8 value.
+        size += 3;
+    }
+    return size;
+}
+
+} // namespace
+
 CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                           const StatusIB & aStatus)
 {
     AttributeState state;
     System::PacketBufferHandle handle;
     System::PacketBufferTLVWriter writer;
-    bool endpointIsNew = false;
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
+    //
+    // Since we might potentially be creating a new entry for aPath.mEndpointId that wasn't there before, we need to
+    // check if an entry didn't exist there previously and remember that so that we can appropriately notify our
+    // clients of the addition of a new endpoint.
+    //
+    bool endpointIsNew = !HasEndpoint(aPath.mEndpointId);
+
+    if (mStorageMode == StorageMode::kCompact)
     {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
+        ReturnErrorOnFailure(UpdateCompactCache(aPath, apData, aStatus));
     }
-
-    if (apData)
+    else if (apData)
     {
         handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
 
@@ -58,12 +80,19 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         handle.RightSize();
 
         state.Set<System::PacketBufferHandle>(std::move(handle));
+    }
+    else
+    {
+        state.Set<StatusIB>(aStatus);
+    }
 
+    if (apData)
+    {
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        GetDataVersionState(aPath).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -84,15 +113,11 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            GetDataVersionState(aPath).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
     }
-    else
-    {
-        state.Set<StatusIB>(aStatus);
-    }
 
     //
     // if the endpoint didn't exist previously, let's track the insertion
@@ -103,11 +128,165 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    if (mStorageMode == StorageMode::kPerAttributeBuffers)
+    {
+        mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    }
     mChangedAttributeSet.insert(aPath);
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR ClusterStateCache::UpdateCompactCache(const ConcreteAttributePath & aPath, TLV::TLVReader * apData,
+                                                 const StatusIB & aStatus)
+{
+    size_t offset = mArena.size();
+    size_t length = 0;
+
+    if (apData)
+    {
+        //
+        // Values are bounded the same way as in packet buffers: copy the value straight to the end of the arena,
+        // then trim the arena down to what was written.
+        //
+        VerifyOrReturnError(offset + kMaxSecureSduLengthBytes <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+        mArena.resize(offset + kMaxSecureSduLengthBytes);
+
+        TLV::TLVWriter writer;
+        writer.Init(mArena.data() + offset, kMaxSecureSduLengthBytes);
+        CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = writer.Finalize();
+        }
+        length = (err == CHIP_NO_ERROR) ? writer.GetLengthWritten() : 0;
+        mArena.resize(offset + length);
+        ReturnErrorOnFailure(err);
+    }
+
+    GetDataVersionState(aPath);
+
+    size_t index = CompactAttributeIndex(aPath);
+    if (index == mCompactAttributes.size() || mCompactAttributes[index].mPath != aPath)
+    {
+        CompactAttributeState attributeState;
+        attributeState.mPath   = aPath;
+        attributeState.mLength = 0;
+        mCompactAttributes.insert(mCompactAttributes.begin() + static_cast<ptrdiff_t>(index), attributeState);
+    }
+
+    CompactAttributeState & attributeState = mCompactAttributes[index];
+    mArenaGarbageSize += attributeState.mLength;
+    attributeState.mOffset = static_cast<uint32_t>(offset);
+    attributeState.mLength = static_cast<uint32_t>(length);
+    attributeState.mStatus = apData ? StatusIB() : aStatus;
+    return CHIP_NO_ERROR;
+}
+
+void ClusterStateCache::CompactArena()
+{
+    if (mArenaGarbageSize <= (mArena.size() - mArenaGarbageSize) / 2)
+    {
+        return;
+    }
+
+    std::vector<uint8_t> arena;
+    arena.reserve(mArena.size() - mArenaGarbageSize);
+    for (auto & attributeState : mCompactAttributes)
+    {
+        if (attributeState.mLength != 0)
+        {
+            const uint8_t * value = mArena.data() + attributeState.mOffset;
+            attributeState.mOffset = static_cast<uint32_t>(arena.size());
+            arena.insert(arena.end(), value, value + attributeState.mLength);
+        }
+    }
+    mArena.swap(arena);
+    mArenaGarbageSize = 0;
+}
+
+bool ClusterStateCache::HasEndpoint(EndpointId endpointId) const
+{
+    if (mStorageMode == StorageMode::kCompact)
+    {
+        size_t index = CompactClusterIndex(ConcreteClusterPath(endpointId, 0));
+        return index < mCompactClusters.size() && mCompactClusters[index].mPath.mEndpointId == endpointId;
+    }
+    return mCache.find(endpointId) != mCache.end();
+}
+
+ClusterStateCache::DataVersionState & ClusterStateCache::GetDataVersionState(const ConcreteClusterPath & path)
+{
+    if (mStorageMode == StorageMode::kPerAttributeBuffers)
+    {
+        return mCache[path.mEndpointId][path.mClusterId];
+    }
+
+    size_t index = CompactClusterIndex(path);
+    if (index == mCompactClusters.size() || mCompactClusters[index].mPath != path)
+    {
+        CompactClusterState clusterState;
+        clusterState.mPath = path;
+        mCompactClusters.insert(mCompactClusters.begin() + static_cast<ptrdiff_t>(index), clusterState);
+    }
+    return mCompactClusters[index];
+}
+
+size_t ClusterStateCache::CompactClusterIndex(const ConcreteClusterPath & path) const
+{
+    auto iter = std::lower_bound(mCompactClusters.begin(), mCompactClusters.end(), path,
+                                 [](const CompactClusterState & clusterState, const ConcreteClusterPath & other) {
+                                     return clusterState.mPath.mEndpointId < other.mEndpointId ||
+                                         (clusterState.mPath.mEndpointId == other.mEndpointId &&
+                                          clusterState.mPath.mClusterId < other.mClusterId);
+                                 });
+    return static_cast<size_t>(iter - mCompactClusters.begin());
+}
+
+size_t ClusterStateCache::CompactAttributeIndex(const ConcreteAttributePath & path) const
+{
+    auto iter = std::lower_bound(mCompactAttributes.begin(), mCompactAttributes.end(), path,
+                                 [](const CompactAttributeState & attributeState, const ConcreteAttributePath & other) {
+                                     return attributeState.mPath < other;
+                                 });
+    return static_cast<size_t>(iter - mCompactAttributes.begin());
+}
+
+const ClusterStateCache::CompactAttributeState *
+ClusterStateCache::GetCompactAttributeState(const ConcreteAttributePath & path) const
+{
+    size_t index = CompactAttributeIndex(path);
+    if (index == mCompactAttributes.size() || mCompactAttributes[index].mPath != path)
+    {
+        return nullptr;
+    }
+    return &mCompactAttributes[index];
+}
+
+size_t ClusterStateCache::GetAttributeStorageSize() const
+{
+    size_t size = mCompactClusters.capacity() * sizeof(CompactClusterState) +
+        mCompactAttributes.capacity() * sizeof(CompactAttributeState) + mArena.capacity();
+
+    for (const auto & endpointIter : mCache)
+    {
+        size += kMapNodeOverhead + sizeof(endpointIter);
+        for (const auto & clusterIter : endpointIter.second)
+        {
+            size += kMapNodeOverhead + sizeof(clusterIter);
+            for (const auto & attributeIter : clusterIter.second.mAttributes)
+            {
+                size += kMapNodeOverhead + sizeof(attributeIter);
+                if (attributeIter.second.Is<System::PacketBufferHandle>())
+                {
+                    const auto & handle = attributeIter.second.Get<System::PacketBufferHandle>();
+                    size += sizeof(System::PacketBuffer) + handle->AllocSize();
+                }
+            }
+        }
+    }
+    return size;
+}
+
 CHIP_ERROR ClusterStateCache::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData, const StatusIB * apStatus)
 {
     if (apData)
@@ -164,7 +343,7 @@ void ClusterStateCache::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = GetDataVersionState(mLastReportDataPath);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -176,6 +355,7 @@ void ClusterStateCache::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
+    CompactArena();
     std::set<std::tuple<EndpointId, ClusterId>> changedClusters;
 
     //
@@ -205,6 +385,16 @@ CHIP_ERROR ClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVRe
 {
     CHIP_ERROR err;
 
+    if (mStorageMode == StorageMode::kCompact)
+    {
+        auto compactAttributeState = GetCompactAttributeState(path);
+        VerifyOrReturnError(compactAttributeState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(compactAttributeState->mLength != 0, CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+
+        reader.Init(mArena.data() + compactAttributeState->mOffset, compactAttributeState->mLength);
+        return reader.Next();
+    }
+
     auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
@@ -339,6 +529,17 @@ void ClusterStateCache::OnAttributeData(const ConcreteDataAttributePath & aPath,
 CHIP_ERROR ClusterStateCache::GetVersion(EndpointId mEndpointId, ClusterId mClusterId, Optional<DataVersion> & aVersion)
 {
     CHIP_ERROR err;
+
+    if (mStorageMode == StorageMode::kCompact)
+    {
+        size_t index = CompactClusterIndex(ConcreteClusterPath(mEndpointId, mClusterId));
+        VerifyOrReturnError(index < mCompactClusters.size() &&
+                                mCompactClusters[index].mPath == ConcreteClusterPath(mEndpointId, mClusterId),
+                            CHIP_ERROR_KEY_NOT_FOUND);
+        aVersion = mCompactClusters[index].mCommittedDataVersion;
+        return CHIP_NO_ERROR;
+    }
+
     auto clusterState = GetClusterState(mEndpointId, mClusterId, err);
     ReturnErrorOnFailure(err);
     aVersion = clusterState->mCommittedDataVersion;
@@ -363,6 +564,16 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteAttributePath & path, Stat
 {
     CHIP_ERROR err;
 
+    if (mStorageMode == StorageMode::kCompact)
+    {
+        auto compactAttributeState = GetCompactAttributeState(path);
+        VerifyOrReturnError(compactAttributeState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(compactAttributeState->mLength == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+        status = compactAttributeState->mStatus;
+        return CHIP_NO_ERROR;
+    }
+
     auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
@@ -389,6 +600,30 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteEventPath & path, StatusIB
 
 void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector)
 {
+    for (auto const & clusterState : mCompactClusters)
+    {
+        if (!clusterState.mCommittedDataVersion.HasValue())
+        {
+            continue;
+        }
+
+        const ConcreteClusterPath & clusterPath = clusterState.mPath;
+        uint32_t clusterSize                    = 0;
+        for (size_t index = CompactAttributeIndex(ConcreteAttributePath(clusterPath.mEndpointId, clusterPath.mClusterId, 0));
+             index < mCompactAttributes.size() && IsInCluster(mCompactAttributes[index], clusterPath); index++)
+        {
+            const auto & attributeState = mCompactAttributes[index];
+            clusterSize += (attributeState.mLength != 0) ? attributeState.mLength : EncodedStatusSize(attributeState.mStatus);
+        }
+        if (clusterSize == 0)
+        {
+            continue;
+        }
+
+        DataVersionFilter filter(clusterPath.mEndpointId, clusterPath.mClusterId, clusterState.mCommittedDataVersion.Value());
+        aVector.push_back(std::make_pair(filter, clusterSize));
+    }
+
     for (auto const & endpointIter : mCache)
     {
         EndpointId endpointId = endpointIter.first;
@@ -406,14 +641,7 @@ void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter
             {
                 if (attributeIter.second.Is<StatusIB>())
                 {
-                    clusterSize +=
-                        5; // 1 byte: anonymous tag control byte for struct. 1 byte: control byte for uint8 value. 1 byte:
-                           // context-specific tag for uint8 value.1 byte: the uint8 value. 1 byte: end of container.
-                    if (attributeIter.second.Get<StatusIB>().mClusterStatus.HasValue())
-                    {
-                        clusterSize += 3; // 1 byte: control byte for uint8 value. 1 byte: context-specific tag for uint8 value. 1
-                                          // byte: the uint8 value.
-                    }
+                    clusterSize += EncodedStatusSize(attributeIter.second.Get<StatusIB>());
                 }
                 else
                 {
@@ -59,6 +59,8 @@ namespace app {
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
  * to make it easier to know what has changed in the cache.
  *
+ * The attribute data can be stored in one of two ways, selected at construction (see StorageMode).
+ *
  * **NOTE**
  * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
@@ -86,8 +88,28 @@ public:
         virtual void OnEndpointAdded(ClusterStateCache * cache, EndpointId endpointId){};
     };
 
-    ClusterStateCache(Callback & callback, Optional<EventNumber> highestReceivedEventNumber = Optional<EventNumber>::Missing()) :
-        mCallback(callback), mBufferedReader(*this)
+    /*
+     * How attribute data is stored in the cache.
+     */
+    enum class StorageMode : uint8_t
+    {
+        //
+        // Each attribute value is held in its own packet buffer, in maps keyed by endpoint, cluster and attribute ID.
+        // Values decoded from the cache remain valid until the cached value for their path is updated.
+        //
+        kPerAttributeBuffers,
+
+        //
+        // Paths are kept in flat vectors sorted by path and attribute values are copied back to back into a single
+        // growable arena, which takes far less memory when caching many attributes. Values decoded from the cache only
+        // remain valid until the cache next receives attribute data.
+        //
+        kCompact,
+    };
+
+    ClusterStateCache(Callback & callback, Optional<EventNumber> highestReceivedEventNumber = Optional<EventNumber>::Missing(),
+                      StorageMode storageMode = StorageMode::kPerAttributeBuffers) :
+        mCallback(callback), mStorageMode(storageMode), mBufferedReader(*this)
     {
         mHighestReceivedEventNumber = highestReceivedEventNumber;
     }
@@ -110,8 +132,8 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
-     * across any async call boundaries.
+     * valid until the cached value for that path is updated (until any attribute data is received in
+     * StorageMode::kCompact), so it must not be held across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
      * ClusterName::Attributes::AttributeName::DecodableType, but any
@@ -331,6 +353,20 @@ public:
     {
         CHIP_ERROR err;
 
+        if (mStorageMode == StorageMode::kCompact)
+        {
+            const ConcreteClusterPath clusterPath(endpointId, clusterId);
+            size_t index = CompactAttributeIndex(ConcreteAttributePath(endpointId, clusterId, 0));
+            VerifyOrReturnError(index < mCompactAttributes.size() && IsInCluster(mCompactAttributes[index], clusterPath),
+                                CHIP_ERROR_KEY_NOT_FOUND);
+            for (; index < mCompactAttributes.size() && IsInCluster(mCompactAttributes[index], clusterPath); index++)
+            {
+                const ConcreteAttributePath path = mCompactAttributes[index].mPath;
+                ReturnErrorOnFailure(func(path));
+            }
+            return CHIP_NO_ERROR;
+        }
+
         auto clusterState = GetClusterState(endpointId, clusterId, err);
         ReturnErrorOnFailure(err);
 
@@ -359,6 +395,15 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func)
     {
+        for (const auto & attributeState : mCompactAttributes)
+        {
+            if (attributeState.mPath.mClusterId == clusterId)
+            {
+                const ConcreteAttributePath path = attributeState.mPath;
+                ReturnErrorOnFailure(func(path));
+            }
+        }
+
         for (auto & endpointIter : mCache)
         {
             for (auto & clusterIter : endpointIter.second)
@@ -392,8 +437,14 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func)
     {
+        for (size_t index = CompactClusterIndex(ConcreteClusterPath(endpointId, 0));
+             index < mCompactClusters.size() && mCompactClusters[index].mPath.mEndpointId == endpointId; index++)
+        {
+            ReturnErrorOnFailure(func(mCompactClusters[index].mPath.mClusterId));
+        }
+
         auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        if (endpointIter != mCache.end())
         {
             for (auto & clusterIter : endpointIter->second)
             {
@@ -461,6 +512,12 @@ public:
         }
     }
 
+    /*
+     * Approximate number of bytes of memory used to store attribute data and statuses, including the bookkeeping
+     * of the storage mode in use.
+     */
+    size_t GetAttributeStorageSize() const;
+
     /*
      * Clear out the event data and status caches.
      *
@@ -489,15 +546,34 @@ private:
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
-    struct ClusterState
+    struct DataVersionState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
+    struct ClusterState : public DataVersionState
+    {
+        std::map<AttributeId, AttributeState> mAttributes;
+    };
     using EndpointState = std::map<ClusterId, ClusterState>;
     using NodeState     = std::map<EndpointId, EndpointState>;
 
+    //
+    // StorageMode::kCompact state. Attribute values are stored at mOffset in mArena; an attribute that holds a status
+    // instead has a zero mLength, as TLV elements take at least one byte.
+    //
+    struct CompactClusterState : public DataVersionState
+    {
+        ConcreteClusterPath mPath;
+    };
+    struct CompactAttributeState
+    {
+        ConcreteAttributePath mPath;
+        uint32_t mOffset;
+        uint32_t mLength;
+        StatusIB mStatus;
+    };
+
     struct Comparator
     {
         bool operator()(const AttributePathParams & x, const AttributePathParams & y) const
@@ -538,6 +614,29 @@ private:
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err);
 
+    bool HasEndpoint(EndpointId endpointId) const;
+
+    // Returns the data versions of a cluster, adding the cluster to the cache if needed.
+    DataVersionState & GetDataVersionState(const ConcreteClusterPath & path);
+
+    //
+    // StorageMode::kCompact lookups: the index of the first cluster or attribute at or after the given path.
+    //
+    size_t CompactClusterIndex(const ConcreteClusterPath & path) const;
+    size_t CompactAttributeIndex(const ConcreteAttributePath & path) const;
+    const CompactAttributeState * GetCompactAttributeState(const ConcreteAttributePath & path) const;
+
+    static bool IsInCluster(const CompactAttributeState & attributeState, const ConcreteClusterPath & path)
+    {
+        return static_cast<const ConcreteClusterPath &>(attributeState.mPath) == path;
+    }
+
+    // Stores the data or status of an attribute in StorageMode::kCompact.
+    CHIP_ERROR UpdateCompactCache(const ConcreteAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus);
+
+    // Reclaims the arena space of overwritten attribute values once it makes up a large part of the arena.
+    void CompactArena();
+
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
      * with the provided status.
@@ -589,7 +688,12 @@ private:
     void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector);
 
     Callback & mCallback;
+    const StorageMode mStorageMode;
     NodeState mCache;
+    std::vector<CompactClusterState> mCompactClusters;     // Sorted by path
+    std::vector<CompactAttributeState> mCompactAttributes; // Sorted by path
+    std::vector<uint8_t> mArena;
+    size_t mArenaGarbageSize = 0; // Bytes of mArena taken by overwritten attribute values
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
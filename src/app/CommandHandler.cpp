@@ -25,13 +25,16 @@
 #include "CommandHandler.h"
 #include "InteractionModelEngine.h"
 #include "RequiredPrivilege.h"
+#include "StatusResponse.h"
 #include "messaging/ExchangeContext.h"
 
 #include <access/AccessControl.h>
 #include <app-common/zap-generated/cluster-objects.h>
+#include <app/InteractionModelTimeout.h>
 #include <app/RequiredPrivilege.h>
 #include <app/util/MatterCallbacks.h>
 #include <credentials/GroupDataProvider.h>
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPTLVUtilities.hpp>
 #include <lib/support/TypeTraits.h>
 #include <protocols/secure_channel/Constants.h>
@@ -50,7 +53,18 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
         System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
         VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
 
+        // Always limit the size of each chunk to fit within kMaxSecureSduLengthBytes regardless of the available buffer
+        // capacity, and leave room for the MIC field and for ending the message.
+        uint16_t reservedSize = 0;
+        if (commandPacket->AvailableDataLength() > kMaxSecureSduLengthBytes)
+        {
+            reservedSize = static_cast<uint16_t>(commandPacket->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        }
+        reservedSize =
+            static_cast<uint16_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES + kReservedSizeForTLVEncodingOverhead);
+
         mCommandMessageWriter.Init(std::move(commandPacket));
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(reservedSize));
         ReturnErrorOnFailure(mInvokeResponseBuilder.Init(&mCommandMessageWriter));
 
         mInvokeResponseBuilder.SuppressResponse(mSuppressResponse);
@@ -58,7 +72,8 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
 
         mInvokeResponseBuilder.CreateInvokeResponses();
         ReturnErrorOnFailure(mInvokeResponseBuilder.GetError());
-        mBufferAllocated = true;
+        mResponsesInMessage = 0;
+        mBufferAllocated    = true;
     }
 
     return CHIP_NO_ERROR;
@@ -128,15 +143,22 @@ CHIP_ERROR CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && pa
     invokeRequests.GetReader(&invokeRequestsReader);
 
     {
-        // We don't support handling multiple commands but the protocol is ready to support it in the future, reject all of them and
-        // IM Engine will send a status response.
+        // We reject requests holding more commands than we can correlate responses for, and IM Engine will send a status
+        // response.
         size_t commandCount = 0;
         TLV::Utilities::Count(invokeRequestsReader, commandCount, false /* recurse */);
-        VerifyOrReturnError(commandCount == 1, CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE);
+        VerifyOrReturnError(commandCount >= 1 && commandCount <= CHIP_IM_MAX_PATHS_PER_INVOKE, CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE);
+
+        // Group commands get no response, so there is nothing to correlate.
+        if (!mpExchangeCtx->IsGroupExchangeContext())
+        {
+            ReturnErrorOnFailure(ValidateRequestCommands(invokeRequestsReader, commandCount));
+        }
     }
 
-    while (CHIP_NO_ERROR == (err = invokeRequestsReader.Next()))
+    for (mDispatchingCommand = 0; CHIP_NO_ERROR == (err = invokeRequestsReader.Next()); mDispatchingCommand++)
     {
+        mRespondingCommand = mRequestCommandCount;
         VerifyOrReturnError(TLV::AnonymousTag() == invokeRequestsReader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
         CommandDataIB::Parser commandData;
         ReturnErrorOnFailure(commandData.Init(invokeRequestsReader));
@@ -160,6 +182,90 @@ CHIP_ERROR CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && pa
     return invokeRequestMessage.ExitContainer();
 }
 
+CHIP_ERROR CommandHandler::ValidateRequestCommands(TLV::TLVReader aInvokeRequestsReader, size_t aCommandCount)
+{
+    CHIP_ERROR err     = CHIP_NO_ERROR;
+    const bool isBatch = aCommandCount > 1;
+
+    mRequestCommandCount = 0;
+    while (CHIP_NO_ERROR == (err = aInvokeRequestsReader.Next()))
+    {
+        VerifyOrReturnError(TLV::AnonymousTag() == aInvokeRequestsReader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(mRequestCommandCount < ArraySize(mRequestCommands), CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE);
+        RequestCommand & command = mRequestCommands[mRequestCommandCount];
+        CommandDataIB::Parser commandData;
+        ReturnErrorOnFailure(commandData.Init(aInvokeRequestsReader));
+
+        uint16_t ref;
+        err = commandData.GetRef(&ref);
+        if (CHIP_END_OF_TLV == err)
+        {
+            // The ref can only be omitted when there is a single command to respond to.
+            VerifyOrReturnError(!isBatch, CHIP_ERROR_IM_MALFORMED_INVOKE_REQUEST_MESSAGE);
+            command.ref.ClearValue();
+        }
+        else
+        {
+            ReturnErrorOnFailure(err);
+            command.ref.SetValue(ref);
+        }
+
+        // Errors in the path of a single command are reported in its response by ProcessCommandDataIB, while a batch
+        // must have unique, concrete paths to correlate the responses with.
+        if (isBatch)
+        {
+            CommandPathIB::Parser commandPath;
+            ReturnErrorOnFailure(commandData.GetPath(&commandPath));
+            ReturnErrorOnFailure(commandPath.GetEndpointId(&command.path.mEndpointId));
+            ReturnErrorOnFailure(commandPath.GetClusterId(&command.path.mClusterId));
+            ReturnErrorOnFailure(commandPath.GetCommandId(&command.path.mCommandId));
+
+            for (size_t i = 0; i < mRequestCommandCount; i++)
+            {
+                VerifyOrReturnError(mRequestCommands[i].ref != command.ref && !(mRequestCommands[i].path == command.path),
+                                    CHIP_ERROR_IM_MALFORMED_INVOKE_REQUEST_MESSAGE);
+            }
+        }
+        mRequestCommandCount++;
+    }
+
+    // if we have exhausted this container
+    if (CHIP_END_OF_TLV == err)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+
+Optional<uint16_t> CommandHandler::GetRefForResponse(const ConcreteCommandPath & aCommandPath, bool aMatchCommandId) const
+{
+    if (mRequestCommandCount == 1)
+    {
+        return mRequestCommands[0].ref;
+    }
+
+    auto matches = [&](const RequestCommand & command) {
+        return command.path.mEndpointId == aCommandPath.mEndpointId && command.path.mClusterId == aCommandPath.mClusterId &&
+            (!aMatchCommandId || command.path.mCommandId == aCommandPath.mCommandId);
+    };
+
+    // Responses of commands handled asynchronously come through a Handle, once the request may have been dispatched.
+    const size_t respondingCommand = (mRespondingCommand < mRequestCommandCount) ? mRespondingCommand : mDispatchingCommand;
+    if (respondingCommand < mRequestCommandCount && matches(mRequestCommands[respondingCommand]))
+    {
+        return mRequestCommands[respondingCommand].ref;
+    }
+
+    for (size_t i = 0; i < mRequestCommandCount; i++)
+    {
+        if (matches(mRequestCommands[i]))
+        {
+            return mRequestCommands[i].ref;
+        }
+    }
+    return NullOptional;
+}
+
 void CommandHandler::Close()
 {
     mSuppressResponse = false;
@@ -220,6 +326,11 @@ void CommandHandler::DecrementHoldOff()
                 mpExchangeCtx->Close();
             }
         }
+        else if (mState == State::AwaitingChunkAck)
+        {
+            // The next chunks are sent as the client acknowledges the previous ones.
+            return;
+        }
     }
 
     Close();
@@ -234,16 +345,87 @@ CHIP_ERROR CommandHandler::SendCommandResponse()
     VerifyOrReturnError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
     ReturnErrorOnFailure(Finalize(commandPacket));
-    ReturnErrorOnFailure(
-        mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse, std::move(commandPacket)));
-    // The ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily dangling, but in
-    // all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
+    mChunks.AddToEnd(std::move(commandPacket));
+
+    return SendNextChunk();
+}
 
-    MoveToState(State::CommandSent);
+CHIP_ERROR CommandHandler::SendNextChunk()
+{
+    using Protocols::InteractionModel::MsgType;
+
+    System::PacketBufferHandle commandPacket = mChunks.PopHead();
+    VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+    if (mChunks.IsNull())
+    {
+        ReturnErrorOnFailure(mpExchangeCtx->SendMessage(MsgType::InvokeCommandResponse, std::move(commandPacket)));
+        // The ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily dangling, but in
+        // all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
+        MoveToState(State::CommandSent);
+        return CHIP_NO_ERROR;
+    }
+
+    //
+    // Let's take over further message processing on this exchange from the IM: the client acknowledges each chunk with a
+    // status response before we send the next one.
+    //
+    mpExchangeCtx->SetDelegate(this);
+    mpExchangeCtx->SetResponseTimeout(kImMessageTimeout);
+    ReturnErrorOnFailure(mpExchangeCtx->SendMessage(MsgType::InvokeCommandResponse, std::move(commandPacket),
+                                                    Messaging::SendMessageFlags::kExpectResponse));
+    MoveToState(State::AwaitingChunkAck);
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandHandler::StartNewResponseChunk(CHIP_ERROR aError)
+{
+    VerifyOrReturnError(aError == CHIP_ERROR_NO_MEMORY || aError == CHIP_ERROR_BUFFER_TOO_SMALL, aError);
+    VerifyOrReturnError(mState == State::AddedCommand && mResponsesInMessage > 0, aError);
+
+    System::PacketBufferHandle commandPacket;
+    ReturnErrorOnFailure(Finalize(commandPacket, /* aHasMoreChunks = */ true));
+    mChunks.AddToEnd(std::move(commandPacket));
+
+    return AllocateBuffer();
+}
+
+CHIP_ERROR CommandHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
+                                             System::PacketBufferHandle && aPayload)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    VerifyOrExit(apExchangeContext == mpExchangeCtx && mState == State::AwaitingChunkAck, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse),
+                 err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
+
+    err = StatusResponse::ProcessStatusResponse(std::move(aPayload));
+    SuccessOrExit(err);
+
+    err = SendNextChunk();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to send command response chunk: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    // Keep the exchange open while chunks remain to be sent.
+    if (err != CHIP_NO_ERROR || mState != State::AwaitingChunkAck)
+    {
+        Close();
+    }
+    return err;
+}
+
+void CommandHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    ChipLogError(DataManagement, "Time out! failed to receive status response from Exchange: " ChipLogFormatExchange,
+                 ChipLogValueExchange(apExchangeContext));
+    Close();
+}
+
 CHIP_ERROR CommandHandler::ProcessCommandDataIB(CommandDataIB::Parser & aCommandElement)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -442,6 +624,21 @@ exit:
 CHIP_ERROR CommandHandler::AddStatusInternal(const ConcreteCommandPath & aCommandPath,
                                              const Protocols::InteractionModel::Status aStatus,
                                              const Optional<ClusterStatus> & aClusterStatus)
+{
+    CHIP_ERROR err = TryAddStatusInternal(aCommandPath, aStatus, aClusterStatus);
+
+    // The responses of a batched invoke may not fit in a single message: try again in the next chunk.
+    if ((err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL) && RollbackResponse() == CHIP_NO_ERROR &&
+        StartNewResponseChunk(err) == CHIP_NO_ERROR)
+    {
+        err = TryAddStatusInternal(aCommandPath, aStatus, aClusterStatus);
+    }
+    return err;
+}
+
+CHIP_ERROR CommandHandler::TryAddStatusInternal(const ConcreteCommandPath & aCommandPath,
+                                                const Protocols::InteractionModel::Status aStatus,
+                                                const Optional<ClusterStatus> & aClusterStatus)
 {
     StatusIB statusIB;
     ReturnErrorOnFailure(PrepareStatus(aCommandPath));
@@ -479,15 +676,23 @@ CHIP_ERROR CommandHandler::AddClusterSpecificFailure(const ConcreteCommandPath &
 }
 
 CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPath, bool aStartDataStruct)
+{
+    return PrepareInvokeResponseCommand(aCommandPath, GetRefForResponse(aCommandPath, /* aMatchCommandId = */ false),
+                                        aStartDataStruct);
+}
+
+CHIP_ERROR CommandHandler::PrepareInvokeResponseCommand(const ConcreteCommandPath & aResponseCommandPath,
+                                                        const Optional<uint16_t> & aRef, bool aStartDataStruct)
 {
     ReturnErrorOnFailure(AllocateBuffer());
 
-    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     MoveToState(State::Preparing);
+    mResponseRef = aRef;
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
     ReturnErrorOnFailure(invokeResponses.GetError());
@@ -496,7 +701,7 @@ CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPa
     ReturnErrorOnFailure(commandData.GetError());
     CommandPathIB::Builder & path = commandData.CreatePath();
     ReturnErrorOnFailure(commandData.GetError());
-    ReturnErrorOnFailure(path.Encode(aCommandPath));
+    ReturnErrorOnFailure(path.Encode(aResponseCommandPath));
     if (aStartDataStruct)
     {
         ReturnErrorOnFailure(commandData.GetWriter()->StartContainer(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)),
@@ -514,10 +719,13 @@ CHIP_ERROR CommandHandler::FinishCommand(bool aStartDataStruct)
     {
         ReturnErrorOnFailure(commandData.GetWriter()->EndContainer(mDataElementContainerType));
     }
+    if (mResponseRef.HasValue())
+    {
+        ReturnErrorOnFailure(commandData.Ref(mResponseRef.Value()).GetError());
+    }
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
+    mResponsesInMessage++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -526,10 +734,12 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
 {
     ReturnErrorOnFailure(AllocateBuffer());
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     MoveToState(State::Preparing);
+    mResponseRef                                 = GetRefForResponse(aCommandPath, /* aMatchCommandId = */ true);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
     ReturnErrorOnFailure(invokeResponses.GetError());
@@ -545,11 +755,14 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
 CHIP_ERROR CommandHandler::FinishStatus()
 {
     VerifyOrReturnError(mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
-    ReturnErrorOnFailure(
-        mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB().GetError());
+    CommandStatusIB::Builder & commandStatus = mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus();
+    if (mResponseRef.HasValue())
+    {
+        ReturnErrorOnFailure(commandStatus.Ref(mResponseRef.Value()).GetError());
+    }
+    ReturnErrorOnFailure(commandStatus.EndOfCommandStatusIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
+    mResponsesInMessage++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -559,9 +772,10 @@ CHIP_ERROR CommandHandler::RollbackResponse()
     VerifyOrReturnError(mState == State::Preparing || mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
     mInvokeResponseBuilder.Rollback(mBackupWriter);
     mInvokeResponseBuilder.ResetError();
-    // Note: We only support one command per request, so we reset the state to Idle here, need to review the states when adding
-    // supports of having multiple requests in the same transaction.
-    MoveToState(State::Idle);
+    // The list of responses stays open for the next ones.
+    mInvokeResponseBuilder.GetInvokeResponses().ResetError();
+    // Go back to waiting for responses, or for transmission if some were added before this one.
+    MoveToState((mResponsesInMessage > 0 || !mChunks.IsNull()) ? State::AddedCommand : State::Idle);
     return CHIP_NO_ERROR;
 }
 
@@ -582,7 +796,15 @@ FabricIndex CommandHandler::GetAccessingFabricIndex() const
 
 CommandHandler * CommandHandler::Handle::Get()
 {
-    return (mMagic == InteractionModelEngine::GetInstance()->GetMagicNumber()) ? mpHandler : nullptr;
+    if (mMagic != InteractionModelEngine::GetInstance()->GetMagicNumber())
+    {
+        return nullptr;
+    }
+    if (mpHandler != nullptr)
+    {
+        mpHandler->mRespondingCommand = mCommandIndex;
+    }
+    return mpHandler;
 }
 
 void CommandHandler::Handle::Release()
@@ -603,14 +825,23 @@ CommandHandler::Handle::Handle(CommandHandler * handle)
     if (handle != nullptr)
     {
         handle->IncrementHoldOff();
-        mpHandler = handle;
-        mMagic    = InteractionModelEngine::GetInstance()->GetMagicNumber();
+        mpHandler     = handle;
+        mMagic        = InteractionModelEngine::GetInstance()->GetMagicNumber();
+        mCommandIndex = handle->mDispatchingCommand;
     }
 }
 
-CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket)
+CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket, bool aHasMoreChunks)
 {
-    VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::AddedCommand && mBufferAllocated, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
+    if (aHasMoreChunks)
+    {
+        ReturnErrorOnFailure(mInvokeResponseBuilder.MoreChunkedMessages(true).GetError());
+    }
+    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
+    mBufferAllocated = false;
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
@@ -631,6 +862,9 @@ const char * CommandHandler::GetStateStr() const
     case State::AddedCommand:
         return "AddedCommand";
 
+    case State::AwaitingChunkAck:
+        return "AwaitingChunkAck";
+
     case State::CommandSent:
         return "CommandSent";
 
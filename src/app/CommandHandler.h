@@ -29,11 +29,13 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/core/CHIPTLVDebug.hpp>
+#include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
 #include <protocols/interaction_model/Constants.h>
@@ -46,7 +48,14 @@
 namespace chip {
 namespace app {
 
-class CommandHandler
+/**
+ * Handles an invoke request, which may hold up to CHIP_IM_MAX_PATHS_PER_INVOKE commands.
+ *
+ * The responses to all the commands of a request are sent in a single InvokeResponseMessage, chunked across several packets
+ * when they do not fit in one. When the request holds several commands, each response carries the CommandRef of the command it
+ * responds to.
+ */
+class CommandHandler : public Messaging::ExchangeDelegate
 {
 public:
     /*
@@ -93,6 +102,7 @@ public:
         {
             mpHandler        = handle.mpHandler;
             mMagic           = handle.mMagic;
+            mCommandIndex    = handle.mCommandIndex;
             handle.mpHandler = nullptr;
             handle.mMagic    = 0;
         }
@@ -105,6 +115,7 @@ public:
             Release();
             mpHandler        = handle.mpHandler;
             mMagic           = handle.mMagic;
+            mCommandIndex    = handle.mCommandIndex;
             handle.mpHandler = nullptr;
             handle.mMagic    = 0;
             return *this;
@@ -119,6 +130,9 @@ public:
         /**
          * Get the CommandHandler object it holds. Get() may return a nullptr if the CommandHandler object is holds is no longer
          * valid.
+         *
+         * The responses added through the returned object until the next Get() are correlated with the command that was being
+         * dispatched when the handle was taken.
          */
         CommandHandler * Get();
 
@@ -127,6 +141,7 @@ public:
     private:
         CommandHandler * mpHandler = nullptr;
         uint32_t mMagic            = 0;
+        size_t mCommandIndex       = 0; // Index of the command of the request the handle was taken for
     };
 
     /*
@@ -155,6 +170,14 @@ public:
     CHIP_ERROR AddClusterSpecificFailure(const ConcreteCommandPath & aCommandPath, ClusterStatus aClusterStatus);
 
     CHIP_ERROR ProcessInvokeRequest(System::PacketBufferHandle && payload, bool isTimedInvoke);
+
+    /**
+     * Starts encoding a response command.
+     *
+     * When the request holds several commands, the response is correlated with the command being dispatched, or with the
+     * command of the Handle it is added through once the request has been dispatched, if that command targets the same
+     * endpoint and cluster.  Otherwise, it is correlated with the first command of the request that does.
+     */
     CHIP_ERROR PrepareCommand(const ConcreteCommandPath & aCommandPath, bool aStartDataStruct = true);
     CHIP_ERROR FinishCommand(bool aEndDataStruct = true);
     CHIP_ERROR PrepareStatus(const ConcreteCommandPath & aCommandPath);
@@ -182,6 +205,16 @@ public:
             // The state guarantees that either we can rollback or we don't have to rollback the buffer, so we don't care about the
             // return value of RollbackResponse.
             RollbackResponse();
+
+            // The responses of a batched invoke may not fit in a single message: try again in the next chunk.
+            if (StartNewResponseChunk(err) == CHIP_NO_ERROR)
+            {
+                err = TryAddResponseData(aRequestCommandPath, aData);
+                if (err != CHIP_NO_ERROR)
+                {
+                    RollbackResponse();
+                }
+            }
         }
         return err;
     }
@@ -239,10 +272,26 @@ private:
         Preparing,           ///< We are prepaing the command or status header.
         AddingCommand,       ///< In the process of adding a command.
         AddedCommand,        ///< A command has been completely encoded and is awaiting transmission.
+        AwaitingChunkAck,    ///< A chunk of the response has been sent, waiting for the status response to send the next one.
         CommandSent,         ///< The command has been sent successfully.
         AwaitingDestruction, ///< The object has completed its work and is awaiting destruction by the application.
     };
 
+    /**
+     * A command of the invoke request, kept to correlate the responses with it.
+     */
+    struct RequestCommand
+    {
+        ConcreteCommandPath path = ConcreteCommandPath(0, 0, 0);
+        Optional<uint16_t> ref;
+    };
+
+    // ExchangeDelegate interface implementation, used while the response is sent in several chunks.  Private so people won't
+    // accidentally call it on us when we're not being treated as an actual ExchangeDelegate.
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
+                                 System::PacketBufferHandle && aPayload) override;
+    void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
+
     void MoveToState(const State aTargetState);
     const char * GetStateStr() const;
 
@@ -276,12 +325,43 @@ private:
     /*
      * Allocates a packet buffer used for encoding an invoke response payload.
      *
-     * This can be called multiple times safely, as it will only allocate the buffer once for the lifetime
-     * of this object.
+     * This can be called multiple times safely, as it will only allocate the buffer once for each chunk of the
+     * response.
      */
     CHIP_ERROR AllocateBuffer();
 
-    CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket);
+    /**
+     * Ends the invoke response message being encoded, and hands out its packet.
+     *
+     * @param [out] commandPacket   The packet of the message.
+     * @param [in]  aHasMoreChunks  Whether more chunks of the response follow this message.
+     */
+    CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket, bool aHasMoreChunks = false);
+
+    /**
+     * Moves the responses encoded so far to a chunk of their own, and starts a new invoke response message for the next
+     * responses.
+     *
+     * Only done when aError shows that the message is full and the message holds at least one response: the caller may
+     * then try again to encode the response that did not fit.  Otherwise, aError is returned.
+     */
+    CHIP_ERROR StartNewResponseChunk(CHIP_ERROR aError);
+
+    /**
+     * Sends the next chunk of the response.  All but the last chunk expect a status response from the client.
+     */
+    CHIP_ERROR SendNextChunk();
+
+    /**
+     * Gets the CommandRef to put in the response to aCommandPath: the one of the command being responded to (the command of
+     * the last Handle used, or else the one being dispatched) if its path matches, otherwise the one of the first command of
+     * the request that matches.  Command ids are only compared if aMatchCommandId is true, since the id of a response command
+     * differs from the one of its request.
+     */
+    Optional<uint16_t> GetRefForResponse(const ConcreteCommandPath & aCommandPath, bool aMatchCommandId) const;
+
+    CHIP_ERROR PrepareInvokeResponseCommand(const ConcreteCommandPath & aResponseCommandPath, const Optional<uint16_t> & aRef,
+                                            bool aStartDataStruct);
 
     /**
      * Called internally to signal the completion of all work on this object, gracefully close the
@@ -301,9 +381,16 @@ private:
      * It doesn't need the endpointId in it's command path since it uses the GroupId in message metadata to find it
      */
     CHIP_ERROR ProcessGroupCommandDataIB(CommandDataIB::Parser & aCommandElement);
+
+    /**
+     * Checks that the command paths and refs of a batched invoke request are unique, and records them.
+     */
+    CHIP_ERROR ValidateRequestCommands(TLV::TLVReader aInvokeRequestsReader, size_t aCommandCount);
     CHIP_ERROR SendCommandResponse();
     CHIP_ERROR AddStatusInternal(const ConcreteCommandPath & aCommandPath, const Protocols::InteractionModel::Status aStatus,
                                  const Optional<ClusterStatus> & aClusterStatus);
+    CHIP_ERROR TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const Protocols::InteractionModel::Status aStatus,
+                                    const Optional<ClusterStatus> & aClusterStatus);
 
     /**
      * If this function fails, it may leave our TLV buffer in an inconsistent state.  Callers should snapshot as needed before
@@ -317,7 +404,7 @@ private:
     CHIP_ERROR TryAddResponseData(const ConcreteCommandPath & aRequestCommandPath, const CommandData & aData)
     {
         ConcreteCommandPath path = { aRequestCommandPath.mEndpointId, aRequestCommandPath.mClusterId, CommandData::GetCommandId() };
-        ReturnErrorOnFailure(PrepareCommand(path, false));
+        ReturnErrorOnFailure(PrepareInvokeResponseCommand(path, GetRefForResponse(aRequestCommandPath, true), false));
         TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
         VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
         ReturnErrorOnFailure(DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData));
@@ -337,6 +424,37 @@ private:
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     TLV::TLVWriter mBackupWriter;
     bool mBufferAllocated = false;
+
+    RequestCommand mRequestCommands[CHIP_IM_MAX_PATHS_PER_INVOKE];
+    size_t mRequestCommandCount = 0;
+    // Index in mRequestCommands of the command being dispatched, mRequestCommandCount when none is.
+    size_t mDispatchingCommand = 0;
+    // Index in mRequestCommands of the command of the Handle last used to get this object, mRequestCommandCount when none was.
+    size_t mRespondingCommand = 0;
+    // CommandRef of the response being encoded.
+    Optional<uint16_t> mResponseRef;
+    // Number of responses in the invoke response message being encoded, and complete chunks of the response waiting to be sent.
+    size_t mResponsesInMessage = 0;
+    System::PacketBufferHandle mChunks;
+
+    /**
+     * Reserved buffer for the TLV level overhead of ending an invoke response message:
+     * InvokeResponseMessage =
+     * {
+     *  suppressResponse = false,
+     *  InvokeResponseIBs =
+     *  [
+     *     (...)
+     *  ],                           <-- 1 byte  "end of InvokeResponseIBs" (end of container)
+     *  moreChunkedMessages = false, <-- 2 bytes "kReservedSizeForMoreChunksFlag"
+     *  InteractionModelRevision = 1,<-- 3 bytes "kReservedSizeForIMRevision"
+     * }                             <-- 1 byte  "end of InvokeResponseMessage" (end of container)
+     */
+    static constexpr uint16_t kReservedSizeForMoreChunksFlag = 1 + 1;
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    static constexpr uint16_t kReservedSizeForIMRevision     = 1 + 1 + 1;
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead =
+        kReservedSizeForIMRevision + kReservedSizeForMoreChunksFlag + kReservedSizeForEndOfContainer + kReservedSizeForEndOfContainer;
 };
 
 } // namespace app
@@ -26,6 +26,7 @@
 #include "InteractionModelEngine.h"
 #include "StatusResponse.h"
 #include <app/TimedRequest.h>
+#include <crypto/CHIPCryptoPAL.h>
 #include <protocols/Protocols.h>
 #include <protocols/interaction_model/Constants.h>
 
@@ -45,7 +46,18 @@ CHIP_ERROR CommandSender::AllocateBuffer()
         System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
         VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
 
+        // Always limit the size of the request to fit within kMaxSecureSduLengthBytes regardless of the available buffer
+        // capacity, and leave room for the MIC field and for ending the message.
+        uint16_t reservedSize = 0;
+        if (commandPacket->AvailableDataLength() > kMaxSecureSduLengthBytes)
+        {
+            reservedSize = static_cast<uint16_t>(commandPacket->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        }
+        reservedSize =
+            static_cast<uint16_t>(reservedSize + Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES + kReservedSizeForTLVEncodingOverhead);
+
         mCommandMessageWriter.Init(std::move(commandPacket));
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(reservedSize));
         ReturnErrorOnFailure(mInvokeRequestBuilder.Init(&mCommandMessageWriter));
 
         mInvokeRequestBuilder.SuppressResponse(mSuppressResponse).TimedRequest(mTimedRequest);
@@ -60,6 +72,14 @@ CHIP_ERROR CommandSender::AllocateBuffer()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandSender::SetMaxCommandsPerRequest(uint16_t aMaxCommands)
+{
+    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aMaxCommands >= 1, CHIP_ERROR_INVALID_ARGUMENT);
+    mMaxCommands = aMaxCommands;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CommandSender::SendCommandRequest(const SessionHandle & session, Optional<System::Clock::Timeout> timeout)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
@@ -133,8 +153,17 @@ CHIP_ERROR CommandSender::OnMessageReceived(Messaging::ExchangeContext * apExcha
 
     if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::InvokeCommandResponse))
     {
-        err = ProcessInvokeResponse(std::move(aPayload));
+        bool moreChunkedMessages = false;
+        err                      = ProcessInvokeResponse(std::move(aPayload), moreChunkedMessages);
         SuccessOrExit(err);
+        if (moreChunkedMessages)
+        {
+            // Acknowledge this chunk of the response, and wait for the next one.
+            err = StatusResponse::Send(Protocols::InteractionModel::Status::Success, apExchangeContext,
+                                       /* aExpectResponse = */ true);
+            SuccessOrExit(err);
+            MoveToState(State::CommandSent);
+        }
     }
     else if (aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse))
     {
@@ -159,12 +188,13 @@ exit:
     {
         Close();
     }
-    // Else we got a response to a Timed Request and just sent the invoke.
+    // Else we got a response to a Timed Request and just sent the invoke, or
+    // acknowledged a chunk of the invoke response and wait for the next one.
 
     return err;
 }
 
-CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && payload)
+CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & moreChunkedMessages)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader reader;
@@ -182,6 +212,11 @@ CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && pa
 
     ReturnErrorOnFailure(invokeResponseMessage.GetSuppressResponse(&suppressResponse));
     ReturnErrorOnFailure(invokeResponseMessage.GetInvokeResponses(&invokeResponses));
+
+    moreChunkedMessages = false;
+    err                 = invokeResponseMessage.GetMoreChunkedMessages(&moreChunkedMessages);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
     invokeResponses.GetReader(&invokeResponsesReader);
 
     while (CHIP_NO_ERROR == (err = invokeResponsesReader.Next()))
@@ -246,6 +281,8 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
     EndpointId endpointId;
     // Default to success when an invoke response is received.
     StatusIB statusIB;
+    uint16_t commandRef = 0;
+    CHIP_ERROR refErr   = CHIP_END_OF_TLV;
 
     {
         bool hasDataResponse = false;
@@ -264,6 +301,7 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
             StatusIB::Parser status;
             commandStatus.GetErrorStatus(&status);
             ReturnErrorOnFailure(status.DecodeStatusIB(statusIB));
+            refErr = commandStatus.GetRef(&commandRef);
         }
         else if (CHIP_END_OF_TLV == err)
         {
@@ -275,6 +313,7 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
             ReturnErrorOnFailure(commandPath.GetClusterId(&clusterId));
             ReturnErrorOnFailure(commandPath.GetCommandId(&commandId));
             commandData.GetData(&commandDataReader);
+            refErr          = commandData.GetRef(&commandRef);
             err             = CHIP_NO_ERROR;
             hasDataResponse = true;
         }
@@ -303,9 +342,29 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
         }
         ReturnErrorOnFailure(err);
 
+        if (IsBatched())
+        {
+            // The server may leave out the ref when there is a single command to respond to.
+            if (CHIP_END_OF_TLV == refErr)
+            {
+                VerifyOrReturnError(mCommandCount == 1, CHIP_ERROR_IM_MALFORMED_INVOKE_RESPONSE_MESSAGE);
+                commandRef = 0;
+            }
+            else
+            {
+                ReturnErrorOnFailure(refErr);
+            }
+            VerifyOrReturnError(commandRef < mCommandCount, CHIP_ERROR_IM_MALFORMED_INVOKE_RESPONSE_MESSAGE);
+        }
+
         if (mpCallback != nullptr)
         {
-            if (statusIB.IsSuccess())
+            if (IsBatched())
+            {
+                mpCallback->OnCommandResponse(this, commandRef, ConcreteCommandPath(endpointId, clusterId, commandId), statusIB,
+                                              hasDataResponse ? &commandDataReader : nullptr);
+            }
+            else if (statusIB.IsSuccess())
             {
                 mpCallback->OnResponse(this, ConcreteCommandPath(endpointId, clusterId, commandId), statusIB,
                                        hasDataResponse ? &commandDataReader : nullptr);
@@ -324,9 +383,12 @@ CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathP
     ReturnErrorOnFailure(AllocateBuffer());
 
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having prepared or sent one, unless several commands
+    // can be queued in the request.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || (mState == State::AddedCommand && IsBatched()), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCommandCount < mMaxCommands, CHIP_ERROR_NO_MEMORY);
+    mInvokeRequestBuilder.Checkpoint(mBackupWriter);
     InvokeRequests::Builder & invokeRequests = mInvokeRequestBuilder.GetInvokeRequests();
     CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
     ReturnErrorOnFailure(invokeRequests.GetError());
@@ -357,15 +419,28 @@ CHIP_ERROR CommandSender::FinishCommand(bool aEndDataStruct)
         ReturnErrorOnFailure(commandData.GetWriter()->EndContainer(mDataElementContainerType));
     }
 
+    // The responses to a batched request are correlated with its commands by their position in the request.
+    if (IsBatched())
+    {
+        ReturnErrorOnFailure(commandData.Ref(mCommandCount).GetError());
+    }
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
+    mCommandCount++;
 
     MoveToState(State::AddedCommand);
 
     return CHIP_NO_ERROR;
 }
 
+void CommandSender::RollbackCommand()
+{
+    VerifyOrReturn(mState == State::AddingCommand);
+    mInvokeRequestBuilder.Rollback(mBackupWriter);
+    mInvokeRequestBuilder.ResetError();
+    mInvokeRequestBuilder.GetInvokeRequests().ResetError();
+    MoveToState(mCommandCount > 0 ? State::AddedCommand : State::Idle);
+}
+
 TLV::TLVWriter * CommandSender::GetCommandDataIBTLVWriter()
 {
     if (mState != State::AddingCommand)
@@ -401,6 +476,9 @@ CHIP_ERROR CommandSender::FinishCommand(const Optional<uint16_t> & aTimedInvokeT
 CHIP_ERROR CommandSender::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
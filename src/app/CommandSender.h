@@ -114,6 +114,24 @@ public:
          */
         virtual void OnError(const CommandSender * apCommandSender, CHIP_ERROR aError) {}
 
+        /**
+         * OnCommandResponse will be called, instead of OnResponse and OnError, for each response to a request that may hold
+         * several commands (see SetMaxCommandsPerRequest()), whether the command succeeded or not.
+         *
+         * The CommandSender object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy the object.
+         *
+         * @param[in] apCommandSender The command sender object that initiated the command transaction.
+         * @param[in] aCommandRef     The position of the command in the request, in the order the commands were added.
+         * @param[in] aPath           The command path field in invoke command response.
+         * @param[in] aStatusIB       The status of the command. If apData is not null it will always be a generic SUCCESS
+         *                            status with no-cluster specific information.
+         * @param[in] apData          The command data, will be nullptr if the server returns a StatusIB.
+         */
+        virtual void OnCommandResponse(CommandSender * apCommandSender, uint16_t aCommandRef, const ConcreteCommandPath & aPath,
+                                       const StatusIB & aStatusIB, TLV::TLVReader * apData)
+        {}
+
         /**
          * OnDone will be called when CommandSender has finished all work and is safe to destroy and free the
          * allocated CommandSender object.
@@ -139,6 +157,16 @@ public:
      * If callbacks are passed the only one that will be called in a group sesttings is the onDone
      */
     CommandSender(Callback * apCallback, Messaging::ExchangeManager * apExchangeMgr, bool aIsTimedRequest = false);
+
+    /**
+     * Allows queueing up to aMaxCommands commands in the request, to invoke them all in a single round trip.  The responses
+     * are then delivered through OnCommandResponse.
+     *
+     * Servers reject requests holding more commands than they support (see CHIP_IM_MAX_PATHS_PER_INVOKE).  This must be
+     * called before adding the first command.
+     */
+    CHIP_ERROR SetMaxCommandsPerRequest(uint16_t aMaxCommands);
+
     CHIP_ERROR PrepareCommand(const CommandPathParams & aCommandPathParams, bool aStartDataStruct = true);
     CHIP_ERROR FinishCommand(bool aEndDataStruct = true);
     TLV::TLVWriter * GetCommandDataIBTLVWriter();
@@ -196,8 +224,17 @@ private:
         ReturnErrorOnFailure(PrepareCommand(aCommandPath, /* aStartDataStruct = */ false));
         TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
         VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        ReturnErrorOnFailure(DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData));
-        return FinishCommand(aTimedInvokeTimeoutMs);
+        CHIP_ERROR err = DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kData)), aData);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = FinishCommand(aTimedInvokeTimeoutMs);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            // Drop the partially encoded command, so the commands already queued can still be sent.
+            RollbackCommand();
+        }
+        return err;
     }
 
 public:
@@ -243,6 +280,13 @@ private:
     void MoveToState(const State aTargetState);
     const char * GetStateStr() const;
 
+    bool IsBatched() const { return mMaxCommands > 1; }
+
+    /**
+     * Rollback the request to before encoding the current command (before calling PrepareCommand)
+     */
+    void RollbackCommand();
+
     /*
      * Allocates a packet buffer used for encoding an invoke request payload.
      *
@@ -273,7 +317,7 @@ private:
      */
     void Abort();
 
-    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload);
+    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & moreChunkedMessages);
     CHIP_ERROR ProcessInvokeResponseIB(InvokeResponseIB::Parser & aInvokeResponse);
 
     // Handle a message received when we are expecting a status response to a
@@ -307,7 +351,28 @@ private:
 
     State mState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
+    TLV::TLVWriter mBackupWriter;
     bool mBufferAllocated = false;
+    uint16_t mMaxCommands  = 1;
+    uint16_t mCommandCount = 0;
+
+    /**
+     * Reserved buffer for the TLV level overhead of ending an invoke request message:
+     * InvokeRequestMessage =
+     * {
+     *  suppressResponse = false,
+     *  timedRequest = false,
+     *  InvokeRequests =
+     *  [
+     *     (...)
+     *  ],                           <-- 1 byte  "end of InvokeRequests" (end of container)
+     *  InteractionModelRevision = 1,<-- 3 bytes "kReservedSizeForIMRevision"
+     * }                             <-- 1 byte  "end of InvokeRequestMessage" (end of container)
+     */
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    static constexpr uint16_t kReservedSizeForIMRevision     = 1 + 1 + 1;
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead =
+        kReservedSizeForIMRevision + kReservedSizeForEndOfContainer + kReservedSizeForEndOfContainer;
 };
 
 } // namespace app
@@ -68,6 +68,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mMovedEventNumber       = 0;
 };
 
 /**
@@ -213,6 +214,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
                     // this to fail.
                     err = CopyToNextBuffer(eventBuffer);
                     SuccessOrExit(err);
+                    eventBuffer->GetNextCircularEventBuffer()->SetNewestEventNumber(ctx.mMovedEventNumber);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
                     err                                 = eventBuffer->EvictHead();
@@ -251,15 +253,14 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
         }
     }
 
+exit:
     mpEventBuffer->mProcessEvictedElement = nullptr;
     mpEventBuffer->mAppData               = nullptr;
-
-exit:
     return err;
 }
 
-CHIP_ERROR EventManagement::CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions,
-                                               uint32_t & requiredSize)
+CHIP_ERROR EventManagement::ConstructEventInScratchBuffer(EventLoggingDelegate * apDelegate, const EventOptions * apOptions,
+                                                          System::PacketBufferHandle & aEventData)
 {
     System::PacketBufferTLVWriter writer;
     EventLoadOutContext ctxt       = EventLoadOutContext(writer, apOptions->mPriority, GetLastEventNumber());
@@ -272,12 +273,8 @@ CHIP_ERROR EventManagement::CalculateEventSize(EventLoggingDelegate * apDelegate
 
     ctxt.mCurrentEventNumber = mLastEventNumber;
     ctxt.mCurrentTime        = mLastEventTimestamp;
-    CHIP_ERROR err           = ConstructEvent(&ctxt, apDelegate, apOptions);
-    if (err == CHIP_NO_ERROR)
-    {
-        requiredSize = writer.GetLengthWritten();
-    }
-    return err;
+    ReturnErrorOnFailure(ConstructEvent(&ctxt, apDelegate, apOptions));
+    return writer.Finalize(&aEventData);
 }
 
 CHIP_ERROR EventManagement::ConstructEvent(EventLoadOutContext * apContext, EventLoggingDelegate * apDelegate,
@@ -425,11 +422,12 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
 {
     CircularTLVWriter writer;
     CHIP_ERROR err               = CHIP_NO_ERROR;
-    uint32_t requestSize         = 0;
     aEventNumber                 = 0;
-    CircularTLVWriter checkpoint = writer;
+    CircularEventBuffer backup   = *mpEventBuffer;
     CircularEventBuffer * buffer = nullptr;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
+    System::PacketBufferHandle eventData;
+    TLVReader eventReader;
     EventOptions opts;
 #if CHIP_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS & CHIP_SYSTEM_CONFIG_PLATFORM_PROVIDES_TIME
     Timestamp timestamp;
@@ -443,8 +441,6 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
 #endif
 
     opts = EventOptions(timestamp);
-    // Start the event container (anonymous structure) in the circular buffer
-    writer.Init(*mpEventBuffer);
 
     opts.mPriority = aEventOptions.mPriority;
     // Create all event specific data
@@ -456,15 +452,45 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     ctxt.mCurrentEventNumber = mLastEventNumber;
     ctxt.mCurrentTime.mValue = mLastEventTimestamp.mValue;
 
-    err = CalculateEventSize(apDelegate, &opts, requestSize);
-    SuccessOrExit(err);
+    // When the free space of the buffer is likely to hold the event, encode it there directly, refusing to evict anything. This
+    // is the only encoding pass the event needs; if it runs out of space, the buffer is rolled back and the event takes the
+    // path below.
+    err = CHIP_ERROR_NO_MEMORY;
+    if (mpEventBuffer->AvailableDataLength() > 0 && mpEventBuffer->AvailableDataLength() >= mLastEventSize)
+    {
+        mpEventBuffer->mProcessEvictedElement = AlwaysFail;
+        writer.Init(*mpEventBuffer);
+        err = ConstructEvent(&ctxt, apDelegate, &opts);
+        if (err != CHIP_NO_ERROR)
+        {
+            *mpEventBuffer = backup;
+        }
+        mpEventBuffer->mProcessEvictedElement = nullptr;
+    }
 
-    // Ensure we have space in the in-memory logging queues
-    err = EnsureSpaceInCircularBuffer(requestSize);
-    SuccessOrExit(err);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Encode the event once out of place to learn its size, make room for it in the in-memory logging queues, and copy the
+        // encoded event over.
+        err = ConstructEventInScratchBuffer(apDelegate, &opts, eventData);
+        SuccessOrExit(err);
+        eventReader.Init(eventData->Start(), eventData->DataLength());
+        err = eventReader.Next();
+        SuccessOrExit(err);
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
-    SuccessOrExit(err);
+        // Evictions are not rolled back, only what is written from here on.
+        err    = EnsureSpaceInCircularBuffer(eventData->DataLength());
+        backup = *mpEventBuffer;
+        SuccessOrExit(err);
+
+        // The scratch buffer holds the one event structure, copy its members over as they are.
+        writer.Init(*mpEventBuffer);
+        err = writer.PutPreEncodedContainer(AnonymousTag(), eventReader.GetType(), eventReader.GetReadPoint(),
+                                            eventReader.GetRemainingLength());
+        SuccessOrExit(err);
+        err = writer.Finalize();
+        SuccessOrExit(err);
+    }
 
     // Check the number of bytes written.  If the event is too large
     // to be evicted from subsequent buffers, drop it now.
@@ -483,12 +509,14 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     }
 
     mBytesWritten += writer.GetLengthWritten();
+    mLastEventSize = writer.GetLengthWritten();
+    mpEventBuffer->SetNewestEventNumber(mLastEventNumber);
 
 exit:
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(EventLogging, "Log event with error %s", ErrorStr(err));
-        writer = checkpoint;
+        *mpEventBuffer = backup;
     }
     else if (opts.mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY)
     {
@@ -715,6 +743,7 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const ObjectLi
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
     TLVReader reader;
+    CircularEventReader circularReader;
     CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
 
@@ -724,8 +753,19 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const ObjectLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
+
+    // Buffers of higher priority only hold events older than the ones of the buffers below them, so start reading from the
+    // first buffer holding an event at or after aEventMin, instead of parsing the older events only to filter them out. The
+    // buffer of the lowest priority is always read.
+    bufWrapper.mpCurrent = GetPriorityBuffer(PriorityLevel::Critical);
+    VerifyOrExit(bufWrapper.mpCurrent != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
+    while (bufWrapper.mpCurrent != mpEventBuffer &&
+           (bufWrapper.mpCurrent->DataLength() == 0 || bufWrapper.mpCurrent->GetNewestEventNumber() < aEventMin))
+    {
+        bufWrapper.mpCurrent = bufWrapper.mpCurrent->GetPreviousCircularEventBuffer();
+    }
+    circularReader.Init(&bufWrapper);
+    reader.Init(circularReader);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
@@ -852,6 +892,7 @@ CHIP_ERROR EventManagement::EvictEvent(CHIPCircularTLVBuffer & apBuffer, void *
 
     // event is not getting dropped. Note how much space it requires, and return.
     ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+    ctx->mMovedEventNumber         = context.mEventNumber;
     return CHIP_END_OF_TLV;
 }
 
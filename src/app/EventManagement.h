@@ -37,6 +37,7 @@
 #include <lib/support/CHIPCounter.h>
 #include <messaging/ExchangeMgr.h>
 #include <system/SystemMutex.h>
+#include <system/SystemPacketBuffer.h>
 
 #define CHIP_CONFIG_EVENT_GLOBAL_PRIORITY PriorityLevel::Debug
 
@@ -100,6 +101,16 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   The event number of the most recent event stored in this buffer, only meaningful while the buffer holds data.
+     *
+     * Events enter a buffer at its tail in increasing event number order and are only ever evicted from its head, so this is
+     * also the highest event number in the buffer.
+     */
+    void SetNewestEventNumber(EventNumber aEventNumber) { mNewestEventNumber = aEventNumber; }
+    EventNumber GetNewestEventNumber() const { return mNewestEventNumber; }
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -110,6 +121,8 @@ private:
                                                       ///< lesser priority are dropped when they get bumped out of this buffer
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
+
+    EventNumber mNewestEventNumber = 0; ///< Event number of the most recent event written or moved to this buffer
 };
 
 class CircularEventReader;
@@ -381,7 +394,17 @@ private:
     };
 
     void VendEventNumber();
-    CHIP_ERROR CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions, uint32_t & requiredSize);
+
+    /**
+     * @brief Encode the event into a scratch packet buffer, for events that do not fit the free space of the event buffer
+     *   and need to know their size before evicting older events.
+     *
+     * @param[in] apDelegate   The EventLoggingDelegate to serialize the event data
+     * @param[in] apOptions    EventOptions describing timestamp and other tags relevant to this event.
+     * @param[out] aEventData  The buffer holding the encoded event on success.
+     */
+    CHIP_ERROR ConstructEventInScratchBuffer(EventLoggingDelegate * apDelegate, const EventOptions * apOptions,
+                                             System::PacketBufferHandle & aEventData);
     /**
      * @brief Helper function for writing event header and data according to event
      *   logging protocol.
@@ -516,6 +539,7 @@ private:
 
     EventNumber mLastEventNumber = 0; ///< Last event Number vended
     Timestamp mLastEventTimestamp;    ///< The timestamp of the last event in this buffer
+    uint32_t mLastEventSize = 0;      ///< Encoded size of the last event, used to guess whether the next one fits without eviction
 };
 } // namespace app
 } // namespace chip
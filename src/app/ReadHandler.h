@@ -44,6 +44,7 @@
 #include <messaging/Flags.h>
 #include <protocols/Protocols.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/TLVPacketBufferBackingStore.h>
 
 namespace chip {
 namespace app {
@@ -265,6 +266,9 @@ private:
 
     const AttributeValueEncoder::AttributeEncodeState & GetAttributeEncodeState() const { return mAttributeEncoderState; }
     void SetAttributeEncodeState(const AttributeValueEncoder::AttributeEncodeState & aState) { mAttributeEncoderState = aState; }
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    System::ChainedPacketBufferTLVReader & GetPendingAttributeReportIBs() { return mPendingAttributeReportIBs; }
+#endif
     uint32_t GetLastWrittenEventsBytes() const { return mLastWrittenEventsBytes; }
 
     // Returns the number of interested paths, including wildcard and concrete paths.
@@ -430,6 +434,11 @@ private:
     SubjectDescriptor mSubjectDescriptor;
     // The detailed encoding state for a single attribute, used by list chunking feature.
     AttributeValueEncoder::AttributeEncodeState mAttributeEncoderState;
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    // The AttributeReportIBs the reporting engine encoded ahead of sending them, positioned before the next one to send.
+    // Null when none are pending.
+    System::ChainedPacketBufferTLVReader mPendingAttributeReportIBs;
+#endif
 };
 } // namespace app
 } // namespace chip
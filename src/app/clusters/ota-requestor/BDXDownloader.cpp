@@ -62,6 +62,13 @@ void BDXDownloader::Reset()
 {
     mPrevBlockCounter = 0;
     DeviceLayer::SystemLayer().CancelTimer(TransferTimeoutCheckHandler, this);
+
+    for (size_t i = 0; i < mQueuedBlockCount; i++)
+    {
+        mQueuedBlocks[i].msg = nullptr;
+    }
+    mQueuedBlockCount  = 0;
+    mIsProcessingBlock = false;
 }
 
 bool BDXDownloader::HasTransferTimedOut()
@@ -98,6 +105,7 @@ CHIP_ERROR BDXDownloader::SetBDXParams(const chip::bdx::TransferSession::Transfe
 {
     mTimeout = timeout;
     mState   = State::kIdle;
+    mIsAsync = false;
     mBdxTransfer.Reset();
 
     VerifyOrReturnError(mState == State::kIdle, CHIP_ERROR_INCORRECT_STATE);
@@ -153,6 +161,12 @@ CHIP_ERROR BDXDownloader::OnPreparedForDownload(CHIP_ERROR status)
 CHIP_ERROR BDXDownloader::FetchNextData()
 {
     VerifyOrReturnError(mState == State::kInProgress, CHIP_ERROR_INCORRECT_STATE);
+    if (IsAsync())
+    {
+        // Blocks are not queried: acknowledge the one processed instead
+        return OnBlockProcessed();
+    }
+
     ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
     PollTransferSession();
 
@@ -235,7 +249,14 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
     case TransferSession::OutputEventType::kNone:
         break;
     case TransferSession::OutputEventType::kAcceptReceived:
-        ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
+        // Recorded for the whole transfer, and after it ends: the session forgets it when reset
+        mIsAsync = (mBdxTransfer.GetControlMode() == bdx::TransferControlFlags::kAsync);
+
+        // In asynchronous mode, the sender starts sending Blocks without being queried
+        if (!IsAsync())
+        {
+            ReturnErrorOnFailure(mBdxTransfer.PrepareBlockQuery());
+        }
         // TODO: need to check ReceiveAccept parameters
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
@@ -250,20 +271,9 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
         }
         break;
     }
-    case TransferSession::OutputEventType::kBlockReceived: {
-        chip::ByteSpan blockData(outEvent.blockdata.Data, outEvent.blockdata.Length);
-        ReturnErrorOnFailure(mImageProcessor->ProcessBlock(blockData));
-        mStateDelegate->OnUpdateProgressChanged(mImageProcessor->GetPercentComplete());
-
-        // TODO: this will cause problems if Finalize() is not guaranteed to do its work after ProcessBlock().
-        if (outEvent.blockdata.IsEof)
-        {
-            mBdxTransfer.PrepareBlockAck();
-            ReturnErrorOnFailure(mImageProcessor->Finalize());
-        }
-
+    case TransferSession::OutputEventType::kBlockReceived:
+        ReturnErrorOnFailure(HandleBlock(outEvent));
         break;
-    }
     case TransferSession::OutputEventType::kStatusReceived:
         ChipLogError(BDX, "BDX StatusReport %x", static_cast<uint16_t>(outEvent.statusData.statusCode));
         mBdxTransfer.Reset();
@@ -293,6 +303,76 @@ CHIP_ERROR BDXDownloader::HandleBdxEvent(const chip::bdx::TransferSession::Outpu
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR BDXDownloader::HandleBlock(const TransferSession::OutputEvent & outEvent)
+{
+    if (IsAsync() && mIsProcessingBlock)
+    {
+        // The image processor only takes one Block at a time: keep this one until it is done with the previous ones
+        VerifyOrReturnError(mQueuedBlockCount < ArraySize(mQueuedBlocks), CHIP_ERROR_NO_MEMORY);
+        QueuedBlock & queuedBlock = mQueuedBlocks[mQueuedBlockCount++];
+        queuedBlock.msg           = outEvent.MsgData.Retain();
+        queuedBlock.data          = outEvent.blockdata;
+        return CHIP_NO_ERROR;
+    }
+
+    return ProcessBlock(outEvent.blockdata);
+}
+
+CHIP_ERROR BDXDownloader::ProcessBlock(const TransferSession::BlockData & block)
+{
+    chip::ByteSpan blockData(block.Data, block.Length);
+    ReturnErrorOnFailure(mImageProcessor->ProcessBlock(blockData));
+    mStateDelegate->OnUpdateProgressChanged(mImageProcessor->GetPercentComplete());
+
+    // TODO: this will cause problems if Finalize() is not guaranteed to do its work after ProcessBlock().
+    if (block.IsEof)
+    {
+        mBdxTransfer.PrepareBlockAck(block.BlockCounter);
+        ReturnErrorOnFailure(mImageProcessor->Finalize());
+    }
+    else if (IsAsync())
+    {
+        // Acknowledged by OnBlockProcessed(), once the image processor fetches the next Block
+        mIsProcessingBlock     = true;
+        mProcessedBlockCounter = block.BlockCounter;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BDXDownloader::OnBlockProcessed()
+{
+    VerifyOrReturnError(mIsProcessingBlock, CHIP_ERROR_INCORRECT_STATE);
+    mIsProcessingBlock = false;
+
+    // Acknowledging the Block lets the sender send another one
+    ReturnErrorOnFailure(mBdxTransfer.PrepareBlockAck(mProcessedBlockCounter));
+    PollTransferSession();
+
+    if (mQueuedBlockCount == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // Take the next Block off the queue before processing it, since processing may end up back here
+    QueuedBlock queuedBlock{ std::move(mQueuedBlocks[0].msg), mQueuedBlocks[0].data };
+    for (size_t i = 1; i < mQueuedBlockCount; i++)
+    {
+        mQueuedBlocks[i - 1].msg  = std::move(mQueuedBlocks[i].msg);
+        mQueuedBlocks[i - 1].data = mQueuedBlocks[i].data;
+    }
+    mQueuedBlockCount--;
+
+    ReturnErrorOnFailure(ProcessBlock(queuedBlock.data));
+    if (queuedBlock.data.IsEof)
+    {
+        // Sends the BlockAckEOF
+        PollTransferSession();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 void BDXDownloader::SetState(State state, OTAChangeReasonEnum reason)
 {
     mState = state;
@@ -27,6 +27,7 @@
 #include "OTADownloader.h"
 
 #include <app-common/zap-generated/cluster-objects.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <system/SystemPacketBuffer.h>
@@ -80,9 +81,22 @@ public:
     // If False, there's been progress in the transfer.
     bool HasTransferTimedOut();
 
+    // Whether the transfer in progress, or else the last one, was accepted in asynchronous mode.
+    bool IsAsync() const { return mIsAsync; }
+
 private:
+    // A Block received in asynchronous mode while the image processor was busy with a previous one
+    struct QueuedBlock
+    {
+        chip::System::PacketBufferHandle msg; // Holds the Block data
+        chip::bdx::TransferSession::BlockData data;
+    };
+
     void PollTransferSession();
     CHIP_ERROR HandleBdxEvent(const chip::bdx::TransferSession::OutputEvent & outEvent);
+    CHIP_ERROR HandleBlock(const chip::bdx::TransferSession::OutputEvent & outEvent);
+    CHIP_ERROR ProcessBlock(const chip::bdx::TransferSession::BlockData & block);
+    CHIP_ERROR OnBlockProcessed();
     void SetState(State state, app::Clusters::OtaSoftwareUpdateRequestor::OTAChangeReasonEnum reason);
     void Reset();
 
@@ -93,6 +107,14 @@ private:
     System::Clock::Timeout mTimeout = System::Clock::kZero;
     // Tracks the last block counter used during the transfer session as of the previous check.
     uint32_t mPrevBlockCounter = 0;
+
+    // In asynchronous mode, Blocks are acknowledged once processed, and the ones received meanwhile are queued. The sender
+    // does not send more Blocks than the window, so the queue cannot overflow.
+    QueuedBlock mQueuedBlocks[CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT];
+    size_t mQueuedBlockCount        = 0;
+    bool mIsAsync                   = false;
+    bool mIsProcessingBlock         = false;
+    uint32_t mProcessedBlockCounter = 0;
 };
 
 } // namespace chip
@@ -622,6 +622,12 @@ void DefaultOTARequestor::OnDownloadStateChanged(OTADownloader::State state, OTA
     case OTADownloader::State::kIdle:
         if (reason != OTAChangeReasonEnum::kSuccess)
         {
+            if (mUseAsyncTransfer && mBdxDownloader->IsAsync())
+            {
+                // The provider may well send more Blocks ahead than accepted: retry in receiver drive
+                ChipLogError(SoftwareUpdate, "Asynchronous download failed, using receiver drive from now on");
+                mUseAsyncTransfer = false;
+            }
             RecordErrorUpdateState(CHIP_ERROR_CONNECTION_ABORTED, reason);
         }
 
@@ -792,8 +798,12 @@ CHIP_ERROR DefaultOTARequestor::StartDownload(OperationalDeviceProxy & devicePro
 
     // TODO: allow caller to provide their own OTADownloader instance and set BDX parameters
 
+    // Asynchronous mode is only used if the provider supports it
+    BitFlags<bdx::TransferControlFlags> transferModes(bdx::TransferControlFlags::kReceiverDrive);
+    transferModes.Set(bdx::TransferControlFlags::kAsync, mUseAsyncTransfer);
+
     TransferSession::TransferInitData initOptions;
-    initOptions.TransferCtlFlags = bdx::TransferControlFlags::kReceiverDrive;
+    initOptions.TransferCtlFlags = transferModes;
     initOptions.MaxBlockSize     = mOtaRequestorDriver->GetMaxDownloadBlockSize();
     initOptions.FileDesLength    = static_cast<uint16_t>(mFileDesignator.size());
     initOptions.FileDesignator   = reinterpret_cast<const uint8_t *>(mFileDesignator.data());
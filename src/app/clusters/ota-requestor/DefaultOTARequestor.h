@@ -299,6 +299,8 @@ private:
     Messaging::ExchangeContext * mExchangeCtx = nullptr;
     BDXDownloader * mBdxDownloader            = nullptr; // TODO: this should be OTADownloader
     BDXMessenger mBdxMessenger;                          // TODO: ideally this is held by the application
+    // Whether to propose asynchronous BDX transfers, until one fails
+    bool mUseAsyncTransfer = CHIP_CONFIG_BDX_ASYNC_TRANSFER;
     uint8_t mUpdateTokenBuffer[kMaxUpdateTokenLen];
     ByteSpan mUpdateToken;
     uint32_t mCurrentVersion = 0;
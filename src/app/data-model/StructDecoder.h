@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Decode.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/*
+ * @brief
+ *
+ * Decodes the fields of a cluster object (struct, command, event) from the TLV structure the reader is positioned on.
+ *
+ * Encoders write the fields in the order of their tags, so generated decoders first read them in that order with
+ * DecodeInOrder(), which only reads the next element of the structure when it has the tag of the field, straight from
+ * the reader buffer. The elements it leaves (fields out of order or repeated, unknown fields, profile tagged elements,
+ * or elements DecodeInOrder() cannot read in place) are then returned by NextOutOfOrder() to the generic loop switching
+ * on the field ID. Elements are consumed in the order they are encoded either way, so the decoded object is the same as
+ * with the generic loop alone:
+ *
+ *     StructDecoder decoder(reader);
+ *     ReturnErrorOnFailure(decoder.Enter());
+ *     ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kA), a));
+ *     ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kB), b));
+ *
+ *     CHIP_ERROR err;
+ *     while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
+ *     {
+ *         switch (decoder.GetFieldId())
+ *         {
+ *         ...
+ *         }
+ *     }
+ *
+ *     return decoder.Exit(err);
+ */
+class StructDecoder
+{
+public:
+    explicit StructDecoder(TLV::TLVReader & reader) : mReader(reader) {}
+
+    CHIP_ERROR Enter()
+    {
+        VerifyOrReturnError(TLV::kTLVType_Structure == mReader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+        return mReader.EnterContainer(mOuter);
+    }
+
+    /*
+     * Decodes the field if it is the next element of the structure, and leaves the element to the next call otherwise.
+     */
+    template <typename X>
+    CHIP_ERROR DecodeInOrder(uint8_t fieldId, X & x)
+    {
+#if CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+        bool found;
+        ReturnErrorOnFailure(mReader.NextIfContextTag(fieldId, found));
+        if (found)
+        {
+            return Decode(mReader, x);
+        }
+#endif // CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+        return CHIP_NO_ERROR;
+    }
+
+    /*
+     * Moves to the next context tagged element not consumed by DecodeInOrder().
+     *
+     * @retval #CHIP_END_OF_TLV once all the elements of the structure are consumed.
+     */
+    CHIP_ERROR NextOutOfOrder()
+    {
+        CHIP_ERROR err;
+        do
+        {
+            err = mReader.Next();
+        } while (err == CHIP_NO_ERROR && !TLV::IsContextTag(mReader.GetTag()));
+        return err;
+    }
+
+    uint32_t GetFieldId() const { return TLV::TagNumFromTag(mReader.GetTag()); }
+
+    /*
+     * Leaves the structure, given the error that ended the NextOutOfOrder() loop.
+     */
+    CHIP_ERROR Exit(CHIP_ERROR err)
+    {
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        return mReader.ExitContainer(mOuter);
+    }
+
+private:
+    TLV::TLVReader & mReader;
+    TLV::TLVType mOuter = TLV::kTLVType_NotSpecified;
+};
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
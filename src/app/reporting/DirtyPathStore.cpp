@@ -0,0 +1,287 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathStore.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+namespace {
+
+// Whether some concrete attribute path is included in both paths. List indices are ignored.
+bool PathsOverlap(const AttributePathParams & aPath1, const AttributePathParams & aPath2)
+{
+    return (aPath1.HasWildcardEndpointId() || aPath2.HasWildcardEndpointId() || aPath1.mEndpointId == aPath2.mEndpointId) &&
+        (aPath1.HasWildcardClusterId() || aPath2.HasWildcardClusterId() || aPath1.mClusterId == aPath2.mClusterId) &&
+        (aPath1.HasWildcardAttributeId() || aPath2.HasWildcardAttributeId() || aPath1.mAttributeId == aPath2.mAttributeId);
+}
+
+} // namespace
+
+const DirtyPathStore::Entry * DirtyPathStore::Table::Find(EndpointId aEndpointId, ClusterId aClusterId,
+                                                          AttributeId aAttributeId) const
+{
+    if (mCount == 0)
+    {
+        return nullptr;
+    }
+    const Entry & slot = mSlots[Probe(aEndpointId, aClusterId, aAttributeId)];
+    return slot.mUsed ? &slot : nullptr;
+}
+
+DirtyPathStore::Entry * DirtyPathStore::Table::FindOrInsert(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId)
+{
+    if (mCount > 0)
+    {
+        Entry & slot = mSlots[Probe(aEndpointId, aClusterId, aAttributeId)];
+        if (slot.mUsed)
+        {
+            return &slot;
+        }
+    }
+
+    VerifyOrReturnError(mCount < CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS, nullptr);
+    if (2 * (mCount + 1) >= mSlotCount)
+    {
+        VerifyOrReturnError(Grow(), nullptr);
+    }
+
+    Entry & slot      = mSlots[Probe(aEndpointId, aClusterId, aAttributeId)];
+    slot.mEndpointId  = aEndpointId;
+    slot.mClusterId   = aClusterId;
+    slot.mAttributeId = aAttributeId;
+    slot.mUsed        = true;
+    mCount++;
+    return &slot;
+}
+
+size_t DirtyPathStore::Table::Probe(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) const
+{
+    // Fibonacci hashing of the three ids, linear probing.
+    constexpr uint64_t kMultiplier = UINT64_C(0x9E3779B97F4A7C15);
+    uint64_t hash                  = (static_cast<uint64_t>(aClusterId) << 32 | aAttributeId) * kMultiplier;
+    hash                           = (hash ^ aEndpointId) * kMultiplier;
+
+    size_t mask = mSlotCount - 1;
+    for (size_t index = static_cast<size_t>(hash >> mSlotShift);; index = (index + 1) & mask)
+    {
+        const Entry & slot = mSlots[index];
+        if (!slot.mUsed ||
+            (slot.mEndpointId == aEndpointId && slot.mClusterId == aClusterId && slot.mAttributeId == aAttributeId))
+        {
+            return index;
+        }
+    }
+}
+
+bool DirtyPathStore::Table::Grow()
+{
+    size_t slotCount = (mSlotCount == 0) ? kInitialSlotCount : 2 * mSlotCount;
+    auto slots       = static_cast<Entry *>(Platform::MemoryCalloc(slotCount, sizeof(Entry)));
+    if (slots == nullptr)
+    {
+        return false;
+    }
+
+    Entry * oldSlots    = mSlots;
+    size_t oldSlotCount = mSlotCount;
+    mSlots              = slots;
+    mSlotCount          = slotCount;
+    mSlotShift          = 64;
+    for (size_t count = slotCount; count > 1; count >>= 1)
+    {
+        mSlotShift--;
+    }
+
+    for (size_t i = 0; i < oldSlotCount; i++)
+    {
+        if (oldSlots[i].mUsed)
+        {
+            mSlots[Probe(oldSlots[i].mEndpointId, oldSlots[i].mClusterId, oldSlots[i].mAttributeId)] = oldSlots[i];
+        }
+    }
+    Platform::MemoryFree(oldSlots);
+    return true;
+}
+
+void DirtyPathStore::Table::Clear()
+{
+    if (mCount > 0)
+    {
+        memset(mSlots, 0, mSlotCount * sizeof(Entry));
+        mCount = 0;
+    }
+}
+
+void DirtyPathStore::Table::Release()
+{
+    if (mSlots != nullptr)
+    {
+        Platform::MemoryFree(mSlots);
+    }
+    mSlots     = nullptr;
+    mSlotCount = 0;
+    mSlotShift = 0;
+    mCount     = 0;
+}
+
+void DirtyPathStore::Insert(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    mLatestGeneration = aGeneration;
+
+    if (aPath.HasWildcardEndpointId() || aPath.HasWildcardClusterId())
+    {
+        InsertWildcard(aPath, aGeneration);
+        return;
+    }
+
+    Entry * cluster = mClusters.FindOrInsert(aPath.mEndpointId, aPath.mClusterId, kInvalidAttributeId);
+    if (cluster == nullptr)
+    {
+        ChipLogError(DataManagement, "Dirty path store full, marking all attributes dirty");
+        mOverflowGeneration = aGeneration;
+        return;
+    }
+    cluster->mLatestGeneration = aGeneration;
+
+    // The list index is not tracked: reports always carry the whole attribute.
+    if (!aPath.HasWildcardAttributeId())
+    {
+        Entry * attribute = mAttributes.FindOrInsert(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+        if (attribute != nullptr)
+        {
+            attribute->mGeneration = aGeneration;
+            return;
+        }
+        ChipLogError(DataManagement, "Dirty path store full, marking cluster " ChipLogFormatMEI " dirty",
+                     ChipLogValueMEI(aPath.mClusterId));
+    }
+    cluster->mGeneration = aGeneration;
+}
+
+void DirtyPathStore::InsertWildcard(const AttributePathParams & aPath, uint64_t aGeneration)
+{
+    // If an existing path covers the new one, just bring it up to date.
+    Loop merged = mWildcardPaths.ForEachActiveObject([&](WildcardPath * path) {
+        if (path->IsAttributePathSupersetOf(aPath))
+        {
+            path->mGeneration = aGeneration;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    if (merged == Loop::Break)
+    {
+        return;
+    }
+
+    // Otherwise the new path replaces all the existing ones it covers.
+    mWildcardPaths.ForEachActiveObject([&](WildcardPath * path) {
+        if (aPath.IsAttributePathSupersetOf(*path))
+        {
+            mWildcardPaths.ReleaseObject(path);
+        }
+        return Loop::Continue;
+    });
+
+    if (mWildcardPaths.CreateObject(aPath, aGeneration) == nullptr)
+    {
+        ChipLogError(DataManagement, "Dirty wildcard path pool full, marking all attributes dirty");
+        mOverflowGeneration = aGeneration;
+    }
+}
+
+bool DirtyPathStore::IsDirty(const ConcreteAttributePath & aPath, uint64_t aGeneration) const
+{
+    VerifyOrReturnError(mLatestGeneration > aGeneration, false);
+    VerifyOrReturnError(mOverflowGeneration <= aGeneration, true);
+
+    const Entry * cluster = mClusters.Find(aPath.mEndpointId, aPath.mClusterId, kInvalidAttributeId);
+    if (cluster != nullptr && cluster->mLatestGeneration > aGeneration)
+    {
+        VerifyOrReturnError(cluster->mGeneration <= aGeneration, true);
+
+        const Entry * attribute = mAttributes.Find(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+        VerifyOrReturnError(attribute == nullptr || attribute->mGeneration <= aGeneration, true);
+    }
+
+    return mWildcardPaths.ForEachActiveObject([&](const WildcardPath * path) {
+        return (path->mGeneration > aGeneration && path->IsAttributePathSupersetOf(aPath)) ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
+}
+
+bool DirtyPathStore::ClusterIntersects(const Entry * apCluster, const AttributePathParams & aPath, uint64_t aGeneration) const
+{
+    VerifyOrReturnError(apCluster != nullptr && apCluster->mLatestGeneration > aGeneration, false);
+    VerifyOrReturnError(!aPath.HasWildcardAttributeId() && apCluster->mGeneration <= aGeneration, true);
+
+    const Entry * attribute = mAttributes.Find(apCluster->mEndpointId, apCluster->mClusterId, aPath.mAttributeId);
+    return attribute != nullptr && attribute->mGeneration > aGeneration;
+}
+
+bool DirtyPathStore::Intersects(const AttributePathParams & aPath, uint64_t aGeneration) const
+{
+    VerifyOrReturnError(mLatestGeneration > aGeneration, false);
+    VerifyOrReturnError(mOverflowGeneration <= aGeneration, true);
+
+    Loop wildcardMatch = mWildcardPaths.ForEachActiveObject([&](const WildcardPath * path) {
+        return (path->mGeneration > aGeneration && PathsOverlap(*path, aPath)) ? Loop::Break : Loop::Continue;
+    });
+    VerifyOrReturnError(wildcardMatch != Loop::Break, true);
+
+    if (!aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId())
+    {
+        return ClusterIntersects(mClusters.Find(aPath.mEndpointId, aPath.mClusterId, kInvalidAttributeId), aPath, aGeneration);
+    }
+
+    return mClusters.ForEachEntry([&](const Entry & cluster) {
+        if ((aPath.HasWildcardEndpointId() || aPath.mEndpointId == cluster.mEndpointId) &&
+            (aPath.HasWildcardClusterId() || aPath.mClusterId == cluster.mClusterId) &&
+            ClusterIntersects(&cluster, aPath, aGeneration))
+        {
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    }) == Loop::Break;
+}
+
+void DirtyPathStore::Clear()
+{
+    mAttributes.Clear();
+    mClusters.Clear();
+    mWildcardPaths.ReleaseAll();
+    mLatestGeneration   = 0;
+    mOverflowGeneration = 0;
+}
+
+void DirtyPathStore::Release()
+{
+    Clear();
+    mAttributes.Release();
+    mClusters.Release();
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
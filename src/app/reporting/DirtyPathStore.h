@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the store of dirty attribute paths used by the Reporting Engine.
+ *
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/Pool.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/*
+ *  @class DirtyPathStore
+ *
+ *  @brief Tracks the attribute paths marked dirty by Engine::SetDirty, together with the dirty set generation at which each
+ * path was last marked, so that read handlers can find what changed since their last report.
+ *
+ *         Concrete attribute paths are kept in a hash table. Every dirty cluster also has a summary entry holding the generation
+ * at which the whole cluster was marked dirty and the latest generation of any of its attributes, so paths with a wildcard
+ * attribute id are matched with a single lookup. Paths with a wildcard endpoint or cluster id are rare and kept in a small pool.
+ *
+ *         When memory runs out, paths are recorded at a coarser granularity (the whole cluster, then everything) instead of
+ * being dropped: reports may then include attributes that did not change, but no change is lost.
+ */
+class DirtyPathStore
+{
+public:
+    DirtyPathStore() = default;
+    ~DirtyPathStore() { Release(); }
+
+    DirtyPathStore(const DirtyPathStore &) = delete;
+    DirtyPathStore & operator=(const DirtyPathStore &) = delete;
+
+    /**
+     * Marks a path dirty at the given generation. Generations must not decrease from one call to the next.
+     */
+    void Insert(const AttributePathParams & aPath, uint64_t aGeneration);
+
+    /**
+     * Returns whether the attribute was marked dirty after the given generation.
+     */
+    bool IsDirty(const ConcreteAttributePath & aPath, uint64_t aGeneration) const;
+
+    /**
+     * Returns whether a path marked dirty after the given generation overlaps aPath, i.e. both include some attribute.
+     */
+    bool Intersects(const AttributePathParams & aPath, uint64_t aGeneration) const;
+
+    bool IsEmpty() const { return mLatestGeneration == 0; }
+
+    /**
+     * Forgets all dirty paths, keeping the memory allocated for them.
+     */
+    void Clear();
+
+    /**
+     * Forgets all dirty paths and frees the memory allocated for them.
+     */
+    void Release();
+
+    size_t AttributePathCount() const { return mAttributes.Count(); }
+    size_t ClusterCount() const { return mClusters.Count(); }
+
+private:
+    struct Entry
+    {
+        ClusterId mClusterId;
+        AttributeId mAttributeId; // kInvalidAttributeId in cluster summaries
+        EndpointId mEndpointId;
+        bool mUsed;
+        uint64_t mGeneration;       // Generation of the attribute, or of the whole cluster in cluster summaries
+        uint64_t mLatestGeneration; // Cluster summaries only: latest generation of the cluster or any of its attributes
+    };
+
+    /**
+     * Open-addressing hash table of entries that grows on demand. Entries are only removed all at once.
+     */
+    class Table
+    {
+    public:
+        Table() = default;
+        ~Table() { Release(); }
+
+        const Entry * Find(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) const;
+
+        /**
+         * Returns the entry for the path, adding a zeroed one if needed, or nullptr if the table already holds
+         * CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS entries or cannot grow.
+         */
+        Entry * FindOrInsert(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId);
+
+        template <typename Function>
+        Loop ForEachEntry(Function && aFunction) const
+        {
+            for (size_t i = 0; i < mSlotCount; i++)
+            {
+                if (mSlots[i].mUsed && aFunction(mSlots[i]) == Loop::Break)
+                {
+                    return Loop::Break;
+                }
+            }
+            return Loop::Finish;
+        }
+
+        size_t Count() const { return mCount; }
+        void Clear();
+        void Release();
+
+    private:
+        static constexpr size_t kInitialSlotCount = 16;
+
+        size_t Probe(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId) const;
+        bool Grow();
+
+        Entry * mSlots    = nullptr;
+        size_t mSlotCount = 0; // Power of two, more than twice mCount
+        size_t mSlotShift = 0; // 64 - log2(mSlotCount)
+        size_t mCount     = 0;
+    };
+
+    struct WildcardPath : public AttributePathParams
+    {
+        WildcardPath(const AttributePathParams & aPath, uint64_t aGeneration) : AttributePathParams(aPath), mGeneration(aGeneration)
+        {}
+        uint64_t mGeneration;
+    };
+
+    void InsertWildcard(const AttributePathParams & aPath, uint64_t aGeneration);
+    bool ClusterIntersects(const Entry * apCluster, const AttributePathParams & aPath, uint64_t aGeneration) const;
+
+    Table mAttributes;
+    Table mClusters;
+    ObjectPool<WildcardPath, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mWildcardPaths;
+
+    uint64_t mLatestGeneration   = 0; // Latest generation of any path, 0 when empty
+    uint64_t mOverflowGeneration = 0; // Generation at which every path was marked dirty for lack of memory, or 0
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -47,7 +47,7 @@ void Engine::Shutdown()
 
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
-    mGlobalDirtySet.ReleaseAll();
+    mGlobalDirtySet.Release();
 }
 
 bool Engine::IsClusterDataVersionMatch(const ObjectList<DataVersionFilter> * aDataVersionFilterList,
@@ -83,143 +83,235 @@ Engine::RetrieveClusterData(const SubjectDescriptor & aSubjectDescriptor, bool a
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
-                                                           ReadHandler * apReadHandler, bool * apHasMoreChunks,
-                                                           bool * apHasEncodedData)
+CHIP_ERROR Engine::EncodeAttributeReportIBs(AttributeReportIBs::Builder & aAttributeReportIBs, ReadHandler * apReadHandler,
+                                            bool & aHasMoreChunks, uint32_t aMaxAttributeReportIBLength)
 {
-    CHIP_ERROR err            = CHIP_NO_ERROR;
-    bool attributeDataWritten = false;
-    bool hasMoreChunks        = true;
-    TLV::TLVWriter backup;
-    const uint32_t kReservedSizeEndOfReportIBs = 1;
-
-    aReportDataBuilder.Checkpoint(backup);
+    // TODO: Figure out how AttributePathExpandIterator should handle read
+    // vs write paths.
+    ConcreteAttributePath readPath;
 
-    AttributeReportIBs::Builder & attributeReportIBs = aReportDataBuilder.CreateAttributeReportIBs();
-    size_t emptyReportDataLength                     = 0;
+    ChipLogDetail(DataManagement,
+                  "Building Reports for ReadHandler with LastReportGeneration = %" PRIu64 " DirtyGeneration = %" PRIu64,
+                  apReadHandler->mPreviousReportsBeginGeneration, apReadHandler->mDirtyGeneration);
 
-    SuccessOrExit(err = aReportDataBuilder.GetError());
+    // This ReadHandler is not generating reports, so we reset the iterator for a clean start.
+    if (!apReadHandler->IsReporting())
+    {
+        apReadHandler->ResetPathIterator();
+    }
 
-    emptyReportDataLength = attributeReportIBs.GetWriter()->GetLengthWritten();
-    //
-    // Reserve enough space for closing out the Report IB list
-    //
-    attributeReportIBs.GetWriter()->ReserveBuffer(kReservedSizeEndOfReportIBs);
+#if CONFIG_IM_BUILD_FOR_UNIT_TEST
+    uint32_t attributesRead = 0;
+#endif
 
+    // For each path included in the interested path of the read handler...
+    for (; apReadHandler->GetAttributePathExpandIterator()->Get(readPath);
+         apReadHandler->GetAttributePathExpandIterator()->Next())
     {
-        // TODO: Figure out how AttributePathExpandIterator should handle read
-        // vs write paths.
-        ConcreteAttributePath readPath;
-
-        ChipLogDetail(DataManagement,
-                      "Building Reports for ReadHandler with LastReportGeneration = %" PRIu64 " DirtyGeneration = %" PRIu64,
-                      apReadHandler->mPreviousReportsBeginGeneration, apReadHandler->mDirtyGeneration);
+        if (!apReadHandler->IsPriming())
+        {
+            // We don't need to worry about paths that were already marked dirty before the last time this read handler
+            // started a report that it completed: those paths already got reported.
+            bool concretePathDirty = mGlobalDirtySet.IsDirty(readPath, apReadHandler->mPreviousReportsBeginGeneration);
 
-        // This ReadHandler is not generating reports, so we reset the iterator for a clean start.
-        if (!apReadHandler->IsReporting())
+            if (!concretePathDirty)
+            {
+                // This attribute is not dirty, we just skip this one.
+                continue;
+            }
+        }
+        else
         {
-            apReadHandler->ResetPathIterator();
+            if (IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
+            {
+                continue;
+            }
         }
 
 #if CONFIG_IM_BUILD_FOR_UNIT_TEST
-        uint32_t attributesRead = 0;
+        attributesRead++;
+        if (attributesRead > mMaxAttributesPerChunk)
+        {
+            return CHIP_ERROR_BUFFER_TOO_SMALL;
+        }
 #endif
 
-        // For each path included in the interested path of the read handler...
-        for (; apReadHandler->GetAttributePathExpandIterator()->Get(readPath);
-             apReadHandler->GetAttributePathExpandIterator()->Next())
+        // If we are processing a read request, or the initial report of a subscription, just regard all paths as dirty
+        // paths.
+        TLV::TLVWriter attributeBackup;
+        aAttributeReportIBs.Checkpoint(attributeBackup);
+        ConcreteReadAttributePath pathForRetrieval(readPath);
+        // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
+        AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
+        encodeState.SetMaxAttributeReportIBLength(aMaxAttributeReportIBLength);
+        CHIP_ERROR err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(),
+                                             aAttributeReportIBs, pathForRetrieval, &encodeState);
+        if (err != CHIP_NO_ERROR)
         {
-            if (!apReadHandler->IsPriming())
-            {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
+            ChipLogError(DataManagement,
+                         "Error retrieving data from clusterId: " ChipLogFormatMEI ", err = %" CHIP_ERROR_FORMAT,
+                         ChipLogValueMEI(pathForRetrieval.mClusterId), err.Format());
 
-                if (!concretePathDirty)
-                {
-                    // This attribute is not dirty, we just skip this one.
-                    continue;
-                }
+            // If error is not CHIP_ERROR_BUFFER_TOO_SMALL and is not CHIP_ERROR_NO_MEMORY, rollback and encode status.
+            // Otherwise, if partial data allowed, save the encode state.
+            // Otherwise roll back. If we have already encoded some chunks, we are done; otherwise encode status.
+
+            if (encodeState.AllowPartialData() && ((err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_ERROR_NO_MEMORY)))
+            {
+                // Encoding is aborted but partial data is allowed, then we don't rollback and save the state for next chunk.
+                apReadHandler->SetAttributeEncodeState(encodeState);
             }
             else
             {
-                if (IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
+                // We met a error during writing reports, one common case is we are running out of buffer, rollback the
+                // attributeReportIB to avoid any partial data.
+                aAttributeReportIBs.Rollback(attributeBackup);
+                apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
+
+                if (err != CHIP_ERROR_NO_MEMORY && err != CHIP_ERROR_BUFFER_TOO_SMALL)
                 {
-                    continue;
+                    // Try to encode our error as a status response.
+                    err = aAttributeReportIBs.EncodeAttributeStatus(pathForRetrieval, StatusIB(err));
+                    if (err != CHIP_NO_ERROR)
+                    {
+                        // OK, just roll back again and give up.
+                        aAttributeReportIBs.Rollback(attributeBackup);
+                    }
                 }
             }
+        }
+        ReturnErrorOnFailure(err);
+        // Successfully encoded the attribute, clear the internal state.
+        apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
+    }
+    // We just visited all paths interested by this read handler and did not abort in the middle of iteration, there are no more
+    // chunks for this report.
+    aHasMoreChunks = false;
 
-#if CONFIG_IM_BUILD_FOR_UNIT_TEST
-            attributesRead++;
-            if (attributesRead > mMaxAttributesPerChunk)
-            {
-                ExitNow(err = CHIP_ERROR_BUFFER_TOO_SMALL);
-            }
-#endif
+    return CHIP_NO_ERROR;
+}
 
-            // If we are processing a read request, or the initial report of a subscription, just regard all paths as dirty
-            // paths.
-            TLV::TLVWriter attributeBackup;
-            attributeReportIBs.Checkpoint(attributeBackup);
-            ConcreteReadAttributePath pathForRetrieval(readPath);
-            // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
-            AttributeValueEncoder::AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            err = RetrieveClusterData(apReadHandler->GetSubjectDescriptor(), apReadHandler->IsFabricFiltered(), attributeReportIBs,
-                                      pathForRetrieval, &encodeState);
-            if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(DataManagement,
-                             "Error retrieving data from clusterId: " ChipLogFormatMEI ", err = %" CHIP_ERROR_FORMAT,
-                             ChipLogValueMEI(pathForRetrieval.mClusterId), err.Format());
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+CHIP_ERROR Engine::EncodePendingAttributeReportIBs(ReadHandler * apReadHandler, uint32_t aMaxAttributeReportIBLength)
+{
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    VerifyOrReturnError(!buf.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-                // If error is not CHIP_ERROR_BUFFER_TOO_SMALL and is not CHIP_ERROR_NO_MEMORY, rollback and encode status.
-                // Otherwise, if partial data allowed, save the encode state.
-                // Otherwise roll back. If we have already encoded some chunks, we are done; otherwise encode status.
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(buf), /* useChainedBuffers = */ true, mMaxReportChainBuffers);
 
-                if (encodeState.AllowPartialData() && ((err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_ERROR_NO_MEMORY)))
-                {
-                    // Encoding is aborted but partial data is allowed, then we don't rollback and save the state for next chunk.
-                    apReadHandler->SetAttributeEncodeState(encodeState);
-                }
-                else
-                {
-                    // We met a error during writing reports, one common case is we are running out of buffer, rollback the
-                    // attributeReportIB to avoid any partial data.
-                    attributeReportIBs.Rollback(attributeBackup);
-                    apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
+    // The pending AttributeReportIBs are a bare sequence of anonymous elements: they are copied one by one into the
+    // AttributeReportIBs array of each report message, and reserving room for an end of container would not span buffers.
+    AttributeReportIBs::Builder attributeReportIBs;
+    static_cast<Builder &>(attributeReportIBs).Init(&writer, TLV::kTLVType_NotSpecified);
+    attributeReportIBs.ResetError();
 
-                    if (err != CHIP_ERROR_NO_MEMORY && err != CHIP_ERROR_BUFFER_TOO_SMALL)
-                    {
-                        // Try to encode our error as a status response.
-                        err = attributeReportIBs.EncodeAttributeStatus(pathForRetrieval, StatusIB(err));
-                        if (err != CHIP_NO_ERROR)
-                        {
-                            // OK, just roll back again and give up.
-                            attributeReportIBs.Rollback(attributeBackup);
-                        }
-                    }
-                }
-            }
-            SuccessOrExit(err);
-            // Successfully encoded the attribute, clear the internal state.
-            apReadHandler->SetAttributeEncodeState(AttributeValueEncoder::AttributeEncodeState());
+    bool hasMoreChunks = true;
+    CHIP_ERROR err     = EncodeAttributeReportIBs(attributeReportIBs, apReadHandler, hasMoreChunks, aMaxAttributeReportIBLength);
+    if ((err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_ERROR_NO_MEMORY))
+    {
+        // The chain is full; the remaining paths go into the next batch.
+        err = CHIP_NO_ERROR;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        writer.Reset();
+        return err;
+    }
+
+    ReturnErrorOnFailure(writer.Finalize(&buf));
+    return apReadHandler->GetPendingAttributeReportIBs().Init(std::move(buf));
+}
+
+CHIP_ERROR Engine::CopyPendingAttributeReportIBs(AttributeReportIBs::Builder & aAttributeReportIBs, ReadHandler * apReadHandler,
+                                                 bool & aHasMoreChunks)
+{
+    System::ChainedPacketBufferTLVReader & pending = apReadHandler->GetPendingAttributeReportIBs();
+    ConcreteAttributePath readPath;
+
+    if (!apReadHandler->IsReporting())
+    {
+        // Leftovers of an aborted report must not leak into a new one.
+        pending.Reset();
+    }
+
+    if (pending.IsNull())
+    {
+        // Only encode a new batch at the start of a report message, so that the dirty paths are looked at once per message, as
+        // when encoding them in place. Every AttributeReportIB of the batch then fits in a message like this one.
+        ReturnErrorOnFailure(
+            EncodePendingAttributeReportIBs(apReadHandler, aAttributeReportIBs.GetWriter()->GetRemainingFreeLength()));
+    }
+
+    while (true)
+    {
+        TLV::TLVReader pendingBackup;
+        pendingBackup.Init(pending);
+
+        CHIP_ERROR err = pending.Next();
+        if (err == CHIP_END_OF_TLV)
+        {
+            pending.Reset();
+            break;
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            pending.Reset();
+            return err;
+        }
+
+        TLV::TLVWriter attributeBackup;
+        aAttributeReportIBs.Checkpoint(attributeBackup);
+        err = aAttributeReportIBs.GetWriter()->CopyElement(TLV::AnonymousTag(), pending);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Keep the AttributeReportIB for the next report message.
+            aAttributeReportIBs.Rollback(attributeBackup);
+            pending.Init(pendingBackup);
+            aHasMoreChunks = true;
+            return err;
         }
-        // We just visited all paths interested by this read handler and did not abort in the middle of iteration, there are no more
-        // chunks for this report.
-        hasMoreChunks = false;
     }
+
+    aHasMoreChunks = apReadHandler->GetAttributePathExpandIterator()->Get(readPath);
+    return CHIP_NO_ERROR;
+}
+#endif
+
+CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
+                                                           ReadHandler * apReadHandler, bool * apHasMoreChunks,
+                                                           bool * apHasEncodedData)
+{
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+    bool attributeDataWritten = false;
+    bool hasMoreChunks        = true;
+    TLV::TLVWriter backup;
+    const uint32_t kReservedSizeEndOfReportIBs = 1;
+
+    aReportDataBuilder.Checkpoint(backup);
+
+    AttributeReportIBs::Builder & attributeReportIBs = aReportDataBuilder.CreateAttributeReportIBs();
+    size_t emptyReportDataLength                     = 0;
+
+    SuccessOrExit(err = aReportDataBuilder.GetError());
+
+    emptyReportDataLength = attributeReportIBs.GetWriter()->GetLengthWritten();
+    //
+    // Reserve enough space for closing out the Report IB list
+    //
+    attributeReportIBs.GetWriter()->ReserveBuffer(kReservedSizeEndOfReportIBs);
+
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    if (mMaxReportChainBuffers > 0)
+    {
+        err = CopyPendingAttributeReportIBs(attributeReportIBs, apReadHandler, hasMoreChunks);
+    }
+    else
+#endif
+    {
+        err = EncodeAttributeReportIBs(attributeReportIBs, apReadHandler, hasMoreChunks);
+    }
+
 exit:
     if (attributeReportIBs.GetWriter()->GetLengthWritten() != emptyReportDataLength)
     {
@@ -629,35 +721,10 @@ void Engine::Run()
     {
         ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
 
-        mGlobalDirtySet.ReleaseAll();
+        mGlobalDirtySet.Clear();
     }
 }
 
-bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
-{
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
 CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
@@ -682,17 +749,9 @@ CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
         return Loop::Continue;
     });
 
-    if (!MergeOverlappedAttributePath(aAttributePath) &&
-        InteractionModelEngine::GetInstance()->IsOverlappedAttributePath(aAttributePath))
+    if (InteractionModelEngine::GetInstance()->IsOverlappedAttributePath(aAttributePath))
     {
-        auto object = mGlobalDirtySet.CreateObject();
-        if (object == nullptr)
-        {
-            ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-            return CHIP_ERROR_NO_MEMORY;
-        }
-        *object             = aAttributePath;
-        object->mGeneration = GetDirtySetGeneration();
+        mGlobalDirtySet.Insert(aAttributePath, GetDirtySetGeneration());
     }
 
     // Schedule work to run asynchronously on the CHIP thread. The scheduled
@@ -721,17 +780,9 @@ void Engine::UpdateReadHandlerDirty(ReadHandler & aReadHandler)
     bool intersected = false;
     for (auto object = aReadHandler.GetAttributePathList(); object != nullptr; object = object->mpNext)
     {
-        mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-            if ((path->IsAttributePathSupersetOf(object->mValue) || object->mValue.IsAttributePathSupersetOf(*path)) &&
-                path->mGeneration > aReadHandler.mPreviousReportsBeginGeneration)
-            {
-                intersected = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
-        if (intersected)
+        if (mGlobalDirtySet.Intersects(object->mValue, aReadHandler.mPreviousReportsBeginGeneration))
         {
+            intersected = true;
             break;
         }
     }
@@ -24,9 +24,12 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <access/AccessControl.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/DirtyPathStore.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -67,6 +70,14 @@ public:
     void SetWriterReserved(uint32_t aReservedSize) { mReservedSize = aReservedSize; }
 
     void SetMaxAttributesPerChunk(uint32_t aMaxAttributesPerChunk) { mMaxAttributesPerChunk = aMaxAttributesPerChunk; }
+
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    // 0 encodes the attribute data of each report message in that message only.
+    void SetMaxReportChainBuffers(uint8_t aMaxReportChainBuffers)
+    {
+        mMaxReportChainBuffers = std::min<uint8_t>(aMaxReportChainBuffers, CHIP_IM_MAX_REPORT_CHAIN_BUFFERS);
+    }
+#endif
 #endif
 
     /**
@@ -129,13 +140,6 @@ public:
 private:
     friend class TestReportingEngine;
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() {}
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-        uint64_t mGeneration = 0;
-    };
-
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -146,6 +150,37 @@ private:
                                                        bool * apHasMoreChunks, bool * apHasEncodedData);
     CHIP_ERROR BuildSingleReportDataEventReports(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
                                                  bool aBufferIsUsed, bool * apHasMoreChunks, bool * apHasEncodedData);
+
+    /**
+     * Encode the AttributeReportIBs of the dirty paths of the read handler, resuming from where its path iterator and attribute
+     * encode state left off, until they are all encoded or aAttributeReportIBs runs out of space.
+     *
+     * @param[out] aHasMoreChunks               Set to false once all the paths have been encoded.
+     * @param[in]  aMaxAttributeReportIBLength  The maximum length of each AttributeReportIB, list items included.
+     *
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL or #CHIP_ERROR_NO_MEMORY when running out of space, everything encoded so far being
+     *         complete.
+     */
+    CHIP_ERROR EncodeAttributeReportIBs(AttributeReportIBs::Builder & aAttributeReportIBs, ReadHandler * apReadHandler,
+                                        bool & aHasMoreChunks, uint32_t aMaxAttributeReportIBLength = UINT32_MAX);
+
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    /**
+     * Encode the AttributeReportIBs of the read handler into a chain of up to mMaxReportChainBuffers packet buffers, which the
+     * read handler keeps as its pending AttributeReportIBs. No AttributeReportIB is longer than aMaxAttributeReportIBLength, so
+     * that each of them fits in a report message on its own.
+     */
+    CHIP_ERROR EncodePendingAttributeReportIBs(ReadHandler * apReadHandler, uint32_t aMaxAttributeReportIBLength);
+
+    /**
+     * Move as many pending AttributeReportIBs of the read handler as fit into aAttributeReportIBs, encoding them first if there
+     * are none pending.
+     *
+     * @param[out] aHasMoreChunks  Set to false once all the paths have been encoded and sent.
+     */
+    CHIP_ERROR CopyPendingAttributeReportIBs(AttributeReportIBs::Builder & aAttributeReportIBs, ReadHandler * apReadHandler,
+                                             bool & aHasMoreChunks);
+#endif
     CHIP_ERROR RetrieveClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
                                    AttributeReportIBs::Builder & aAttributeReportIBs,
                                    const ConcreteReadAttributePath & aClusterInfo,
@@ -180,14 +215,6 @@ private:
     CHIP_ERROR ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten);
     void GetMinEventLogPosition(uint32_t & aMinLogPosition);
 
-    /**
-     * If the provided path is a superset of our of our existing paths, update that existing path to match the
-     * provided path.
-     *
-     * Return whether one of our paths is now a superset of the provided path.
-     */
-    bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
-
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
     /**
@@ -215,10 +242,10 @@ private:
     ReadHandler * mRunningReadHandler = nullptr;
 
     /**
-     *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
+     *  mGlobalDirtySet is used to track the set of attribute paths marked dirty for reporting purposes.
      *
      */
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+    DirtyPathStore mGlobalDirtySet;
 
     /**
      * A generation counter for the dirty attrbute set.
@@ -234,6 +261,14 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    /**
+     * The number of packet buffers the AttributeReportIBs of a report may be encoded into ahead of sending them, 0 to encode
+     * them in each report message instead.
+     */
+    uint8_t mMaxReportChainBuffers = CHIP_IM_MAX_REPORT_CHAIN_BUFFERS;
+#endif
+
 #if CONFIG_IM_BUILD_FOR_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
@@ -66,3 +66,19 @@ void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePa
  * Same but only with an EndpointId, this is used when adding / enabling an endpoint during runtime.
  */
 void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint);
+
+/*
+ * Same as MatterReportingAttributeChangeCallback with an attribute path, but callable from any thread without holding the CHIP
+ * stack lock: the change is queued, then reported from the CHIP event loop.
+ *
+ * Returns CHIP_ERROR_NO_MEMORY if the queue is full, or disabled (CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE is 0). The application
+ * should then lock the CHIP stack and call MatterReportingAttributeChangeCallback instead.
+ */
+CHIP_ERROR MatterReportingAttributeChangeCallbackFromAnyThread(chip::EndpointId endpoint, chip::ClusterId clusterId,
+                                                               chip::AttributeId attributeId);
+
+/*
+ * Reports the changes queued by MatterReportingAttributeChangeCallbackFromAnyThread. This is scheduled on the CHIP event loop
+ * whenever changes get queued, and must be called with the CHIP stack lock held.
+ */
+void MatterReportingProcessQueuedAttributeChanges();
@@ -98,6 +98,9 @@ struct ServerInitParams
     // Access control delegate: MUST be injected. Used to look up access control rules. Must be
     // initialized before being provided
     Access::AccessControl::Delegate * accessDelegate = nullptr;
+    // Session crypto worker: Optional. When provided, the expensive crypto of incoming CASE session
+    // establishments runs on it instead of the event loop. Must be initialized before being provided.
+    SessionCryptoWorker * sessionCryptoWorker = nullptr;
 };
 
 /**
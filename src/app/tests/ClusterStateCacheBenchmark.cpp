@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares the memory taken and the lookup time of both ClusterStateCache storage modes, when caching all the
+ *      attributes of a 50 endpoint bridge after they were reported twice.
+ */
+
+#include <app/ClusterStateCache.h>
+#include <lib/support/CHIPMem.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+constexpr EndpointId kBridgeEndpointCount   = 50;
+constexpr ClusterId kBridgeClusterCount     = 6;
+constexpr AttributeId kBridgeAttributeCount = 10;
+constexpr size_t kBridgeAttributeTotal      = kBridgeEndpointCount * kBridgeClusterCount * kBridgeAttributeCount;
+constexpr size_t kLookupCount               = 200000;
+
+class NullCallback : public ClusterStateCache::Callback
+{
+    void OnDone() override {}
+};
+
+ConcreteAttributePath BridgeAttributePath(size_t index)
+{
+    return ConcreteAttributePath(static_cast<EndpointId>(index / (kBridgeClusterCount * kBridgeAttributeCount)),
+                                 static_cast<ClusterId>(index / kBridgeAttributeCount % kBridgeClusterCount),
+                                 static_cast<AttributeId>(index % kBridgeAttributeCount));
+}
+
+// Reports every attribute of the bridge: odd attributes as status, the others as an octet string tagged with the round.
+bool ReportBridgeAttributes(ReadClient::Callback & callback, uint8_t round)
+{
+    callback.OnReportBegin();
+    for (size_t i = 0; i < kBridgeAttributeTotal; i++)
+    {
+        ConcreteDataAttributePath path(BridgeAttributePath(i));
+        path.mDataVersion.SetValue(round);
+        if (path.mAttributeId % 2 != 0)
+        {
+            callback.OnAttributeData(path, nullptr, StatusIB(Protocols::InteractionModel::Status::UnsupportedAttribute));
+            continue;
+        }
+
+        uint8_t value[16];
+        memset(value, round, sizeof(value));
+        uint8_t buffer[32];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        TLV::TLVReader reader;
+        if (writer.Put(TLV::AnonymousTag(), ByteSpan(value)) != CHIP_NO_ERROR)
+        {
+            return false;
+        }
+        reader.Init(buffer, writer.GetLengthWritten());
+        if (reader.Next() != CHIP_NO_ERROR)
+        {
+            return false;
+        }
+        callback.OnAttributeData(path, &reader, StatusIB());
+    }
+    callback.OnReportEnd();
+    return true;
+}
+
+bool Run(ClusterStateCache::StorageMode storageMode, const char * storageModeName)
+{
+    NullCallback callback;
+    ClusterStateCache cache(callback, Optional<EventNumber>::Missing(), storageMode);
+    if (!ReportBridgeAttributes(cache.GetBufferedCallback(), 1) || !ReportBridgeAttributes(cache.GetBufferedCallback(), 2))
+    {
+        return false;
+    }
+
+    size_t found = 0;
+    auto start   = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookupCount; i++)
+    {
+        TLV::TLVReader reader;
+        // Even attributes hold data, visited in a scattered order.
+        found += (cache.Get(BridgeAttributePath((i * 7919 * 2) % kBridgeAttributeTotal), reader) == CHIP_NO_ERROR) ? 1 : 0;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    printf("%-21s: %u attributes in %7u bytes, %6.1f ns/lookup\n", storageModeName, static_cast<unsigned>(kBridgeAttributeTotal),
+           static_cast<unsigned>(cache.GetAttributeStorageSize()),
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / kLookupCount);
+    return found == kLookupCount;
+}
+
+} // namespace
+
+int main()
+{
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+
+    bool success = Run(ClusterStateCache::StorageMode::kPerAttributeBuffers, "per-attribute buffers") &&
+        Run(ClusterStateCache::StorageMode::kCompact, "compact");
+    if (!success)
+    {
+        fprintf(stderr, "The cache lost attribute data\n");
+    }
+
+    Platform::MemoryShutdown();
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,187 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures the decode time of cluster objects encoded with their fields in tag order, as every CHIP encoder writes
+ *      them, and with their fields reversed, which the generated decoders handle with their generic loop.
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+constexpr size_t kMaxFields = 16;
+constexpr int kRounds       = 10;
+constexpr int kIterations   = 10000;
+
+struct EncodedObject
+{
+    uint8_t buffer[512];
+    uint32_t length = 0;
+};
+
+template <typename T>
+CHIP_ERROR EncodeObject(const T & object, EncodedObject & encoded)
+{
+    TLV::TLVWriter writer;
+    writer.Init(encoded.buffer);
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::AnonymousTag(), object));
+    ReturnErrorOnFailure(writer.Finalize());
+    encoded.length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReverseFields(const EncodedObject & in, EncodedObject & out)
+{
+    TLV::TLVReader fields[kMaxFields];
+    size_t fieldCount = 0;
+
+    TLV::TLVReader reader;
+    TLV::TLVType outer;
+    reader.Init(in.buffer, in.length);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(fieldCount < kMaxFields, CHIP_ERROR_NO_MEMORY);
+        fields[fieldCount++].Init(reader);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    TLV::TLVWriter writer;
+    TLV::TLVType writerOuter;
+    writer.Init(out.buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, writerOuter));
+    while (fieldCount > 0)
+    {
+        ReturnErrorOnFailure(writer.CopyElement(fields[--fieldCount]));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(writerOuter));
+    ReturnErrorOnFailure(writer.Finalize());
+    out.length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+// Returns the average decode time, in nanoseconds, over the fastest of a few rounds, so that the result is not skewed by
+// the other activity of the machine.
+template <typename T>
+CHIP_ERROR MeasureDecode(const EncodedObject & encoded, double & decodeNs)
+{
+    std::chrono::steady_clock::duration fastest = std::chrono::steady_clock::duration::max();
+    for (int round = 0; round < kRounds; round++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIterations; i++)
+        {
+            T decoded;
+            TLV::TLVReader reader;
+            reader.Init(encoded.buffer, encoded.length);
+            ReturnErrorOnFailure(reader.Next());
+            ReturnErrorOnFailure(DataModel::Decode(reader, decoded));
+        }
+        fastest = std::min(fastest, std::chrono::steady_clock::now() - start);
+    }
+    decodeNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(fastest).count()) / kIterations;
+    return CHIP_NO_ERROR;
+}
+
+template <typename Type, typename DecodableType>
+CHIP_ERROR Run(const char * name, const Type & value)
+{
+    EncodedObject inOrder, reversed;
+    ReturnErrorOnFailure(EncodeObject(value, inOrder));
+    ReturnErrorOnFailure(ReverseFields(inOrder, reversed));
+
+    double inOrderNs, reversedNs;
+    ReturnErrorOnFailure(MeasureDecode<DecodableType>(inOrder, inOrderNs));
+    ReturnErrorOnFailure(MeasureDecode<DecodableType>(reversed, reversedNs));
+    printf("Decode %-44s %3" PRIu32 " bytes: %7.1f ns in tag order, %7.1f ns out of order\n", name, inOrder.length, inOrderNs,
+           reversedNs);
+    return CHIP_NO_ERROR;
+}
+
+void BuildSimpleStruct(TestCluster::Structs::SimpleStruct::Type & value)
+{
+    value.a = 42;
+    value.b = true;
+    value.c = TestCluster::SimpleEnum::kValueB;
+    value.d = ByteSpan(reinterpret_cast<const uint8_t *>("octets"), 6);
+    value.e = CharSpan::fromCharString("characters");
+    value.f.Set(TestCluster::SimpleBitmap::kValueC);
+    value.g = 3.5f;
+    value.h = 0.125;
+}
+
+CHIP_ERROR RunAll()
+{
+    namespace Structs  = TestCluster::Structs;
+    namespace Commands = NetworkCommissioning::Commands;
+
+    Structs::SimpleStruct::Type simpleStruct;
+    BuildSimpleStruct(simpleStruct);
+    ReturnErrorOnFailure((Run<Structs::SimpleStruct::Type, Structs::SimpleStruct::DecodableType>("TestCluster::SimpleStruct",
+                                                                                                  simpleStruct)));
+
+    Structs::NestedStruct::Type nestedStruct;
+    nestedStruct.a = 7;
+    nestedStruct.b = true;
+    BuildSimpleStruct(nestedStruct.c);
+    ReturnErrorOnFailure((Run<Structs::NestedStruct::Type, Structs::NestedStruct::DecodableType>("TestCluster::NestedStruct",
+                                                                                                  nestedStruct)));
+
+    Commands::AddOrUpdateWiFiNetwork::Type addNetwork;
+    addNetwork.ssid        = ByteSpan(reinterpret_cast<const uint8_t *>("network-ssid"), 12);
+    addNetwork.credentials = ByteSpan(reinterpret_cast<const uint8_t *>("network-passphrase"), 18);
+    addNetwork.breadcrumb.Emplace(3);
+    return Run<Commands::AddOrUpdateWiFiNetwork::Type, Commands::AddOrUpdateWiFiNetwork::DecodableType>(
+        "NetworkCommissioning::AddOrUpdateWiFiNetwork", addNetwork);
+}
+
+} // namespace
+
+int main()
+{
+#if CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+    printf("Ordered struct decode: enabled\n");
+#else
+    printf("Ordered struct decode: disabled\n");
+#endif
+
+    CHIP_ERROR err = RunAll();
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to decode: %" CHIP_ERROR_FORMAT "\n", err.Format());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -384,6 +384,39 @@ void TestEncodeListChunking(nlTestSuite * aSuite, void * aContext)
     }
 }
 
+void TestEncodeListItemLengthLimit(nlTestSuite * aSuite, void * aContext)
+{
+    bool list[]      = { true, false, true, false };
+    auto listEncoder = [&list](const auto & encoder) -> CHIP_ERROR {
+        for (auto & item : list)
+        {
+            ReturnErrorOnFailure(encoder.Encode(item));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    {
+        // The limit applies to each AttributeReportIB: the empty list takes 23 bytes and each item 24 bytes, and all of them fit
+        // in the buffer.
+        AttributeValueEncoder::AttributeEncodeState state;
+        state.SetMaxAttributeReportIBLength(24);
+        TestSetup test(aSuite, 0, state);
+        CHIP_ERROR err = test.encoder.EncodeList(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(aSuite, test.writer.GetLengthWritten() == 3 + 23 + 4 * 24);
+    }
+    {
+        // The empty list fits, the first item does not and is rolled back.
+        AttributeValueEncoder::AttributeEncodeState state;
+        state.SetMaxAttributeReportIBLength(23);
+        TestSetup test(aSuite, 0, state);
+        CHIP_ERROR err = test.encoder.EncodeList(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        NL_TEST_ASSERT(aSuite, test.encoder.GetState().AllowPartialData());
+        NL_TEST_ASSERT(aSuite, test.writer.GetLengthWritten() == 3 + 23);
+    }
+}
+
 #undef VERIFY_BUFFER_STATE
 
 } // anonymous namespace
@@ -396,6 +429,7 @@ const nlTest sTests[] = { NL_TEST_DEF("TestEncodeNothing", TestEncodeNothing),
                           NL_TEST_DEF("TestEncodeListOfBools1", TestEncodeListOfBools1),
                           NL_TEST_DEF("TestEncodeListOfBools2", TestEncodeListOfBools2),
                           NL_TEST_DEF("TestEncodeListChunking", TestEncodeListChunking),
+                          NL_TEST_DEF("TestEncodeListItemLengthLimit", TestEncodeListItemLengthLimit),
                           NL_TEST_DEF("TestEncodeFabricScoped", TestEncodeFabricScoped),
                           NL_TEST_SENTINEL() };
 }
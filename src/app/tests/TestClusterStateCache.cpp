@@ -535,11 +535,11 @@ CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
     }
 }
 
-void RunAndValidateSequence(AttributeInstructionListType list)
+void RunAndValidateSequence(ClusterStateCache::StorageMode storageMode, AttributeInstructionListType list)
 {
     ForwardedDataCallbackValidator dataCallbackValidator;
     CacheValidator client(list, dataCallbackValidator);
-    ClusterStateCache cache(client);
+    ClusterStateCache cache(client, Optional<EventNumber>::Missing(), storageMode);
     DataSeriesGenerator generator(&cache.GetBufferedCallback(), list);
     generator.Generate(dataCallbackValidator);
 }
@@ -555,7 +555,7 @@ void RunAndValidateSequence(AttributeInstructionListType list)
  * E1:A1 --- Endpoint 1, Attribute A, Version 1
  *
  */
-void TestCache(nlTestSuite * apSuite, void * apContext)
+void ValidateSequences(ClusterStateCache::StorageMode storageMode)
 {
     ChipLogProgress(DataManagement, "Validating various sequences of attribute data IBs...");
 
@@ -563,61 +563,199 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
     // Validate a range of types and ensure that they can be successfully decoded.
     //
     ChipLogProgress(DataManagement, "E1:A1 --> E1:A1");
-    RunAndValidateSequence({ AttributeInstruction(
+    RunAndValidateSequence(storageMode, { AttributeInstruction(
 
         AttributeInstruction::kAttributeA, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:B1 --> E1:B1");
-    RunAndValidateSequence({ AttributeInstruction(
+    RunAndValidateSequence(storageMode, { AttributeInstruction(
 
         AttributeInstruction::kAttributeB, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:C1 --> E1:C1");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeC, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E1:D1 --> E1:D1");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate that a newer version of a data item over-rides the
     // previous copy.
     //
     ChipLogProgress(DataManagement, "E1:D1 E1:D2 --> E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate that a newer StatusIB over-rides a previous data value.
     //
     ChipLogProgress(DataManagement, "E1:D1 E1:D2s --> E1:D2s");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus) });
 
     //
     // Validate that a newer data value over-rides a previous status value.
     //
     ChipLogProgress(DataManagement, "E1:D1s E1:D2 --> E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     //
     // Validate data across different endpoints.
     //
     ChipLogProgress(DataManagement, "E0:D1 E1:D2 --> E0:D1 E1:D2");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeD, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kData) });
 
     ChipLogProgress(DataManagement, "E0:A1 E0:B2 E0:A3 E0:B4 --> E0:A3 E0:B4");
-    RunAndValidateSequence({ AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+    RunAndValidateSequence(storageMode,
+                           { AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+void TestCache(nlTestSuite * apSuite, void * apContext)
+{
+    ValidateSequences(ClusterStateCache::StorageMode::kPerAttributeBuffers);
+}
+
+void TestCompactCache(nlTestSuite * apSuite, void * apContext)
+{
+    ValidateSequences(ClusterStateCache::StorageMode::kCompact);
+}
+
+//
+// A small bridge-like node: several endpoints, each with a few clusters of small attributes.
+//
+constexpr EndpointId kBridgeEndpointCount   = 3;
+constexpr ClusterId kBridgeClusterCount     = 2;
+constexpr AttributeId kBridgeAttributeCount = 4;
+constexpr size_t kBridgeAttributeTotal      = kBridgeEndpointCount * kBridgeClusterCount * kBridgeAttributeCount;
+
+class NullCallback : public ClusterStateCache::Callback
+{
+    void OnDone() override {}
+};
+
+ConcreteAttributePath BridgeAttributePath(size_t index)
+{
+    return ConcreteAttributePath(static_cast<EndpointId>(index / (kBridgeClusterCount * kBridgeAttributeCount)),
+                                 static_cast<ClusterId>(index / kBridgeAttributeCount % kBridgeClusterCount),
+                                 static_cast<AttributeId>(index % kBridgeAttributeCount));
+}
+
+// Reports every attribute of the bridge: odd attributes as status, the others as an octet string tagged with the round.
+void ReportBridgeAttributes(ReadClient::Callback & callback, uint8_t round)
+{
+    callback.OnReportBegin();
+    for (size_t i = 0; i < kBridgeAttributeTotal; i++)
+    {
+        ConcreteDataAttributePath path(BridgeAttributePath(i));
+        path.mDataVersion.SetValue(round);
+        if (path.mAttributeId % 2 != 0)
+        {
+            callback.OnAttributeData(path, nullptr, StatusIB(Protocols::InteractionModel::Status::UnsupportedAttribute));
+            continue;
+        }
+
+        uint8_t value[16];
+        memset(value, round, sizeof(value));
+        uint8_t buffer[32];
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        NL_TEST_ASSERT(gSuite, writer.Put(TLV::AnonymousTag(), ByteSpan(value)) == CHIP_NO_ERROR);
+
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        NL_TEST_ASSERT(gSuite, reader.Next() == CHIP_NO_ERROR);
+        callback.OnAttributeData(path, &reader, StatusIB());
+    }
+    callback.OnReportEnd();
+}
+
+void ValidateBridgeAttributes(ClusterStateCache & cache, uint8_t round)
+{
+    for (size_t i = 0; i < kBridgeAttributeTotal; i++)
+    {
+        ConcreteAttributePath path = BridgeAttributePath(i);
+        TLV::TLVReader reader;
+        CHIP_ERROR err = cache.Get(path, reader);
+        if (path.mAttributeId % 2 != 0)
+        {
+            StatusIB status;
+            NL_TEST_ASSERT(gSuite, err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED);
+            NL_TEST_ASSERT(gSuite, cache.GetStatus(path, status) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(gSuite, status.mStatus == Protocols::InteractionModel::Status::UnsupportedAttribute);
+            continue;
+        }
+
+        ByteSpan value;
+        NL_TEST_ASSERT(gSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(gSuite, reader.Get(value) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(gSuite, value.size() == 16 && value.data()[0] == round && value.data()[15] == round);
+    }
+
+    size_t clusterCount = 0;
+    NL_TEST_ASSERT(gSuite, cache.ForEachCluster(kBridgeEndpointCount - 1, [&clusterCount](ClusterId clusterId) {
+        clusterCount++;
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(gSuite, clusterCount == kBridgeClusterCount);
+
+    size_t attributeCount = 0;
+    NL_TEST_ASSERT(gSuite, cache.ForEachAttribute(1, 1, [&attributeCount](const ConcreteAttributePath & path) {
+        attributeCount++;
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(gSuite, attributeCount == kBridgeAttributeCount);
+    NL_TEST_ASSERT(gSuite,
+                   cache.ForEachAttribute(kBridgeEndpointCount, 0, [](const ConcreteAttributePath & path) {
+                       return CHIP_NO_ERROR;
+                   }) == CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+/*
+ * Caches the same reports in both storage modes: both return the latest value or status of every attribute, and the
+ * compact mode takes less memory. Overwritten values are dropped from the compact storage, so reporting the same
+ * attributes again does not make it grow past the size it took for the first report.
+ */
+void TestCompactStorage(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr uint8_t kRounds = 10;
+
+    NullCallback callback;
+    ClusterStateCache perAttributeCache(callback, Optional<EventNumber>::Missing(),
+                                        ClusterStateCache::StorageMode::kPerAttributeBuffers);
+    ClusterStateCache compactCache(callback, Optional<EventNumber>::Missing(), ClusterStateCache::StorageMode::kCompact);
+
+    ReportBridgeAttributes(perAttributeCache.GetBufferedCallback(), 1);
+    ReportBridgeAttributes(compactCache.GetBufferedCallback(), 1);
+    ValidateBridgeAttributes(perAttributeCache, 1);
+    ValidateBridgeAttributes(compactCache, 1);
+    NL_TEST_ASSERT(apSuite, compactCache.GetAttributeStorageSize() < perAttributeCache.GetAttributeStorageSize());
+
+    const size_t firstReportSize = compactCache.GetAttributeStorageSize();
+    for (uint8_t round = 2; round <= kRounds; round++)
+    {
+        ReportBridgeAttributes(compactCache.GetBufferedCallback(), round);
+        ValidateBridgeAttributes(compactCache, round);
+    }
+    NL_TEST_ASSERT(apSuite, compactCache.GetAttributeStorageSize() <= firstReportSize);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestCompactCache", TestCompactCache),
+    NL_TEST_DEF("TestCompactStorage", TestCompactStorage),
     NL_TEST_SENTINEL()
 };
 
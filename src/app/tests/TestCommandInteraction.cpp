@@ -22,7 +22,9 @@
  *
  */
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstdio>
 
 #include <app/AppBuildConfig.h>
 #include <app/InteractionModelEngine.h>
@@ -67,6 +69,11 @@ namespace app {
 
 CommandHandler::Handle asyncCommandHandle;
 
+// When set, each dispatched command is only responded to later, through a handle kept here.
+bool asyncBatchedCommands = false;
+CommandHandler::Handle asyncBatchedCommandHandles[2];
+size_t asyncBatchedCommandCount = 0;
+
 InteractionModel::Status ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath)
 {
     // Mock cluster catalog, only support commands on one cluster on one endpoint.
@@ -90,6 +97,20 @@ InteractionModel::Status ServerClusterCommandExists(const ConcreteCommandPath &
     return Status::Success;
 }
 
+// Response data of the commands other than kTestCommandId
+struct MockCommandResponse
+{
+    static constexpr CommandId GetCommandId() { return kTestCommandIdCommandSpecificResponse; }
+
+    CHIP_ERROR Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+    {
+        TLV::TLVType outerContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Structure, outerContainerType));
+        ReturnErrorOnFailure(aWriter.PutBoolean(TLV::ContextTag(1), true));
+        return aWriter.EndContainer(outerContainerType);
+    }
+};
+
 void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip::TLV::TLVReader & aReader,
                                   CommandHandler * apCommandObj)
 {
@@ -102,6 +123,16 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
         asyncCommand       = false;
     }
 
+    if (asyncBatchedCommands)
+    {
+        if (asyncBatchedCommandCount < ArraySize(asyncBatchedCommandHandles))
+        {
+            asyncBatchedCommandHandles[asyncBatchedCommandCount++] = apCommandObj;
+        }
+        chip::isCommandDispatched = true;
+        return;
+    }
+
     if (sendResponse)
     {
         if (aCommandPath.mCommandId == kTestCommandId)
@@ -110,10 +141,7 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
         }
         else
         {
-            apCommandObj->PrepareCommand(aCommandPath);
-            chip::TLV::TLVWriter * writer = apCommandObj->GetCommandDataIBTLVWriter();
-            writer->PutBoolean(chip::TLV::ContextTag(1), true);
-            apCommandObj->FinishCommand();
+            apCommandObj->AddResponseData(aCommandPath, MockCommandResponse());
         }
     }
 
@@ -137,18 +165,36 @@ public:
         ChipLogError(Controller, "OnError happens with %" CHIP_ERROR_FORMAT, aError.Format());
         onErrorCalledTimes++;
     }
+    void OnCommandResponse(chip::app::CommandSender * apCommandSender, uint16_t aCommandRef,
+                           const chip::app::ConcreteCommandPath & aPath, const chip::app::StatusIB & aStatus,
+                           chip::TLV::TLVReader * aData) override
+    {
+        onCommandResponseCalledTimes++;
+        if (aCommandRef < 64)
+        {
+            commandRefsResponded |= (1ull << aCommandRef);
+            commandRefsFailed |= aStatus.IsSuccess() ? 0 : (1ull << aCommandRef);
+        }
+    }
     void OnDone(chip::app::CommandSender * apCommandSender) override { onFinalCalledTimes++; }
 
     void ResetCounter()
     {
-        onResponseCalledTimes = 0;
-        onErrorCalledTimes    = 0;
-        onFinalCalledTimes    = 0;
+        onResponseCalledTimes        = 0;
+        onErrorCalledTimes           = 0;
+        onFinalCalledTimes           = 0;
+        onCommandResponseCalledTimes = 0;
+        commandRefsResponded         = 0;
+        commandRefsFailed            = 0;
     }
 
-    int onResponseCalledTimes = 0;
-    int onErrorCalledTimes    = 0;
-    int onFinalCalledTimes    = 0;
+    int onResponseCalledTimes        = 0;
+    int onErrorCalledTimes           = 0;
+    int onFinalCalledTimes           = 0;
+    int onCommandResponseCalledTimes = 0;
+    // Bit masks of the refs of the batched commands that got a response, and a failure response.
+    uint64_t commandRefsResponded = 0;
+    uint64_t commandRefsFailed    = 0;
 } mockCommandSenderDelegate;
 
 class MockCommandHandlerCallback : public CommandHandler::Callback
@@ -185,6 +231,7 @@ public:
     static void TestCommandHandlerWithProcessReceivedMsg(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerWithProcessReceivedEmptyDataMsg(nlTestSuite * apSuite, void * apContext);
     static void TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerChunkedResponse(nlTestSuite * apSuite, void * apContext);
 
     static void TestCommandSenderCommandSuccessResponseFlow(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderCommandAsyncSuccessResponseFlow(nlTestSuite * apSuite, void * apContext);
@@ -193,6 +240,13 @@ public:
 
     static void TestCommandSenderAbruptDestruction(nlTestSuite * apSuite, void * apContext);
 
+#if CHIP_IM_MAX_PATHS_PER_INVOKE > 1
+    static void TestCommandSenderBatchedCommandsResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderBatchedCommandsChunkedResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderBatchedAsyncCommandsResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderBatchedCommandsLatency(nlTestSuite * apSuite, void * apContext);
+#endif
+
     static size_t GetNumActiveHandlerObjects()
     {
         return chip::app::InteractionModelEngine::GetInstance()->mCommandHandlerObjs.Allocated();
@@ -210,6 +264,7 @@ private:
     static void AddInvokeResponseData(nlTestSuite * apSuite, void * apContext, CommandHandler * apCommandHandler,
                                       bool aNeedStatusCode, CommandId aCommandId = kTestCommandId);
     static void ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode);
+    static size_t CountInvokeResponses(nlTestSuite * apSuite, System::PacketBufferHandle && aPayload, bool aExpectMoreChunks);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -435,8 +490,10 @@ void TestCommandInteraction::TestCommandSenderWithSendCommand(nlTestSuite * apSu
     ctx.DrainAndServiceIO();
 
     GenerateInvokeResponse(apSuite, apContext, buf, true /*aNeedCommandData*/);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::TestCommandHandlerWithSendEmptyCommand(nlTestSuite * apSuite, void * apContext)
@@ -470,8 +527,10 @@ void TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg(nlTestSuite
     System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
 
     GenerateInvokeResponse(apSuite, apContext, buf, true /*aNeedCommandData*/);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode)
@@ -846,7 +905,7 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
 
         commandSender.AllocateBuffer();
 
-        // CommandSender does not support sending multiple commands with public API, so we craft a message manaully.
+        // CommandSender always sends the ref of batched commands with public API, so we craft a message manaully.
         for (int i = 0; i < 2; i++)
         {
             InvokeRequests::Builder & invokeRequests = commandSender.mInvokeRequestBuilder.GetInvokeRequests();
@@ -866,10 +925,8 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
             NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.EndOfCommandDataIB().GetError());
         }
 
-        NL_TEST_ASSERT(apSuite,
-                       CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
-
+        // Commands without a ref cannot be correlated with their responses, so the handler rejects them even when it
+        // supports batched invokes.
         commandSender.MoveToState(app::CommandSender::State::AddedCommand);
     }
 
@@ -888,6 +945,240 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+size_t TestCommandInteraction::CountInvokeResponses(nlTestSuite * apSuite, System::PacketBufferHandle && aPayload,
+                                                    bool aExpectMoreChunks)
+{
+    System::PacketBufferTLVReader reader;
+    InvokeResponseMessage::Parser invokeResponseMessageParser;
+    InvokeResponseIBs::Parser invokeResponses;
+    TLV::TLVReader invokeResponsesReader;
+    bool moreChunkedMessages = false;
+    size_t count             = 0;
+
+    NL_TEST_ASSERT(apSuite, aPayload->DataLength() <= kMaxSecureSduLengthBytes);
+
+    reader.Init(std::move(aPayload));
+    NL_TEST_ASSERT(apSuite, invokeResponseMessageParser.Init(reader) == CHIP_NO_ERROR);
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    NL_TEST_ASSERT(apSuite, invokeResponseMessageParser.CheckSchemaValidity() == CHIP_NO_ERROR);
+#endif
+    CHIP_ERROR err = invokeResponseMessageParser.GetMoreChunkedMessages(&moreChunkedMessages);
+    NL_TEST_ASSERT(apSuite, err == (aExpectMoreChunks ? CHIP_NO_ERROR : CHIP_END_OF_TLV));
+    NL_TEST_ASSERT(apSuite, moreChunkedMessages == aExpectMoreChunks);
+
+    NL_TEST_ASSERT(apSuite, invokeResponseMessageParser.GetInvokeResponses(&invokeResponses) == CHIP_NO_ERROR);
+    invokeResponses.GetReader(&invokeResponsesReader);
+    NL_TEST_ASSERT(apSuite, TLV::Utilities::Count(invokeResponsesReader, count, false /* recurse */) == CHIP_NO_ERROR);
+    return count;
+}
+
+void TestCommandInteraction::TestCommandHandlerChunkedResponse(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    app::CommandHandler commandHandler(&mockCommandHandlerDelegate);
+
+    TestExchangeDelegate delegate;
+    commandHandler.mpExchangeCtx = ctx.NewExchangeToAlice(&delegate);
+
+    // Add responses until one does not fit in the first message.
+    size_t responseCount = 0;
+    while (commandHandler.mChunks.IsNull() && responseCount < 1000)
+    {
+        ConcreteCommandPath path(kTestEndpointId, kTestClusterId, static_cast<CommandId>(responseCount));
+        NL_TEST_ASSERT(apSuite, commandHandler.AddStatus(path, Protocols::InteractionModel::Status::Success) == CHIP_NO_ERROR);
+        responseCount++;
+    }
+    NL_TEST_ASSERT(apSuite, !commandHandler.mChunks.IsNull());
+    NL_TEST_ASSERT(apSuite, commandHandler.mResponsesInMessage == 1);
+
+    System::PacketBufferHandle lastChunk;
+    NL_TEST_ASSERT(apSuite, commandHandler.Finalize(lastChunk) == CHIP_NO_ERROR);
+    System::PacketBufferHandle firstChunk = commandHandler.mChunks.PopHead();
+    NL_TEST_ASSERT(apSuite, commandHandler.mChunks.IsNull());
+
+    size_t firstCount = CountInvokeResponses(apSuite, std::move(firstChunk), /* aExpectMoreChunks = */ true);
+    size_t lastCount  = CountInvokeResponses(apSuite, std::move(lastChunk), /* aExpectMoreChunks = */ false);
+    NL_TEST_ASSERT(apSuite, lastCount == 1);
+    NL_TEST_ASSERT(apSuite, firstCount + lastCount == responseCount);
+}
+
+#if CHIP_IM_MAX_PATHS_PER_INVOKE > 1
+void TestCommandInteraction::TestCommandSenderBatchedCommandsResponseFlow(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+    NL_TEST_ASSERT(apSuite, commandSender.SetMaxCommandsPerRequest(3) == CHIP_NO_ERROR);
+
+    // A status response, a data response and a failure, for refs 0, 1 and 2.
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandId);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdCommandSpecificResponse);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestNonExistCommandId);
+
+    auto commandPathParams = MakeTestCommandPath();
+    NL_TEST_ASSERT(apSuite, commandSender.PrepareCommand(commandPathParams) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(apSuite, commandSender.SetMaxCommandsPerRequest(4) == CHIP_ERROR_INCORRECT_STATE);
+
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onCommandResponseCalledTimes == 3 &&
+                       mockCommandSenderDelegate.commandRefsResponded == 0b111 &&
+                       mockCommandSenderDelegate.commandRefsFailed == 0b100);
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == 0 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onErrorCalledTimes == 0);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandSenderBatchedCommandsChunkedResponseFlow(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    // The responses to that many commands do not fit in a single message, and can only all get to the sender in chunks.
+    constexpr uint16_t kCommandCount = std::min(48, CHIP_IM_MAX_PATHS_PER_INVOKE);
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+    NL_TEST_ASSERT(apSuite, commandSender.SetMaxCommandsPerRequest(kCommandCount) == CHIP_NO_ERROR);
+
+    for (uint16_t i = 0; i < kCommandCount; i++)
+    {
+        // Paths must be unique, and command 0 does not exist.
+        auto commandPathParams = MakeTestCommandPath(static_cast<CommandId>(i + 1));
+        NL_TEST_ASSERT(apSuite, commandSender.PrepareCommand(commandPathParams, /* aStartDataStruct = */ false) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, commandSender.FinishCommand(/* aEndDataStruct = */ false) == CHIP_NO_ERROR);
+    }
+
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onCommandResponseCalledTimes == kCommandCount &&
+                       mockCommandSenderDelegate.commandRefsResponded == ((1ull << kCommandCount) - 1) &&
+                       mockCommandSenderDelegate.commandRefsFailed == 0);
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onFinalCalledTimes == 1 && mockCommandSenderDelegate.onErrorCalledTimes == 0);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandSenderBatchedAsyncCommandsResponseFlow(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+    NL_TEST_ASSERT(apSuite, commandSender.SetMaxCommandsPerRequest(2) == CHIP_NO_ERROR);
+
+    // Two commands of the same cluster, for refs 0 and 1, both handled asynchronously.
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandId);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdCommandSpecificResponse);
+
+    asyncBatchedCommands     = true;
+    asyncBatchedCommandCount = 0;
+    NL_TEST_ASSERT(apSuite, commandSender.SendCommandRequest(ctx.GetSessionBobToAlice()) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    asyncBatchedCommands = false;
+
+    NL_TEST_ASSERT(apSuite, asyncBatchedCommandCount == 2);
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onCommandResponseCalledTimes == 0);
+
+    // The response command of the second command only shares its endpoint and cluster with the first one: its handle tells
+    // which command it responds to.
+    CommandHandler * handler = asyncBatchedCommandHandles[1].Get();
+    NL_TEST_ASSERT(apSuite, handler != nullptr);
+    if (handler != nullptr)
+    {
+        ConcreteCommandPath responsePath = { kTestEndpointId, kTestClusterId, kTestCommandIdCommandSpecificResponse + 1 };
+        NL_TEST_ASSERT(apSuite, handler->PrepareCommand(responsePath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, handler->FinishCommand() == CHIP_NO_ERROR);
+    }
+
+    handler = asyncBatchedCommandHandles[0].Get();
+    NL_TEST_ASSERT(apSuite, handler != nullptr);
+    if (handler != nullptr)
+    {
+        ConcreteCommandPath requestPath = { kTestEndpointId, kTestClusterId, kTestCommandId };
+        NL_TEST_ASSERT(apSuite, handler->AddStatus(requestPath, Protocols::InteractionModel::Status::Failure) == CHIP_NO_ERROR);
+    }
+
+    asyncBatchedCommandHandles[1] = nullptr;
+    asyncBatchedCommandHandles[0] = nullptr;
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onCommandResponseCalledTimes == 2 &&
+                       mockCommandSenderDelegate.commandRefsResponded == 0b11 &&
+                       mockCommandSenderDelegate.commandRefsFailed == 0b01);
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onFinalCalledTimes == 1 && mockCommandSenderDelegate.onErrorCalledTimes == 0);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandSenderBatchedCommandsLatency(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    constexpr uint16_t kCommandCount = std::min(16, CHIP_IM_MAX_PATHS_PER_INVOKE);
+
+    // One round trip per command.
+    mockCommandSenderDelegate.ResetCounter();
+    uint32_t messageCount = ctx.GetLoopback().mSentMessageCount;
+    auto start            = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint16_t i = 0; i < kCommandCount; i++)
+    {
+        app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+        AddInvokeRequestData(apSuite, apContext, &commandSender, static_cast<CommandId>(i + 1));
+        NL_TEST_ASSERT(apSuite, commandSender.SendCommandRequest(ctx.GetSessionBobToAlice()) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+    }
+    const uint64_t sequentialUs       = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+    const uint32_t sequentialMessages = ctx.GetLoopback().mSentMessageCount - messageCount;
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == kCommandCount &&
+                       mockCommandSenderDelegate.onFinalCalledTimes == kCommandCount);
+
+    // A single round trip for all of them.
+    mockCommandSenderDelegate.ResetCounter();
+    messageCount = ctx.GetLoopback().mSentMessageCount;
+    start        = System::SystemClock().GetMonotonicMicroseconds64();
+    {
+        app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+        NL_TEST_ASSERT(apSuite, commandSender.SetMaxCommandsPerRequest(kCommandCount) == CHIP_NO_ERROR);
+        for (uint16_t i = 0; i < kCommandCount; i++)
+        {
+            AddInvokeRequestData(apSuite, apContext, &commandSender, static_cast<CommandId>(i + 1));
+        }
+        NL_TEST_ASSERT(apSuite, commandSender.SendCommandRequest(ctx.GetSessionBobToAlice()) == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+    }
+    const uint64_t batchedUs       = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+    const uint32_t batchedMessages = ctx.GetLoopback().mSentMessageCount - messageCount;
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onCommandResponseCalledTimes == kCommandCount &&
+                       mockCommandSenderDelegate.onFinalCalledTimes == 1);
+
+    NL_TEST_ASSERT(apSuite, batchedMessages < sequentialMessages);
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+
+    printf("%u commands: %" PRIu64 " us in %" PRIu32 " messages one by one, %" PRIu64 " us in %" PRIu32 " messages batched\n",
+           kCommandCount, sequentialUs, sequentialMessages, batchedUs, batchedMessages);
+}
+#endif // CHIP_IM_MAX_PATHS_PER_INVOKE > 1
+
 } // namespace app
 } // namespace chip
 
@@ -909,11 +1200,18 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedNotExistCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistCommand),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedEmptyDataMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg),
     NL_TEST_DEF("TestCommandHandlerRejectMultipleCommands", chip::app::TestCommandInteraction::TestCommandHandlerRejectMultipleCommands),
+    NL_TEST_DEF("TestCommandHandlerChunkedResponse", chip::app::TestCommandInteraction::TestCommandHandlerChunkedResponse),
 
     NL_TEST_DEF("TestCommandSenderCommandSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandAsyncSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandAsyncSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandSpecificResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandFailureResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow),
+#if CHIP_IM_MAX_PATHS_PER_INVOKE > 1
+    NL_TEST_DEF("TestCommandSenderBatchedCommandsResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderBatchedCommandsResponseFlow),
+    NL_TEST_DEF("TestCommandSenderBatchedCommandsChunkedResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderBatchedCommandsChunkedResponseFlow),
+    NL_TEST_DEF("TestCommandSenderBatchedAsyncCommandsResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderBatchedAsyncCommandsResponseFlow),
+    NL_TEST_DEF("TestCommandSenderBatchedCommandsLatency", chip::app::TestCommandInteraction::TestCommandSenderBatchedCommandsLatency),
+#endif
     NL_TEST_DEF("TestCommandSenderAbruptDestruction", chip::app::TestCommandInteraction::TestCommandSenderAbruptDestruction),
     NL_TEST_SENTINEL()
 };
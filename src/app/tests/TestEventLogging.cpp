@@ -184,6 +184,19 @@ private:
     int32_t mStatus;
 };
 
+class FailingEventGenerator : public chip::app::EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(chip::TLV::TLVWriter & aWriter)
+    {
+        chip::TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(chip::TLV::ContextTag(chip::to_underlying(chip::app::EventDataIB::Tag::kData)),
+                                                    chip::TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(kLivenessDeviceStatus, static_cast<int32_t>(0)));
+        return CHIP_ERROR_INTERNAL;
+    }
+};
+
 static void CheckLogEventWithEvictToNextBuffer(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -307,12 +320,55 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+
+static void CheckLogEventFailureKeepsLog(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    chip::EventNumber eid1, eid2, eid3;
+    size_t numEvents;
+    chip::TLV::TLVReader reader;
+    chip::app::CircularEventBufferWrapper bufWrapper;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Info;
+    TestEventGenerator testEventGenerator;
+    FailingEventGenerator failingEventGenerator;
+    chip::app::ObjectList<chip::app::EventPathParams> wildcardPath;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    testEventGenerator.SetStatus(0);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    err = logMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = chip::TLV::Utilities::Count(reader, numEvents, false);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The partially written event is rolled back, and nothing is evicted for it
+    err = logMgmt.LogEvent(&failingEventGenerator, options, eid2);
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INTERNAL);
+    NL_TEST_ASSERT(apSuite, eid2 == 0);
+    CheckLogState(apSuite, logMgmt, numEvents, chip::app::PriorityLevel::Critical);
+
+    testEventGenerator.SetStatus(1);
+    err = logMgmt.LogEvent(&testEventGenerator, options, eid3);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, (eid1 + 1) == eid3);
+
+    // Fetching from the newest events skips the older ones held by the buffers of higher priority
+    CheckLogReadOut(apSuite, logMgmt, eid1, 2, &wildcardPath);
+    CheckLogReadOut(apSuite, logMgmt, eid3, 1, &wildcardPath);
+    CheckLogReadOut(apSuite, logMgmt, eid3 + 1, 0, &wildcardPath);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckLogEventFailureKeepsLog", CheckLogEventFailureKeepsLog), NL_TEST_SENTINEL() };
 
 // clang-format off
 nlTestSuite sSuite =
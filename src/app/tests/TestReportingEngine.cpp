@@ -37,6 +37,10 @@
 
 #include <nlunit-test.h>
 
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
 using TestContext = chip::Test::AppContext;
 
 namespace chip {
@@ -52,7 +56,8 @@ class TestReportingEngine
 {
 public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
-    static void TestMergeOverlappedAttributePath(nlTestSuite * apSuite, void * apContext);
+    static void TestDirtyPathStore(nlTestSuite * apSuite, void * apContext);
+    static void TestDirtyPathStoreStress(nlTestSuite * apSuite, void * apContext);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -114,66 +119,180 @@ void TestReportingEngine::TestBuildAndSendSingleReportData(nlTestSuite * apSuite
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 }
 
-void TestReportingEngine::TestMergeOverlappedAttributePath(nlTestSuite * apSuite, void * apContext)
+void TestReportingEngine::TestDirtyPathStore(nlTestSuite * apSuite, void * apContext)
 {
-    TestContext & ctx = *static_cast<TestContext *>(apContext);
-    CHIP_ERROR err    = CHIP_NO_ERROR;
-    err               = InteractionModelEngine::GetInstance()->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable());
-    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    DirtyPathStore store;
+    NL_TEST_ASSERT(apSuite, store.IsEmpty());
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    store.Insert(AttributePathParams(1, 1, 1), 2);
+    NL_TEST_ASSERT(apSuite, store.IsDirty(ConcreteAttributePath(1, 1, 1), 1));
+    NL_TEST_ASSERT(apSuite, !store.IsDirty(ConcreteAttributePath(1, 1, 1), 2));
+    NL_TEST_ASSERT(apSuite, !store.IsDirty(ConcreteAttributePath(1, 1, 3), 1));
 
+    // List indices are merged into the attribute.
+    store.Insert(AttributePathParams(1, 1, 1, 2), 3);
+    NL_TEST_ASSERT(apSuite, store.AttributePathCount() == 1);
+    NL_TEST_ASSERT(apSuite, store.IsDirty(ConcreteAttributePath(1, 1, 1), 2));
+
+    // Wildcard attribute: the whole cluster is dirty.
+    store.Insert(AttributePathParams(1, 1, kInvalidAttributeId), 4);
+    NL_TEST_ASSERT(apSuite, store.IsDirty(ConcreteAttributePath(1, 1, 3), 3));
+    NL_TEST_ASSERT(apSuite, !store.IsDirty(ConcreteAttributePath(1, 2, 3), 0));
+    NL_TEST_ASSERT(apSuite, store.Intersects(AttributePathParams(1, 1, 5), 3));
+    NL_TEST_ASSERT(apSuite, !store.Intersects(AttributePathParams(1, 1, 5), 4));
+    NL_TEST_ASSERT(apSuite, store.Intersects(AttributePathParams(kInvalidEndpointId, 1, 1), 3));
+    NL_TEST_ASSERT(apSuite, !store.Intersects(AttributePathParams(kInvalidEndpointId, 2, kInvalidAttributeId), 0));
+    NL_TEST_ASSERT(apSuite, store.ClusterCount() == 1);
+
+    // Wildcard endpoint and cluster: a new path replaces the ones it covers.
+    store.Insert(AttributePathParams(2, kInvalidClusterId, kInvalidAttributeId), 5);
+    NL_TEST_ASSERT(apSuite, store.IsDirty(ConcreteAttributePath(2, 8, 9), 4));
+    NL_TEST_ASSERT(apSuite, !store.IsDirty(ConcreteAttributePath(3, 8, 9), 4));
+    NL_TEST_ASSERT(apSuite, store.Intersects(AttributePathParams(kInvalidEndpointId, 8, 9), 4));
+    store.Insert(AttributePathParams(kInvalidEndpointId, kInvalidClusterId, kInvalidAttributeId), 6);
+    NL_TEST_ASSERT(apSuite, store.IsDirty(ConcreteAttributePath(7, 8, 9), 5));
+    NL_TEST_ASSERT(apSuite, !store.IsDirty(ConcreteAttributePath(7, 8, 9), 6));
+    store.Insert(AttributePathParams(2, kInvalidClusterId, kInvalidAttributeId), 7);
+    NL_TEST_ASSERT(apSuite, store.IsDirty(ConcreteAttributePath(7, 8, 9), 6));
+
+    store.Clear();
+    NL_TEST_ASSERT(apSuite, store.IsEmpty());
+    NL_TEST_ASSERT(apSuite, !store.IsDirty(ConcreteAttributePath(1, 1, 1), 0));
+    NL_TEST_ASSERT(apSuite, !store.Intersects(AttributePathParams(kInvalidEndpointId, kInvalidClusterId, kInvalidAttributeId), 0));
+}
+
+namespace {
+
+// Number of distinct concrete paths RandomPath() returns. Host platforms track that many attributes individually; smaller
+// configurations degrade to cluster granularity, which may report more paths dirty but never fewer.
+constexpr uint32_t kStressAttributePaths = 32 * 8 * 16;
+constexpr bool kStressPathsTracked       = CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS >= kStressAttributePaths;
+
+struct ReferenceDirtyPath
+{
+    AttributePathParams mPath;
+    uint64_t mGeneration;
+};
+
+bool ReferenceOverlaps(const AttributePathParams & aPath1, const AttributePathParams & aPath2)
+{
+    return (aPath1.HasWildcardEndpointId() || aPath2.HasWildcardEndpointId() || aPath1.mEndpointId == aPath2.mEndpointId) &&
+        (aPath1.HasWildcardClusterId() || aPath2.HasWildcardClusterId() || aPath1.mClusterId == aPath2.mClusterId) &&
+        (aPath1.HasWildcardAttributeId() || aPath2.HasWildcardAttributeId() || aPath1.mAttributeId == aPath2.mAttributeId);
+}
+
+AttributePathParams RandomPath(bool aAllowWildcards)
+{
+    // At most kStressAttributePaths distinct attributes.
+    AttributePathParams path(static_cast<EndpointId>(std::rand() % 32), static_cast<ClusterId>(std::rand() % 8),
+                             static_cast<AttributeId>(std::rand() % 16));
+    if (aAllowWildcards)
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 3;
-        NL_TEST_ASSERT(apSuite,
-                       !InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-    }
-    {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = 1;
-        testClusterInfo.mListIndex   = 2;
-        NL_TEST_ASSERT(apSuite,
-                       InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        switch (std::rand() % 8)
+        {
+        case 0:
+            path.mEndpointId = kInvalidEndpointId;
+            break;
+        case 1:
+            path.mClusterId = kInvalidClusterId;
+            break;
+        case 2:
+            path.mAttributeId = kInvalidAttributeId;
+            break;
+        default:
+            break;
+        }
     }
+    return path;
+}
+
+} // namespace
+
+void TestReportingEngine::TestDirtyPathStoreStress(nlTestSuite * apSuite, void * apContext)
+{
+    // Thousands of dirty paths from bursty updates, checked against a linear list of everything that was marked dirty (the
+    // former global dirty set without its size limit).
+    constexpr int kDirtyPaths = 5000;
+    constexpr int kQueries    = 20000;
+
+    DirtyPathStore store;
+    std::vector<ReferenceDirtyPath> reference;
+    uint64_t generation = 1;
 
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kDirtyPaths; i++)
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = 1;
-        testClusterInfo.mClusterId   = 1;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        NL_TEST_ASSERT(apSuite,
-                       InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
+        // Wildcard endpoint or cluster paths are few and far between.
+        AttributePathParams path = RandomPath(false);
+        if (i % 1000 == 0)
+        {
+            path.mEndpointId = kInvalidEndpointId;
+        }
+        else if (i % 50 == 0)
+        {
+            path.mAttributeId = kInvalidAttributeId;
+        }
+        generation++;
+        store.Insert(path, generation);
+        reference.push_back({ path, generation });
     }
+    auto inserted = std::chrono::steady_clock::now();
 
+    NL_TEST_ASSERT(apSuite, !kStressPathsTracked || store.AttributePathCount() > 1000);
+
+    int mismatches = 0;
+    for (int i = 0; i < kQueries; i++)
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        NL_TEST_ASSERT(apSuite,
-                       InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        NL_TEST_ASSERT(apSuite, clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
+        uint64_t since           = 1 + static_cast<uint64_t>(std::rand()) % generation;
+        AttributePathParams path = RandomPath(i % 2 == 0);
+
+        bool expected = false;
+        for (const auto & dirty : reference)
+        {
+            if (dirty.mGeneration > since && ReferenceOverlaps(dirty.mPath, path))
+            {
+                expected = true;
+                break;
+            }
+        }
+
+        bool intersects = store.Intersects(path, since);
+        bool isDirty    = intersects;
+        if (!path.IsWildcardPath())
+        {
+            isDirty = store.IsDirty(ConcreteAttributePath(path.mEndpointId, path.mClusterId, path.mAttributeId), since);
+        }
+
+        if (kStressPathsTracked)
+        {
+            mismatches += (isDirty != expected || intersects != expected) ? 1 : 0;
+        }
+        else
+        {
+            mismatches += (expected && (!isDirty || !intersects)) ? 1 : 0;
+        }
     }
+    NL_TEST_ASSERT(apSuite, mismatches == 0);
 
+    // Time the lookups done while building reports, separately from the reference checks above.
+    uint32_t dirtyCount = 0;
+    auto lookupStart    = std::chrono::steady_clock::now();
+    for (int i = 0; i < kQueries; i++)
     {
-        AttributePathParams testClusterInfo;
-        testClusterInfo.mEndpointId  = kInvalidEndpointId;
-        testClusterInfo.mClusterId   = kInvalidClusterId;
-        testClusterInfo.mAttributeId = kInvalidAttributeId;
-        NL_TEST_ASSERT(apSuite,
-                       InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        NL_TEST_ASSERT(apSuite,
-                       clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                           clusterInfo->mAttributeId == kInvalidAttributeId);
+        ConcreteAttributePath path(static_cast<EndpointId>(i % 32), static_cast<ClusterId>(i % 8),
+                                   static_cast<AttributeId>(i % 16));
+        dirtyCount += store.IsDirty(path, generation / 2) ? 1 : 0;
     }
-    InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
+    auto lookupEnd = std::chrono::steady_clock::now();
+
+    printf("%d dirty paths (%u attributes, %u clusters): insert %.1f ns/path, IsDirty %.1f ns/lookup, %u dirty\n", kDirtyPaths,
+           static_cast<unsigned>(store.AttributePathCount()), static_cast<unsigned>(store.ClusterCount()),
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(inserted - start).count()) / kDirtyPaths,
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(lookupEnd - lookupStart).count()) / kQueries,
+           dirtyCount);
+
+    store.Clear();
+    NL_TEST_ASSERT(apSuite, store.IsEmpty() && store.AttributePathCount() == 0);
 }
 
 } // namespace reporting
@@ -185,7 +304,8 @@ namespace {
 const nlTest sTests[] =
 {
     NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
-    NL_TEST_DEF("TestMergeOverlappedAttributePath", chip::app::reporting::TestReportingEngine::TestMergeOverlappedAttributePath),
+    NL_TEST_DEF("TestDirtyPathStore", chip::app::reporting::TestReportingEngine::TestDirtyPathStore),
+    NL_TEST_DEF("TestDirtyPathStoreStress", chip::app::reporting::TestReportingEngine::TestDirtyPathStoreStress),
     NL_TEST_SENTINEL()
 };
 // clang-format on
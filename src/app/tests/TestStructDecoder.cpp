@@ -0,0 +1,278 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the decoding of cluster objects
+ *      whose fields are not in tag order.
+ *
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+constexpr size_t kMaxFields = 16;
+
+struct EncodedObject
+{
+    uint8_t buffer[512];
+    uint32_t length = 0;
+};
+
+template <typename T>
+CHIP_ERROR EncodeObject(const T & object, EncodedObject & encoded)
+{
+    TLV::TLVWriter writer;
+    writer.Init(encoded.buffer);
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::AnonymousTag(), object));
+    ReturnErrorOnFailure(writer.Finalize());
+    encoded.length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+// Rewrites the fields of an encoded object in the given order: order[i] is the index of the field to write at position i.
+CHIP_ERROR ReorderFields(const EncodedObject & in, const size_t * order, size_t orderLength, EncodedObject & out)
+{
+    TLV::TLVReader fields[kMaxFields];
+    size_t fieldCount = 0;
+
+    TLV::TLVReader reader;
+    TLV::TLVType outer;
+    reader.Init(in.buffer, in.length);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(fieldCount < kMaxFields, CHIP_ERROR_NO_MEMORY);
+        fields[fieldCount++].Init(reader);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    VerifyOrReturnError(orderLength == fieldCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    TLV::TLVWriter writer;
+    TLV::TLVType writerOuter;
+    writer.Init(out.buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, writerOuter));
+    for (size_t i = 0; i < orderLength; i++)
+    {
+        ReturnErrorOnFailure(writer.CopyElement(fields[order[i]]));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(writerOuter));
+    ReturnErrorOnFailure(writer.Finalize());
+    out.length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReverseFields(const EncodedObject & in, size_t fieldCount, EncodedObject & out)
+{
+    size_t order[kMaxFields];
+    VerifyOrReturnError(fieldCount <= kMaxFields, CHIP_ERROR_INVALID_ARGUMENT);
+    for (size_t i = 0; i < fieldCount; i++)
+    {
+        order[i] = fieldCount - 1 - i;
+    }
+    return ReorderFields(in, order, fieldCount, out);
+}
+
+template <typename T>
+CHIP_ERROR DecodeObject(const EncodedObject & encoded, T & object)
+{
+    TLV::TLVReader reader;
+    reader.Init(encoded.buffer, encoded.length);
+    ReturnErrorOnFailure(reader.Next());
+    return DataModel::Decode(reader, object);
+}
+
+void BuildSimpleStruct(TestCluster::Structs::SimpleStruct::Type & value)
+{
+    value.a = 42;
+    value.b = true;
+    value.c = TestCluster::SimpleEnum::kValueB;
+    value.d = ByteSpan(reinterpret_cast<const uint8_t *>("octets"), 6);
+    value.e = CharSpan::fromCharString("characters");
+    value.f.Set(TestCluster::SimpleBitmap::kValueC);
+    value.g = 3.5f;
+    value.h = 0.125;
+}
+
+bool IsSimpleStructDecoded(const TestCluster::Structs::SimpleStruct::DecodableType & value)
+{
+    return value.a == 42 && value.b && value.c == TestCluster::SimpleEnum::kValueB &&
+        value.d.data_equal(ByteSpan(reinterpret_cast<const uint8_t *>("octets"), 6)) &&
+        value.e.data_equal(CharSpan::fromCharString("characters")) && value.f.Has(TestCluster::SimpleBitmap::kValueC) &&
+        value.g == 3.5f && value.h == 0.125;
+}
+
+void TestDecodeReorderedFields(nlTestSuite * apSuite, void * apContext)
+{
+    TestCluster::Structs::SimpleStruct::Type value;
+    BuildSimpleStruct(value);
+
+    EncodedObject inOrder, reordered;
+    NL_TEST_ASSERT(apSuite, EncodeObject(value, inOrder) == CHIP_NO_ERROR);
+
+    const size_t orders[][8] = {
+        { 0, 1, 2, 3, 4, 5, 6, 7 }, { 7, 6, 5, 4, 3, 2, 1, 0 }, { 3, 4, 5, 6, 7, 0, 1, 2 },
+        { 0, 2, 1, 3, 5, 4, 7, 6 }, { 1, 0, 2, 3, 4, 5, 6, 7 }, { 0, 1, 2, 3, 4, 5, 7, 6 },
+    };
+    for (const auto & order : orders)
+    {
+        NL_TEST_ASSERT(apSuite, ReorderFields(inOrder, order, ArraySize(order), reordered) == CHIP_NO_ERROR);
+
+        TestCluster::Structs::SimpleStruct::DecodableType decoded;
+        NL_TEST_ASSERT(apSuite, DecodeObject(reordered, decoded) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, IsSimpleStructDecoded(decoded));
+    }
+}
+
+void TestDecodeMissingFields(nlTestSuite * apSuite, void * apContext)
+{
+    TestCluster::Structs::NullablesAndOptionalsStruct::Type value;
+    value.nullableInt.SetNonNull(static_cast<uint16_t>(5));
+    value.nullableString.SetNull();
+    value.optionalString.Emplace(CharSpan::fromCharString("present"));
+    value.nullableStruct.SetNull();
+    value.nullableList.SetNull();
+    value.nullableOptionalList.Emplace().SetNull();
+
+    EncodedObject inOrder, reversed;
+    NL_TEST_ASSERT(apSuite, EncodeObject(value, inOrder) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, ReverseFields(inOrder, 6, reversed) == CHIP_NO_ERROR);
+
+    for (const EncodedObject * encoded : { &inOrder, &reversed })
+    {
+        TestCluster::Structs::NullablesAndOptionalsStruct::DecodableType decoded;
+        NL_TEST_ASSERT(apSuite, DecodeObject(*encoded, decoded) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, !decoded.nullableInt.IsNull() && decoded.nullableInt.Value() == 5);
+        NL_TEST_ASSERT(apSuite, !decoded.optionalInt.HasValue());
+        NL_TEST_ASSERT(apSuite, !decoded.nullableOptionalInt.HasValue());
+        NL_TEST_ASSERT(apSuite, decoded.nullableString.IsNull());
+        NL_TEST_ASSERT(apSuite,
+                       decoded.optionalString.HasValue() &&
+                           decoded.optionalString.Value().data_equal(CharSpan::fromCharString("present")));
+        NL_TEST_ASSERT(apSuite, !decoded.nullableOptionalString.HasValue());
+        NL_TEST_ASSERT(apSuite, decoded.nullableStruct.IsNull());
+        NL_TEST_ASSERT(apSuite, !decoded.optionalStruct.HasValue());
+        NL_TEST_ASSERT(apSuite, decoded.nullableList.IsNull());
+        NL_TEST_ASSERT(apSuite, !decoded.optionalList.HasValue());
+        NL_TEST_ASSERT(apSuite, decoded.nullableOptionalList.HasValue() && decoded.nullableOptionalList.Value().IsNull());
+    }
+}
+
+void TestDecodeRepeatedAndUnknownFields(nlTestSuite * apSuite, void * apContext)
+{
+    EncodedObject encoded;
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    writer.Init(encoded.buffer);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(0), static_cast<uint8_t>(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.PutBoolean(TLV::ContextTag(1), true) == CHIP_NO_ERROR);
+    // Elements that are not fields: skipped.
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ProfileTag(0x1234, 2), static_cast<uint8_t>(9)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.PutString(TLV::ContextTag(200), "unknown") == CHIP_NO_ERROR);
+    // A field repeated: the last value wins.
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(0), static_cast<uint8_t>(2)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(7), 0.5) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+    encoded.length = writer.GetLengthWritten();
+
+    TestCluster::Structs::SimpleStruct::DecodableType decoded;
+    NL_TEST_ASSERT(apSuite, DecodeObject(encoded, decoded) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, decoded.a == 2);
+    NL_TEST_ASSERT(apSuite, decoded.b);
+    NL_TEST_ASSERT(apSuite, decoded.h == 0.5);
+    NL_TEST_ASSERT(apSuite, decoded.e.empty());
+}
+
+void TestDecodeInvalidField(nlTestSuite * apSuite, void * apContext)
+{
+    TestCluster::Structs::SimpleStruct::Type value;
+    BuildSimpleStruct(value);
+
+    // Field d encoded as a string instead of an octet string.
+    EncodedObject encoded, reversed;
+    TLV::TLVWriter writer;
+    TLV::TLVType outer;
+    writer.Init(encoded.buffer);
+    NL_TEST_ASSERT(apSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Put(TLV::ContextTag(0), static_cast<uint8_t>(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.PutString(TLV::ContextTag(3), "not octets") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.PutBoolean(TLV::ContextTag(1), true) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.EndContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize() == CHIP_NO_ERROR);
+    encoded.length = writer.GetLengthWritten();
+    NL_TEST_ASSERT(apSuite, ReverseFields(encoded, 3, reversed) == CHIP_NO_ERROR);
+
+    for (const EncodedObject * object : { &encoded, &reversed })
+    {
+        TestCluster::Structs::SimpleStruct::DecodableType decoded;
+        NL_TEST_ASSERT(apSuite, DecodeObject(*object, decoded) != CHIP_NO_ERROR);
+    }
+
+    // Not a structure.
+    NL_TEST_ASSERT(apSuite, EncodeObject(static_cast<uint8_t>(1), encoded) == CHIP_NO_ERROR);
+    TestCluster::Structs::SimpleStruct::DecodableType decoded;
+    NL_TEST_ASSERT(apSuite, DecodeObject(encoded, decoded) == CHIP_ERROR_WRONG_TLV_TYPE);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestDecodeReorderedFields", TestDecodeReorderedFields),
+    NL_TEST_DEF("TestDecodeMissingFields", TestDecodeMissingFields),
+    NL_TEST_DEF("TestDecodeRepeatedAndUnknownFields", TestDecodeRepeatedAndUnknownFields),
+    NL_TEST_DEF("TestDecodeInvalidField", TestDecodeInvalidField),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestStructDecoder()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "TestStructDecoder",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestStructDecoder)
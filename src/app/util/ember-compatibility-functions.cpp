@@ -22,6 +22,7 @@
  */
 
 #include <access/AccessControl.h>
+#include <app/AppBuildConfig.h>
 #include <app/CommandHandlerInterface.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/GlobalAttributes.h>
@@ -40,8 +41,10 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/MpscQueue.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/TypeTraits.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <platform/LockTracker.h>
 #include <protocols/interaction_model/Constants.h>
 
@@ -50,6 +53,8 @@
 
 #include <zap-generated/endpoint_config.h>
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 
 using namespace chip;
@@ -586,6 +591,7 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, b
 
     TLV::TLVWriter backup;
     aAttributeReports.Checkpoint(backup);
+    const uint32_t startLength = aAttributeReports.GetWriter()->GetLengthWritten();
 
     AttributeReportIB::Builder & attributeReport = aAttributeReports.CreateAttributeReport();
     ReturnErrorOnFailure(aAttributeReports.GetError());
@@ -818,7 +824,12 @@ CHIP_ERROR ReadSingleClusterData(const SubjectDescriptor & aSubjectDescriptor, b
     Protocols::InteractionModel::Status imStatus = ToInteractionModelStatus(emberStatus);
     if (imStatus == Protocols::InteractionModel::Status::Success)
     {
-        return SendSuccessStatus(attributeReport, attributeDataIBBuilder);
+        ReturnErrorOnFailure(SendSuccessStatus(attributeReport, attributeDataIBBuilder));
+        // The AttributeReportIB is subject to the same length limit as those encoded by an AttributeValueEncoder.
+        const uint32_t maxLength = (apEncoderState == nullptr) ? UINT32_MAX : apEncoderState->GetMaxAttributeReportIBLength();
+        VerifyOrReturnError(aAttributeReports.GetWriter()->GetLengthWritten() - startLength <= maxLength,
+                            CHIP_ERROR_BUFFER_TOO_SMALL);
+        return CHIP_NO_ERROR;
     }
 
     return SendFailureStatus(aPath, aAttributeReports, imStatus, &backup);
@@ -1086,6 +1097,21 @@ void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clust
     MatterReportingAttributeChangeCallback(endpoint, clusterId, attributeId);
 }
 
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0
+namespace {
+
+MpscQueue<ConcreteAttributePath, CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE> sQueuedAttributeChanges;
+// Whether MatterReportingProcessQueuedAttributeChanges is scheduled to run and pick up newly queued changes.
+std::atomic<bool> sQueuedAttributeChangesScheduled{ false };
+
+void ProcessQueuedAttributeChanges(intptr_t)
+{
+    MatterReportingProcessQueuedAttributeChanges();
+}
+
+} // namespace
+#endif // CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0
+
 void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
 {
     // Attribute writes have asserted this already, but this assert should catch
@@ -1106,6 +1132,75 @@ void MatterReportingAttributeChangeCallback(const ConcreteAttributePath & aPath)
     return MatterReportingAttributeChangeCallback(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
 }
 
+CHIP_ERROR MatterReportingAttributeChangeCallbackFromAnyThread(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId)
+{
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0
+    VerifyOrReturnError(sQueuedAttributeChanges.Push(ConcreteAttributePath(endpoint, clusterId, attributeId)),
+                        CHIP_ERROR_NO_MEMORY);
+
+    // Only the first change queued since the last pass over the queue needs to schedule another one.
+    if (!sQueuedAttributeChangesScheduled.exchange(true))
+    {
+#if !CONFIG_IM_BUILD_FOR_UNIT_TEST
+        // Unit tests do not run the CHIP event loop, they call MatterReportingProcessQueuedAttributeChanges themselves.
+        DeviceLayer::PlatformMgr().ScheduleWork(ProcessQueuedAttributeChanges);
+#endif
+    }
+    return CHIP_NO_ERROR;
+#else
+    IgnoreUnusedVariable(endpoint);
+    IgnoreUnusedVariable(clusterId);
+    IgnoreUnusedVariable(attributeId);
+    return CHIP_ERROR_NO_MEMORY;
+#endif // CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0
+}
+
+void MatterReportingProcessQueuedAttributeChanges()
+{
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0
+    assertChipStackLockedByCurrentThread();
+
+    // Changes queued from now on may be missed by this pass, so they schedule another one.
+    sQueuedAttributeChangesScheduled = false;
+
+    // Devices tend to update the same attributes over and over: sort the changes by batches, to increase the data version of each
+    // cluster and mark each attribute dirty once per batch.
+    constexpr size_t kBatchSize = 32;
+    ConcreteAttributePath batch[kBatchSize];
+    size_t count;
+    do
+    {
+        for (count = 0; count < kBatchSize && sQueuedAttributeChanges.Pop(batch[count]); count++)
+        {
+        }
+        std::sort(batch, batch + count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const ConcreteAttributePath & path = batch[i];
+            bool sameCluster =
+                (i > 0) && (path.mEndpointId == batch[i - 1].mEndpointId) && (path.mClusterId == batch[i - 1].mClusterId);
+
+            if (!sameCluster)
+            {
+                IncreaseClusterDataVersion(path);
+            }
+            else if (path.mAttributeId == batch[i - 1].mAttributeId)
+            {
+                continue;
+            }
+
+            AttributePathParams info;
+            info.mClusterId   = path.mClusterId;
+            info.mAttributeId = path.mAttributeId;
+            info.mEndpointId  = path.mEndpointId;
+
+            InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(info);
+        }
+    } while (count == kBatchSize);
+#endif // CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0
+}
+
 void MatterReportingAttributeChangeCallback(EndpointId endpoint)
 {
     // Attribute writes have asserted this already, but this assert should catch
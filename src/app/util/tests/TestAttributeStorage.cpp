@@ -0,0 +1,242 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Tests the endpoint bookkeeping of the ember attribute storage, built against the temperature-measurement-app endpoint
+ *      configuration with room for two dynamic endpoints.
+ */
+
+#include <app-common/zap-generated/attribute-id.h>
+#include <app-common/zap-generated/cluster-id.h>
+#include <app/reporting/reporting.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <string.h>
+
+using namespace chip;
+
+static_assert(CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT == 2, "The dynamic endpoint tests fill every dynamic endpoint slot");
+
+// The suite links the attribute storage without the rest of the data model: these are the parts of it the storage and
+// the temperature-measurement-app endpoint configuration call into.
+void MatterReportingAttributeChangeCallback(EndpointId endpoint) {}
+void MatterReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId) {}
+void emberAfSetDeviceEnabled(EndpointId endpoint, bool enabled) {}
+EmberStatus emberAfDeactivateClusterTick(EndpointId endpoint, ClusterId clusterId, bool isClient)
+{
+    return EMBER_SUCCESS;
+}
+
+// The tests only touch fixed size attributes.
+uint8_t emberAfStringLength(const uint8_t * buffer)
+{
+    return 0;
+}
+uint16_t emberAfLongStringLength(const uint8_t * buffer)
+{
+    return 0;
+}
+void emberAfCopyString(uint8_t * dest, const uint8_t * src, size_t size) {}
+void emberAfCopyLongString(uint8_t * dest, const uint8_t * src, size_t size) {}
+
+void emberAfBasicClusterServerInitCallback(EndpointId endpoint) {}
+void emberAfLocalizationConfigurationClusterServerInitCallback(EndpointId endpoint) {}
+void emberAfTimeFormatLocalizationClusterServerInitCallback(EndpointId endpoint) {}
+Protocols::InteractionModel::Status
+MatterLocalizationConfigurationClusterServerPreAttributeChangedCallback(const app::ConcreteAttributePath & attributePath,
+                                                                        EmberAfAttributeType attributeType, uint16_t size,
+                                                                        uint8_t * value)
+{
+    return Protocols::InteractionModel::Status::Success;
+}
+Protocols::InteractionModel::Status
+MatterTimeFormatLocalizationClusterServerPreAttributeChangedCallback(const app::ConcreteAttributePath & attributePath,
+                                                                     EmberAfAttributeType attributeType, uint16_t size,
+                                                                     uint8_t * value)
+{
+    return Protocols::InteractionModel::Status::Success;
+}
+
+namespace {
+
+constexpr EndpointId kDynamicEndpointId      = 0x0100;
+constexpr EndpointId kOtherDynamicEndpointId = 0x0101;
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(onOffAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(ZCL_ON_OFF_ATTRIBUTE_ID, BOOLEAN, 1, 0), /* on/off */
+    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(dynamicClusters)
+DECLARE_DYNAMIC_CLUSTER(ZCL_ON_OFF_CLUSTER_ID, onOffAttrs, nullptr, nullptr), DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(dynamicEndpoint, dynamicClusters);
+
+DataVersion gDynamicDataVersions[2][ArraySize(dynamicClusters)];
+
+EmberAfStatus SetDynamicEndpoint(uint16_t index, EndpointId id)
+{
+    return emberAfSetDynamicEndpoint(index, id, &dynamicEndpoint, Span<DataVersion>(gDynamicDataVersions[index % 2]));
+}
+
+// Writes an attribute of each fixed endpoint through the storage, and checks where the bytes landed in attributeData: the
+// storage of a fixed endpoint starts where the storage of the previous one ends.
+void TestFixedEndpointAttributeOffsets(nlTestSuite * inSuite, void * inContext)
+{
+    uint16_t endpointOffset   = 0;
+    uint16_t checkedEndpoints = 0;
+
+    for (uint16_t index = 0; index < emberAfFixedEndpointCount(); index++)
+    {
+        EndpointId endpoint                      = emberAfEndpointFromIndex(index);
+        const EmberAfEndpointType * endpointType = emberAfFindEndpointType(endpoint);
+        NL_TEST_ASSERT(inSuite, endpointType != nullptr);
+        VerifyOrReturn(endpointType != nullptr);
+
+        // Find the first attribute held in attributeData, and its offset within the storage of the endpoint.
+        const EmberAfCluster * cluster      = nullptr;
+        const EmberAfAttributeMetadata * am = nullptr;
+        uint16_t attributeOffset            = 0;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount && am == nullptr; clusterIndex++)
+        {
+            const EmberAfCluster * candidateCluster = &endpointType->cluster[clusterIndex];
+            uint16_t offset                         = attributeOffset;
+            for (uint16_t attributeIndex = 0; attributeIndex < candidateCluster->attributeCount; attributeIndex++)
+            {
+                const EmberAfAttributeMetadata * candidate = &candidateCluster->attributes[attributeIndex];
+                if (candidate->mask & (ATTRIBUTE_MASK_EXTERNAL_STORAGE | ATTRIBUTE_MASK_SINGLETON))
+                {
+                    continue;
+                }
+                if (!emberAfIsStringAttributeType(candidate->attributeType) &&
+                    !emberAfIsLongStringAttributeType(candidate->attributeType))
+                {
+                    cluster         = candidateCluster;
+                    am              = candidate;
+                    attributeOffset = offset;
+                    break;
+                }
+                offset = static_cast<uint16_t>(offset + emberAfAttributeSize(candidate));
+            }
+            if (am == nullptr)
+            {
+                attributeOffset = static_cast<uint16_t>(attributeOffset + candidateCluster->clusterSize);
+            }
+        }
+
+        if (am != nullptr)
+        {
+            uint8_t value[8];
+            uint16_t size = emberAfAttributeSize(am);
+            NL_TEST_ASSERT(inSuite, size <= sizeof(value));
+            memset(value, static_cast<int>(0x11 * (index + 1)), sizeof(value));
+
+            EmberAfAttributeSearchRecord record = { endpoint, cluster->clusterId, am->attributeId };
+            NL_TEST_ASSERT(inSuite, emAfReadOrWriteAttribute(&record, nullptr, value, 0, true) == EMBER_ZCL_STATUS_SUCCESS);
+            NL_TEST_ASSERT(inSuite, memcmp(attributeData + endpointOffset + attributeOffset, value, size) == 0);
+
+            uint8_t readBack[sizeof(value)] = {};
+            EmberAfStatus status            = emAfReadOrWriteAttribute(&record, nullptr, readBack, sizeof(readBack), false);
+            NL_TEST_ASSERT(inSuite, status == EMBER_ZCL_STATUS_SUCCESS);
+            NL_TEST_ASSERT(inSuite, memcmp(readBack, value, size) == 0);
+            checkedEndpoints++;
+        }
+
+        endpointOffset = static_cast<uint16_t>(endpointOffset + endpointType->endpointSize);
+    }
+
+    // Offsets only matter past the first endpoint.
+    NL_TEST_ASSERT(inSuite, checkedEndpoints >= 2);
+}
+
+void TestDynamicEndpointIds(nlTestSuite * inSuite, void * inContext)
+{
+    const uint16_t fixedCount = emberAfFixedEndpointCount();
+
+    // The id of a fixed endpoint is taken.
+    NL_TEST_ASSERT(inSuite, SetDynamicEndpoint(0, emberAfEndpointFromIndex(0)) == EMBER_ZCL_STATUS_DUPLICATE_EXISTS);
+    NL_TEST_ASSERT(inSuite, emberAfEndpointFromIndex(fixedCount) == kInvalidEndpointId);
+    NL_TEST_ASSERT(inSuite, emberAfIndexFromEndpoint(emberAfEndpointFromIndex(0)) == 0);
+
+    NL_TEST_ASSERT(inSuite, SetDynamicEndpoint(0, kDynamicEndpointId) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(inSuite, emberAfIndexFromEndpoint(kDynamicEndpointId) == fixedCount);
+    NL_TEST_ASSERT(inSuite, emberAfGetDynamicIndexFromEndpoint(kDynamicEndpointId) == 0);
+
+    // So is the id of another dynamic endpoint, and the slot it was offered stays empty.
+    NL_TEST_ASSERT(inSuite, SetDynamicEndpoint(1, kDynamicEndpointId) == EMBER_ZCL_STATUS_DUPLICATE_EXISTS);
+    NL_TEST_ASSERT(inSuite, emberAfEndpointFromIndex(static_cast<uint16_t>(fixedCount + 1)) == kInvalidEndpointId);
+    NL_TEST_ASSERT(inSuite, emberAfIndexFromEndpoint(kDynamicEndpointId) == fixedCount);
+
+    NL_TEST_ASSERT(inSuite, SetDynamicEndpoint(1, kOtherDynamicEndpointId) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(inSuite, emberAfGetDynamicIndexFromEndpoint(kOtherDynamicEndpointId) == 1);
+    NL_TEST_ASSERT(inSuite, SetDynamicEndpoint(2, 0x0102) == EMBER_ZCL_STATUS_INSUFFICIENT_SPACE);
+
+    // A cleared id can be used again, in another slot.
+    NL_TEST_ASSERT(inSuite, emberAfClearDynamicEndpoint(0) == kDynamicEndpointId);
+    NL_TEST_ASSERT(inSuite, emberAfIndexFromEndpoint(kDynamicEndpointId) == kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(inSuite, emberAfGetDynamicIndexFromEndpoint(kDynamicEndpointId) == kEmberInvalidEndpointIndex);
+    NL_TEST_ASSERT(inSuite, emberAfClearDynamicEndpoint(1) == kOtherDynamicEndpointId);
+    NL_TEST_ASSERT(inSuite, SetDynamicEndpoint(1, kDynamicEndpointId) == EMBER_ZCL_STATUS_SUCCESS);
+    NL_TEST_ASSERT(inSuite, emberAfGetDynamicIndexFromEndpoint(kDynamicEndpointId) == 1);
+    NL_TEST_ASSERT(inSuite, emberAfClearDynamicEndpoint(1) == kDynamicEndpointId);
+
+    // The fixed endpoints are untouched.
+    for (uint16_t index = 0; index < fixedCount; index++)
+    {
+        NL_TEST_ASSERT(inSuite, emberAfIndexFromEndpoint(emberAfEndpointFromIndex(index)) == index);
+    }
+}
+
+int Setup(void * inContext)
+{
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    emberAfEndpointConfigure();
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestAttributeStorage()
+{
+    static nlTest sTests[] = {
+        NL_TEST_DEF("TestFixedEndpointAttributeOffsets", TestFixedEndpointAttributeOffsets),
+        NL_TEST_DEF("TestDynamicEndpointIds", TestDynamicEndpointIds),
+        NL_TEST_SENTINEL(),
+    };
+
+    nlTestSuite theSuite = {
+        "AttributeStorage",
+        &sTests[0],
+        Setup,
+        Teardown,
+    };
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeStorage)
@@ -124,7 +124,8 @@ CHIP_ERROR DeviceController::Init(ControllerInitParams params)
     VerifyOrReturnError(params.operationalCredentialsDelegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     mOperationalCredentialsDelegate = params.operationalCredentialsDelegate;
 
-    mVendorId = params.controllerVendorId;
+    mVendorId                        = params.controllerVendorId;
+    mRemoveFromFabricTableOnShutdown = params.removeFromFabricTableOnShutdown;
     if (params.operationalKeypair != nullptr || !params.controllerNOC.empty() || !params.controllerRCAC.empty())
     {
         ReturnErrorOnFailure(ProcessControllerNOCChain(params));
@@ -210,7 +211,7 @@ CHIP_ERROR DeviceController::Shutdown()
 
     mState = State::NotInitialized;
 
-    if (mFabricInfo != nullptr)
+    if (mFabricInfo != nullptr && mRemoveFromFabricTableOnShutdown)
     {
         // Shut down any ongoing CASE session activity we have.  We're going to
         // assume that all sessions for our fabric belong to us here.
@@ -221,12 +222,11 @@ CHIP_ERROR DeviceController::Shutdown()
         // we're in the middle of as initiator.  Maybe it should shut down
         // existing sessions too?
         mSystemState->SessionMgr()->ExpireAllPairingsForFabric(mFabricInfo->GetFabricIndex());
-    }
 
-    if (mFabricInfo != nullptr)
-    {
         mFabricInfo->Reset();
     }
+    // Otherwise the fabric, and the sessions on it, are left to the controllers sharing it.
+    mFabricInfo = nullptr;
     mSystemState->Release();
     mSystemState = nullptr;
 
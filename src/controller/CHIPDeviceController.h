@@ -108,6 +108,12 @@ struct ControllerInitParams
     //
     bool enableServerInteractions = false;
 
+    //
+    // Controls whether Shutdown() expires the sessions of the fabric and removes the fabric from the fabric table. Clear
+    // it on controllers sharing their fabric with another controller that outlives them.
+    //
+    bool removeFromFabricTableOnShutdown = true;
+
     uint16_t controllerVendorId;
 };
 
@@ -249,9 +255,10 @@ protected:
 
     State mState;
 
-    PeerId mLocalId          = PeerId();
-    FabricId mFabricId       = kUndefinedFabricId;
-    FabricInfo * mFabricInfo = nullptr;
+    PeerId mLocalId                       = PeerId();
+    FabricId mFabricId                    = kUndefinedFabricId;
+    FabricInfo * mFabricInfo              = nullptr;
+    bool mRemoveFromFabricTableOnShutdown = true;
 
     // TODO(cecille): Make this configuarable.
     static constexpr int kMaxCommissionableNodes = 10;
@@ -249,7 +249,8 @@ void DeviceControllerFactory::PopulateInitParams(ControllerInitParams & controll
     controllerParams.systemState        = mSystemState;
     controllerParams.controllerVendorId = params.controllerVendorId;
 
-    controllerParams.enableServerInteractions = params.enableServerInteractions;
+    controllerParams.enableServerInteractions        = params.enableServerInteractions;
+    controllerParams.removeFromFabricTableOnShutdown = params.removeFromFabricTableOnShutdown;
 }
 
 CHIP_ERROR DeviceControllerFactory::SetupController(SetupParams params, DeviceController & controller)
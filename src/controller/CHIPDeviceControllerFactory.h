@@ -65,6 +65,12 @@ struct SetupParams
     //
     bool enableServerInteractions = false;
 
+    //
+    // Controls whether shutting the controller down expires the sessions of its fabric and removes the fabric from the
+    // fabric table. Clear it on controllers sharing their fabric with another controller that outlives them.
+    //
+    bool removeFromFabricTableOnShutdown = true;
+
     Credentials::DeviceAttestationVerifier * deviceAttestationVerifier = nullptr;
     CommissioningDelegate * defaultCommissioner                        = nullptr;
 };
@@ -0,0 +1,289 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of the commissioning pipeline, which commissions a batch
+ *      of nodes with several of them in progress at the same time.
+ *
+ */
+
+#include <controller/CommissioningPipeline.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace Controller {
+
+void CommissioningLane::ReportCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    if (mPipeline != nullptr)
+    {
+        mPipeline->OnLaneStatusUpdate(nodeId, stageCompleted, error);
+    }
+}
+
+void CommissioningLane::ReportCommissioningComplete(NodeId nodeId, CHIP_ERROR error)
+{
+    VerifyOrReturn(mBusy);
+    mBusy = false;
+    if (mPipeline != nullptr)
+    {
+        mPipeline->OnLaneComplete(nodeId, error);
+    }
+}
+
+void CommissioningLane::ReportNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData)
+{
+    if (mPipeline != nullptr)
+    {
+        mPipeline->OnLaneNodeDiscovered(*this, nodeData);
+    }
+}
+
+CHIP_ERROR DeviceCommissionerLane::Init(SetupParams params)
+{
+    // Each lane drives its nodes with its own AutoCommissioner.
+    params.pairingDelegate          = this;
+    params.defaultCommissioner      = nullptr;
+    params.enableServerInteractions = false;
+    // The fabric is shared with the other lanes, and with the controller the lanes were set up alongside.
+    params.removeFromFabricTableOnShutdown = false;
+    return DeviceControllerFactory::GetInstance().SetupCommissioner(params, mCommissioner);
+}
+
+void DeviceCommissionerLane::Shutdown()
+{
+    // The commissioner leaves the sessions of the fabric alone: drop the one of the node in progress, if any.
+    if (mNodeId != kUndefinedNodeId)
+    {
+        mCommissioner.ReleaseOperationalDevice(mNodeId);
+    }
+    mCommissioner.Shutdown();
+    mNodeId = kUndefinedNodeId;
+}
+
+CHIP_ERROR DeviceCommissionerLane::StartCommissioning(const CommissioningRequest & request, const CommissioningParameters & params)
+{
+    if (request.rendezvousParams != nullptr)
+    {
+        RendezvousParameters rendezvousParams       = *request.rendezvousParams;
+        CommissioningParameters commissioningParams = params;
+        ReturnErrorOnFailure(mCommissioner.PairDevice(request.nodeId, rendezvousParams, commissioningParams));
+    }
+    else
+    {
+        VerifyOrReturnError(request.setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(mCommissioner.PairDevice(request.nodeId, request.setUpCode, params));
+    }
+    mNodeId = request.nodeId;
+    return CHIP_NO_ERROR;
+}
+
+void DeviceCommissionerLane::OnPairingComplete(CHIP_ERROR error)
+{
+    // A PASE failure ends the commissioning of the node; a PASE success is followed by the commissioning stages.
+    if (error != CHIP_NO_ERROR && mNodeId != kUndefinedNodeId)
+    {
+        NodeId nodeId = mNodeId;
+        mNodeId       = kUndefinedNodeId;
+        ReportCommissioningComplete(nodeId, error);
+    }
+}
+
+void DeviceCommissionerLane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(deviceId == mNodeId);
+    mNodeId = kUndefinedNodeId;
+    ReportCommissioningComplete(deviceId, error);
+}
+
+void DeviceCommissionerLane::OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    ReportCommissioningStatusUpdate(peerId.GetNodeId(), stageCompleted, error);
+}
+
+void DeviceCommissionerLane::OnNodeDiscoveredByOtherLane(const Dnssd::DiscoveredNodeData & nodeData)
+{
+    // Not shared back: the lane that discovered the node already did.
+    mCommissioner.DeviceCommissioner::OnNodeDiscovered(nodeData);
+}
+
+void DeviceCommissionerLane::Commissioner::OnNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData)
+{
+    DeviceCommissioner::OnNodeDiscovered(nodeData);
+    mLane.ReportNodeDiscovered(nodeData);
+}
+
+CHIP_ERROR CommissioningPipeline::Init(System::Layer * systemLayer, Span<CommissioningLane * const> lanes,
+                                       CommissioningPipelineDelegate * delegate)
+{
+    VerifyOrReturnError(systemLayer != nullptr && delegate != nullptr && !lanes.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    for (CommissioningLane * lane : lanes)
+    {
+        VerifyOrReturnError(lane != nullptr && lane->mPipeline == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    mSystemLayer = systemLayer;
+    mLanes       = lanes;
+    mDelegate    = delegate;
+    for (CommissioningLane * lane : mLanes)
+    {
+        lane->mPipeline = this;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void CommissioningPipeline::Shutdown()
+{
+    VerifyOrReturn(mDelegate != nullptr);
+
+    if (mDispatchScheduled)
+    {
+        mSystemLayer->CancelTimer(DispatchRequests, this);
+        mDispatchScheduled = false;
+    }
+    for (CommissioningLane * lane : mLanes)
+    {
+        lane->mPipeline = nullptr;
+    }
+    mLanes    = Span<CommissioningLane * const>();
+    mRequests = Span<const CommissioningRequest>();
+    mDelegate = nullptr;
+}
+
+CHIP_ERROR CommissioningPipeline::Commission(Span<const CommissioningRequest> requests, const CommissioningParameters & params)
+{
+    VerifyOrReturnError(mDelegate != nullptr && !IsBatchInProgress(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!requests.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mRequests       = requests;
+    mParams         = params;
+    mNextRequest    = 0;
+    mCompletedCount = 0;
+    mFailedCount    = 0;
+
+    ChipLogProgress(Controller, "Commissioning %u nodes with %u lanes", static_cast<unsigned>(mRequests.size()),
+                    static_cast<unsigned>(mLanes.size()));
+    ScheduleDispatch();
+    return CHIP_NO_ERROR;
+}
+
+size_t CommissioningPipeline::GetActiveCount() const
+{
+    size_t count = 0;
+    for (CommissioningLane * lane : mLanes)
+    {
+        count += lane->IsBusy() ? 1 : 0;
+    }
+    return count;
+}
+
+void CommissioningPipeline::ScheduleDispatch()
+{
+    VerifyOrReturn(!mDispatchScheduled);
+
+    CHIP_ERROR err = mSystemLayer->ScheduleWork(DispatchRequests, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule commissioning pipeline dispatch: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mDispatchScheduled = true;
+}
+
+void CommissioningPipeline::DispatchRequests(System::Layer * systemLayer, void * context)
+{
+    CommissioningPipeline * pipeline = static_cast<CommissioningPipeline *>(context);
+    pipeline->mDispatchScheduled     = false;
+
+    for (CommissioningLane * lane : pipeline->mLanes)
+    {
+        // A lane starting a node, or a batch being completed, may have shut the pipeline down.
+        VerifyOrReturn(pipeline->mDelegate != nullptr && pipeline->mNextRequest < pipeline->mRequests.size());
+        if (!lane->IsBusy())
+        {
+            pipeline->StartNextRequest(*lane);
+        }
+    }
+}
+
+void CommissioningPipeline::StartNextRequest(CommissioningLane & lane)
+{
+    while (mDelegate != nullptr && mNextRequest < mRequests.size())
+    {
+        const CommissioningRequest & request = mRequests.data()[mNextRequest++];
+
+        lane.mBusy     = true;
+        CHIP_ERROR err = lane.StartCommissioning(request, mParams);
+        if (err == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        lane.mBusy = false;
+        ChipLogError(Controller, "Failed to start commissioning node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(request.nodeId), err.Format());
+        CompleteRequest(request.nodeId, err);
+    }
+}
+
+void CommissioningPipeline::OnLaneStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error)
+{
+    mDelegate->OnCommissioningStatusUpdate(nodeId, stageCompleted, error);
+}
+
+void CommissioningPipeline::OnLaneComplete(NodeId nodeId, CHIP_ERROR error)
+{
+    // The commissioner reporting the completion is still cleaning up after it: hand the lane its next node later.
+    if (mNextRequest < mRequests.size())
+    {
+        ScheduleDispatch();
+    }
+    CompleteRequest(nodeId, error);
+}
+
+void CommissioningPipeline::OnLaneNodeDiscovered(CommissioningLane & lane, const Dnssd::DiscoveredNodeData & nodeData)
+{
+    for (CommissioningLane * otherLane : mLanes)
+    {
+        if (otherLane != &lane)
+        {
+            otherLane->OnNodeDiscoveredByOtherLane(nodeData);
+        }
+    }
+}
+
+void CommissioningPipeline::CompleteRequest(NodeId nodeId, CHIP_ERROR error)
+{
+    mCompletedCount++;
+    mFailedCount += (error == CHIP_NO_ERROR) ? 0 : 1;
+
+    mDelegate->OnCommissioningComplete(nodeId, error);
+
+    if (mDelegate != nullptr && mCompletedCount == mRequests.size())
+    {
+        ChipLogProgress(Controller, "Commissioned %u of %u nodes", static_cast<unsigned>(mCompletedCount - mFailedCount),
+                        static_cast<unsigned>(mCompletedCount));
+        mDelegate->OnBatchComplete(mCompletedCount - mFailedCount, mFailedCount);
+    }
+}
+
+} // namespace Controller
+} // namespace chip
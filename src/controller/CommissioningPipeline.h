@@ -0,0 +1,229 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of the commissioning pipeline, which commissions a batch
+ *      of nodes with several of them in progress at the same time.
+ *
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CHIPDeviceControllerFactory.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/dnssd/Resolver.h>
+#include <lib/support/DLLUtil.h>
+#include <lib/support/Span.h>
+#include <protocols/secure_channel/RendezvousParameters.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace Controller {
+
+class CommissioningPipeline;
+
+/**
+ * A node for a CommissioningPipeline to commission.
+ */
+struct CommissioningRequest
+{
+    // The node ID to assign to the node.
+    NodeId nodeId = kUndefinedNodeId;
+    // The QR code or manual pairing code of the node.
+    const char * setUpCode = nullptr;
+    // Where and how to reach the node, for nodes commissioned without discovery instead of with a setup code.
+    const RendezvousParameters * rendezvousParams = nullptr;
+};
+
+/**
+ * Receives the progress of the nodes of a CommissioningPipeline batch.
+ */
+class DLL_EXPORT CommissioningPipelineDelegate
+{
+public:
+    virtual ~CommissioningPipelineDelegate() {}
+
+    /**
+     * Called when a node completes a commissioning stage.
+     */
+    virtual void OnCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error) {}
+
+    /**
+     * Called when a node is commissioned, or its commissioning fails.
+     */
+    virtual void OnCommissioningComplete(NodeId nodeId, CHIP_ERROR error) = 0;
+
+    /**
+     * Called once all the nodes of the batch are done.
+     *
+     * @param[in] succeeded     The number of nodes that were commissioned.
+     * @param[in] failed        The number of nodes that failed to be commissioned.
+     */
+    virtual void OnBatchComplete(size_t succeeded, size_t failed) = 0;
+};
+
+/**
+ * One slot of a CommissioningPipeline, commissioning one node at a time with its own commissioning stage state.
+ */
+class DLL_EXPORT CommissioningLane
+{
+public:
+    virtual ~CommissioningLane() {}
+
+    /**
+     * Starts commissioning a node. Unless this returns an error, the lane must report the end of commissioning with
+     * ReportCommissioningComplete().
+     */
+    virtual CHIP_ERROR StartCommissioning(const CommissioningRequest & request, const CommissioningParameters & params) = 0;
+
+    bool IsBusy() const { return mBusy; }
+
+protected:
+    void ReportCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error);
+    void ReportCommissioningComplete(NodeId nodeId, CHIP_ERROR error);
+    // Shares a commissionable node the lane discovered with the other lanes of its pipeline.
+    void ReportNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData);
+
+private:
+    friend class CommissioningPipeline;
+
+    // Called with the commissionable nodes the other lanes of the pipeline discovered.
+    virtual void OnNodeDiscoveredByOtherLane(const Dnssd::DiscoveredNodeData & nodeData) {}
+
+    CommissioningPipeline * mPipeline = nullptr;
+    bool mBusy                        = false;
+};
+
+/**
+ * A lane commissioning through its own DeviceCommissioner, hence with its own PASE session, AutoCommissioner, stage
+ * machine and commissionable node discovery. Lanes set up with the same SetupParams share the operational credentials
+ * delegate issuing the NOCs, the device attestation verifier, and the fabric table entry of their fabric, which a fabric
+ * table holds once.
+ *
+ * Shutting a lane down only ends the commissioning in progress on it: the fabric, and the sessions other lanes have on
+ * it, are left to the controller the lanes were set up alongside, which must outlive them. In builds with commissioner
+ * discovery, give each lane its own UDC port with GetCommissioner().SetUdcListenPort() before Init().
+ *
+ * Minimal mDNS reports the commissionable nodes it discovers to the last commissioner that started a discovery only, so
+ * the lanes of a pipeline share the nodes they discover with each other.
+ */
+class DLL_EXPORT DeviceCommissionerLane : public CommissioningLane, public DevicePairingDelegate
+{
+public:
+    CHIP_ERROR Init(SetupParams params);
+    void Shutdown();
+
+    DeviceCommissioner & GetCommissioner() { return mCommissioner; }
+
+    CHIP_ERROR StartCommissioning(const CommissioningRequest & request, const CommissioningParameters & params) override;
+
+private:
+    // DevicePairingDelegate implementation.
+    void OnPairingComplete(CHIP_ERROR error) override;
+    void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+    void OnCommissioningStatusUpdate(PeerId peerId, CommissioningStage stageCompleted, CHIP_ERROR error) override;
+
+    void OnNodeDiscoveredByOtherLane(const Dnssd::DiscoveredNodeData & nodeData) override;
+
+    class Commissioner : public DeviceCommissioner
+    {
+    public:
+        Commissioner(DeviceCommissionerLane & lane) : mLane(lane) {}
+
+        void OnNodeDiscovered(const Dnssd::DiscoveredNodeData & nodeData) override;
+
+    private:
+        DeviceCommissionerLane & mLane;
+    };
+
+    Commissioner mCommissioner{ *this };
+    NodeId mNodeId = kUndefinedNodeId;
+};
+
+/**
+ * Commissions a batch of nodes, handing each of them to the first idle lane, so that as many nodes as there are lanes
+ * make progress at the same time. Must be used from the CHIP thread.
+ *
+ * A lane that is done is handed its next node from a later iteration of the event loop, once the commissioner that
+ * reported the completion has finished cleaning up after it.
+ */
+class DLL_EXPORT CommissioningPipeline
+{
+public:
+    /**
+     * @param[in] systemLayer   The system layer of the CHIP thread.
+     * @param[in] lanes         The lanes to commission with. They must outlive the pipeline.
+     * @param[in] delegate      The delegate receiving the progress of the nodes.
+     */
+    CHIP_ERROR Init(System::Layer * systemLayer, Span<CommissioningLane * const> lanes, CommissioningPipelineDelegate * delegate);
+
+    /**
+     * Stops handing nodes to the lanes. Nodes in progress are left to their lanes.
+     */
+    void Shutdown();
+
+    /**
+     * Starts commissioning a batch of nodes.
+     *
+     * @param[in] requests  The nodes to commission. They, and the setup codes and rendezvous parameters they point to,
+     *                      must remain valid until OnBatchComplete() is called.
+     * @param[in] params    The commissioning parameters used for every node, e.g. the network credentials. The
+     *                      buffers they point to must also remain valid until OnBatchComplete() is called.
+     *
+     * @retval #CHIP_ERROR_INCORRECT_STATE  If a batch is already in progress.
+     */
+    CHIP_ERROR Commission(Span<const CommissioningRequest> requests, const CommissioningParameters & params);
+
+    bool IsBatchInProgress() const { return mCompletedCount < mRequests.size(); }
+
+    /**
+     * Returns the number of nodes being commissioned right now.
+     */
+    size_t GetActiveCount() const;
+
+private:
+    friend class CommissioningLane;
+
+    static void DispatchRequests(System::Layer * systemLayer, void * context);
+    void ScheduleDispatch();
+    // Hands the next pending requests to the lane, until one starts or none is left.
+    void StartNextRequest(CommissioningLane & lane);
+    void OnLaneStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error);
+    void OnLaneComplete(NodeId nodeId, CHIP_ERROR error);
+    void OnLaneNodeDiscovered(CommissioningLane & lane, const Dnssd::DiscoveredNodeData & nodeData);
+    void CompleteRequest(NodeId nodeId, CHIP_ERROR error);
+
+    System::Layer * mSystemLayer = nullptr;
+    Span<CommissioningLane * const> mLanes;
+    CommissioningPipelineDelegate * mDelegate = nullptr;
+    bool mDispatchScheduled                   = false;
+
+    Span<const CommissioningRequest> mRequests;
+    CommissioningParameters mParams;
+    size_t mNextRequest    = 0;
+    size_t mCompletedCount = 0;
+    size_t mFailedCount    = 0;
+};
+
+} // namespace Controller
+} // namespace chip
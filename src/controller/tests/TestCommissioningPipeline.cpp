@@ -0,0 +1,249 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the commissioning pipeline,
+ *      and compares the throughput of a single lane with that of several lanes.
+ *
+ */
+
+#include <app/tests/AppTestContext.h>
+#include <controller/CommissioningPipeline.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+using TestContext = chip::Test::AppContext;
+
+// The time a commissionee takes to answer each commissioning step.
+constexpr System::Clock::Milliseconds32 kStepLatency = 5_ms32;
+constexpr System::Clock::Timeout kBatchTimeout       = 10000_ms32;
+constexpr const char kSetUpCode[]                    = "MT:-24J0AFN00KA0648G00";
+constexpr const char kFailingSetUpCode[]             = "fail";
+
+/**
+ * A lane going through the commissioning stages of a node, each of them taking kStepLatency.
+ * Nodes with kFailingSetUpCode fail when their NOC is sent.
+ */
+class FakeLane : public CommissioningLane
+{
+public:
+    void Init(System::Layer * systemLayer) { mSystemLayer = systemLayer; }
+    void Shutdown() { mSystemLayer->CancelTimer(OnStepDone, this); }
+
+    CHIP_ERROR StartCommissioning(const CommissioningRequest & request, const CommissioningParameters & params) override
+    {
+        VerifyOrReturnError(request.setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        mNodeId = request.nodeId;
+        mFail   = strcmp(request.setUpCode, kFailingSetUpCode) == 0;
+        mStage  = CommissioningStage::kSecurePairing;
+        return mSystemLayer->StartTimer(kStepLatency, OnStepDone, this);
+    }
+
+private:
+    static void OnStepDone(System::Layer * systemLayer, void * context)
+    {
+        FakeLane * lane = static_cast<FakeLane *>(context);
+
+        if (lane->mFail && lane->mStage == CommissioningStage::kSendNOC)
+        {
+            lane->ReportCommissioningStatusUpdate(lane->mNodeId, lane->mStage, CHIP_ERROR_INTERNAL);
+            lane->ReportCommissioningComplete(lane->mNodeId, CHIP_ERROR_INTERNAL);
+            return;
+        }
+
+        lane->ReportCommissioningStatusUpdate(lane->mNodeId, lane->mStage, CHIP_NO_ERROR);
+        if (lane->mStage == CommissioningStage::kSendComplete)
+        {
+            lane->ReportCommissioningComplete(lane->mNodeId, CHIP_NO_ERROR);
+            return;
+        }
+
+        lane->mStage = static_cast<CommissioningStage>(lane->mStage + 1);
+        systemLayer->StartTimer(kStepLatency, OnStepDone, lane);
+    }
+
+    System::Layer * mSystemLayer = nullptr;
+    NodeId mNodeId               = kUndefinedNodeId;
+    CommissioningStage mStage    = CommissioningStage::kError;
+    bool mFail                   = false;
+};
+
+class TestPipelineDelegate : public CommissioningPipelineDelegate
+{
+public:
+    void OnCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error) override
+    {
+        mStatusUpdateCount++;
+        mMaxActiveCount = std::max(mMaxActiveCount, mPipeline->GetActiveCount());
+    }
+
+    void OnCommissioningComplete(NodeId nodeId, CHIP_ERROR error) override
+    {
+        mCompleteCount++;
+    }
+
+    void OnBatchComplete(size_t succeeded, size_t failed) override
+    {
+        mBatchComplete = true;
+        mSucceeded     = succeeded;
+        mFailed        = failed;
+    }
+
+    CommissioningPipeline * mPipeline = nullptr;
+    size_t mStatusUpdateCount         = 0;
+    size_t mMaxActiveCount            = 0;
+    size_t mCompleteCount             = 0;
+    bool mBatchComplete               = false;
+    size_t mSucceeded                 = 0;
+    size_t mFailed                    = 0;
+};
+
+constexpr size_t kMaxLanes = 4;
+
+// Commissions the batch with the given number of lanes, and returns the time it took.
+System::Clock::Milliseconds64 CommissionBatch(nlTestSuite * apSuite, TestContext & ctx, size_t laneCount,
+                                              Span<const CommissioningRequest> requests, TestPipelineDelegate & delegate)
+{
+    FakeLane lanes[kMaxLanes];
+    CommissioningLane * lanePointers[kMaxLanes];
+    for (size_t i = 0; i < laneCount; i++)
+    {
+        lanes[i].Init(&ctx.GetSystemLayer());
+        lanePointers[i] = &lanes[i];
+    }
+
+    CommissioningPipeline pipeline;
+    delegate.mPipeline = &pipeline;
+    NL_TEST_ASSERT(apSuite,
+                   pipeline.Init(&ctx.GetSystemLayer(), Span<CommissioningLane * const>(lanePointers, laneCount), &delegate) ==
+                       CHIP_NO_ERROR);
+
+    System::Clock::Timestamp start = System::SystemClock().GetMonotonicTimestamp();
+    NL_TEST_ASSERT(apSuite, pipeline.Commission(requests, CommissioningParameters()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, pipeline.IsBatchInProgress());
+    NL_TEST_ASSERT(apSuite, pipeline.Commission(requests, CommissioningParameters()) == CHIP_ERROR_INCORRECT_STATE);
+
+    ctx.GetIOContext().DriveIOUntil(kBatchTimeout, [&delegate]() { return delegate.mBatchComplete; });
+    System::Clock::Timestamp elapsed = System::SystemClock().GetMonotonicTimestamp() - start;
+
+    NL_TEST_ASSERT(apSuite, !pipeline.IsBatchInProgress());
+    NL_TEST_ASSERT(apSuite, pipeline.GetActiveCount() == 0);
+
+    pipeline.Shutdown();
+    for (size_t i = 0; i < laneCount; i++)
+    {
+        lanes[i].Shutdown();
+    }
+    return elapsed;
+}
+
+void TestCommissionBatch(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CommissioningRequest requests[10];
+    for (size_t i = 0; i < ArraySize(requests); i++)
+    {
+        requests[i].nodeId    = 0x100 + i;
+        requests[i].setUpCode = kSetUpCode;
+    }
+    requests[3].setUpCode = kFailingSetUpCode;
+    // Fails to start: the pipeline goes on with the next node.
+    requests[7].setUpCode = nullptr;
+
+    TestPipelineDelegate delegate;
+    CommissionBatch(apSuite, ctx, 3, Span<const CommissioningRequest>(requests), delegate);
+
+    NL_TEST_ASSERT(apSuite, delegate.mBatchComplete);
+    NL_TEST_ASSERT(apSuite, delegate.mCompleteCount == ArraySize(requests));
+    NL_TEST_ASSERT(apSuite, delegate.mSucceeded == ArraySize(requests) - 2);
+    NL_TEST_ASSERT(apSuite, delegate.mFailed == 2);
+    NL_TEST_ASSERT(apSuite, delegate.mMaxActiveCount == 3);
+    NL_TEST_ASSERT(apSuite, delegate.mStatusUpdateCount > 0);
+}
+
+void TestThroughput(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CommissioningRequest requests[12];
+    for (size_t i = 0; i < ArraySize(requests); i++)
+    {
+        requests[i].nodeId    = 0x200 + i;
+        requests[i].setUpCode = kSetUpCode;
+    }
+
+    TestPipelineDelegate serialDelegate;
+    System::Clock::Milliseconds64 serialTime =
+        CommissionBatch(apSuite, ctx, 1, Span<const CommissioningRequest>(requests), serialDelegate);
+    NL_TEST_ASSERT(apSuite, serialDelegate.mSucceeded == ArraySize(requests));
+    NL_TEST_ASSERT(apSuite, serialDelegate.mMaxActiveCount == 1);
+
+    TestPipelineDelegate parallelDelegate;
+    System::Clock::Milliseconds64 parallelTime =
+        CommissionBatch(apSuite, ctx, kMaxLanes, Span<const CommissioningRequest>(requests), parallelDelegate);
+    NL_TEST_ASSERT(apSuite, parallelDelegate.mSucceeded == ArraySize(requests));
+    NL_TEST_ASSERT(apSuite, parallelDelegate.mMaxActiveCount == kMaxLanes);
+    NL_TEST_ASSERT(apSuite, parallelTime < serialTime);
+
+    printf("Commissioned %u nodes in %" PRIu64 " ms with 1 lane, %" PRIu64 " ms with %u lanes\n",
+           static_cast<unsigned>(ArraySize(requests)), static_cast<uint64_t>(serialTime.count()),
+           static_cast<uint64_t>(parallelTime.count()), static_cast<unsigned>(kMaxLanes));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestCommissionBatch", TestCommissionBatch),
+    NL_TEST_DEF("TestThroughput", TestThroughput),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestCommissioningPipeline",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestCommissioningPipeline()
+{
+    TestContext gContext;
+    nlTestRunner(&sSuite, &gContext);
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommissioningPipeline)
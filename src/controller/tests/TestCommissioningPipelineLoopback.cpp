@@ -0,0 +1,874 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the commissioning pipeline
+ *      with DeviceCommissionerLane lanes, commissioning fake devices end to
+ *      end over UDP on the loopback interface, and reporting the throughput.
+ *
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/MessageDef/InvokeRequestMessage.h>
+#include <app/MessageDef/InvokeResponseMessage.h>
+#include <app/MessageDef/ReportDataMessage.h>
+#include <app/StatusResponse.h>
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+#include <controller/CommissioningPipeline.h>
+#include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <credentials/CertificationDeclaration.h>
+#include <credentials/DeviceAttestationConstructor.h>
+#include <credentials/FabricTable.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/attestation_verifier/DefaultDeviceAttestationVerifier.h>
+#include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <credentials/examples/DeviceAttestationCredsExample.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/dnssd/MinimalMdnsServer.h>
+#include <lib/dnssd/ServiceNaming.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/ResponseBuilder.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/dnssd/minimal_mdns/records/Txt.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/TestGroupData.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/tests/MessagingContext.h>
+#include <nlunit-test.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/interaction_model/Constants.h>
+#include <protocols/secure_channel/CASEServer.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <system/TLVPacketBufferBackingStore.h>
+#include <transport/SessionManager.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/UDP.h>
+
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+namespace GeneralCommissioning  = app::Clusters::GeneralCommissioning;
+namespace OperationalCredentials = app::Clusters::OperationalCredentials;
+
+using Protocols::InteractionModel::Status;
+
+constexpr size_t kLaneCount                     = 2;
+constexpr size_t kDeviceCount                   = 4;
+constexpr NodeId kControllerNodeId              = 112233;
+constexpr FabricId kFabricId                    = 1;
+constexpr uint32_t kSetupPINCode                = 20202021;
+constexpr uint8_t kSalt[]                       = "CommissioningSalt";
+constexpr System::Clock::Timeout kBatchTimeout  = 30000_ms32;
+constexpr const char kHostName[]                = "0A1B2C3D4E5F6071";
+constexpr const char kInstanceName[]            = "8796A5B4C3D2E1F0";
+constexpr uint16_t kFailSafeExpiryLengthSeconds = 60;
+constexpr DataVersion kDataVersion              = 1;
+
+static_assert(sizeof(kSalt) >= Crypto::kSpake2p_Min_PBKDF_Salt_Length, "The PASE salt is too short");
+
+template <typename AttributeInfo>
+CHIP_ERROR AddAttributeData(app::AttributeReportIBs::Builder & attributeReports, const typename AttributeInfo::Type & value)
+{
+    app::AttributeReportIB::Builder & attributeReport = attributeReports.CreateAttributeReport();
+    ReturnErrorOnFailure(attributeReports.GetError());
+    app::AttributeDataIB::Builder & attributeData = attributeReport.CreateAttributeData();
+    ReturnErrorOnFailure(attributeReport.GetError());
+    ReturnErrorOnFailure(attributeData.DataVersion(kDataVersion).GetError());
+
+    app::AttributePathIB::Builder & path = attributeData.CreatePath();
+    ReturnErrorOnFailure(attributeData.GetError());
+    ReturnErrorOnFailure(path.Endpoint(kRootEndpointId)
+                             .Cluster(AttributeInfo::GetClusterId())
+                             .Attribute(AttributeInfo::GetAttributeId())
+                             .EndOfAttributePathIB()
+                             .GetError());
+    ReturnErrorOnFailure(app::DataModel::Encode(*attributeData.GetWriter(),
+                                                TLV::ContextTag(to_underlying(app::AttributeDataIB::Tag::kData)), value));
+    ReturnErrorOnFailure(attributeData.EndOfAttributeDataIB().GetError());
+    return attributeReport.EndOfAttributeReportIB().GetError();
+}
+
+template <typename ResponseType>
+CHIP_ERROR AddCommandResponse(app::InvokeResponseIBs::Builder & invokeResponses, const app::ConcreteCommandPath & requestPath,
+                              const ResponseType & response)
+{
+    app::InvokeResponseIB::Builder & invokeResponse = invokeResponses.CreateInvokeResponse();
+    ReturnErrorOnFailure(invokeResponses.GetError());
+    app::CommandDataIB::Builder & commandData = invokeResponse.CreateCommand();
+    ReturnErrorOnFailure(invokeResponse.GetError());
+
+    app::CommandPathIB::Builder & path = commandData.CreatePath();
+    ReturnErrorOnFailure(commandData.GetError());
+    ReturnErrorOnFailure(
+        path.Encode(app::ConcreteCommandPath(requestPath.mEndpointId, ResponseType::GetClusterId(), ResponseType::GetCommandId())));
+    ReturnErrorOnFailure(app::DataModel::Encode(*commandData.GetWriter(),
+                                                TLV::ContextTag(to_underlying(app::CommandDataIB::Tag::kData)), response));
+    ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
+    return invokeResponse.EndOfInvokeResponseIB().GetError();
+}
+
+CHIP_ERROR AddCommandStatus(app::InvokeResponseIBs::Builder & invokeResponses, const app::ConcreteCommandPath & requestPath,
+                            Status status)
+{
+    app::InvokeResponseIB::Builder & invokeResponse = invokeResponses.CreateInvokeResponse();
+    ReturnErrorOnFailure(invokeResponses.GetError());
+    app::CommandStatusIB::Builder & commandStatus = invokeResponse.CreateStatus();
+    ReturnErrorOnFailure(invokeResponse.GetError());
+
+    app::CommandPathIB::Builder & path = commandStatus.CreatePath();
+    ReturnErrorOnFailure(commandStatus.GetError());
+    ReturnErrorOnFailure(path.Encode(requestPath));
+    ReturnErrorOnFailure(commandStatus.CreateErrorStatus().EncodeStatusIB(app::StatusIB(status)).GetError());
+    ReturnErrorOnFailure(commandStatus.EndOfCommandStatusIB().GetError());
+    return invokeResponse.EndOfInvokeResponseIB().GetError();
+}
+
+// Signs a payload and the attestation challenge of the session with the DAC, as attestation and CSR responses are.
+CHIP_ERROR SignWithDeviceAttestationKey(Messaging::ExchangeContext * ec, const ByteSpan & payload, MutableByteSpan & signature)
+{
+    uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuffer);
+
+    Crypto::Hash_SHA256_stream hashStream;
+    ReturnErrorOnFailure(hashStream.Begin());
+    ReturnErrorOnFailure(hashStream.AddData(payload));
+    ReturnErrorOnFailure(
+        hashStream.AddData(ec->GetSessionHandle()->AsSecureSession()->GetCryptoContext().GetAttestationChallenge()));
+    ReturnErrorOnFailure(hashStream.Finish(digest));
+    return Credentials::Examples::GetExampleDACProvider()->SignWithDeviceAttestationKey(digest, signature);
+}
+
+/**
+ * A commissionee waiting for PASE on its own UDP port of the loopback interface, with the example device attestation
+ * credentials. It answers the commissioning reads and commands as a device would, advertises its operational identity
+ * once it has a NOC, then accepts CASE from the commissioner and completes commissioning over it.
+ */
+class FakeDevice : public SessionEstablishmentDelegate,
+                   public Messaging::UnsolicitedMessageHandler,
+                   public Messaging::ExchangeDelegate
+{
+public:
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mTransportMgr.Init(Transport::UdpListenParameters(DeviceLayer::UDPEndPointManager())
+                                                    .SetAddressType(Inet::IPAddressType::kIPv6)
+                                                    .SetListenPort(0)));
+        ReturnErrorOnFailure(mFabricTable.Init(&mStorage));
+        mGroupDataProvider.SetStorageDelegate(&mStorage);
+        ReturnErrorOnFailure(mGroupDataProvider.Init());
+        ReturnErrorOnFailure(
+            mSessionManager.Init(&DeviceLayer::SystemLayer(), &mTransportMgr, &mMessageCounterManager, &mStorage, &mFabricTable));
+        ReturnErrorOnFailure(mExchangeManager.Init(&mSessionManager));
+        ReturnErrorOnFailure(mMessageCounterManager.Init(&mExchangeManager));
+        ReturnErrorOnFailure(mCASEServer.ListenForSessionEstablishment(&mExchangeManager, &mSessionManager, &mFabricTable, nullptr,
+                                                                       &mGroupDataProvider));
+
+        Crypto::Spake2pVerifier verifier;
+        uint32_t setupPINCode = kSetupPINCode;
+        ReturnErrorOnFailure(verifier.Generate(Crypto::kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt), setupPINCode));
+
+        ReturnErrorOnFailure(mExchangeManager.RegisterUnsolicitedMessageHandlerForType(
+            Protocols::SecureChannel::MsgType::PBKDFParamRequest, &mPairing));
+        ReturnErrorOnFailure(mExchangeManager.RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
+        return mPairing.WaitForPairing(mSessionManager, verifier, Crypto::kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt),
+                                       Optional<ReliableMessageProtocolConfig>::Missing(), this);
+    }
+
+    void Shutdown()
+    {
+        mExchangeManager.UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
+        mExchangeManager.UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::PBKDFParamRequest);
+        mExchangeManager.UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+        mPairing.Clear();
+        mMessageCounterManager.Shutdown();
+        mExchangeManager.Shutdown();
+        mSessionManager.Shutdown();
+        mFabricTable.DeleteAllFabrics();
+        mGroupDataProvider.Finish();
+        mTransportMgr.Close();
+    }
+
+    Transport::PeerAddress GetAddress()
+    {
+        Inet::IPAddress loopback;
+        Inet::IPAddress::FromString("::1", loopback);
+        return Transport::PeerAddress::UDP(loopback, mTransportMgr.GetTransport().GetImplAtIndex<0>().GetBoundPort());
+    }
+
+    size_t GetPASESessionCount() const { return mPASESessionCount; }
+    // The number of times commissioning was completed over CASE.
+    size_t GetCommissioningCompleteCount() const { return mCommissioningCompleteCount; }
+
+private:
+    // SessionEstablishmentDelegate implementation.
+    void OnSessionEstablished(const SessionHandle & session) override { mPASESessionCount++; }
+
+    // UnsolicitedMessageHandler implementation.
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader,
+                                            Messaging::ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    // ExchangeDelegate implementation.
+    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && payload) override
+    {
+        CHIP_ERROR err = CHIP_ERROR_INVALID_MESSAGE_TYPE;
+        if (payloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::ReadRequest))
+        {
+            err = SendCommissioningInfo(ec);
+        }
+        else if (payloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::InvokeCommandRequest))
+        {
+            err = HandleInvokeRequest(ec, std::move(payload));
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Controller, "Fake device failed to answer: %" CHIP_ERROR_FORMAT, err.Format());
+            return app::StatusResponse::Send(Status::Failure, ec, false);
+        }
+        return CHIP_NO_ERROR;
+    }
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
+
+    // Answers the read of the commissioner with the attributes it uses: the device needs no network setup.
+    CHIP_ERROR SendCommissioningInfo(Messaging::ExchangeContext * ec)
+    {
+        namespace Basic = app::Clusters::Basic;
+
+        System::PacketBufferTLVWriter writer;
+        writer.Init(System::PacketBufferHandle::New(app::kMaxSecureSduLengthBytes));
+        app::ReportDataMessage::Builder reportData;
+        ReturnErrorOnFailure(reportData.Init(&writer));
+        app::AttributeReportIBs::Builder & attributeReports = reportData.CreateAttributeReportIBs();
+        ReturnErrorOnFailure(reportData.GetError());
+
+        GeneralCommissioning::Structs::BasicCommissioningInfo::Type basicCommissioningInfo;
+        basicCommissioningInfo.failSafeExpiryLengthSeconds = kFailSafeExpiryLengthSeconds;
+        ReturnErrorOnFailure(AddAttributeData<GeneralCommissioning::Attributes::Breadcrumb::TypeInfo>(attributeReports, 0));
+        ReturnErrorOnFailure(AddAttributeData<GeneralCommissioning::Attributes::BasicCommissioningInfo::TypeInfo>(
+            attributeReports, basicCommissioningInfo));
+        ReturnErrorOnFailure(AddAttributeData<GeneralCommissioning::Attributes::RegulatoryConfig::TypeInfo>(
+            attributeReports, GeneralCommissioning::RegulatoryLocationType::kIndoor));
+        ReturnErrorOnFailure(AddAttributeData<GeneralCommissioning::Attributes::LocationCapability::TypeInfo>(
+            attributeReports, GeneralCommissioning::RegulatoryLocationType::kIndoor));
+        ReturnErrorOnFailure(AddAttributeData<Basic::Attributes::VendorID::TypeInfo>(
+            attributeReports, static_cast<VendorId>(CHIP_DEVICE_CONFIG_DEVICE_VENDOR_ID)));
+        ReturnErrorOnFailure(
+            AddAttributeData<Basic::Attributes::ProductID::TypeInfo>(attributeReports, CHIP_DEVICE_CONFIG_DEVICE_PRODUCT_ID));
+        ReturnErrorOnFailure(attributeReports.EndOfAttributeReportIBs().GetError());
+        ReturnErrorOnFailure(reportData.SuppressResponse(true).EndOfReportDataMessage().GetError());
+
+        System::PacketBufferHandle message;
+        ReturnErrorOnFailure(writer.Finalize(&message));
+        return ec->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(message));
+    }
+
+    CHIP_ERROR HandleInvokeRequest(Messaging::ExchangeContext * ec, System::PacketBufferHandle && payload)
+    {
+        System::PacketBufferTLVReader reader;
+        reader.Init(std::move(payload));
+        app::InvokeRequestMessage::Parser invokeRequest;
+        ReturnErrorOnFailure(invokeRequest.Init(reader));
+        app::InvokeRequests::Parser invokeRequests;
+        ReturnErrorOnFailure(invokeRequest.GetInvokeRequests(&invokeRequests));
+
+        // The commissioner sends its commands one at a time.
+        TLV::TLVReader commandReader;
+        invokeRequests.GetReader(&commandReader);
+        ReturnErrorOnFailure(commandReader.Next());
+        app::CommandDataIB::Parser commandData;
+        ReturnErrorOnFailure(commandData.Init(commandReader));
+        app::CommandPathIB::Parser commandPath;
+        ReturnErrorOnFailure(commandData.GetPath(&commandPath));
+        app::ConcreteCommandPath path(kInvalidEndpointId, kInvalidClusterId, kInvalidCommandId);
+        ReturnErrorOnFailure(commandPath.GetEndpointId(&path.mEndpointId));
+        ReturnErrorOnFailure(commandPath.GetClusterId(&path.mClusterId));
+        ReturnErrorOnFailure(commandPath.GetCommandId(&path.mCommandId));
+        TLV::TLVReader fields;
+        ReturnErrorOnFailure(commandData.GetData(&fields));
+
+        System::PacketBufferTLVWriter writer;
+        writer.Init(System::PacketBufferHandle::New(app::kMaxSecureSduLengthBytes));
+        app::InvokeResponseMessage::Builder invokeResponse;
+        ReturnErrorOnFailure(invokeResponse.Init(&writer));
+        invokeResponse.SuppressResponse(false);
+        app::InvokeResponseIBs::Builder & invokeResponses = invokeResponse.CreateInvokeResponses();
+        ReturnErrorOnFailure(invokeResponse.GetError());
+        ReturnErrorOnFailure(HandleCommand(ec, path, fields, invokeResponses));
+        ReturnErrorOnFailure(invokeResponses.EndOfInvokeResponses().GetError());
+        ReturnErrorOnFailure(invokeResponse.EndOfInvokeResponseMessage().GetError());
+
+        System::PacketBufferHandle message;
+        ReturnErrorOnFailure(writer.Finalize(&message));
+        return ec->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse, std::move(message));
+    }
+
+    CHIP_ERROR HandleCommand(Messaging::ExchangeContext * ec, const app::ConcreteCommandPath & path, TLV::TLVReader & fields,
+                             app::InvokeResponseIBs::Builder & invokeResponses)
+    {
+        if (path.mClusterId == GeneralCommissioning::Id)
+        {
+            switch (path.mCommandId)
+            {
+            case GeneralCommissioning::Commands::ArmFailSafe::Id: {
+                GeneralCommissioning::Commands::ArmFailSafeResponse::Type response;
+                response.errorCode = GeneralCommissioning::CommissioningError::kOk;
+                return AddCommandResponse(invokeResponses, path, response);
+            }
+            case GeneralCommissioning::Commands::SetRegulatoryConfig::Id: {
+                GeneralCommissioning::Commands::SetRegulatoryConfigResponse::Type response;
+                response.errorCode = GeneralCommissioning::CommissioningError::kOk;
+                return AddCommandResponse(invokeResponses, path, response);
+            }
+            case GeneralCommissioning::Commands::CommissioningComplete::Id: {
+                VerifyOrReturnError(ec->GetSessionHandle()->AsSecureSession()->IsCASESession(), CHIP_ERROR_INCORRECT_STATE);
+                mCommissioningCompleteCount++;
+                GeneralCommissioning::Commands::CommissioningCompleteResponse::Type response;
+                response.errorCode = GeneralCommissioning::CommissioningError::kOk;
+                return AddCommandResponse(invokeResponses, path, response);
+            }
+            }
+        }
+        else if (path.mClusterId == OperationalCredentials::Id)
+        {
+            switch (path.mCommandId)
+            {
+            case OperationalCredentials::Commands::CertificateChainRequest::Id:
+                return HandleCertificateChainRequest(path, fields, invokeResponses);
+            case OperationalCredentials::Commands::AttestationRequest::Id:
+                return HandleAttestationRequest(ec, path, fields, invokeResponses);
+            case OperationalCredentials::Commands::CSRRequest::Id:
+                return HandleCSRRequest(ec, path, fields, invokeResponses);
+            case OperationalCredentials::Commands::AddTrustedRootCertificate::Id: {
+                OperationalCredentials::Commands::AddTrustedRootCertificate::DecodableType request;
+                ReturnErrorOnFailure(app::DataModel::Decode(fields, request));
+                ReturnErrorOnFailure(mFabricBeingCommissioned.SetRootCert(request.rootCertificate));
+                return AddCommandStatus(invokeResponses, path, Status::Success);
+            }
+            case OperationalCredentials::Commands::AddNOC::Id:
+                return HandleAddNOC(ec, path, fields, invokeResponses);
+            }
+        }
+        return AddCommandStatus(invokeResponses, path, Status::UnsupportedCommand);
+    }
+
+    CHIP_ERROR HandleCertificateChainRequest(const app::ConcreteCommandPath & path, TLV::TLVReader & fields,
+                                             app::InvokeResponseIBs::Builder & invokeResponses)
+    {
+        OperationalCredentials::Commands::CertificateChainRequest::DecodableType request;
+        ReturnErrorOnFailure(app::DataModel::Decode(fields, request));
+
+        uint8_t certificateBuffer[Credentials::kMaxDERCertLength];
+        MutableByteSpan certificate(certificateBuffer);
+        Credentials::DeviceAttestationCredentialsProvider * dacProvider = Credentials::Examples::GetExampleDACProvider();
+        if (request.certificateType == Credentials::CertificateType::kDAC)
+        {
+            ReturnErrorOnFailure(dacProvider->GetDeviceAttestationCert(certificate));
+        }
+        else
+        {
+            VerifyOrReturnError(request.certificateType == Credentials::CertificateType::kPAI, CHIP_ERROR_INVALID_ARGUMENT);
+            ReturnErrorOnFailure(dacProvider->GetProductAttestationIntermediateCert(certificate));
+        }
+
+        OperationalCredentials::Commands::CertificateChainResponse::Type response;
+        response.certificate = certificate;
+        return AddCommandResponse(invokeResponses, path, response);
+    }
+
+    CHIP_ERROR HandleAttestationRequest(Messaging::ExchangeContext * ec, const app::ConcreteCommandPath & path,
+                                        TLV::TLVReader & fields, app::InvokeResponseIBs::Builder & invokeResponses)
+    {
+        OperationalCredentials::Commands::AttestationRequest::DecodableType request;
+        ReturnErrorOnFailure(app::DataModel::Decode(fields, request));
+
+        uint8_t certificationDeclarationBuffer[Credentials::kMaxCMSSignedCDMessage];
+        MutableByteSpan certificationDeclaration(certificationDeclarationBuffer);
+        ReturnErrorOnFailure(Credentials::Examples::GetExampleDACProvider()->GetCertificationDeclaration(certificationDeclaration));
+
+        Platform::ScopedMemoryBuffer<uint8_t> attestationElementsBuffer;
+        size_t attestationElementsLength =
+            TLV::EstimateStructOverhead(certificationDeclaration.size(), request.attestationNonce.size(), sizeof(uint64_t) * 8);
+        VerifyOrReturnError(attestationElementsBuffer.Alloc(attestationElementsLength), CHIP_ERROR_NO_MEMORY);
+        MutableByteSpan attestationElements(attestationElementsBuffer.Get(), attestationElementsLength);
+        Credentials::DeviceAttestationVendorReservedConstructor noVendorReserved(nullptr, 0);
+        ReturnErrorOnFailure(Credentials::ConstructAttestationElements(certificationDeclaration, request.attestationNonce, 0,
+                                                                       ByteSpan(), noVendorReserved, attestationElements));
+
+        Crypto::P256ECDSASignature signatureBuffer;
+        MutableByteSpan signature(signatureBuffer.Bytes(), signatureBuffer.Capacity());
+        ReturnErrorOnFailure(SignWithDeviceAttestationKey(ec, attestationElements, signature));
+
+        OperationalCredentials::Commands::AttestationResponse::Type response;
+        response.attestationElements = attestationElements;
+        response.signature           = signature;
+        return AddCommandResponse(invokeResponses, path, response);
+    }
+
+    CHIP_ERROR HandleCSRRequest(Messaging::ExchangeContext * ec, const app::ConcreteCommandPath & path, TLV::TLVReader & fields,
+                                app::InvokeResponseIBs::Builder & invokeResponses)
+    {
+        OperationalCredentials::Commands::CSRRequest::DecodableType request;
+        ReturnErrorOnFailure(app::DataModel::Decode(fields, request));
+
+        Crypto::P256Keypair operationalKeypair;
+        ReturnErrorOnFailure(operationalKeypair.Initialize());
+        ReturnErrorOnFailure(mFabricBeingCommissioned.SetOperationalKeypair(&operationalKeypair));
+
+        uint8_t csrBuffer[Crypto::kMAX_CSR_Length];
+        size_t csrLength = sizeof(csrBuffer);
+        ReturnErrorOnFailure(operationalKeypair.NewCertificateSigningRequest(csrBuffer, csrLength));
+
+        Platform::ScopedMemoryBuffer<uint8_t> nocsrElementsBuffer;
+        size_t nocsrElementsLength = TLV::EstimateStructOverhead(csrLength, request.CSRNonce.size(), 0u);
+        VerifyOrReturnError(nocsrElementsBuffer.Alloc(nocsrElementsLength), CHIP_ERROR_NO_MEMORY);
+        MutableByteSpan nocsrElements(nocsrElementsBuffer.Get(), nocsrElementsLength);
+        ReturnErrorOnFailure(Credentials::ConstructNOCSRElements(ByteSpan(csrBuffer, csrLength), request.CSRNonce, ByteSpan(),
+                                                                 ByteSpan(), ByteSpan(), nocsrElements));
+
+        Crypto::P256ECDSASignature signatureBuffer;
+        MutableByteSpan signature(signatureBuffer.Bytes(), signatureBuffer.Capacity());
+        ReturnErrorOnFailure(SignWithDeviceAttestationKey(ec, nocsrElements, signature));
+
+        OperationalCredentials::Commands::CSRResponse::Type response;
+        response.NOCSRElements        = nocsrElements;
+        response.attestationSignature = signature;
+        return AddCommandResponse(invokeResponses, path, response);
+    }
+
+    // Installs the fabric and its IPK as a device does, then advertises the operational identity of the device.
+    CHIP_ERROR HandleAddNOC(Messaging::ExchangeContext * ec, const app::ConcreteCommandPath & path, TLV::TLVReader & fields,
+                            app::InvokeResponseIBs::Builder & invokeResponses)
+    {
+        OperationalCredentials::Commands::AddNOC::DecodableType request;
+        ReturnErrorOnFailure(app::DataModel::Decode(fields, request));
+        VerifyOrReturnError(request.IPKValue.size() == Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+        ReturnErrorOnFailure(mFabricBeingCommissioned.SetNOCCert(request.NOCValue));
+        ReturnErrorOnFailure(mFabricBeingCommissioned.SetICACert(request.ICACValue));
+        mFabricBeingCommissioned.SetVendorId(request.adminVendorId);
+
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        ReturnErrorOnFailure(mFabricTable.AddNewFabric(mFabricBeingCommissioned, &fabricIndex));
+        FabricInfo * fabric = mFabricTable.FindFabricWithIndex(fabricIndex);
+        VerifyOrReturnError(fabric != nullptr, CHIP_ERROR_INTERNAL);
+
+        Credentials::GroupDataProvider::KeySet keySet;
+        keySet.keyset_id     = Credentials::GroupDataProvider::kIdentityProtectionKeySetId;
+        keySet.policy        = app::Clusters::GroupKeyManagement::GroupKeySecurityPolicy::kTrustFirst;
+        keySet.num_keys_used = 1;
+        memcpy(keySet.epoch_keys[0].key, request.IPKValue.data(), Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES);
+        uint8_t compressedFabricIdBuffer[sizeof(uint64_t)];
+        MutableByteSpan compressedFabricId(compressedFabricIdBuffer);
+        ReturnErrorOnFailure(fabric->GetCompressedId(compressedFabricId));
+        ReturnErrorOnFailure(mGroupDataProvider.SetKeySet(fabricIndex, compressedFabricId, keySet));
+
+        ReturnErrorOnFailure(ec->GetSessionHandle()->AsSecureSession()->AdoptFabricIndex(fabricIndex));
+        ReturnErrorOnFailure(AdvertiseOperational(fabric->GetPeerId()));
+
+        OperationalCredentials::Commands::NOCResponse::Type response;
+        response.statusCode = OperationalCredentials::OperationalCertStatus::kSuccess;
+        response.fabricIndex.SetValue(fabricIndex);
+        return AddCommandResponse(invokeResponses, path, response);
+    }
+
+    // Hands the operational records of the device to minimal mDNS, as the answer to a query from the commissioner would.
+    CHIP_ERROR AdvertiseOperational(const PeerId & peerId)
+    {
+        char instanceName[Dnssd::Operational::kInstanceNameMaxLength + 1];
+        ReturnErrorOnFailure(Dnssd::MakeInstanceName(instanceName, sizeof(instanceName), peerId));
+        char hostName[17];
+        snprintf(hostName, sizeof(hostName), "%016" PRIX64, peerId.GetNodeId());
+
+        const mdns::Minimal::QNamePart serviceName[]  = { Dnssd::kOperationalServiceName, Dnssd::kOperationalProtocol,
+                                                         Dnssd::kLocalDomain };
+        const mdns::Minimal::QNamePart instanceQName[] = { instanceName, Dnssd::kOperationalServiceName,
+                                                           Dnssd::kOperationalProtocol, Dnssd::kLocalDomain };
+        const mdns::Minimal::QNamePart hostQName[]     = { hostName, Dnssd::kLocalDomain };
+        const char * txtEntries[]                      = { "T=0" };
+
+        Transport::PeerAddress address = GetAddress();
+        mdns::Minimal::ResponseBuilder builder(System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize));
+        VerifyOrReturnError(builder.HasPacketBuffer(), CHIP_ERROR_NO_MEMORY);
+        builder.AddRecord(mdns::Minimal::ResourceType::kAnswer, mdns::Minimal::PtrResourceRecord(serviceName, instanceQName))
+            .AddRecord(mdns::Minimal::ResourceType::kAdditional,
+                       mdns::Minimal::SrvResourceRecord(instanceQName, hostQName, address.GetPort()))
+            .AddRecord(mdns::Minimal::ResourceType::kAdditional, mdns::Minimal::TxtResourceRecord(instanceQName, txtEntries))
+            .AddRecord(mdns::Minimal::ResourceType::kAdditional,
+                       mdns::Minimal::IPResourceRecord(hostQName, address.GetIPAddress()));
+        VerifyOrReturnError(builder.Ok(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        System::PacketBufferHandle packet = builder.ReleasePacket();
+        Inet::IPPacketInfo packetInfo;
+        packetInfo.Clear();
+        Dnssd::GlobalMinimalMdnsServer::Instance().OnResponse(
+            mdns::Minimal::BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &packetInfo);
+        return CHIP_NO_ERROR;
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    TransportMgr<Transport::UDP> mTransportMgr;
+    FabricTable mFabricTable;
+    Credentials::GroupDataProviderImpl mGroupDataProvider;
+    SessionManager mSessionManager;
+    Messaging::ExchangeManager mExchangeManager;
+    secure_channel::MessageCounterManager mMessageCounterManager;
+    PASESession mPairing;
+    CASEServer mCASEServer;
+    FabricInfo mFabricBeingCommissioned;
+    size_t mPASESessionCount           = 0;
+    size_t mCommissioningCompleteCount = 0;
+};
+
+class TestPipelineDelegate : public CommissioningPipelineDelegate
+{
+public:
+    void OnCommissioningStatusUpdate(NodeId nodeId, CommissioningStage stageCompleted, CHIP_ERROR error) override
+    {
+        if (stageCompleted == CommissioningStage::kReadCommissioningInfo && error == CHIP_NO_ERROR)
+        {
+            mReadCommissioningInfoCount++;
+        }
+        mMaxActiveCount = std::max(mMaxActiveCount, mPipeline->GetActiveCount());
+    }
+
+    void OnCommissioningComplete(NodeId nodeId, CHIP_ERROR error) override
+    {
+        mCompleteCount++;
+        mErrorCount += (error == CHIP_NO_ERROR) ? 0 : 1;
+    }
+
+    void OnBatchComplete(size_t succeeded, size_t failed) override
+    {
+        mBatchComplete     = true;
+        mBatchCompleteTime = System::SystemClock().GetMonotonicTimestamp();
+        mSucceeded         = succeeded;
+        mFailed            = failed;
+        DeviceLayer::PlatformMgr().StopEventLoopTask();
+    }
+
+    CommissioningPipeline * mPipeline  = nullptr;
+    size_t mReadCommissioningInfoCount = 0;
+    size_t mMaxActiveCount             = 0;
+    size_t mCompleteCount              = 0;
+    size_t mErrorCount                 = 0;
+    bool mBatchComplete                = false;
+    size_t mSucceeded                  = 0;
+    size_t mFailed                     = 0;
+    System::Clock::Timestamp mBatchCompleteTime;
+};
+
+// The sessions of the fake devices are freed on destruction, so the memory is shut down after the members are destroyed.
+class TestContext : public Test::PlatformMemoryUser
+{
+public:
+    static int Initialize(void * context);
+    static int Finalize(void * context);
+
+    TestPersistentStorageDelegate mStorage;
+    Credentials::GroupDataProviderImpl mGroupDataProvider;
+    ExampleOperationalCredentialsIssuer mOperationalCredentialsIssuer;
+    Crypto::P256Keypair mOperationalKeypair;
+    Platform::ScopedMemoryBuffer<uint8_t> mNOC;
+    Platform::ScopedMemoryBuffer<uint8_t> mICAC;
+    Platform::ScopedMemoryBuffer<uint8_t> mRCAC;
+    SetupParams mSetupParams;
+
+    // The controller of the fabric, which the lanes share.
+    DeviceController mController;
+    DeviceCommissionerLane mLanes[kLaneCount];
+    FakeDevice mDevices[kDeviceCount];
+
+private:
+    CHIP_ERROR Init();
+    void Shutdown();
+};
+
+CHIP_ERROR TestContext::Init()
+{
+    ReturnErrorOnFailure(PlatformMemoryUser::Init());
+
+    mGroupDataProvider.SetStorageDelegate(&mStorage);
+    ReturnErrorOnFailure(mGroupDataProvider.Init());
+
+    FactoryInitParams factoryParams;
+    factoryParams.fabricIndependentStorage = &mStorage;
+    factoryParams.groupDataProvider        = &mGroupDataProvider;
+    ReturnErrorOnFailure(DeviceControllerFactory::GetInstance().Init(factoryParams));
+    // The fake devices use the example attestation credentials, which chain to the test PAAs.
+    Credentials::SetDeviceAttestationVerifier(Credentials::GetDefaultDACVerifier(Credentials::GetTestAttestationTrustStore()));
+
+    ReturnErrorOnFailure(mOperationalKeypair.Initialize());
+    ReturnErrorOnFailure(mOperationalCredentialsIssuer.Initialize(mStorage));
+    VerifyOrReturnError(mNOC.Alloc(kMaxCHIPDERCertLength), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mICAC.Alloc(kMaxCHIPDERCertLength), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mRCAC.Alloc(kMaxCHIPDERCertLength), CHIP_ERROR_NO_MEMORY);
+
+    MutableByteSpan nocSpan(mNOC.Get(), kMaxCHIPDERCertLength);
+    MutableByteSpan icacSpan(mICAC.Get(), kMaxCHIPDERCertLength);
+    MutableByteSpan rcacSpan(mRCAC.Get(), kMaxCHIPDERCertLength);
+    ReturnErrorOnFailure(mOperationalCredentialsIssuer.GenerateNOCChainAfterValidation(
+        kControllerNodeId, kFabricId, CATValues(), mOperationalKeypair.Pubkey(), rcacSpan, icacSpan, nocSpan));
+
+    mSetupParams.operationalCredentialsDelegate = &mOperationalCredentialsIssuer;
+    mSetupParams.operationalKeypair             = &mOperationalKeypair;
+    mSetupParams.controllerRCAC                 = rcacSpan;
+    mSetupParams.controllerICAC                 = icacSpan;
+    mSetupParams.controllerNOC                  = nocSpan;
+
+    ReturnErrorOnFailure(DeviceControllerFactory::GetInstance().SetupController(mSetupParams, mController));
+    // The example issuer hands the default IPK to the commissionees, which CASE with them needs.
+    FabricInfo * fabric = mController.GetFabricInfo();
+    VerifyOrReturnError(fabric != nullptr, CHIP_ERROR_INTERNAL);
+    uint8_t compressedFabricIdBuffer[sizeof(uint64_t)];
+    MutableByteSpan compressedFabricId(compressedFabricIdBuffer);
+    ReturnErrorOnFailure(fabric->GetCompressedId(compressedFabricId));
+    ReturnErrorOnFailure(Credentials::SetSingleIpkEpochKey(&mGroupDataProvider, fabric->GetFabricIndex(),
+                                                           GroupTesting::DefaultIpkValue::GetDefaultIpk(), compressedFabricId));
+    for (DeviceCommissionerLane & lane : mLanes)
+    {
+        ReturnErrorOnFailure(lane.Init(mSetupParams));
+    }
+    for (FakeDevice & device : mDevices)
+    {
+        ReturnErrorOnFailure(device.Init());
+    }
+    return CHIP_NO_ERROR;
+}
+
+void TestContext::Shutdown()
+{
+    for (DeviceCommissionerLane & lane : mLanes)
+    {
+        lane.Shutdown();
+    }
+    for (FakeDevice & device : mDevices)
+    {
+        device.Shutdown();
+    }
+    // The last controller tears the stack down.
+    mController.Shutdown();
+    DeviceControllerFactory::GetInstance().Shutdown();
+    mGroupDataProvider.Finish();
+    mNOC.Free();
+    mICAC.Free();
+    mRCAC.Free();
+}
+
+int TestContext::Initialize(void * context)
+{
+    CHIP_ERROR err = static_cast<TestContext *>(context)->Init();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to set up the commissioning pipeline loopback test: %" CHIP_ERROR_FORMAT, err.Format());
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int TestContext::Finalize(void * context)
+{
+    static_cast<TestContext *>(context)->Shutdown();
+    return SUCCESS;
+}
+
+// Each lane of a pipeline looks for commissionable nodes: an answer from a node must reach every one of them, although
+// minimal mDNS hands it to the last lane that started looking only.
+void TestDiscoveryReachesEveryLane(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CommissioningLane * lanePointers[kLaneCount];
+    for (size_t i = 0; i < kLaneCount; i++)
+    {
+        lanePointers[i] = &ctx.mLanes[i];
+    }
+    CommissioningPipeline pipeline;
+    TestPipelineDelegate delegate;
+    NL_TEST_ASSERT(apSuite,
+                   pipeline.Init(&DeviceLayer::SystemLayer(), Span<CommissioningLane * const>(lanePointers), &delegate) ==
+                       CHIP_NO_ERROR);
+
+    for (DeviceCommissionerLane & lane : ctx.mLanes)
+    {
+        // Sending the query fails on hosts without a multicast interface, but the lane listens for answers regardless.
+        lane.GetCommissioner().DiscoverCommissionableNodes(Dnssd::DiscoveryFilter());
+    }
+
+    const mdns::Minimal::QNamePart serviceName[]  = { Dnssd::kCommissionableServiceName, Dnssd::kCommissionProtocol,
+                                                     Dnssd::kLocalDomain };
+    const mdns::Minimal::QNamePart instanceName[] = { kInstanceName, Dnssd::kCommissionableServiceName,
+                                                      Dnssd::kCommissionProtocol, Dnssd::kLocalDomain };
+    const mdns::Minimal::QNamePart hostName[]     = { kHostName, Dnssd::kLocalDomain };
+
+    Transport::PeerAddress address = ctx.mDevices[0].GetAddress();
+    mdns::Minimal::ResponseBuilder builder(System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize));
+    NL_TEST_ASSERT(apSuite, builder.HasPacketBuffer());
+    builder.AddRecord(mdns::Minimal::ResourceType::kAnswer, mdns::Minimal::PtrResourceRecord(serviceName, instanceName))
+        .AddRecord(mdns::Minimal::ResourceType::kAdditional,
+                   mdns::Minimal::SrvResourceRecord(instanceName, hostName, address.GetPort()))
+        .AddRecord(mdns::Minimal::ResourceType::kAdditional, mdns::Minimal::IPResourceRecord(hostName, address.GetIPAddress()));
+    NL_TEST_ASSERT(apSuite, builder.Ok());
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    Inet::IPPacketInfo packetInfo;
+    packetInfo.Clear();
+    Dnssd::GlobalMinimalMdnsServer::Instance().OnResponse(
+        mdns::Minimal::BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &packetInfo);
+
+    for (DeviceCommissionerLane & lane : ctx.mLanes)
+    {
+        const Dnssd::DiscoveredNodeData * node = lane.GetCommissioner().GetDiscoveredDevice(0);
+        NL_TEST_ASSERT(apSuite, node != nullptr);
+        NL_TEST_ASSERT(apSuite, node != nullptr && strcmp(node->hostName, kHostName) == 0);
+        NL_TEST_ASSERT(apSuite, node != nullptr && node->port == address.GetPort());
+    }
+
+    pipeline.Shutdown();
+}
+
+void OnBatchTimeout(System::Layer * systemLayer, void * context)
+{
+    ChipLogError(Controller, "The commissioning batch timed out");
+    DeviceLayer::PlatformMgr().StopEventLoopTask();
+}
+
+// Each device is commissioned end to end by the lane it is handed to: PASE, attestation, NOC, operational discovery and
+// CASE. Prints the throughput of the pipeline.
+void TestCommissionBatch(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    CommissioningLane * lanePointers[kLaneCount];
+    for (size_t i = 0; i < kLaneCount; i++)
+    {
+        lanePointers[i] = &ctx.mLanes[i];
+    }
+
+    RendezvousParameters rendezvousParams[kDeviceCount];
+    CommissioningRequest requests[kDeviceCount];
+    for (size_t i = 0; i < kDeviceCount; i++)
+    {
+        rendezvousParams[i].SetSetupPINCode(kSetupPINCode).SetPeerAddress(ctx.mDevices[i].GetAddress());
+        requests[i].nodeId           = 0x100 + i;
+        requests[i].rendezvousParams = &rendezvousParams[i];
+    }
+
+    CommissioningPipeline pipeline;
+    TestPipelineDelegate delegate;
+    delegate.mPipeline = &pipeline;
+    NL_TEST_ASSERT(apSuite,
+                   pipeline.Init(&DeviceLayer::SystemLayer(), Span<CommissioningLane * const>(lanePointers), &delegate) ==
+                       CHIP_NO_ERROR);
+    System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    NL_TEST_ASSERT(apSuite, pipeline.Commission(Span<const CommissioningRequest>(requests), CommissioningParameters()) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, DeviceLayer::SystemLayer().StartTimer(kBatchTimeout, OnBatchTimeout, nullptr) == CHIP_NO_ERROR);
+    DeviceLayer::PlatformMgr().RunEventLoop();
+    DeviceLayer::SystemLayer().CancelTimer(OnBatchTimeout, nullptr);
+
+    NL_TEST_ASSERT(apSuite, delegate.mBatchComplete);
+    NL_TEST_ASSERT(apSuite, delegate.mCompleteCount == kDeviceCount);
+    NL_TEST_ASSERT(apSuite, delegate.mErrorCount == 0);
+    NL_TEST_ASSERT(apSuite, delegate.mSucceeded == kDeviceCount);
+    NL_TEST_ASSERT(apSuite, delegate.mFailed == 0);
+    NL_TEST_ASSERT(apSuite, delegate.mReadCommissioningInfoCount == kDeviceCount);
+    NL_TEST_ASSERT(apSuite, delegate.mMaxActiveCount == kLaneCount);
+    for (FakeDevice & device : ctx.mDevices)
+    {
+        NL_TEST_ASSERT(apSuite, device.GetPASESessionCount() == 1);
+        NL_TEST_ASSERT(apSuite, device.GetCommissioningCompleteCount() == 1);
+    }
+
+    if (delegate.mBatchComplete)
+    {
+        System::Clock::Milliseconds64 elapsed = delegate.mBatchCompleteTime - startTime;
+        printf("Commissioned %u of %u devices with %u lanes in %u ms: %.1f devices/s\n", static_cast<unsigned>(delegate.mSucceeded),
+               static_cast<unsigned>(kDeviceCount), static_cast<unsigned>(kLaneCount), static_cast<unsigned>(elapsed.count()),
+               static_cast<double>(delegate.mSucceeded) * 1000 / static_cast<double>(std::max<uint64_t>(elapsed.count(), 1)));
+    }
+
+    pipeline.Shutdown();
+}
+
+// Shutting a lane down leaves the fabric to the other lanes and to the controller.
+void TestLaneShutdownKeepsFabric(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    FabricInfo * fabric = ctx.mLanes[1].GetCommissioner().GetFabricInfo();
+    NL_TEST_ASSERT(apSuite, fabric != nullptr && fabric == ctx.mController.GetFabricInfo());
+
+    ctx.mLanes[0].Shutdown();
+
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+    NL_TEST_ASSERT(apSuite, fabric != nullptr && fabric->IsInitialized());
+    NL_TEST_ASSERT(apSuite, ctx.mLanes[1].GetCommissioner().GetFabricIndex(&fabricIndex) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, fabricIndex != kUndefinedFabricIndex);
+    NL_TEST_ASSERT(apSuite, ctx.mController.GetCompressedFabricId() == ctx.mLanes[1].GetCommissioner().GetCompressedFabricId());
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestDiscoveryReachesEveryLane", TestDiscoveryReachesEveryLane),
+    NL_TEST_DEF("TestCommissionBatch", TestCommissionBatch),
+    NL_TEST_DEF("TestLaneShutdownKeepsFabric", TestLaneShutdownKeepsFabric),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "TestCommissioningPipelineLoopback",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestCommissioningPipelineLoopback()
+{
+    TestContext gContext;
+    nlTestRunner(&sSuite, &gContext);
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommissioningPipelineLoopback)
@@ -27,6 +27,7 @@
 #include <app/CommandHandlerInterface.h>
 #include <app/InteractionModelEngine.h>
 #include <app/data-model/Decode.h>
+#include <app/reporting/reporting.h>
 #include <app/tests/AppTestContext.h>
 #include <app/util/DataModelHandler.h>
 #include <app/util/attribute-storage.h>
@@ -42,6 +43,12 @@
 #include <nlunit-test.h>
 #include <utility>
 
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0 && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
 using TestContext = chip::Test::AppContext;
 using namespace chip;
 using namespace chip::app::Clusters;
@@ -65,6 +72,11 @@ constexpr EndpointId kTestEndpointId4    = 4;
 constexpr EndpointId kTestEndpointId5    = 5;
 constexpr AttributeId kTestListAttribute = 6;
 constexpr AttributeId kTestBadAttribute  = 7; // Reading this attribute will return CHIP_NO_MEMORY but nothing is actually encoded.
+// A list attribute spanning many report messages.
+constexpr AttributeId kTestLargeListAttribute = 8;
+constexpr uint32_t kTestLargeListSize         = 1000;
+// The number of list items the data model was asked to encode for kTestLargeListAttribute.
+uint32_t gLargeListItemsEncoded = 0;
 
 class TestCommandInteraction
 {
@@ -75,6 +87,12 @@ public:
     static void TestBadChunking(nlTestSuite * apSuite, void * apContext);
     static void TestDynamicEndpoint(nlTestSuite * apSuite, void * apContext);
     static void TestSetDirtyBetweenChunks(nlTestSuite * apSuite, void * apContext);
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    static void TestLargeListChainedEncoding(nlTestSuite * apSuite, void * apContext);
+#endif
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0 && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    static void TestAttributeChangesFromOtherThreads(nlTestSuite * apSuite, void * apContext);
+#endif
 
 private:
 };
@@ -92,7 +110,7 @@ DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
 
 DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testClusterAttrsOnEndpoint3)
 DECLARE_DYNAMIC_ATTRIBUTE(kTestListAttribute, ARRAY, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(kTestBadAttribute, ARRAY, 1, 0),
-    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+    DECLARE_DYNAMIC_ATTRIBUTE(kTestLargeListAttribute, ARRAY, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
 
 DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpoint3Clusters)
 DECLARE_DYNAMIC_CLUSTER(TestCluster::Id, testClusterAttrsOnEndpoint3, nullptr, nullptr), DECLARE_DYNAMIC_CLUSTER_LIST_END;
@@ -135,6 +153,7 @@ public:
     void OnSubscriptionEstablished(uint64_t aSubscriptionId) override { mOnSubscriptionEstablished = true; }
 
     uint32_t mAttributeCount        = 0;
+    size_t mLargeListSize           = 0;
     bool mOnReportEnd               = false;
     bool mOnSubscriptionEstablished = false;
     app::BufferedReadCallback mBufferedCallback;
@@ -175,6 +194,19 @@ void TestReadCallback::OnAttributeData(const app::ConcreteDataAttributePath & aP
     {
         // Nothing to check for this one; depends on the endpoint.
     }
+    else if (aPath.mAttributeId == kTestLargeListAttribute)
+    {
+        app::DataModel::DecodableList<uint32_t> v;
+        NL_TEST_ASSERT(gSuite, app::DataModel::Decode(*apData, v) == CHIP_NO_ERROR);
+        auto it         = v.begin();
+        uint32_t expect = 0;
+        while (it.Next())
+        {
+            NL_TEST_ASSERT(gSuite, it.GetValue() == expect++);
+        }
+        NL_TEST_ASSERT(gSuite, it.GetStatus() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(gSuite, v.ComputeSize(&mLargeListSize) == CHIP_NO_ERROR);
+    }
     else if (aPath.mAttributeId != kTestListAttribute)
     {
         uint8_t v;
@@ -278,6 +310,15 @@ CHIP_ERROR TestAttrAccess::Read(const app::ConcreteReadAttributePath & aPath, ap
         return aEncoder.EncodeList([](const auto & encoder) {
             return encoder.Encode(ByteSpan(sAnStringThatCanNeverFitIntoTheMTU, sizeof(sAnStringThatCanNeverFitIntoTheMTU)));
         });
+    case kTestLargeListAttribute:
+        return aEncoder.EncodeList([](const auto & encoder) {
+            for (uint32_t i = 0; i < kTestLargeListSize; i++)
+            {
+                gLargeListItemsEncoded++;
+                ReturnErrorOnFailure(encoder.Encode(i));
+            }
+            return CHIP_NO_ERROR;
+        });
     default:
         return aEncoder.Encode((uint8_t) gIterationCount);
     }
@@ -890,6 +931,197 @@ void TestCommandInteraction::TestSetDirtyBetweenChunks(nlTestSuite * apSuite, vo
     app::InteractionModelEngine::GetInstance()->GetReportingEngine().SetMaxAttributesPerChunk(UINT32_MAX);
 }
 
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+/*
+ * Reads a list attribute spanning many report messages, first encoding the attribute data of each report message in that
+ * message, then encoding it ahead into chained buffers, and compares the cost of both: the list is encoded again from its
+ * start for each batch of report data, so chaining buffers should ask the data model for far fewer items.
+ */
+void TestCommandInteraction::TestLargeListChainedEncoding(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                        = *static_cast<TestContext *>(apContext);
+    auto sessionHandle                       = ctx.GetSessionBobToAlice();
+    app::InteractionModelEngine * engine     = app::InteractionModelEngine::GetInstance();
+    app::reporting::Engine & reportingEngine = engine->GetReportingEngine();
+
+    // Initialize the ember side server logic
+    InitDataModelHandler(&ctx.GetExchangeManager());
+
+    // Register our fake dynamic endpoint.
+    DataVersion dataVersionStorage[ArraySize(testEndpoint3Clusters)];
+    emberAfSetDynamicEndpoint(0, kTestEndpointId3, &testEndpoint3, Span<DataVersion>(dataVersionStorage));
+
+    app::AttributePathParams attributePath(kTestEndpointId3, app::Clusters::TestCluster::Id, kTestLargeListAttribute);
+    app::ReadPrepareParams readParams(sessionHandle);
+
+    readParams.mpAttributePathParamsList    = &attributePath;
+    readParams.mAttributePathParamsListSize = 1;
+
+    uint32_t itemsEncoded[2];
+    uint64_t elapsedUs[2];
+    const uint8_t chainBuffers[2] = { 0, CHIP_IM_MAX_REPORT_CHAIN_BUFFERS };
+
+    for (size_t i = 0; i < ArraySize(chainBuffers); i++)
+    {
+        TestReadCallback readCallback;
+
+        reportingEngine.SetMaxReportChainBuffers(chainBuffers[i]);
+        gLargeListItemsEncoded = 0;
+        auto start             = System::SystemClock().GetMonotonicMicroseconds64();
+
+        {
+            app::ReadClient readClient(engine, &ctx.GetExchangeManager(), readCallback.mBufferedCallback,
+                                       app::ReadClient::InteractionType::Read);
+
+            NL_TEST_ASSERT(apSuite, readClient.SendRequest(readParams) == CHIP_NO_ERROR);
+
+            ctx.DrainAndServiceIO();
+        }
+
+        elapsedUs[i]    = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+        itemsEncoded[i] = gLargeListItemsEncoded;
+
+        NL_TEST_ASSERT(apSuite, readCallback.mOnReportEnd);
+        NL_TEST_ASSERT(apSuite, readCallback.mLargeListSize == kTestLargeListSize);
+        NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+    }
+
+    // Encoding in place asks for about kTestLargeListSize * N / 2 items over N report messages. Each batch of chained buffers
+    // holds the items of several report messages, so the list is started over several times less often.
+    NL_TEST_ASSERT(apSuite, itemsEncoded[1] * 3 < itemsEncoded[0]);
+
+    printf("%" PRIu32 " list items: %" PRIu64 " us encoding %" PRIu32 " items in place, %" PRIu64 " us encoding %" PRIu32
+           " items into up to %u chained buffers\n",
+           kTestLargeListSize, elapsedUs[0], itemsEncoded[0], elapsedUs[1], itemsEncoded[1],
+           static_cast<unsigned>(chainBuffers[1]));
+
+    reportingEngine.SetMaxReportChainBuffers(CHIP_IM_MAX_REPORT_CHAIN_BUFFERS);
+    emberAfClearDynamicEndpoint(0);
+}
+#endif
+
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0 && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+/*
+ * Notifies attribute changes from several threads through the attribute change queue, while this thread stands in for the CHIP
+ * event loop, and measures how fast the producers go and how long a change takes to reach a subscriber.
+ */
+void TestCommandInteraction::TestAttributeChangesFromOtherThreads(nlTestSuite * apSuite, void * apContext)
+{
+    using namespace TestSetDirtyBetweenChunksUtil;
+    TestContext & ctx                    = *static_cast<TestContext *>(apContext);
+    auto sessionHandle                   = ctx.GetSessionBobToAlice();
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+
+    gCtx   = &ctx;
+    gSuite = apSuite;
+
+    // Initialize the ember side server logic
+    InitDataModelHandler(&ctx.GetExchangeManager());
+
+    DataVersion dataVersionStorage[ArraySize(testEndpoint5Clusters)] = {};
+
+    gMutableAttrAccess.Reset();
+
+    // Register our fake dynamic endpoint.
+    emberAfSetDynamicEndpoint(0, kTestEndpointId5, &testEndpoint5, Span<DataVersion>(dataVersionStorage));
+
+    app::AttributePathParams attributePath(kTestEndpointId5, TestCluster::Id);
+    app::ReadPrepareParams readParams(sessionHandle);
+
+    readParams.mpAttributePathParamsList    = &attributePath;
+    readParams.mAttributePathParamsListSize = 1;
+    readParams.mMinIntervalFloorSeconds     = 0;
+    readParams.mMaxIntervalCeilingSeconds   = 2;
+
+    {
+        TestMutableReadCallback readCallback;
+
+        app::ReadClient readClient(engine, &ctx.GetExchangeManager(), readCallback.mBufferedCallback,
+                                   app::ReadClient::InteractionType::Subscribe);
+
+        NL_TEST_ASSERT(apSuite, readClient.SendRequest(readParams) == CHIP_NO_ERROR);
+
+        DriveIOUntilSubscriptionEstablished(&readCallback);
+
+        // Producer throughput: the changes of a few hot attributes get coalesced.
+        constexpr uint32_t kProducers          = 4;
+        constexpr uint32_t kChangesPerProducer = 10000;
+        std::atomic<uint32_t> producersDone{ 0 };
+        std::atomic<uint32_t> queueFullCount{ 0 };
+        std::vector<std::thread> producers;
+        const DataVersion versionBefore = dataVersionStorage[0];
+
+        auto start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (uint32_t producer = 0; producer < kProducers; producer++)
+        {
+            producers.emplace_back([&]() {
+                for (uint32_t i = 0; i < kChangesPerProducer; i++)
+                {
+                    auto attribute = static_cast<AttributeId>(1 + i % 3);
+                    while (MatterReportingAttributeChangeCallbackFromAnyThread(kTestEndpointId5, TestCluster::Id, attribute) !=
+                           CHIP_NO_ERROR)
+                    {
+                        queueFullCount++;
+                        std::this_thread::yield();
+                    }
+                }
+                producersDone++;
+            });
+        }
+        while (true)
+        {
+            // Checked before processing, so that the last pass picks up the last changes.
+            bool done = producersDone.load() == kProducers;
+            MatterReportingProcessQueuedAttributeChanges();
+            if (done)
+            {
+                break;
+            }
+            std::this_thread::yield();
+        }
+        const uint64_t producersUs = (System::SystemClock().GetMonotonicMicroseconds64() - start).count();
+        for (auto & producer : producers)
+        {
+            producer.join();
+        }
+
+        const DataVersion versionsUsed = dataVersionStorage[0] - versionBefore;
+        NL_TEST_ASSERT(apSuite, versionsUsed > 0 && versionsUsed < kProducers * kChangesPerProducer);
+
+        DriveIOUntilEndOfReport(&readCallback);
+        NL_TEST_ASSERT(apSuite, readCallback.mAttributeCount > 0);
+
+        // End-to-end latency: from a change on another thread to the end of the report carrying it.
+        constexpr uint32_t kRounds = 20;
+        uint64_t latencyUs         = 0;
+        for (uint32_t round = 0; round < kRounds; round++)
+        {
+            System::Clock::Microseconds64 changed;
+            CHIP_ERROR err = CHIP_NO_ERROR;
+            std::thread device([&]() {
+                changed = System::SystemClock().GetMonotonicMicroseconds64();
+                err     = MatterReportingAttributeChangeCallbackFromAnyThread(kTestEndpointId5, TestCluster::Id, 1);
+            });
+            device.join();
+            NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+            MatterReportingProcessQueuedAttributeChanges();
+            DriveIOUntilEndOfReport(&readCallback);
+            latencyUs += (System::SystemClock().GetMonotonicMicroseconds64() - changed).count();
+        }
+
+        printf("%" PRIu32 " producers: %" PRIu64 " ns per change, queue full %" PRIu32 " times, %" PRIu32
+               " data versions; %" PRIu64 " us from change to report\n",
+               kProducers, producersUs * 1000 / (kProducers * kChangesPerProducer), queueFullCount.load(), versionsUsed,
+               latencyUs / kRounds);
+    }
+
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+
+    emberAfClearDynamicEndpoint(0);
+}
+#endif
+
 // clang-format off
 const nlTest sTests[] =
 {
@@ -898,6 +1130,12 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestBadChunking", TestCommandInteraction::TestBadChunking),
     NL_TEST_DEF("TestDynamicEndpoint", TestCommandInteraction::TestDynamicEndpoint),
     NL_TEST_DEF("TestSetDirtyBetweenChunks", TestCommandInteraction::TestSetDirtyBetweenChunks),
+#if CHIP_IM_MAX_REPORT_CHAIN_BUFFERS > 0
+    NL_TEST_DEF("TestLargeListChainedEncoding", TestCommandInteraction::TestLargeListChainedEncoding),
+#endif
+#if CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE > 0 && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    NL_TEST_DEF("TestAttributeChangesFromOtherThreads", TestCommandInteraction::TestAttributeChangesFromOtherThreads),
+#endif
     NL_TEST_SENTINEL()
 };
 
@@ -171,6 +171,15 @@ public:
     CHIP_ERROR VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, Credentials::ValidationContext & context,
                                  PeerId & nocPeerId, FabricId & fabricId, Crypto::P256PublicKey & nocPubkey) const;
 
+    /**
+     *  Verify the operational credentials against the given root certificate, without using any fabric.
+     *  This does not touch the fabric table, so it can run on a thread other than the CHIP event loop,
+     *  provided the caller owns the memory of all the certificates.
+     */
+    static CHIP_ERROR VerifyCredentials(const ByteSpan & rcac, const ByteSpan & noc, const ByteSpan & icac,
+                                        Credentials::ValidationContext & context, NodeId & nodeId, FabricId & fabricId,
+                                        Crypto::P256PublicKey & nocPubkey);
+
     /**
      *  Reset the state to a completely uninitialized status.
      */
@@ -882,6 +882,7 @@ struct KeySetData : PersistentData<kPersistentBufferMax>
 
 constexpr size_t GroupDataProvider::GroupInfo::kGroupNameMax;
 constexpr size_t GroupDataProviderImpl::kIteratorsMax;
+constexpr size_t GroupDataProviderImpl::kGroupSessionsMax;
 
 CHIP_ERROR GroupDataProviderImpl::Init()
 {
@@ -889,6 +890,7 @@ CHIP_ERROR GroupDataProviderImpl::Init()
     {
         return CHIP_ERROR_INCORRECT_STATE;
     }
+    RebuildGroupSessions();
     return CHIP_NO_ERROR;
 }
 
@@ -900,6 +902,9 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mKeyContexPool.ReleaseAll();
+    Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mGroupSessions), sizeof(mGroupSessions));
+    mGroupSessionCount    = 0;
+    mGroupSessionsIndexed = false;
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
@@ -1442,7 +1447,9 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     if (found)
     {
         // Update existing map
-        return map.Save(mStorage);
+        ReturnErrorOnFailure(map.Save(mStorage));
+        UpdateGroupSessions(fabric_index);
+        return CHIP_NO_ERROR;
     }
 
     // Insert last
@@ -1467,7 +1474,9 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     }
     // Update fabric
     fabric.map_count++;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    UpdateGroupSessions(fabric_index);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, GroupKey & out_map)
@@ -1515,7 +1524,9 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
         fabric.map_count--;
     }
     // Update fabric
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    UpdateGroupSessions(fabric_index);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
@@ -1540,7 +1551,9 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index
     // Update fabric
     fabric.first_map = 0;
     fabric.map_count = 0;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    RemoveGroupSessions(fabric_index);
+    return CHIP_NO_ERROR;
 }
 
 GroupDataProvider::GroupKeyIterator * GroupDataProviderImpl::IterateGroupKeys(chip::FabricIndex fabric_index)
@@ -1628,7 +1641,9 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     if (found)
     {
         // Update existing keyset info, keep next
-        return keyset.Save(mStorage);
+        ReturnErrorOnFailure(keyset.Save(mStorage));
+        UpdateGroupSessions(fabric_index);
+        return CHIP_NO_ERROR;
     }
 
     // New keyset, insert first
@@ -1637,7 +1652,9 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     // Update fabric
     fabric.keyset_count++;
     fabric.first_keyset = in_keyset.keyset_id;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    UpdateGroupSessions(fabric_index);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint16_t target_id, KeySet & out_keyset)
@@ -1691,7 +1708,9 @@ CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, u
         fabric.keyset_count--;
     }
     // Update fabric info
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    UpdateGroupSessions(fabric_index);
+    return CHIP_NO_ERROR;
 }
 
 GroupDataProvider::KeySetIterator * GroupDataProviderImpl::IterateKeySets(chip::FabricIndex fabric_index)
@@ -1786,6 +1805,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
         keyset_count++;
     }
 
+    RemoveGroupSessions(fabric_index);
+
     // Remove fabric
     return fabric.Delete(mStorage);
 }
@@ -1899,6 +1920,13 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mKeyContext(provider)
 {
+    if (provider.mGroupSessionsIndexed)
+    {
+        mSession = provider.FindGroupSession(session_id);
+        mIndexed = true;
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_fabric;
@@ -1911,9 +1939,20 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
-    FabricData fabric(mFirstFabric);
     size_t count = 0;
 
+    if (mIndexed)
+    {
+        for (size_t i = mProvider.FindGroupSession(mSessionId);
+             i < mProvider.mGroupSessionCount && mProvider.mGroupSessions[i].session_id == mSessionId; ++i)
+        {
+            count++;
+        }
+        return count;
+    }
+
+    FabricData fabric(mFirstFabric);
+
     for (size_t i = 0; i < mFabricTotal; i++, fabric.fabric_index = fabric.next)
     {
         if (CHIP_NO_ERROR != fabric.Load(mProvider.mStorage))
@@ -1952,6 +1991,21 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mIndexed)
+    {
+        VerifyOrReturnError(mSession < mProvider.mGroupSessionCount, false);
+        const GroupSessionEntry & entry = mProvider.mGroupSessions[mSession];
+        VerifyOrReturnError(entry.session_id == mSessionId, false);
+        mSession++;
+
+        mKeyContext.SetKey(ByteSpan(entry.key), mSessionId);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = entry.security_policy;
+        output.key             = &mKeyContext;
+        return true;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -2009,6 +2063,168 @@ void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
+//
+// Session index
+//
+
+void GroupDataProviderImpl::UpdateGroupSessions(chip::FabricIndex fabric_index)
+{
+    if (!mGroupSessionsIndexed)
+    {
+        // The index overflowed earlier, the removal of keys may have made room
+        RebuildGroupSessions();
+        return;
+    }
+
+    CHIP_ERROR err = IndexGroupSessions(fabric_index);
+    if (CHIP_NO_ERROR != err)
+    {
+        ChipLogError(Crypto, "Group session index disabled, err = %" CHIP_ERROR_FORMAT, err.Format());
+        mGroupSessionsIndexed = false;
+    }
+}
+
+void GroupDataProviderImpl::RebuildGroupSessions()
+{
+    Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mGroupSessions), sizeof(mGroupSessions));
+    mGroupSessionCount    = 0;
+    mGroupSessionsIndexed = false;
+
+    // Index disabled: group sessions are always resolved from storage
+    VerifyOrReturn(kGroupSessionsMax > 0);
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    if (CHIP_ERROR_NOT_FOUND == err)
+    {
+        // No fabric has group data yet
+        mGroupSessionsIndexed = true;
+        return;
+    }
+
+    FabricData fabric(fabric_list.first_fabric);
+    for (size_t i = 0; (CHIP_NO_ERROR == err) && (i < fabric_list.fabric_count); i++, fabric.fabric_index = fabric.next)
+    {
+        err = fabric.Load(mStorage);
+        if (CHIP_NO_ERROR == err)
+        {
+            err = IndexGroupSessions(fabric.fabric_index);
+        }
+    }
+
+    if (CHIP_NO_ERROR != err)
+    {
+        ChipLogError(Crypto, "Group session index disabled, err = %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mGroupSessionsIndexed = true;
+}
+
+CHIP_ERROR GroupDataProviderImpl::IndexGroupSessions(chip::FabricIndex fabric_index)
+{
+    RemoveGroupSessions(fabric_index);
+
+    FabricData fabric(fabric_index);
+    CHIP_ERROR err = fabric.Load(mStorage);
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+    for (uint16_t i = 0; i < fabric.map_count; ++i, mapping.id = mapping.next)
+    {
+        ReturnErrorOnFailure(mapping.Load(mStorage));
+
+        KeySetData keyset;
+        if (!keyset.Find(mStorage, fabric, mapping.keyset_id))
+        {
+            // The mapping may outlive its keyset
+            continue;
+        }
+
+        GroupSessionEntry entry;
+        entry.fabric_index    = fabric_index;
+        entry.group_id        = mapping.group_id;
+        entry.security_policy = keyset.policy;
+        for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+        {
+            entry.session_id = keyset.operational_keys[k].hash;
+            memcpy(entry.key, keyset.operational_keys[k].value, sizeof(entry.key));
+            err = AddGroupSession(entry);
+            if (CHIP_NO_ERROR != err)
+            {
+                break;
+            }
+        }
+        Crypto::ClearSecretData(entry.key);
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(keyset.operational_keys), sizeof(keyset.operational_keys));
+        ReturnErrorOnFailure(err);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR GroupDataProviderImpl::AddGroupSession(const GroupSessionEntry & entry)
+{
+    VerifyOrReturnError(mGroupSessionCount < kGroupSessionsMax, CHIP_ERROR_NO_MEMORY);
+
+    // Insert after all the entries ordered before the new one
+    size_t index = FindGroupSession(entry.session_id);
+    while (index < mGroupSessionCount && mGroupSessions[index].session_id == entry.session_id &&
+           (mGroupSessions[index].group_id < entry.group_id ||
+            (mGroupSessions[index].group_id == entry.group_id && mGroupSessions[index].fabric_index <= entry.fabric_index)))
+    {
+        index++;
+    }
+    for (size_t i = mGroupSessionCount; i > index; --i)
+    {
+        mGroupSessions[i] = mGroupSessions[i - 1];
+    }
+    mGroupSessions[index] = entry;
+    mGroupSessionCount++;
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::RemoveGroupSessions(chip::FabricIndex fabric_index)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < mGroupSessionCount; ++i)
+    {
+        if (mGroupSessions[i].fabric_index != fabric_index)
+        {
+            if (count != i)
+            {
+                mGroupSessions[count] = mGroupSessions[i];
+            }
+            count++;
+        }
+    }
+    for (size_t i = count; i < mGroupSessionCount; ++i)
+    {
+        Crypto::ClearSecretData(mGroupSessions[i].key);
+        mGroupSessions[i] = GroupSessionEntry();
+    }
+    mGroupSessionCount = count;
+}
+
+size_t GroupDataProviderImpl::FindGroupSession(uint16_t session_id) const
+{
+    // Lower bound: first entry whose session id is not less than the target
+    size_t low  = 0;
+    size_t high = mGroupSessionCount;
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (mGroupSessions[mid].session_id < session_id)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
 namespace {
 
 GroupDataProvider * gGroupsProvider = nullptr;
@@ -26,7 +26,8 @@ namespace Credentials {
 class GroupDataProviderImpl : public GroupDataProvider
 {
 public:
-    static constexpr size_t kIteratorsMax = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kIteratorsMax     = CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS;
+    static constexpr size_t kGroupSessionsMax = CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE;
 
     GroupDataProviderImpl() = default;
     GroupDataProviderImpl(uint16_t maxGroupsPerFabric, uint16_t maxGroupKeysPerFabric) :
@@ -218,12 +219,39 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
+        size_t mSession          = 0;
+        bool mIndexed            = false;
         GroupKeyContext mKeyContext;
     };
+
+    // Operational group key bound to one of the groups mapped to its key set.
+    // Entries are kept sorted by (session_id, group_id, fabric_index).
+    struct GroupSessionEntry
+    {
+        uint16_t session_id                                          = 0;
+        GroupId group_id                                             = kUndefinedGroupId;
+        FabricIndex fabric_index                                     = kUndefinedFabricIndex;
+        SecurityPolicy security_policy                               = SecurityPolicy::kCacheAndSync;
+        uint8_t key[Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES] = { 0 };
+    };
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
+    // Session index
+    void UpdateGroupSessions(FabricIndex fabric_index);
+    void RebuildGroupSessions();
+    CHIP_ERROR IndexGroupSessions(FabricIndex fabric_index);
+    CHIP_ERROR AddGroupSession(const GroupSessionEntry & entry);
+    void RemoveGroupSessions(FabricIndex fabric_index);
+    size_t FindGroupSession(uint16_t session_id) const;
+
     chip::PersistentStorageDelegate * mStorage = nullptr;
+    // In-memory index of the operational group keys, unused when kGroupSessionsMax is 0. When it cannot hold every key,
+    // mGroupSessionsIndexed is false and group sessions are resolved from storage instead.
+    GroupSessionEntry mGroupSessions[kGroupSessionsMax > 0 ? kGroupSessionsMax : 1];
+    size_t mGroupSessionCount  = 0;
+    bool mGroupSessionsIndexed = false;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
     ObjectPool<GroupKeyIteratorImpl, kIteratorsMax> mGroupKeyIterators;
     ObjectPool<EndpointIteratorImpl, kIteratorsMax> mEndpointIterators;
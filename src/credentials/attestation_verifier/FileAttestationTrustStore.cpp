@@ -16,6 +16,8 @@
  */
 #include "FileAttestationTrustStore.h"
 
+#include <lib/support/logging/CHIPLogging.h>
+
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -63,11 +65,19 @@ FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStoreP
                 file = fopen(filename.c_str(), "rb");
                 if (file != nullptr)
                 {
-                    uint32_t certificateLength = fread(certificate.data(), sizeof(uint8_t), kMaxDERCertLength, file);
+                    size_t certificateLength = fread(certificate.data(), sizeof(uint8_t), kMaxDERCertLength, file);
                     if (certificateLength > 0)
                     {
-                        mDerCerts.push_back(certificate);
-                        mIsInitialized = true;
+                        CHIP_ERROR err = AddCert(ByteSpan(certificate.data(), certificateLength));
+                        if (err == CHIP_NO_ERROR)
+                        {
+                            mIsInitialized = true;
+                        }
+                        else
+                        {
+                            ChipLogError(Controller, "Skipping PAA certificate %s: %" CHIP_ERROR_FORMAT, filename.c_str(),
+                                         err.Format());
+                        }
                     }
                     fclose(file);
                 }
@@ -93,6 +103,19 @@ void FileAttestationTrustStore::Cleanup()
     mIsInitialized = false;
 }
 
+CHIP_ERROR FileAttestationTrustStore::AddCert(const ByteSpan & derCert)
+{
+    VerifyOrReturnError(derCert.size() <= kMaxDERCertLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Skid skid;
+    MutableByteSpan skidSpan(skid);
+    VerifyOrReturnError(Crypto::ExtractSKIDFromX509Cert(derCert, skidSpan) == CHIP_NO_ERROR, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(skidSpan.size() == skid.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    bool inserted = mDerCerts.emplace(skid, std::vector<uint8_t>(derCert.begin(), derCert.end())).second;
+    return inserted ? CHIP_NO_ERROR : CHIP_ERROR_DUPLICATE_KEY_ID;
+}
+
 CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const ByteSpan & skid,
                                                                          MutableByteSpan & outPaaDerBuffer) const
 {
@@ -100,22 +123,13 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mDerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        VerifyOrReturnError(CHIP_NO_ERROR ==
-                                Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan),
-                            CHIP_ERROR_INTERNAL);
+    Skid key;
+    memcpy(key.data(), skid.data(), key.size());
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto candidate = mDerCerts.find(key);
+    VerifyOrReturnError(candidate != mDerCerts.end(), CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    return CopySpanToMutableSpan(ByteSpan{ candidate->second.data(), candidate->second.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
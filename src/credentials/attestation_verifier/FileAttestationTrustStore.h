@@ -20,11 +20,19 @@
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 
 #include <array>
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
 namespace chip {
 namespace Credentials {
 
+/**
+ * PAA trust store loading the DER certificates (*.der files) of a directory.
+ *
+ * Each certificate is parsed once, when loaded, and indexed by its Subject Key Identifier: looking a PAA up
+ * is a hash table lookup, whatever the number of certificates in the store.
+ */
 class FileAttestationTrustStore : public AttestationTrustStore
 {
 public:
@@ -37,7 +45,28 @@ public:
     size_t size() const { return mDerCerts.size(); }
 
 protected:
-    std::vector<std::array<uint8_t, kMaxDERCertLength>> mDerCerts;
+    using Skid = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+    struct SkidHash
+    {
+        // SKIDs are normally digests of the public key: their leading bytes hash as well as any function of them would.
+        size_t operator()(const Skid & skid) const
+        {
+            size_t hash;
+            memcpy(&hash, skid.data(), sizeof(hash));
+            return hash;
+        }
+    };
+
+    /**
+     * Adds a certificate to the store, indexed by its SKID.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if the certificate is too long, or has no valid SKID.
+     * @retval CHIP_ERROR_DUPLICATE_KEY_ID if a certificate with the same SKID is already in the store.
+     */
+    CHIP_ERROR AddCert(const ByteSpan & derCert);
+
+    std::unordered_map<Skid, std::vector<uint8_t>, SkidHash> mDerCerts;
 
 private:
     bool mIsInitialized = false;
@@ -30,9 +30,22 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/Span.h>
 #include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
 
 #include <nlunit-test.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <inttypes.h>
+#include <string>
+#include <vector>
+
+#if FILE_ATTESTATION_TRUST_STORE_AVAILABLE
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <unistd.h>
+#endif // FILE_ATTESTATION_TRUST_STORE_AVAILABLE
+
 #include "CHIPAttCert_test_vectors.h"
 
 using namespace chip;
@@ -154,39 +167,43 @@ static void OnAttestationInformationVerificationCallback(void * context, Attesta
     *pResult                                = result;
 }
 
+static const uint8_t attestationElementsTestVector[] = {
+    0x15, 0x30, 0x01, 0xeb, 0x30, 0x81, 0xe8, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x02, 0xa0, 0x81,
+    0xda, 0x30, 0x81, 0xd7, 0x02, 0x01, 0x03, 0x31, 0x0d, 0x30, 0x0b, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04,
+    0x02, 0x01, 0x30, 0x45, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x01, 0xa0, 0x38, 0x04, 0x36, 0x15,
+    0x24, 0x00, 0x01, 0x25, 0x01, 0xf1, 0xff, 0x36, 0x02, 0x05, 0x00, 0x80, 0x18, 0x25, 0x03, 0x34, 0x12, 0x2c, 0x04, 0x13,
+    0x5a, 0x49, 0x47, 0x32, 0x30, 0x31, 0x34, 0x31, 0x5a, 0x42, 0x33, 0x33, 0x30, 0x30, 0x30, 0x31, 0x2d, 0x32, 0x34, 0x24,
+    0x05, 0x00, 0x24, 0x06, 0x00, 0x25, 0x07, 0x94, 0x26, 0x24, 0x08, 0x00, 0x18, 0x31, 0x7c, 0x30, 0x7a, 0x02, 0x01, 0x03,
+    0x80, 0x14, 0x62, 0xfa, 0x82, 0x33, 0x59, 0xac, 0xfa, 0xa9, 0x96, 0x3e, 0x1c, 0xfa, 0x14, 0x0a, 0xdd, 0xf5, 0x04, 0xf3,
+    0x71, 0x60, 0x30, 0x0b, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x30, 0x0a, 0x06, 0x08, 0x2a,
+    0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x04, 0x46, 0x30, 0x44, 0x02, 0x20, 0x43, 0xa6, 0x3f, 0x2b, 0x94, 0x3d, 0xf3,
+    0x3c, 0x38, 0xb3, 0xe0, 0x2f, 0xca, 0xa7, 0x5f, 0xe3, 0x53, 0x2a, 0xeb, 0xbf, 0x5e, 0x63, 0xf5, 0xbb, 0xdb, 0xc0, 0xb1,
+    0xf0, 0x1d, 0x3c, 0x4f, 0x60, 0x02, 0x20, 0x4c, 0x1a, 0xbf, 0x5f, 0x18, 0x07, 0xb8, 0x18, 0x94, 0xb1, 0x57, 0x6c, 0x47,
+    0xe4, 0x72, 0x4e, 0x4d, 0x96, 0x6c, 0x61, 0x2e, 0xd3, 0xfa, 0x25, 0xc1, 0x18, 0xc3, 0xf2, 0xb3, 0xf9, 0x03, 0x69, 0x30,
+    0x02, 0x20, 0xe0, 0x42, 0x1b, 0x91, 0xc6, 0xfd, 0xcd, 0xb4, 0x0e, 0x2a, 0x4d, 0x2c, 0xf3, 0x1d, 0xb2, 0xb4, 0xe1, 0x8b,
+    0x41, 0x1b, 0x1d, 0x3a, 0xd4, 0xd1, 0x2a, 0x9d, 0x90, 0xaa, 0x8e, 0x52, 0xfa, 0xe2, 0x26, 0x03, 0xfd, 0xc6, 0x5b, 0x28,
+    0xd0, 0xf1, 0xff, 0x3e, 0x00, 0x01, 0x00, 0x17, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x76, 0x65, 0x6e, 0x64, 0x6f,
+    0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x31, 0xd0, 0xf1, 0xff, 0x3e, 0x00, 0x03, 0x00, 0x18, 0x76,
+    0x65, 0x6e, 0x64, 0x6f, 0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x33, 0x5f, 0x65, 0x78, 0x61, 0x6d,
+    0x70, 0x6c, 0x65, 0x18
+};
+
+static const uint8_t attestationChallengeTestVector[] = { 0x7a, 0x49, 0x53, 0x05, 0xd0, 0x77, 0x79, 0xa4, 0x94, 0xdd, 0x39, 0xa0,
+                                                          0x85, 0x1b, 0x66, 0x0d };
+
+static const uint8_t attestationSignatureTestVector[] = { 0x79, 0x82, 0x53, 0x5d, 0x24, 0xcf, 0xe1, 0x4a, 0x71, 0xab, 0x04, 0x24,
+                                                          0xcf, 0x0b, 0xac, 0xf1, 0xe3, 0x45, 0x48, 0x7e, 0xd5, 0x0f, 0x1a, 0xc0,
+                                                          0xbc, 0x25, 0x9e, 0xcc, 0xfb, 0x39, 0x08, 0x1e, 0x61, 0xa9, 0x26, 0x7e,
+                                                          0x74, 0xf8, 0x55, 0xda, 0x53, 0x63, 0x83, 0x74, 0xa0, 0x16, 0x71, 0xcf,
+                                                          0x3d, 0x7d, 0xb8, 0xcc, 0x17, 0x0b, 0x38, 0x03, 0x45, 0xe6, 0x0b, 0xc8,
+                                                          0x6f, 0xdf, 0x45, 0x9e };
+
+static const uint8_t attestationNonceTestVector[] = { 0xe0, 0x42, 0x1b, 0x91, 0xc6, 0xfd, 0xcd, 0xb4, 0x0e, 0x2a, 0x4d, 0x2c, 0xf3,
+                                                      0x1d, 0xb2, 0xb4, 0xe1, 0x8b, 0x41, 0x1b, 0x1d, 0x3a, 0xd4, 0xd1, 0x2a, 0x9d,
+                                                      0x90, 0xaa, 0x8e, 0x52, 0xfa, 0xe2 };
+
 static void TestDACVerifierExample_AttestationInfoVerification(nlTestSuite * inSuite, void * inContext)
 {
-    uint8_t attestationElementsTestVector[] = {
-        0x15, 0x30, 0x01, 0xeb, 0x30, 0x81, 0xe8, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x02, 0xa0, 0x81,
-        0xda, 0x30, 0x81, 0xd7, 0x02, 0x01, 0x03, 0x31, 0x0d, 0x30, 0x0b, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04,
-        0x02, 0x01, 0x30, 0x45, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x07, 0x01, 0xa0, 0x38, 0x04, 0x36, 0x15,
-        0x24, 0x00, 0x01, 0x25, 0x01, 0xf1, 0xff, 0x36, 0x02, 0x05, 0x00, 0x80, 0x18, 0x25, 0x03, 0x34, 0x12, 0x2c, 0x04, 0x13,
-        0x5a, 0x49, 0x47, 0x32, 0x30, 0x31, 0x34, 0x31, 0x5a, 0x42, 0x33, 0x33, 0x30, 0x30, 0x30, 0x31, 0x2d, 0x32, 0x34, 0x24,
-        0x05, 0x00, 0x24, 0x06, 0x00, 0x25, 0x07, 0x94, 0x26, 0x24, 0x08, 0x00, 0x18, 0x31, 0x7c, 0x30, 0x7a, 0x02, 0x01, 0x03,
-        0x80, 0x14, 0x62, 0xfa, 0x82, 0x33, 0x59, 0xac, 0xfa, 0xa9, 0x96, 0x3e, 0x1c, 0xfa, 0x14, 0x0a, 0xdd, 0xf5, 0x04, 0xf3,
-        0x71, 0x60, 0x30, 0x0b, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x30, 0x0a, 0x06, 0x08, 0x2a,
-        0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x04, 0x46, 0x30, 0x44, 0x02, 0x20, 0x43, 0xa6, 0x3f, 0x2b, 0x94, 0x3d, 0xf3,
-        0x3c, 0x38, 0xb3, 0xe0, 0x2f, 0xca, 0xa7, 0x5f, 0xe3, 0x53, 0x2a, 0xeb, 0xbf, 0x5e, 0x63, 0xf5, 0xbb, 0xdb, 0xc0, 0xb1,
-        0xf0, 0x1d, 0x3c, 0x4f, 0x60, 0x02, 0x20, 0x4c, 0x1a, 0xbf, 0x5f, 0x18, 0x07, 0xb8, 0x18, 0x94, 0xb1, 0x57, 0x6c, 0x47,
-        0xe4, 0x72, 0x4e, 0x4d, 0x96, 0x6c, 0x61, 0x2e, 0xd3, 0xfa, 0x25, 0xc1, 0x18, 0xc3, 0xf2, 0xb3, 0xf9, 0x03, 0x69, 0x30,
-        0x02, 0x20, 0xe0, 0x42, 0x1b, 0x91, 0xc6, 0xfd, 0xcd, 0xb4, 0x0e, 0x2a, 0x4d, 0x2c, 0xf3, 0x1d, 0xb2, 0xb4, 0xe1, 0x8b,
-        0x41, 0x1b, 0x1d, 0x3a, 0xd4, 0xd1, 0x2a, 0x9d, 0x90, 0xaa, 0x8e, 0x52, 0xfa, 0xe2, 0x26, 0x03, 0xfd, 0xc6, 0x5b, 0x28,
-        0xd0, 0xf1, 0xff, 0x3e, 0x00, 0x01, 0x00, 0x17, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x76, 0x65, 0x6e, 0x64, 0x6f,
-        0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x31, 0xd0, 0xf1, 0xff, 0x3e, 0x00, 0x03, 0x00, 0x18, 0x76,
-        0x65, 0x6e, 0x64, 0x6f, 0x72, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x33, 0x5f, 0x65, 0x78, 0x61, 0x6d,
-        0x70, 0x6c, 0x65, 0x18
-    };
-    uint8_t attestationChallengeTestVector[] = { 0x7a, 0x49, 0x53, 0x05, 0xd0, 0x77, 0x79, 0xa4,
-                                                 0x94, 0xdd, 0x39, 0xa0, 0x85, 0x1b, 0x66, 0x0d };
-    uint8_t attestationSignatureTestVector[] = { 0x79, 0x82, 0x53, 0x5d, 0x24, 0xcf, 0xe1, 0x4a, 0x71, 0xab, 0x04, 0x24, 0xcf,
-                                                 0x0b, 0xac, 0xf1, 0xe3, 0x45, 0x48, 0x7e, 0xd5, 0x0f, 0x1a, 0xc0, 0xbc, 0x25,
-                                                 0x9e, 0xcc, 0xfb, 0x39, 0x08, 0x1e, 0x61, 0xa9, 0x26, 0x7e, 0x74, 0xf8, 0x55,
-                                                 0xda, 0x53, 0x63, 0x83, 0x74, 0xa0, 0x16, 0x71, 0xcf, 0x3d, 0x7d, 0xb8, 0xcc,
-                                                 0x17, 0x0b, 0x38, 0x03, 0x45, 0xe6, 0x0b, 0xc8, 0x6f, 0xdf, 0x45, 0x9e };
-    uint8_t attestationNonceTestVector[]     = { 0xe0, 0x42, 0x1b, 0x91, 0xc6, 0xfd, 0xcd, 0xb4, 0x0e, 0x2a, 0x4d,
-                                             0x2c, 0xf3, 0x1d, 0xb2, 0xb4, 0xe1, 0x8b, 0x41, 0x1b, 0x1d, 0x3a,
-                                             0xd4, 0xd1, 0x2a, 0x9d, 0x90, 0xaa, 0x8e, 0x52, 0xfa, 0xe2 };
-
     // Make sure default verifier exists and is not implemented on at least one method
     DeviceAttestationVerifier * default_verifier = GetDeviceAttestationVerifier();
     NL_TEST_ASSERT(inSuite, default_verifier != nullptr);
@@ -405,6 +422,169 @@ static void TestAttestationTrustStore(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+#if FILE_ATTESTATION_TRUST_STORE_AVAILABLE
+
+namespace {
+
+/// A temporary directory of PAA certificates, removed on destruction
+class TestPaaDirectory
+{
+public:
+    TestPaaDirectory()
+    {
+        strcpy(mPath, "/tmp/TestPaaStore.XXXXXX");
+        if (mkdtemp(mPath) == nullptr)
+        {
+            mPath[0] = '\0';
+        }
+    }
+
+    ~TestPaaDirectory()
+    {
+        for (const auto & file : mFiles)
+        {
+            unlink(file.c_str());
+        }
+        if (mPath[0] != '\0')
+        {
+            rmdir(mPath);
+        }
+    }
+
+    bool AddFile(const char * name, const ByteSpan & contents)
+    {
+        std::string path = std::string(mPath) + "/" + name;
+        FILE * file      = (mPath[0] != '\0') ? fopen(path.c_str(), "wb") : nullptr;
+        if (file == nullptr)
+        {
+            return false;
+        }
+        mFiles.push_back(path);
+
+        bool ok = (fwrite(contents.data(), 1, contents.size(), file) == contents.size());
+        return (fclose(file) == 0) && ok;
+    }
+
+    const char * GetPath() const { return mPath; }
+
+private:
+    char mPath[32];
+    std::vector<std::string> mFiles;
+};
+
+} // namespace
+
+static void TestFileAttestationTrustStore(nlTestSuite * inSuite, void * inContext)
+{
+    TestPaaDirectory directory;
+    NL_TEST_ASSERT(inSuite, directory.AddFile("paa-fff1.der", TestCerts::sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, directory.AddFile("paa-novid.der", TestCerts::sTestCert_PAA_NoVID_Cert));
+
+    // Skipped: a certificate already in the store, an invalid certificate and a file that is not DER
+    const uint8_t kGarbage[] = { 0x30, 0x03, 0x02, 0x01, 0x00 };
+    NL_TEST_ASSERT(inSuite, directory.AddFile("paa-fff1-copy.der", TestCerts::sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, directory.AddFile("garbage.der", ByteSpan(kGarbage)));
+    NL_TEST_ASSERT(inSuite, directory.AddFile("paa-fff1.pem", TestCerts::sTestCert_PAA_FFF1_Cert));
+
+    FileAttestationTrustStore trustStore(directory.GetPath());
+    NL_TEST_ASSERT(inSuite, trustStore.IsInitialized());
+    NL_TEST_ASSERT(inSuite, trustStore.size() == 2);
+
+    uint8_t buf[kMaxDERCertLength];
+    MutableByteSpan paaCertSpan{ buf };
+    NL_TEST_ASSERT(inSuite,
+                   trustStore.GetProductAttestationAuthorityCert(TestCerts::sTestCert_PAA_FFF1_SKID, paaCertSpan) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, paaCertSpan.data_equal(TestCerts::sTestCert_PAA_FFF1_Cert));
+
+    paaCertSpan = MutableByteSpan{ buf };
+    NL_TEST_ASSERT(inSuite,
+                   trustStore.GetProductAttestationAuthorityCert(TestCerts::sTestCert_PAA_NoVID_SKID, paaCertSpan) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, paaCertSpan.data_equal(TestCerts::sTestCert_PAA_NoVID_Cert));
+
+    paaCertSpan = MutableByteSpan{ buf, 16 };
+    NL_TEST_ASSERT(inSuite,
+                   trustStore.GetProductAttestationAuthorityCert(TestCerts::sTestCert_PAA_NoVID_SKID, paaCertSpan) ==
+                       CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    paaCertSpan = MutableByteSpan{ buf };
+    NL_TEST_ASSERT(inSuite,
+                   trustStore.GetProductAttestationAuthorityCert(TestCerts::sTestCert_PAI_FFF1_8000_SKID, paaCertSpan) ==
+                       CHIP_ERROR_CA_CERT_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite,
+                   trustStore.GetProductAttestationAuthorityCert(TestCerts::sTestCert_PAA_FFF1_Cert.SubSpan(0, 19), paaCertSpan) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+
+    // No certificates: the store is unusable
+    TestPaaDirectory emptyDirectory;
+    FileAttestationTrustStore emptyTrustStore(emptyDirectory.GetPath());
+    NL_TEST_ASSERT(inSuite, !emptyTrustStore.IsInitialized());
+    NL_TEST_ASSERT(inSuite,
+                   emptyTrustStore.GetProductAttestationAuthorityCert(TestCerts::sTestCert_PAA_FFF1_SKID, paaCertSpan) ==
+                       CHIP_ERROR_CA_CERT_NOT_FOUND);
+}
+
+static uint64_t MeasurePaaLookupsPerSecond(const AttestationTrustStore & trustStore, const ByteSpan & skid, uint32_t count)
+{
+    uint8_t buf[kMaxDERCertLength];
+    bool ok = true;
+
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        MutableByteSpan paaCertSpan{ buf };
+        ok = ok && (trustStore.GetProductAttestationAuthorityCert(skid, paaCertSpan) == CHIP_NO_ERROR);
+    }
+    System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    return ok ? (count * 1000000ull / std::max<uint64_t>(elapsed.count(), 1)) : 0;
+}
+
+static void TestDACVerifierExample_Throughput(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kVerificationCount = 200;
+    constexpr uint32_t kLookupCount       = 20000;
+
+    // Full attestation verifications, as a commissioner does for each device
+    DeviceAttestationVerifier * verifier            = GetDefaultDACVerifier(GetTestAttestationTrustStore());
+    AttestationVerificationResult attestationResult = AttestationVerificationResult::kNotImplemented;
+    Callback::Callback<OnAttestationInformationVerification> attestationInformationVerificationCallback(
+        OnAttestationInformationVerificationCallback, &attestationResult);
+    Credentials::DeviceAttestationVerifier::AttestationInfo info(
+        ByteSpan(attestationElementsTestVector), ByteSpan(attestationChallengeTestVector), ByteSpan(attestationSignatureTestVector),
+        TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, ByteSpan(attestationNonceTestVector),
+        static_cast<VendorId>(0xFFF1), 0x8000);
+
+    System::Clock::Timestamp start = System::SystemClock().GetMonotonicTimestamp();
+    uint32_t successCount          = 0;
+    for (uint32_t i = 0; i < kVerificationCount; i++)
+    {
+        attestationResult = AttestationVerificationResult::kNotImplemented;
+        verifier->VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+        successCount += (attestationResult == AttestationVerificationResult::kSuccess) ? 1 : 0;
+    }
+    System::Clock::Timestamp elapsed = System::SystemClock().GetMonotonicTimestamp() - start;
+    NL_TEST_ASSERT(inSuite, successCount == kVerificationCount);
+    printf("Attestation verifications: %" PRIu64 "/s\n", kVerificationCount * 1000ull / std::max<uint64_t>(elapsed.count(), 1));
+
+    // PAA lookups, the part of a verification that depends on the size of the trust store
+    const ByteSpan kPaaCerts[] = { TestCerts::sTestCert_PAA_FFF1_Cert, TestCerts::sTestCert_PAA_NoVID_Cert };
+    ArrayAttestationTrustStore arrayTrustStore(kPaaCerts, ArraySize(kPaaCerts));
+
+    TestPaaDirectory directory;
+    NL_TEST_ASSERT(inSuite, directory.AddFile("paa-fff1.der", TestCerts::sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, directory.AddFile("paa-novid.der", TestCerts::sTestCert_PAA_NoVID_Cert));
+    FileAttestationTrustStore fileTrustStore(directory.GetPath());
+
+    uint64_t arrayLookups = MeasurePaaLookupsPerSecond(arrayTrustStore, TestCerts::sTestCert_PAA_NoVID_SKID, kLookupCount);
+    uint64_t fileLookups  = MeasurePaaLookupsPerSecond(fileTrustStore, TestCerts::sTestCert_PAA_NoVID_SKID, kLookupCount);
+    NL_TEST_ASSERT(inSuite, arrayLookups > 0);
+    NL_TEST_ASSERT(inSuite, fileLookups > 0);
+    printf("PAA lookups: %" PRIu64 "/s parsing each certificate, %" PRIu64 "/s indexed by SKID\n", arrayLookups, fileLookups);
+}
+
+#endif // FILE_ATTESTATION_TRUST_STORE_AVAILABLE
+
 /**
  *  Set up the test suite.
  */
@@ -437,9 +617,15 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test Example Device Attestation Credentials Providers", TestDACProvidersExample_Providers),
     NL_TEST_DEF("Test Example Device Attestation Signature", TestDACProvidersExample_Signature),
     NL_TEST_DEF("Test the 'for testing' Paa Root Store", TestAttestationTrustStore),
+#if FILE_ATTESTATION_TRUST_STORE_AVAILABLE
+    NL_TEST_DEF("Test the file Paa Root Store", TestFileAttestationTrustStore),
+#endif // FILE_ATTESTATION_TRUST_STORE_AVAILABLE
     NL_TEST_DEF("Test Example Device Attestation Information Verification", TestDACVerifierExample_AttestationInfoVerification),
     NL_TEST_DEF("Test Example Device Attestation Certification Declaration Verification", TestDACVerifierExample_CertDeclarationVerification),
     NL_TEST_DEF("Test Example Device Attestation Node Operational CSR Information Verification", TestDACVerifierExample_NocsrInformationVerification),
+#if FILE_ATTESTATION_TRUST_STORE_AVAILABLE
+    NL_TEST_DEF("Test Example Device Attestation Verification Throughput", TestDACVerifierExample_Throughput),
+#endif // FILE_ATTESTATION_TRUST_STORE_AVAILABLE
     NL_TEST_SENTINEL()
 };
 // clang-format on
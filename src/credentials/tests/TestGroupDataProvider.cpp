@@ -1181,6 +1181,104 @@ void TestGroupDecryption(nlTestSuite * apSuite, void * apContext)
     }
 }
 
+size_t CountGroupSessions(nlTestSuite * apSuite, GroupDataProvider * provider, uint16_t session_id)
+{
+    GroupSession session;
+    auto it      = provider->IterateGroupSessions(session_id);
+    size_t count = 0;
+
+    NL_TEST_ASSERT(apSuite, it);
+    VerifyOrReturnError(it, 0);
+    while (it->Next(session))
+    {
+        NL_TEST_ASSERT(apSuite, session.key != nullptr);
+        NL_TEST_ASSERT(apSuite, session.fabric_index == kFabric2);
+        count++;
+    }
+    NL_TEST_ASSERT(apSuite, count == it->Count());
+    it->Release();
+    return count;
+}
+
+void TestGroupSessionIndex(nlTestSuite * apSuite, void * apContext)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    NL_TEST_ASSERT(apSuite, provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1));
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    NL_TEST_ASSERT(apSuite, nullptr != key_context);
+    VerifyOrReturn(nullptr != key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    NL_TEST_ASSERT(apSuite, 1 == CountGroupSessions(apSuite, provider, session_id));
+
+    // Every group mapped to the keyset is a candidate for the session
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetGroupKeyAt(kFabric2, 1, kGroup3Keyset1));
+    NL_TEST_ASSERT(apSuite, 2 == CountGroupSessions(apSuite, provider, session_id));
+
+    // Removing a mapping removes its candidate
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveGroupKeyAt(kFabric2, 1));
+    NL_TEST_ASSERT(apSuite, 1 == CountGroupSessions(apSuite, provider, session_id));
+
+    // Removing the keyset removes the remaining candidates, restoring it brings them back
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveKeySet(kFabric2, kKeysetId1));
+    NL_TEST_ASSERT(apSuite, 0 == CountGroupSessions(apSuite, provider, session_id));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1));
+    NL_TEST_ASSERT(apSuite, 1 == CountGroupSessions(apSuite, provider, session_id));
+
+    // Keys replaced in an existing keyset invalidate the old session
+    KeySet keyset = kKeySet1;
+    keyset.epoch_keys[0].key[0] ^= 0xff;
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, keyset));
+    NL_TEST_ASSERT(apSuite, 0 == CountGroupSessions(apSuite, provider, session_id));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1));
+    NL_TEST_ASSERT(apSuite, 1 == CountGroupSessions(apSuite, provider, session_id));
+
+    // Sessions are dropped with the fabric
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider->RemoveFabric(kFabric2));
+    NL_TEST_ASSERT(apSuite, 0 == CountGroupSessions(apSuite, provider, session_id));
+}
+
+void TestGroupSessionIndexOverflow(nlTestSuite * apSuite, void * apContext)
+{
+    // Allow one more group-key mapping than the index can hold, each with the three keys of the keyset
+    constexpr uint16_t kMappingCount = static_cast<uint16_t>(GroupDataProviderImpl::kGroupSessionsMax / KeySet::kEpochKeysMax + 1);
+
+    chip::TestPersistentStorageDelegate delegate;
+    GroupDataProviderImpl provider(kMaxGroupsPerFabric, kMappingCount);
+    provider.SetStorageDelegate(&delegate);
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.Init());
+
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.SetKeySet(kFabric2, kCompressedFabricId2, kKeySet3));
+    for (uint16_t i = 0; i < kMappingCount; ++i)
+    {
+        const GroupKey mapping(static_cast<GroupId>(kGroup1 + i), kKeysetId3);
+        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.SetGroupKeyAt(kFabric2, i, mapping));
+    }
+
+    Crypto::SymmetricKeyContext * key_context = provider.GetKeyContext(kFabric2, kGroup1);
+    NL_TEST_ASSERT(apSuite, nullptr != key_context);
+    VerifyOrReturn(nullptr != key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    // The keys no longer fit in the index: sessions are resolved from storage, with the same results
+    NL_TEST_ASSERT(apSuite, kMappingCount == CountGroupSessions(apSuite, &provider, session_id));
+
+    // Removing a mapping makes room: the index is rebuilt
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.RemoveGroupKeyAt(kFabric2, kMappingCount - 1u));
+    NL_TEST_ASSERT(apSuite, kMappingCount - 1u == CountGroupSessions(apSuite, &provider, session_id));
+
+    provider.Finish();
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -1258,6 +1356,8 @@ const nlTest sTests[] = { NL_TEST_DEF("TestStorageDelegate", chip::app::TestGrou
                           NL_TEST_DEF("TestIpk", chip::app::TestGroups::TestIpk),
                           NL_TEST_DEF("TestPerFabricData", chip::app::TestGroups::TestPerFabricData),
                           NL_TEST_DEF("TestGroupDecryption", chip::app::TestGroups::TestGroupDecryption),
+                          NL_TEST_DEF("TestGroupSessionIndex", chip::app::TestGroups::TestGroupSessionIndex),
+                          NL_TEST_DEF("TestGroupSessionIndexOverflow", chip::app::TestGroups::TestGroupSessionIndexOverflow),
                           NL_TEST_SENTINEL() };
 } // namespace
 
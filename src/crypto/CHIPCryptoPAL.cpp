@@ -588,6 +588,20 @@ CHIP_ERROR Spake2pVerifier::ComputeWS(uint32_t pbkdf2IterCount, const ByteSpan &
                                 pbkdf2IterCount, ws_len, ws);
 }
 
+AesCcm128Context & AesCcm128Context::operator=(const AesCcm128Context & other)
+{
+    if (this != &other)
+    {
+        Clear();
+        if (other.mInitialized)
+        {
+            // Even if no cipher context can be set up, the key is kept and messages fall back to the one-shot functions.
+            (void) Init(other.mKey.Span());
+        }
+    }
+    return *this;
+}
+
 CHIP_ERROR ConvertIntegerRawToDerWithoutTag(const ByteSpan & raw_integer, MutableByteSpan & out_der_integer)
 {
     return ConvertIntegerRawToDerInternal(raw_integer, out_der_integer, /* include_tag_and_length = */ false);
@@ -54,6 +54,7 @@ constexpr size_t CHIP_CRYPTO_GROUP_SIZE_BYTES      = kP256_FE_Length;
 constexpr size_t CHIP_CRYPTO_PUBLIC_KEY_SIZE_BYTES = kP256_Point_Length;
 
 constexpr size_t CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES      = 16;
+constexpr size_t CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES    = 13;
 constexpr size_t CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES = 16;
 
 constexpr size_t kMax_ECDH_Secret_Length     = kP256_FE_Length;
@@ -223,7 +224,7 @@ public:
 
         ClearSecretData(&bytes[0], Cap);
         SetLength(other.Length());
-        ::memcpy(Bytes(), other.Bytes(), other.Length());
+        ::memcpy(Bytes(), other.ConstBytes(), other.Length());
         return *this;
     }
 
@@ -507,6 +508,57 @@ private:
     uint8_t bytes[kAES_CCM128_Key_Length];
 };
 
+/**
+ * @brief An AES-CCM-128 key set up once and used for many messages.
+ *
+ * Where the backend supports it, the key is expanded into a cipher context at Init() time, so that
+ * each Encrypt() or Decrypt() only has to process the nonce, AAD and payload. Messages that use a
+ * nonce length other than CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES or a tag length other than
+ * CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES go through AES_CCM_encrypt()/AES_CCM_decrypt() instead.
+ *
+ * The cipher context is modified by every message, which is why Encrypt() and Decrypt() are not const,
+ * and an instance must not be used from several threads at once. Copies get their own cipher context.
+ */
+class AesCcm128Context
+{
+public:
+    AesCcm128Context() {}
+    ~AesCcm128Context() { Clear(); }
+
+    AesCcm128Context(const AesCcm128Context & other) { *this = other; }
+    AesCcm128Context & operator=(const AesCcm128Context & other);
+
+    /**
+     * @brief Set the key used by subsequent messages, replacing any previous one.
+     * @return CHIP_ERROR_INTERNAL if the cipher context could not be set up (messages then still work, without
+     *         the caching), CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const AesCcm128KeySpan & key);
+
+    /**
+     * @brief Same as AES_CCM_encrypt(), using the key given to Init().
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Same as AES_CCM_decrypt(), using the key given to Init().
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                       uint8_t * plaintext);
+
+    bool IsInitialized() const { return mInitialized; }
+
+    /** Release the cipher context and sanitize the key */
+    void Clear();
+
+private:
+    AesCcm128Key mKey;
+    void * mCipherContext = nullptr; // Backend-specific keyed context, or nullptr
+    bool mInitialized     = false;
+};
+
 /**
  * @brief Convert a raw ECDSA signature to ASN.1 signature (per X9.62) as used by TLS libraries.
  *
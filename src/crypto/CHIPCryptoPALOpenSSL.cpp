@@ -125,16 +125,15 @@ static const EVP_MD * _digestForType(DigestType digestType)
     }
 }
 
-CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
-                           const uint8_t * key, size_t key_length, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
-                           uint8_t * tag, size_t tag_length)
+// Encrypts one message with a context whose cipher, nonce length and tag length are already set. The
+// key is nullptr when the context already holds it from a previous encryption.
+static CHIP_ERROR _aesCcmEncrypt(EVP_CIPHER_CTX * context, const uint8_t * key, const uint8_t * plaintext, size_t plaintext_length,
+                                 const uint8_t * aad, size_t aad_length, const uint8_t * nonce, uint8_t * ciphertext, uint8_t * tag,
+                                 size_t tag_length)
 {
-    EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
-    CHIP_ERROR error         = CHIP_NO_ERROR;
     int result               = 1;
-    const EVP_CIPHER * type  = nullptr;
 
     // Placeholder location for avoiding null params for plaintexts when
     // size is zero.
@@ -160,92 +159,55 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
         }
     }
 
-    VerifyOrExit((key_length == kAES_CCM128_Key_Length) || (key_length == kAES_CCM256_Key_Length),
-                 error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit((plaintext_length != 0) || ciphertext_was_null, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(plaintext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(ciphertext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(key != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(_isValidKeyLength(key_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(_isValidTagLength(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-
-    // TODO: Remove support for AES-256 since not in 1.0
-    // Determine crypto type by key length
-    type = (key_length == kAES_CCM128_Key_Length) ? EVP_aes_128_ccm() : EVP_aes_256_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in tag length. Cast is safe because we checked _isValidTagLength.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError((plaintext_length != 0) || ciphertext_was_null, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     // Pass in key + nonce
     result = EVP_EncryptInit_ex(context, nullptr, nullptr, Uint8::to_const_uchar(key), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in plain text length
-    VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in AAD
     if (aad_length > 0 && aad != nullptr)
     {
-        VerifyOrExit(CanCastTo<int>(aad_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
         result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
-        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
     }
 
     // Encrypt
-    VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
                                static_cast<int>(plaintext_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit((ciphertext_was_null && bytesWritten == 0) || (bytesWritten >= 0), error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError((ciphertext_was_null && bytesWritten == 0) || (bytesWritten >= 0), CHIP_ERROR_INTERNAL);
     ciphertext_length = static_cast<unsigned int>(bytesWritten);
 
     // Finalize encryption
     result = EVP_EncryptFinal_ex(context, ciphertext + ciphertext_length, &bytesWritten);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit(bytesWritten >= 0 && bytesWritten <= static_cast<int>(plaintext_length), error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten >= 0 && bytesWritten <= static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
 
     // Get tag
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-exit:
-    if (context != nullptr)
-    {
-        EVP_CIPHER_CTX_free(context);
-        context = nullptr;
-    }
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
-    return error;
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
-                           const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * nonce,
-                           size_t nonce_length, uint8_t * plaintext)
+// Decrypts one message with a context whose cipher, nonce length and tag length are already set. The
+// key is nullptr when the context already holds it from a previous decryption.
+static CHIP_ERROR _aesCcmDecrypt(EVP_CIPHER_CTX * context, const uint8_t * key, const uint8_t * ciphertext,
+                                 size_t ciphertext_length, const uint8_t * aad, size_t aad_length, const uint8_t * tag,
+                                 size_t tag_length, const uint8_t * nonce, uint8_t * plaintext)
 {
-    EVP_CIPHER_CTX * context = nullptr;
-    CHIP_ERROR error         = CHIP_NO_ERROR;
-    int bytesOutput          = 0;
-    int result               = 1;
-    const EVP_CIPHER * type  = nullptr;
+    int bytesOutput = 0;
+    int result      = 1;
 
     // Placeholder location for avoiding null params for ciphertext when
     // size is zero.
@@ -271,69 +233,93 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
         }
     }
 
-    VerifyOrExit((key_length == kAES_CCM128_Key_Length) || (key_length == kAES_CCM256_Key_Length),
-                 error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(ciphertext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(plaintext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(_isValidTagLength(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(key != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(_isValidKeyLength(key_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-
-    // TODO: Remove support for AES-256 since not in 1.0
-    // Determine crypto type by key length
-    type = (key_length == kAES_CCM128_Key_Length) ? EVP_aes_128_ccm() : EVP_aes_256_ccm();
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    // Pass in key + nonce. This must come first, as the expected tag can only be set once the context
+    // is in decryption mode.
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, Uint8::to_const_uchar(key), Uint8::to_const_uchar(nonce));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in expected tag
     // Removing "const" from |tag| here should hopefully be safe as
     // we're writing the tag, not reading.
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
                                  const_cast<void *>(static_cast<const void *>(tag)));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in key + nonce
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, Uint8::to_const_uchar(key), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in cipher text length
-    VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit(bytesOutput <= static_cast<int>(ciphertext_length), error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesOutput <= static_cast<int>(ciphertext_length), CHIP_ERROR_INTERNAL);
 
     // Pass in aad
     if (aad_length > 0 && aad != nullptr)
     {
-        VerifyOrExit(CanCastTo<int>(aad_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
         result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
-        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-        VerifyOrExit(bytesOutput <= static_cast<int>(aad_length), error = CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(bytesOutput <= static_cast<int>(aad_length), CHIP_ERROR_INTERNAL);
     }
 
     // Pass in ciphertext. We wont get anything if validation fails.
-    VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
                                static_cast<int>(ciphertext_length));
     if (plaintext_was_null)
     {
-        VerifyOrExit(bytesOutput <= static_cast<int>(sizeof(placeholder_plaintext)), error = CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(bytesOutput <= static_cast<int>(sizeof(placeholder_plaintext)), CHIP_ERROR_INTERNAL);
     }
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+// Creates a context for the given AES-CCM cipher, nonce length and tag length, without a key.
+static EVP_CIPHER_CTX * _newAesCcmContext(size_t key_length, size_t nonce_length, size_t tag_length)
+{
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnError(context != nullptr, nullptr);
+
+    // TODO: Remove support for AES-256 since not in 1.0
+    // Determine crypto type by key length
+    const EVP_CIPHER * type = (key_length == kAES_CCM128_Key_Length) ? EVP_aes_128_ccm() : EVP_aes_256_ccm();
+
+    // Pass in cipher, nonce length and tag length. Casts are safe because callers checked
+    // CanCastTo and _isValidTagLength.
+    if (EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+}
+
+CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                           const uint8_t * key, size_t key_length, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
+                           uint8_t * tag, size_t tag_length)
+{
+    EVP_CIPHER_CTX * context = nullptr;
+    CHIP_ERROR error         = CHIP_NO_ERROR;
+
+    VerifyOrExit((key_length == kAES_CCM128_Key_Length) || (key_length == kAES_CCM256_Key_Length),
+                 error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(key != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(_isValidKeyLength(key_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(_isValidTagLength(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    context = _newAesCcmContext(key_length, nonce_length, tag_length);
+    VerifyOrExit(context != nullptr, error = CHIP_ERROR_INTERNAL);
+
+    error = _aesCcmEncrypt(context, key, plaintext, plaintext_length, aad, aad_length, nonce, ciphertext, tag, tag_length);
 
 exit:
     if (context != nullptr)
@@ -345,6 +331,114 @@ exit:
     return error;
 }
 
+CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                           const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * nonce,
+                           size_t nonce_length, uint8_t * plaintext)
+{
+    EVP_CIPHER_CTX * context = nullptr;
+    CHIP_ERROR error         = CHIP_NO_ERROR;
+
+    VerifyOrExit((key_length == kAES_CCM128_Key_Length) || (key_length == kAES_CCM256_Key_Length),
+                 error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(_isValidTagLength(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(key != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(_isValidKeyLength(key_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+
+    context = _newAesCcmContext(key_length, nonce_length, tag_length);
+    VerifyOrExit(context != nullptr, error = CHIP_ERROR_INTERNAL);
+
+    error = _aesCcmDecrypt(context, key, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce, plaintext);
+
+exit:
+    if (context != nullptr)
+    {
+        EVP_CIPHER_CTX_free(context);
+        context = nullptr;
+    }
+
+    return error;
+}
+
+CHIP_ERROR AesCcm128Context::Init(const AesCcm128KeySpan & key)
+{
+    Clear();
+    memcpy(mKey.Bytes(), key.data(), key.size());
+    mInitialized = true;
+
+    EVP_CIPHER_CTX * context = _newAesCcmContext(kAES_CCM128_Key_Length, CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES,
+                                                 CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_INTERNAL);
+
+    // Expand the key once; messages then only pass in their nonce. OpenSSL does not keep the key when
+    // a context switches between encryption and decryption, so a context used both ways is re-keyed
+    // on every switch. Sessions use each key in a single direction.
+    if (EVP_EncryptInit_ex(context, nullptr, nullptr, Uint8::to_const_uchar(mKey.ConstBytes()), nullptr) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mCipherContext = context;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mCipherContext == nullptr || nonce_length != CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES ||
+        tag_length != CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, mKey.ConstBytes(), mKey.Length(), nonce, nonce_length,
+                               ciphertext, tag, tag_length);
+    }
+
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    EVP_CIPHER_CTX * context = static_cast<EVP_CIPHER_CTX *>(mCipherContext);
+    const uint8_t * key      = EVP_CIPHER_CTX_encrypting(context) ? nullptr : mKey.ConstBytes();
+    return _aesCcmEncrypt(context, key, plaintext, plaintext_length, aad, aad_length, nonce, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR AesCcm128Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mCipherContext == nullptr || nonce_length != CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES ||
+        tag_length != CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, mKey.ConstBytes(), mKey.Length(),
+                               nonce, nonce_length, plaintext);
+    }
+
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    EVP_CIPHER_CTX * context = static_cast<EVP_CIPHER_CTX *>(mCipherContext);
+    const uint8_t * key      = EVP_CIPHER_CTX_encrypting(context) ? mKey.ConstBytes() : nullptr;
+    return _aesCcmDecrypt(context, key, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce, plaintext);
+}
+
+void AesCcm128Context::Clear()
+{
+    if (mCipherContext != nullptr)
+    {
+        EVP_CIPHER_CTX_free(static_cast<EVP_CIPHER_CTX *>(mCipherContext));
+        mCipherContext = nullptr;
+    }
+    ClearSecretData(mKey.Bytes(), mKey.Length());
+    mInitialized = false;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -199,6 +199,41 @@ exit:
     return error;
 }
 
+// mbedTLS keeps the expanded key in a heap-allocated cipher context, which would cost every
+// session a few hundred bytes of heap on constrained devices. Only the key is kept, and each
+// message goes through the one-shot functions.
+CHIP_ERROR AesCcm128Context::Init(const AesCcm128KeySpan & key)
+{
+    Clear();
+    memcpy(mKey.Bytes(), key.data(), key.size());
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AesCcm128Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, mKey.ConstBytes(), mKey.Length(), nonce, nonce_length,
+                           ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR AesCcm128Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, mKey.ConstBytes(), mKey.Length(), nonce,
+                           nonce_length, plaintext);
+}
+
+void AesCcm128Context::Clear()
+{
+    ClearSecretData(mKey.Bytes(), mKey.Length());
+    mInitialized = false;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
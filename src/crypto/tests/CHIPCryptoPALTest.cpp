@@ -628,6 +628,97 @@ static void TestAES_CCM_128Containers(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(testVector, deepCopy.Span().data(), deepCopy.Span().size()) == 0);
 }
 
+static void TestAES_CCM_128ContextTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    int numOfTestsRan = 0;
+    for (const ccm_128_test_vector * vector : ccm_128_test_vectors)
+    {
+        if (vector->pt_len > 0 && vector->key_len == kAES_CCM128_Key_Length && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            AesCcm128Context context;
+            NL_TEST_ASSERT(inSuite, context.Init(AesCcm128KeySpan(vector->key)) == CHIP_NO_ERROR);
+
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            out_ct.Alloc(vector->ct_len);
+            NL_TEST_ASSERT(inSuite, out_ct);
+            uint8_t out_tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+            CHIP_ERROR err = context.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                             vector->nonce_len, out_ct.Get(), out_tag, vector->tag_len);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(out_ct.Get(), vector->ct, vector->ct_len) == 0);
+            NL_TEST_ASSERT(inSuite, memcmp(out_tag, vector->tag, vector->tag_len) == 0);
+
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            NL_TEST_ASSERT(inSuite, out_pt);
+            err = context.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                  vector->nonce, vector->nonce_len, out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, memcmp(out_pt.Get(), vector->pt, vector->pt_len) == 0);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
+static void TestAES_CCM_128ContextReuse(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    uint8_t key[kAES_CCM128_Key_Length];
+    uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+    uint8_t aad[16];
+    uint8_t plaintext[100];
+    NL_TEST_ASSERT(inSuite, DRBG_get_bytes(key, sizeof(key)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DRBG_get_bytes(aad, sizeof(aad)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DRBG_get_bytes(plaintext, sizeof(plaintext)) == CHIP_NO_ERROR);
+
+    AesCcm128Context context;
+    NL_TEST_ASSERT(inSuite, !context.IsInitialized());
+    NL_TEST_ASSERT(inSuite, context.Init(AesCcm128KeySpan(key)) == CHIP_NO_ERROR);
+    AesCcm128Context copy(context);
+
+    // Messages of varying sizes, alternating between directions on the same context, must match the
+    // one-shot functions.
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        size_t length = 1 + i * 13u;
+        memset(nonce, i, sizeof(nonce));
+
+        uint8_t expected_ct[sizeof(plaintext)];
+        uint8_t expected_tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        NL_TEST_ASSERT(inSuite,
+                       AES_CCM_encrypt(plaintext, length, aad, sizeof(aad), key, sizeof(key), nonce, sizeof(nonce), expected_ct,
+                                       expected_tag, sizeof(expected_tag)) == CHIP_NO_ERROR);
+
+        AesCcm128Context & current = (i % 2) ? copy : context;
+        uint8_t ct[sizeof(plaintext)];
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        NL_TEST_ASSERT(inSuite,
+                       current.Encrypt(plaintext, length, aad, sizeof(aad), nonce, sizeof(nonce), ct, tag, sizeof(tag)) ==
+                           CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(ct, expected_ct, length) == 0);
+        NL_TEST_ASSERT(inSuite, memcmp(tag, expected_tag, sizeof(tag)) == 0);
+
+        uint8_t pt[sizeof(plaintext)];
+        NL_TEST_ASSERT(inSuite,
+                       current.Decrypt(ct, length, aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce), pt) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(pt, plaintext, length) == 0);
+
+        // A tampered tag is rejected, and does not break the next message.
+        tag[0] ^= 1;
+        NL_TEST_ASSERT(inSuite,
+                       current.Decrypt(ct, length, aad, sizeof(aad), tag, sizeof(tag), nonce, sizeof(nonce), pt) != CHIP_NO_ERROR);
+    }
+
+    context.Clear();
+    NL_TEST_ASSERT(inSuite, !context.IsInitialized());
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    NL_TEST_ASSERT(inSuite,
+                   context.Encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), nonce, sizeof(nonce), plaintext, tag,
+                                   sizeof(tag)) == CHIP_ERROR_INCORRECT_STATE);
+}
+
 static void TestAsn1Conversions(nlTestSuite * inSuite, void * inContext)
 {
     HeapChecker heapChecker(inSuite);
@@ -2347,6 +2438,8 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid key", TestAES_CCM_128DecryptInvalidKey),
     NL_TEST_DEF("Test decrypting AES-CCM-128 invalid nonce", TestAES_CCM_128DecryptInvalidNonceLen),
     NL_TEST_DEF("Test decrypting AES-CCM-128 Containers", TestAES_CCM_128Containers),
+    NL_TEST_DEF("Test AES-CCM-128 context with test vectors", TestAES_CCM_128ContextTestVectors),
+    NL_TEST_DEF("Test AES-CCM-128 context reuse", TestAES_CCM_128ContextReuse),
     NL_TEST_DEF("Test encrypting AES-CCM-256 test vectors", TestAES_CCM_256EncryptTestVectors),
     NL_TEST_DEF("Test decrypting AES-CCM-256 test vectors", TestAES_CCM_256DecryptTestVectors),
     NL_TEST_DEF("Test encrypting AES-CCM-256 using nil key", TestAES_CCM_256EncryptNilKey),
@@ -250,4 +250,22 @@
 #ifndef INET_CONFIG_IP_MULTICAST_HOP_LIMIT
 #define INET_CONFIG_IP_MULTICAST_HOP_LIMIT                 (64)
 #endif // INET_CONFIG_IP_MULTICAST_HOP_LIMIT
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams that a UDP endpoint
+ *    receives with a single system call.
+ *
+ *  @details
+ *    This only applies to sockets platforms providing
+ *    recvmmsg() (HAVE_RECVMMSG), such as Linux. There, a listening
+ *    UDP endpoint keeps this many receive buffers allocated,
+ *    and drains up to this many datagrams per readable event.
+ *    Set to 1 to receive a single datagram per readable event.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_BATCH_SIZE                  8
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE
 // clang-format on
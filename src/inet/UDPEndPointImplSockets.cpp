@@ -156,6 +156,92 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+/**
+ * Storage for the header of an incoming message, along with the data it points to.
+ */
+struct ReceiveHeader
+{
+    struct msghdr msgHeader;
+    struct iovec msgIOV;
+    SockAddr peerSockAddr;
+    uint8_t controlData[256];
+
+    void Init(const System::PacketBufferHandle & buffer)
+    {
+        msgIOV.iov_base = buffer->Start();
+        msgIOV.iov_len  = buffer->AvailableDataLength();
+
+        memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+
+        memset(&msgHeader, 0, sizeof(msgHeader));
+
+        msgHeader.msg_name       = &peerSockAddr;
+        msgHeader.msg_namelen    = sizeof(peerSockAddr);
+        msgHeader.msg_iov        = &msgIOV;
+        msgHeader.msg_iovlen     = 1;
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = sizeof(controlData);
+    }
+};
+
+/**
+ * Completes a buffer and its packet information with a message of \c rcvLen bytes received with \c msgHeader.
+ */
+CHIP_ERROR ReadReceivedMsg(struct msghdr & msgHeader, size_t rcvLen, const System::PacketBufferHandle & buffer,
+                           IPPacketInfo & pktInfo)
+{
+    VerifyOrReturnError(rcvLen <= buffer->AvailableDataLength(), CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+    buffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            pktInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            pktInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -432,6 +518,13 @@ void UDPEndPointImplSockets::CloseImpl()
         mSocket = kInvalidSocketFd;
     }
 
+#if HAVE_RECVMMSG
+    for (System::PacketBufferHandle & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // HAVE_RECVMMSG
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
     if (mReadableSource)
     {
@@ -576,122 +669,103 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         return;
     }
 
-    CHIP_ERROR lStatus = CHIP_NO_ERROR;
+#if HAVE_RECVMMSG
+    ReceiveBatch();
+#else  // !HAVE_RECVMMSG
     IPPacketInfo lPacketInfo;
-    System::PacketBufferHandle lBuffer;
-
     lPacketInfo.Clear();
-    lPacketInfo.DestPort = mBoundPort;
-
-    lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
 
-    if (!lBuffer.IsNull())
+    System::PacketBufferHandle lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    if (lBuffer.IsNull())
     {
-        struct iovec msgIOV;
-        SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
-        struct msghdr msgHeader;
-
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
+        HandleReceivedMsg(CHIP_ERROR_NO_MEMORY, std::move(lBuffer), lPacketInfo);
+        return;
+    }
 
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
+    ReceiveHeader receive;
+    receive.Init(lBuffer);
 
-        memset(&msgHeader, 0, sizeof(msgHeader));
-
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+    CHIP_ERROR lStatus   = CHIP_NO_ERROR;
+    const ssize_t rcvLen = recvmsg(mSocket, &receive.msgHeader, MSG_DONTWAIT);
+    if (rcvLen < 0)
+    {
+        lStatus = CHIP_ERROR_POSIX(errno);
+    }
+    else
+    {
+        lPacketInfo.DestPort = mBoundPort;
+        lStatus              = ReadReceivedMsg(receive.msgHeader, static_cast<size_t>(rcvLen), lBuffer, lPacketInfo);
+    }
+    HandleReceivedMsg(lStatus, std::move(lBuffer), lPacketInfo);
+#endif // !HAVE_RECVMMSG
+}
 
-        ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
+#if HAVE_RECVMMSG
+void UDPEndPointImplSockets::ReceiveBatch()
+{
+    ReceiveHeader receives[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct mmsghdr batch[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    IPPacketInfo lPacketInfo;
+    lPacketInfo.Clear();
 
-        if (rcvLen < 0)
-        {
-            lStatus = CHIP_ERROR_POSIX(errno);
-        }
-        else if (rcvLen > lBuffer->AvailableDataLength())
-        {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
-        }
-        else
+    // Replace the buffers handed over with the previous batch; the others are still empty, and are reused as they are.
+    unsigned int batchSize = 0;
+    for (System::PacketBufferHandle & buffer : mReceiveBuffers)
+    {
+        if (buffer.IsNull())
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
             {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
+                break;
             }
         }
+        receives[batchSize].Init(buffer);
+        batch[batchSize].msg_hdr = receives[batchSize].msgHeader;
+        batch[batchSize].msg_len = 0;
+        batchSize++;
+    }
+    if (batchSize == 0)
+    {
+        HandleReceivedMsg(CHIP_ERROR_NO_MEMORY, System::PacketBufferHandle(), lPacketInfo);
+        return;
+    }
 
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
-        }
+    const int received = recvmmsg(mSocket, batch, batchSize, MSG_DONTWAIT, nullptr);
+    if (received < 0)
+    {
+        HandleReceivedMsg(CHIP_ERROR_POSIX(errno), System::PacketBufferHandle(), lPacketInfo);
+        return;
     }
-    else
+
+    // Handling a message may close the endpoint, or even free it: keep it until the whole batch is delivered.
+    Retain();
+    for (int i = 0; (i < received) && (mState == State::kListening); i++)
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        System::PacketBufferHandle lBuffer = std::move(mReceiveBuffers[i]);
+
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort = mBoundPort;
+        CHIP_ERROR lStatus   = ReadReceivedMsg(batch[i].msg_hdr, batch[i].msg_len, lBuffer, lPacketInfo);
+        HandleReceivedMsg(lStatus, std::move(lBuffer), lPacketInfo);
     }
+    Release();
+}
+#endif // HAVE_RECVMMSG
 
-    if (lStatus == CHIP_NO_ERROR)
+void UDPEndPointImplSockets::HandleReceivedMsg(CHIP_ERROR status, System::PacketBufferHandle && buffer,
+                                               const IPPacketInfo & pktInfo)
+{
+    if (status == CHIP_NO_ERROR)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        buffer.RightSize();
+        OnMessageReceived(this, std::move(buffer), &pktInfo);
     }
     else
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
         {
-            OnReceiveError(this, lStatus, nullptr);
+            OnReceiveError(this, status, nullptr);
         }
     }
 }
@@ -61,10 +61,19 @@ private:
     CHIP_ERROR GetSocket(IPAddressType addressType);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
+    void HandleReceivedMsg(CHIP_ERROR status, System::PacketBufferHandle && buffer, const IPPacketInfo & pktInfo);
+#if HAVE_RECVMMSG
+    void ReceiveBatch();
+#endif // HAVE_RECVMMSG
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if HAVE_RECVMMSG
+    // Buffers receiving the next batch of datagrams. Only those handed over with a datagram are replaced between batches.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+#endif // HAVE_RECVMMSG
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
     dispatch_source_t mReadableSource = nullptr;
 #endif // CHIP_SYSTEM_CONFIG_USE_DISPATCH
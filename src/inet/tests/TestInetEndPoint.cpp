@@ -28,6 +28,7 @@
 #define __STDC_LIMIT_MACROS
 #endif
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 #include <stdint.h>
@@ -353,6 +354,95 @@ static void TestInetEndPointInternal(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, SYSTEM_STATS_TEST_HIGH_WATER_MARK(System::Stats::kInetLayer_NumTCPEps, 1));
 }
 
+constexpr uint32_t kThroughputMsgCount = 4096;
+constexpr size_t kThroughputBurstSize  = 64;
+
+struct ThroughputState
+{
+    uint32_t receivedCount   = 0;
+    uint32_t outOfOrderCount = 0;
+};
+
+static void HandleThroughputMessage(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    auto * state     = static_cast<ThroughputState *>(endPoint->mAppState);
+    uint32_t counter = UINT32_MAX;
+    if (msg->DataLength() == sizeof(counter))
+    {
+        memcpy(&counter, msg->Start(), sizeof(counter));
+    }
+    if (counter != state->receivedCount)
+    {
+        state->outOfOrderCount++;
+    }
+    state->receivedCount++;
+}
+
+// Sends numbered datagrams over the loopback interface, in bursts the socket buffers can hold, and returns the number of
+// datagrams received per second.
+static uint64_t MeasureUDPThroughput(nlTestSuite * inSuite, UDPEndPoint * sender, UDPEndPoint * receiver, const IPAddress & address)
+{
+    auto * state = static_cast<ThroughputState *>(receiver->mAppState);
+    *state       = ThroughputState();
+
+    IPPacketInfo pktInfo;
+    pktInfo.Clear();
+    pktInfo.DestAddress = address;
+    pktInfo.DestPort    = receiver->GetBoundPort();
+
+    const Clock::Timestamp start = SystemClock().GetMonotonicTimestamp();
+
+    uint32_t sentCount = 0;
+    while (sentCount < kThroughputMsgCount)
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        for (size_t i = 0; (i < kThroughputBurstSize) && (err == CHIP_NO_ERROR); i++, sentCount++)
+        {
+            err = sender->SendMsg(&pktInfo, PacketBufferHandle::NewWithData(&sentCount, sizeof(sentCount)));
+        }
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        // Drain the burst before sending the next one, so that no datagram is dropped.
+        for (int i = 0; (i < 1000) && (state->receivedCount < sentCount); i++)
+        {
+            ServiceEvents(10);
+        }
+        if (state->receivedCount != sentCount)
+        {
+            NL_TEST_ASSERT(inSuite, state->receivedCount == sentCount);
+            return 0;
+        }
+    }
+
+    const Clock::Milliseconds64 elapsed = std::max(SystemClock().GetMonotonicTimestamp() - start, Clock::Milliseconds64(1));
+    NL_TEST_ASSERT(inSuite, state->outOfOrderCount == 0);
+    return kThroughputMsgCount * 1000ull / elapsed.count();
+}
+
+// Measure the rate at which datagrams go through a pair of UDP endpoints.
+static void TestInetUDPThroughput(nlTestSuite * inSuite, void * inContext)
+{
+    UDPEndPoint * sender   = nullptr;
+    UDPEndPoint * receiver = nullptr;
+    ThroughputState state;
+
+    NL_TEST_ASSERT(inSuite, gUDP.NewEndPoint(&sender) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gUDP.NewEndPoint(&receiver) == CHIP_NO_ERROR);
+    VerifyOrReturn(sender != nullptr && receiver != nullptr);
+
+    IPAddress loopback;
+    NL_TEST_ASSERT(inSuite, IPAddress::FromString("::1", loopback));
+    NL_TEST_ASSERT(inSuite, sender->Bind(IPAddressType::kIPv6, loopback, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver->Bind(IPAddressType::kIPv6, loopback, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver->Listen(HandleThroughputMessage, nullptr, &state) == CHIP_NO_ERROR);
+
+    const uint64_t rate = MeasureUDPThroughput(inSuite, sender, receiver, loopback);
+    printf("    UDP loopback, %" PRIu32 " datagrams: %" PRIu64 " packets/s\n", kThroughputMsgCount, rate);
+
+    sender->Free();
+    receiver->Free();
+}
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 static void TestInetEndPointLimit(nlTestSuite * inSuite, void * inContext)
@@ -444,6 +534,7 @@ static const nlTest sTests[] = { NL_TEST_DEF("InetEndPoint::PreTest", TestInetPr
                                  NL_TEST_DEF("InetEndPoint::TestInetError", TestInetError),
                                  NL_TEST_DEF("InetEndPoint::TestInetInterface", TestInetInterface),
                                  NL_TEST_DEF("InetEndPoint::TestInetEndPoint", TestInetEndPointInternal),
+                                 NL_TEST_DEF("InetEndPoint::TestInetUDPThroughput", TestInetUDPThroughput),
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
                                  NL_TEST_DEF("InetEndPoint::TestEndPointLimit", TestInetEndPointLimit),
 #endif
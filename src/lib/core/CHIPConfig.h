@@ -752,10 +752,14 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *    The following definitions sets the maximum number of corresponding interaction model object pool size.
  *
  *      * #CHIP_IM_MAX_NUM_COMMAND_HANDLER
+ *      * #CHIP_IM_MAX_PATHS_PER_INVOKE
  *      * #CHIP_IM_MAX_NUM_READ_HANDLER
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
+ *      * #CHIP_IM_MAX_REPORT_CHAIN_BUFFERS
+ *      * #CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -772,6 +776,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_COMMAND_HANDLER 4
 #endif
 
+/**
+ * @def CHIP_IM_MAX_PATHS_PER_INVOKE
+ *
+ * @brief Defines the maximum number of commands a CommandHandler accepts in a single invoke request.
+ *
+ * Each CommandHandler keeps the path and reference of every command of the request it is processing, to correlate the
+ * responses with the commands. Requests holding more commands are rejected as a whole.
+ */
+#ifndef CHIP_IM_MAX_PATHS_PER_INVOKE
+#define CHIP_IM_MAX_PATHS_PER_INVOKE 1
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_READ_HANDLER
  *
@@ -795,6 +811,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_MAX_REPORT_CHAIN_BUFFERS
+ *
+ * @brief Defines the maximum number of packet buffers the reporting engine chains to encode the attribute data of a report
+ *        ahead of sending it, 0 to encode the attribute data of each report message in that message only.
+ *
+ * The attribute data is encoded once into the chain, which each ReadHandler keeps until it is sent, and split into report
+ * messages as they are sent. Otherwise, the attribute data which does not fit in a message, such as the rest of a long
+ * list, is encoded again for the next one.
+ */
+#ifndef CHIP_IM_MAX_REPORT_CHAIN_BUFFERS
+#define CHIP_IM_MAX_REPORT_CHAIN_BUFFERS 0
+#endif
+
+/**
+ * @def CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE
+ *
+ * @brief Defines the number of attribute changes MatterReportingAttributeChangeCallbackFromAnyThread can hold until the CHIP
+ *        event loop reports them, 0 to disable it. Must be a power of two.
+ *
+ * Threads other than the CHIP event loop, such as the ones of bridged devices, can then notify attribute changes without taking
+ * the CHIP stack lock.
+ */
+#ifndef CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE
+#define CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE 0
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *
@@ -812,12 +855,25 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
  *
- * @brief Defines the maximum number of dirty set, limits the number of attributes being read or subscribed at the same time.
+ * @brief Defines the maximum number of dirty paths with a wildcard endpoint or cluster id tracked by the reporting engine.
+ *        Further wildcard paths make every attribute dirty until the next report.
  */
 #ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
+ *
+ * @brief Defines the maximum number of dirty attributes, and of dirty clusters, tracked individually by the reporting engine.
+ *        The tracking tables are allocated on demand. Once they are full, or when allocation fails, further attributes are
+ *        tracked at cluster granularity, and further clusters make every attribute dirty until the next report. The default
+ *        suits constrained devices; platforms with plenty of heap, such as Linux and Darwin, raise it.
+ */
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS 32
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -973,6 +1029,24 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE
+ *
+ * @brief Defines the number of operational group keys held in the in-memory group session index, 0 to disable it.
+ *
+ * Each entry binds one operational key of a key set to one group mapped to that key set: indexing every key
+ * takes one entry per group-key mapping (up to CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC per fabric) and per
+ * epoch key of the mapped key set (up to 3). Incoming group messages are resolved through this index without
+ * reading persistent storage; if the configured keys do not fit, the lookup falls back to walking persistent
+ * storage.
+ *
+ * Disabled by default: each entry takes about 22 bytes of RAM (2 KB for every key of 16 fabrics) and holds an
+ * operational key in RAM rather than only in storage. Platforms with RAM to spare enable it.
+ */
+#ifndef CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1072,6 +1146,30 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
     "Please enable at least one of CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT or CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FLEXIBLE_COPY_SUPPORT"
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+ *
+ * Compile the access control entries into a lookup structure, rebuilt when
+ * they change, so that access control checks do not walk every entry of the
+ * fabric.
+ *
+ * Access control delegates that change their entries other than through
+ * AccessControl must disable it.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE 1
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE
+ *
+ * Number of recent access control decisions remembered by the decision
+ * cache, 0 to remember none.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_MEMO_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_SESSION_RECOVERY_DELEGATES
  *
@@ -1093,6 +1191,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+ *
+ * @brief
+ *   Maximum number of incoming CASE session establishments that the CASE
+ *   server processes at the same time. Each one holds a CASESession.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 2
+#endif
+
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_STALE_HANDSHAKE_TIMEOUT
+ *
+ * @brief
+ *   Time after which an incoming CASE session establishment that has not
+ *   completed may be evicted, when a new one arrives and all of the
+ *   CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES are in progress.
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_STALE_HANDSHAKE_TIMEOUT
+#define CHIP_CONFIG_CASE_SERVER_STALE_HANDSHAKE_TIMEOUT (10000_ms32)
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1210,6 +1331,64 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST 0
 #endif // CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+ *
+ * @brief Number of resource records the minmdns resolver remembers until
+ *        their TTL runs out.
+ *
+ *        Operational nodes are resolved from these records, so the cache
+ *        cannot be disabled: answers split across several packets are put
+ *        together in it. A resolved node takes 3 to 6 records (SRV, TXT and
+ *        its addresses), and each record takes about 200 bytes.
+ *
+ *        The default of 6 records (about 1.2 KB) holds one node at a time,
+ *        which suits devices resolving their controllers one after the other.
+ *        When the cache is full, the records closest to their expiry are
+ *        evicted, and a node whose records are missing is resolved with a
+ *        query again. Controllers resolving many nodes should raise it, as
+ *        Linux does.
+ *
+ *        Records with more than 96 bytes of data, such as long TXT records,
+ *        are not cached (see mdns::Minimal::RecordCacheBase::kMaxDataSize).
+ *        Operational TXT records only hold a few short keys and fit.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE 6
+#endif // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+
+/*
+ * @def CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT
+ *
+ * @brief Default window of asynchronous BDX transfers: the number of
+ *        Blocks a Sender sends ahead of their acknowledgements, and that
+ *        a Receiver accepts before acknowledging them.
+ *
+ *        A Receiver may hold on to that many Blocks until it has processed
+ *        them, so this bounds its buffer usage to about the window times the
+ *        Block size.
+ */
+#ifndef CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT
+#define CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT 4
+#endif // CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT
+
+/*
+ * @def CHIP_CONFIG_BDX_ASYNC_TRANSFER
+ *
+ * @brief Have the OTA Requestor propose asynchronous BDX transfers
+ *        alongside receiver drive.
+ *
+ *        Disabled by default: BDX messages do not carry the window, so a
+ *        Provider sending more Blocks ahead than
+ *        CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT fails the transfer, and over
+ *        MRP the window is one Block anyway, which is no faster than
+ *        receiver drive. Once an asynchronous download fails, the Requestor
+ *        falls back to receiver drive for the next ones.
+ */
+#ifndef CHIP_CONFIG_BDX_ASYNC_TRANSFER
+#define CHIP_CONFIG_BDX_ASYNC_TRANSFER 0
+#endif // CHIP_CONFIG_BDX_ASYNC_TRANSFER
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1246,6 +1425,26 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SETUP_CODE_PAIRER_DISCOVERY_TIMEOUT_SECS 30
 #endif // CHIP_CONFIG_SETUP_CODE_PAIRER_DISCOVERY_TIMEOUT_SECS
 
+/**
+ *  @def CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+ *
+ *  @brief
+ *    If 1, the generated decoders of cluster object structs, commands and
+ *    events first try to read the fields in the order of their tags, which
+ *    is the order encoders write them in, before falling back to the
+ *    generic decoding loop for any remaining element.
+ *    If 0, all the fields are decoded by the generic decoding loop, and
+ *    the in-order attempts compile to nothing.
+ *
+ *    Off by default to keep the generated decoders small on devices. The
+ *    Linux, Darwin and Android platforms, which controllers run on, turn
+ *    it on.
+ *
+ */
+#ifndef CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+#define CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE 0
+#endif // CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+
 /**
  * @}
  */
@@ -216,6 +216,26 @@ public:
      */
     CHIP_ERROR Next(Tag expectedTag);
 
+    /**
+     * Advances the TLVReader object to the next TLV element of the current structure if that
+     * element has the given context tag, and leaves the reader in place otherwise.
+     *
+     * This is meant for decoding the fields of a structure in the order they are encoded: the
+     * element is read straight from the current buffer, without the checks of Next() that do not
+     * apply to a context tagged element of a structure. If the next element cannot be read that
+     * way, e.g. because its head spans two buffers, @p found is false and the element is left to
+     * Next(), as for any element with another tag.
+     *
+     * @param[in]  tagNum                   The context tag number of the expected element.
+     * @param[out] found                    Whether the reader was positioned on the expected element.
+     *
+     * @retval #CHIP_NO_ERROR              If the reader was positioned on the expected element, or
+     *                                      left in place.
+     * @retval other                        The errors of Next() when skipping the current element.
+     *
+     */
+    CHIP_ERROR NextIfContextTag(uint8_t tagNum, bool & found);
+
     /**
      * Advances the TLVReader object to the next TLV element to be read, asserting the type and tag of
      * the new element.
@@ -528,6 +528,70 @@ CHIP_ERROR TLVReader::Next(Tag expectedTag)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TLVReader::NextIfContextTag(uint8_t tagNum, bool & found)
+{
+    found = false;
+
+    // Only elements of structures are read here, leave the tag checks of other containers to Next().
+    if (mContainerType != kTLVType_Structure)
+        return CHIP_NO_ERROR;
+
+    CHIP_ERROR err = Skip();
+    if (err != CHIP_NO_ERROR)
+        return err;
+
+    // The element head must be in the current buffer, and within the length the reader is limited to.
+    const uint32_t remainingLen = mMaxLen - mLenRead;
+    if (mBufEnd - mReadPoint < 2 || remainingLen < 2)
+        return CHIP_NO_ERROR;
+    if (static_cast<TLVTagControl>(mReadPoint[0] & kTLVTagControlMask) != TLVTagControl::ContextSpecific || mReadPoint[1] != tagNum)
+        return CHIP_NO_ERROR;
+
+    // A context tagged end of container is invalid: leave it to Next() to report.
+    TLVElementType elemType = static_cast<TLVElementType>(mReadPoint[0] & kTLVTypeMask);
+    if (!IsValidTLVType(elemType) || elemType == TLVElementType::EndOfContainer)
+        return CHIP_NO_ERROR;
+
+    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
+    uint8_t elemHeadBytes          = static_cast<uint8_t>(2 + TLVFieldSizeToBytes(lenOrValFieldSize));
+    if (elemHeadBytes > (mBufEnd - mReadPoint) || elemHeadBytes > remainingLen)
+        return CHIP_NO_ERROR;
+
+    const uint8_t * p = mReadPoint + 2;
+    uint64_t lenOrVal = 0;
+    switch (lenOrValFieldSize)
+    {
+    case kTLVFieldSize_0Byte:
+        break;
+    case kTLVFieldSize_1Byte:
+        lenOrVal = Read8(p);
+        break;
+    case kTLVFieldSize_2Byte:
+        lenOrVal = LittleEndian::Read16(p);
+        break;
+    case kTLVFieldSize_4Byte:
+        lenOrVal = LittleEndian::Read32(p);
+        break;
+    case kTLVFieldSize_8Byte:
+        lenOrVal = LittleEndian::Read64(p);
+        break;
+    }
+
+    // As in VerifyElement(), the data must fit within the remaining bytes of the encoding.
+    if (TLVTypeHasLength(elemType) && static_cast<uint32_t>(remainingLen - elemHeadBytes) < lenOrVal)
+        return CHIP_NO_ERROR;
+
+    mControlByte  = mReadPoint[0];
+    mElemTag      = ContextTag(tagNum);
+    mElemLenOrVal = lenOrVal;
+
+    mReadPoint += elemHeadBytes;
+    mLenRead += elemHeadBytes;
+
+    found = true;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TLVReader::Next(TLVType expectedType, Tag expectedTag)
 {
     CHIP_ERROR err = Next(expectedTag);
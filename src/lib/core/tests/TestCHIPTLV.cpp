@@ -4301,6 +4301,140 @@ static void CheckGetByteView(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+static void CheckNextIfContextTag(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainer;
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), static_cast<uint32_t>(70000)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutString(ContextTag(3), "hello") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ProfileTag(TestProfile_1, 4), true) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag(), kTLVType_Array, outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(AnonymousTag(), static_cast<uint8_t>(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    TLVReader reader;
+    bool found = true;
+    uint32_t value;
+    reader.Init(buf, writer.GetLengthWritten());
+
+    // Only the elements of a structure are read.
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(1, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !found);
+
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainer) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(1, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, found);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(1));
+    NL_TEST_ASSERT(inSuite, reader.Get(value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, value == 70000);
+
+    // A different tag leaves the element to the next call.
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(2, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !found);
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(3, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, found);
+    NL_TEST_ASSERT(inSuite, reader.GetType() == kTLVType_UTF8String);
+    NL_TEST_ASSERT(inSuite, reader.GetLength() == 5);
+
+    // Profile tags are left to Next().
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(4, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !found);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ProfileTag(TestProfile_1, 4));
+
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(5, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !found);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(inSuite, reader.ExitContainer(outerContainer) == CHIP_NO_ERROR);
+
+    // Elements of an array have no tag to match.
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(0, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !found);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.ExitContainer(outerContainer) == CHIP_NO_ERROR);
+}
+
+// Hands the whole buffer to the reader at once, whatever the length the reader is limited to.
+class SingleBufferBackingStore : public TLVBackingStore
+{
+public:
+    SingleBufferBackingStore(const uint8_t * data, uint32_t dataLen) : mData(data), mDataLen(dataLen) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mData;
+        bufLen   = mDataLen;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = nullptr;
+        bufLen   = 0;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mData;
+    uint32_t mDataLen;
+};
+
+static void CheckNextIfContextTagMaxLength(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[32];
+    TLVWriter writer;
+    TLVType outerContainer;
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), static_cast<uint32_t>(70000)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    // The structure head is 1 byte and the field takes 6 bytes: stop the reader at every length within the field.
+    SingleBufferBackingStore backingStore(buf, writer.GetLengthWritten());
+    for (uint32_t maxLen = 1; maxLen < 7; maxLen++)
+    {
+        TLVReader reader;
+        bool found = true;
+        NL_TEST_ASSERT(inSuite, reader.Init(backingStore, maxLen) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainer) == CHIP_NO_ERROR);
+
+        // The field crosses the limit, so it must not be read even though the buffer holds all of it.
+        NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(1, found) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !found);
+        NL_TEST_ASSERT(inSuite, reader.GetLengthRead() == 1);
+    }
+
+    TLVReader reader;
+    bool found = false;
+    uint32_t value;
+    NL_TEST_ASSERT(inSuite, reader.Init(backingStore, 7) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.NextIfContextTag(1, found) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, found);
+    NL_TEST_ASSERT(inSuite, reader.Get(value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, value == 70000);
+}
+
 static void CheckCHIPTLVScopedBuffer(nlTestSuite * inSuite, void * inContext)
 {
     Platform::ScopedMemoryBuffer<uint8_t> buf;
@@ -4380,6 +4514,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
     NL_TEST_DEF("CHIP TLV GetStringView Test",         CheckGetStringView),
     NL_TEST_DEF("CHIP TLV GetByteView Test",           CheckGetByteView),
+    NL_TEST_DEF("CHIP TLV NextIfContextTag Test",      CheckNextIfContextTag),
+    NL_TEST_DEF("CHIP TLV NextIfContextTag Max Length Test", CheckNextIfContextTagMaxLength),
     NL_TEST_DEF("Int Min/Max Test",                    TestIntMinMax),
 
     NL_TEST_SENTINEL()
@@ -211,5 +211,14 @@ Optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::NextSch
     return Optional<ScheduledAttempt>::Missing();
 }
 
+Optional<PeerId> ActiveResolveAttempts::GetPendingResolve(size_t index) const
+{
+    if ((index >= kRetryQueueSize) || !mRetryQueue[index].attempt.IsResolve())
+    {
+        return Optional<PeerId>::Missing();
+    }
+    return Optional<PeerId>::Value(mRetryQueue[index].attempt.peerId);
+}
+
 } // namespace Minimal
 } // namespace mdns
@@ -169,6 +169,13 @@ public:
     //    any peer that needs a new request sent
     chip::Optional<ScheduledAttempt> NextScheduled();
 
+    // Get the peer id of the resolve attempt at the given position in the
+    // internal list, if that position holds one.
+    //
+    // Allows going through all the pending resolves, with index from 0 to
+    // kRetryQueueSize, without affecting their schedule.
+    chip::Optional<chip::PeerId> GetPendingResolve(size_t index) const;
+
 private:
     struct RetryEntry
     {
@@ -17,6 +17,7 @@
 
 #include "Resolver.h"
 
+#include <algorithm>
 #include <limits>
 
 #include <lib/core/CHIPConfig.h>
@@ -27,6 +28,7 @@
 #include <lib/dnssd/TxtFields.h>
 #include <lib/dnssd/minimal_mdns/Parser.h>
 #include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+#include <lib/dnssd/minimal_mdns/RecordCache.h>
 #include <lib/dnssd/minimal_mdns/RecordData.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
 #include <lib/support/CHIPMemString.h>
@@ -60,19 +62,18 @@ private:
     NodeData & mNodeData;
 };
 
-constexpr size_t kMdnsMaxPacketSize   = 1024;
-constexpr uint16_t kMdnsPort          = 5353;
-constexpr uint16_t kDefaultTtlSeconds = 120;
+constexpr size_t kMdnsMaxPacketSize = 1024;
+constexpr uint16_t kMdnsPort        = 5353;
 
 using namespace mdns::Minimal;
 
 class PacketDataReporter : public ParserDelegate
 {
 public:
-    PacketDataReporter(OperationalResolveDelegate * opDelegate, CommissioningResolveDelegate * commissionDelegate,
+    PacketDataReporter(CommissioningResolveDelegate * commissionDelegate, RecordCacheBase & recordCache,
                        chip::Inet::InterfaceId interfaceId, DiscoveryType discoveryType, const BytesRange & packet) :
-        mOperationalDelegate(opDelegate),
-        mCommissioningDelegate(commissionDelegate), mDiscoveryType(discoveryType), mPacketRange(packet)
+        mCommissioningDelegate(commissionDelegate),
+        mRecordCache(recordCache), mDiscoveryType(discoveryType), mPacketRange(packet)
     {
         mInterfaceId = interfaceId;
     }
@@ -85,26 +86,28 @@ public:
 
     // Called after ParsePacket is complete to send final notifications to the delegate.
     // Used to ensure all the available IP addresses are attached before completion.
+    //
+    // Operational nodes are resolved from the record cache instead, see MinMdnsResolver::ReportCachedResolves.
     void OnComplete(ActiveResolveAttempts & activeAttempts);
 
+    // Operational node advertised by the SRV record of the packet, if any.
+    const Optional<PeerId> & GetOperationalPeer() const { return mOperationalPeer; }
+
 private:
-    OperationalResolveDelegate * mOperationalDelegate;
     CommissioningResolveDelegate * mCommissioningDelegate;
+    RecordCacheBase & mRecordCache;
     DiscoveryType mDiscoveryType;
-    ResolvedNodeData mNodeData;
+    Optional<PeerId> mOperationalPeer;
     DiscoveredNodeData mDiscoveredNodeData;
     chip::Inet::InterfaceId mInterfaceId;
     BytesRange mPacketRange;
 
-    bool mValid       = false;
-    bool mHasNodePort = false;
-    bool mHasIP       = false;
+    bool mValid = false;
 
     void OnCommissionableNodeSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
-    void OnOperationalSrvRecord(SerializedQNameIterator name, const SrvRecord & srv);
+    void OnOperationalSrvRecord(SerializedQNameIterator name);
 
     void OnDiscoveredNodeIPAddress(const chip::Inet::IPAddress & addr);
-    void OnOperationalIPAddress(const chip::Inet::IPAddress & addr);
 };
 
 void PacketDataReporter::OnQuery(const QueryData & data)
@@ -118,41 +121,28 @@ void PacketDataReporter::OnHeader(ConstHeaderRef & header)
 {
     mValid = header.GetFlags().IsResponse();
 
-    if (header.GetFlags().IsTruncated())
-    {
-#ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
-        // MinMdns does not cache data, so receiving piecewise data does not work
-        ChipLogError(Discovery, "Truncated responses not supported for address resolution");
-#endif
-    }
+    // Truncated responses need no special handling: records are cached as they
+    // arrive, and operational nodes are resolved once all their records are.
 }
 
-void PacketDataReporter::OnOperationalSrvRecord(SerializedQNameIterator name, const SrvRecord & srv)
+void PacketDataReporter::OnOperationalSrvRecord(SerializedQNameIterator name)
 {
-    mdns::Minimal::SerializedQNameIterator it = srv.GetName();
-    if (it.Next())
-    {
-        Platform::CopyString(mNodeData.mHostName, it.Value());
-    }
-
     if (!name.Next())
     {
 #ifdef MINMDNS_RESOLVER_OVERLY_VERBOSE
         ChipLogError(Discovery, "mDNS packet is missing a valid server name");
 #endif
-        mHasNodePort = false;
         return;
     }
 
-    if (ExtractIdFromInstanceName(name.Value(), &mNodeData.mPeerId) != CHIP_NO_ERROR)
+    PeerId peerId;
+    if (ExtractIdFromInstanceName(name.Value(), &peerId) != CHIP_NO_ERROR)
     {
         ChipLogError(Discovery, "Failed to parse peer id from %s", name.Value());
-        mHasNodePort = false;
         return;
     }
 
-    mNodeData.mPort = srv.GetPort();
-    mHasNodePort    = true;
+    mOperationalPeer.SetValue(peerId);
 }
 
 void PacketDataReporter::OnCommissionableNodeSrvRecord(SerializedQNameIterator name, const SrvRecord & srv)
@@ -170,23 +160,6 @@ void PacketDataReporter::OnCommissionableNodeSrvRecord(SerializedQNameIterator n
     mDiscoveredNodeData.port = srv.GetPort();
 }
 
-void PacketDataReporter::OnOperationalIPAddress(const chip::Inet::IPAddress & addr)
-{
-    // TODO: should validate that the IP address we receive belongs to the
-    // server associated with the SRV record.
-    //
-    // This code assumes that all entries in the mDNS packet relate to the
-    // same entity. This may not be correct if multiple servers are reported
-    // (if multi-admin decides to use unique ports for every ecosystem).
-    if (mNodeData.mNumIPs >= ResolvedNodeData::kMaxIPAddresses)
-    {
-        return;
-    }
-    mNodeData.mAddress[mNodeData.mNumIPs++] = addr;
-    mNodeData.mInterfaceId                  = mInterfaceId;
-    mHasIP                                  = true;
-}
-
 void PacketDataReporter::OnDiscoveredNodeIPAddress(const chip::Inet::IPAddress & addr)
 {
     if (mDiscoveredNodeData.numIPs >= DiscoveredNodeData::kMaxIPAddresses)
@@ -217,6 +190,13 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         return;
     }
 
+    // Records that do not fit the cache are still handled below for commissionable nodes, but
+    // operational nodes can only be resolved from cached records.
+    if (!mRecordCache.Add(data, mPacketRange, mInterfaceId) && HasQNamePart(data.GetName(), kOperationalServiceName))
+    {
+        ChipLogDetail(Discovery, "Operational mDNS record of type %u could not be cached", static_cast<unsigned>(data.GetType()));
+    }
+
     /// Data content is expected to contain:
     /// - A SRV entry that includes the node ID in expected format (fabric + nodeid)
     ///    - Can extract: fabricid, nodeid, port
@@ -229,7 +209,6 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         if (!srv.Parse(data.GetData(), mPacketRange))
         {
             ChipLogError(Discovery, "Packet data reporter failed to parse SRV record");
-            mHasNodePort = false;
         }
         else if (mDiscoveryType == DiscoveryType::kOperational)
         {
@@ -237,7 +216,7 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
             // TODO: Fix this comparison which is too loose.
             if (HasQNamePart(data.GetName(), kOperationalServiceName))
             {
-                OnOperationalSrvRecord(data.GetName(), srv);
+                OnOperationalSrvRecord(data.GetName());
             }
         }
         else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
@@ -268,29 +247,16 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
             TxtRecordDelegateImpl<DiscoveredNodeData> textRecordDelegate(mDiscoveredNodeData);
             ParseTxtRecord(data.GetData(), &textRecordDelegate);
         }
-        else if (mDiscoveryType == DiscoveryType::kOperational)
-        {
-            TxtRecordDelegateImpl<ResolvedNodeData> textRecordDelegate(mNodeData);
-            ParseTxtRecord(data.GetData(), &textRecordDelegate);
-        }
         break;
     case QType::A: {
         Inet::IPAddress addr;
         if (!ParseARecord(data.GetData(), &addr))
         {
             ChipLogError(Discovery, "Packet data reporter failed to parse A record");
-            mHasIP = false;
         }
-        else
+        else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
         {
-            if (mDiscoveryType == DiscoveryType::kOperational)
-            {
-                OnOperationalIPAddress(addr);
-            }
-            else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
-            {
-                OnDiscoveredNodeIPAddress(addr);
-            }
+            OnDiscoveredNodeIPAddress(addr);
         }
         break;
     }
@@ -299,18 +265,10 @@ void PacketDataReporter::OnResource(ResourceType type, const ResourceData & data
         if (!ParseAAAARecord(data.GetData(), &addr))
         {
             ChipLogError(Discovery, "Packet data reporter failed to parse AAAA record");
-            mHasIP = false;
         }
-        else
+        else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
         {
-            if (mDiscoveryType == DiscoveryType::kOperational)
-            {
-                OnOperationalIPAddress(addr);
-            }
-            else if (mDiscoveryType == DiscoveryType::kCommissionableNode || mDiscoveryType == DiscoveryType::kCommissionerNode)
-            {
-                OnDiscoveredNodeIPAddress(addr);
-            }
+            OnDiscoveredNodeIPAddress(addr);
         }
         break;
     }
@@ -334,32 +292,12 @@ void PacketDataReporter::OnComplete(ActiveResolveAttempts & activeAttempts)
             ChipLogError(Discovery, "No delegate to report commissioning node discovery");
         }
     }
-    else if (mDiscoveryType == DiscoveryType::kOperational && mHasIP && mHasNodePort)
-    {
-        activeAttempts.Complete(mNodeData.mPeerId);
-        mNodeData.LogNodeIdResolved();
-
-        //
-        // This is a quick fix to address some failing tests. Issue #15489 tracks the correct fix here.
-        //
-        const System::Clock::Timestamp currentTime = System::SystemClock().GetMonotonicTimestamp();
-        mNodeData.mExpiryTime                      = currentTime + System::Clock::Seconds16(kDefaultTtlSeconds);
-
-        if (mOperationalDelegate != nullptr)
-        {
-            mOperationalDelegate->OnOperationalNodeResolved(mNodeData);
-        }
-        else
-        {
-            ChipLogError(Discovery, "No delegate to report operational node discovery");
-        }
-    }
 }
 
 class MinMdnsResolver : public Resolver, public MdnsPacketDelegate
 {
 public:
-    MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock())
+    MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock()), mRecordCache(&chip::System::SystemClock())
     {
         GlobalMinimalMdnsServer::Instance().SetResponseDelegate(this);
     }
@@ -382,6 +320,7 @@ private:
     DiscoveryType mDiscoveryType                          = DiscoveryType::kUnknown;
     System::Layer * mSystemLayer                          = nullptr;
     ActiveResolveAttempts mActiveResolves;
+    RecordCache<CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE> mRecordCache;
 
     CHIP_ERROR SendPendingResolveQueries();
     CHIP_ERROR SendPendingBrowseQueries();
@@ -390,6 +329,17 @@ private:
 
     static void RetryCallback(System::Layer *, void * self);
 
+    // Fills in the node data from the cached records, if they have all that is needed
+    // (a SRV record and at least one address).
+    bool ResolveFromCache(const PeerId & peerId, ResolvedNodeData & nodeData);
+
+    // Reports the pending resolves that cached records can answer, as well as the
+    // given node, which advertised itself without necessarily being asked to.
+    void ReportCachedResolves(const Optional<PeerId> & advertisedPeer);
+    void ReportResolved(ResolvedNodeData & nodeData);
+
+    static void ReportCachedResolvesCallback(System::Layer *, void * self);
+
     CHIP_ERROR SendQuery(mdns::Minimal::FullQName qname, mdns::Minimal::QType type, bool unicastResponse);
     CHIP_ERROR BrowseNodes(DiscoveryType type, DiscoveryFilter subtype);
     template <typename... Args>
@@ -413,7 +363,7 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
         return;
     }
 
-    PacketDataReporter reporter(mOperationalDelegate, mCommissioningDelegate, info->Interface, mDiscoveryType, data);
+    PacketDataReporter reporter(mCommissioningDelegate, mRecordCache, info->Interface, mDiscoveryType, data);
 
     if (!ParsePacket(data, &reporter))
     {
@@ -422,6 +372,7 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
     else
     {
         reporter.OnComplete(mActiveResolves);
+        ReportCachedResolves(reporter.GetOperationalPeer());
         ScheduleRetries();
     }
 }
@@ -442,6 +393,11 @@ CHIP_ERROR MinMdnsResolver::Init(chip::Inet::EndPointManager<chip::Inet::UDPEndP
 
 void MinMdnsResolver::Shutdown()
 {
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(&ReportCachedResolvesCallback, this);
+    }
+    mRecordCache.Clear();
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
 }
 
@@ -600,8 +556,122 @@ void MinMdnsResolver::RetryCallback(System::Layer *, void * self)
     reinterpret_cast<MinMdnsResolver *>(self)->SendAllPendingQueries();
 }
 
+bool MinMdnsResolver::ResolveFromCache(const PeerId & peerId, ResolvedNodeData & nodeData)
+{
+    char nameBuffer[kMaxOperationalServiceNameSize] = "";
+    if (MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId) != CHIP_NO_ERROR)
+    {
+        return false;
+    }
+    const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+
+    const RecordCacheBase::Record * srvRecord = mRecordCache.Find(FullQName(instanceQName), QType::SRV);
+    SrvRecord srv;
+    if ((srvRecord == nullptr) || !srv.Parse(srvRecord->GetData(), srvRecord->GetData()))
+    {
+        return false;
+    }
+
+    nodeData         = ResolvedNodeData();
+    nodeData.mPeerId = peerId;
+    nodeData.mPort   = srv.GetPort();
+
+    SerializedQNameIterator hostName = srv.GetName();
+    if (hostName.Next())
+    {
+        Platform::CopyString(nodeData.mHostName, hostName.Value());
+    }
+
+    // The node is reported for as long as all the records used remain valid.
+    System::Clock::Timestamp expiryTime = srvRecord->GetExpiryTime();
+
+    for (QType type : { QType::AAAA, QType::A })
+    {
+        const RecordCacheBase::Record * record = nullptr;
+        while ((nodeData.mNumIPs < ResolvedNodeData::kMaxIPAddresses) &&
+               ((record = mRecordCache.Find(srv.GetName(), type, record)) != nullptr))
+        {
+            Inet::IPAddress addr;
+            const bool parsed =
+                (type == QType::AAAA) ? ParseAAAARecord(record->GetData(), &addr) : ParseARecord(record->GetData(), &addr);
+
+            // A single interface is reported: link-local addresses are only valid on the one they were received on.
+            if (!parsed || ((nodeData.mNumIPs > 0) && (record->GetInterfaceId() != nodeData.mInterfaceId)))
+            {
+                continue;
+            }
+
+            nodeData.mAddress[nodeData.mNumIPs++] = addr;
+            nodeData.mInterfaceId                 = record->GetInterfaceId();
+            expiryTime                            = std::min(expiryTime, record->GetExpiryTime());
+        }
+    }
+
+    if (nodeData.mNumIPs == 0)
+    {
+        return false;
+    }
+
+    // The TXT record carries the MRP parameters of the node: without it, the node is not reported until it is received, rather
+    // than with default parameters that may not suit it.
+    const RecordCacheBase::Record * txtRecord = mRecordCache.Find(FullQName(instanceQName), QType::TXT);
+    if (txtRecord == nullptr)
+    {
+        return false;
+    }
+
+    TxtRecordDelegateImpl<ResolvedNodeData> textRecordDelegate(nodeData);
+    ParseTxtRecord(txtRecord->GetData(), &textRecordDelegate);
+
+    nodeData.mExpiryTime = std::min(expiryTime, txtRecord->GetExpiryTime());
+    return true;
+}
+
+void MinMdnsResolver::ReportResolved(ResolvedNodeData & nodeData)
+{
+    mActiveResolves.Complete(nodeData.mPeerId);
+    nodeData.LogNodeIdResolved();
+
+    if (mOperationalDelegate != nullptr)
+    {
+        mOperationalDelegate->OnOperationalNodeResolved(nodeData);
+    }
+    else
+    {
+        ChipLogError(Discovery, "No delegate to report operational node discovery");
+    }
+}
+
+void MinMdnsResolver::ReportCachedResolves(const Optional<PeerId> & advertisedPeer)
+{
+    ResolvedNodeData nodeData;
+
+    if (advertisedPeer.HasValue() && ResolveFromCache(advertisedPeer.Value(), nodeData))
+    {
+        ReportResolved(nodeData);
+    }
+
+    for (size_t i = 0; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        Optional<PeerId> peerId = mActiveResolves.GetPendingResolve(i);
+        if (peerId.HasValue() && ResolveFromCache(peerId.Value(), nodeData))
+        {
+            ReportResolved(nodeData);
+        }
+    }
+}
+
+void MinMdnsResolver::ReportCachedResolvesCallback(System::Layer *, void * self)
+{
+    MinMdnsResolver * resolver = reinterpret_cast<MinMdnsResolver *>(self);
+    resolver->ReportCachedResolves(Optional<PeerId>::Missing());
+    resolver->ScheduleRetries();
+}
+
 CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
 {
+    bool answeredFromCache = false;
+
     while (true)
     {
         Optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
@@ -615,6 +685,14 @@ CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
             continue;
         }
 
+        // Reported once the caller is done (it may not be ready for the answer yet), without a query.
+        ResolvedNodeData nodeData;
+        if (ResolveFromCache(resolve.Value().peerId, nodeData))
+        {
+            answeredFromCache = true;
+            continue;
+        }
+
         System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
         ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
 
@@ -650,6 +728,40 @@ CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
             // would be needed to resolve the host name to an IP address
 
             builder.AddQuery(query);
+
+            // The addresses of a known host may have expired before its SRV record.
+            // Responders leave out known answers, and the additional records that
+            // come with them, so the host addresses are asked for separately.
+            const RecordCacheBase::Record * srvRecord = mRecordCache.Find(FullQName(instanceQName), QType::SRV);
+            SrvRecord srv;
+            char hostName[kHostNameMaxLength + 1] = "";
+            if ((srvRecord != nullptr) && srv.Parse(srvRecord->GetData(), srvRecord->GetData()))
+            {
+                SerializedQNameIterator srvHostName = srv.GetName();
+                if (srvHostName.Next())
+                {
+                    Platform::CopyString(hostName, srvHostName.Value());
+                }
+            }
+
+            if (hostName[0] != '\0')
+            {
+                // Operational host names are <host>.local
+                const char * hostQName[] = { hostName, kLocalDomain };
+                Query hostQuery(hostQName);
+                hostQuery.SetClass(QClass::IN).SetType(QType::ANY).SetAnswerViaUnicast(resolve.Value().firstSend);
+                builder.AddQuery(hostQuery);
+            }
+
+            const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+            for (QType type : { QType::SRV, QType::TXT })
+            {
+                const RecordCacheBase::Record * knownAnswer = mRecordCache.Find(FullQName(instanceQName), type);
+                if ((knownAnswer != nullptr) && knownAnswer->IsFresh(now))
+                {
+                    builder.AddKnownAnswer(*knownAnswer, now);
+                }
+            }
         }
 
         ReturnErrorCodeIf(!builder.Ok(), CHIP_ERROR_INTERNAL);
@@ -664,6 +776,12 @@ CHIP_ERROR MinMdnsResolver::SendPendingResolveQueries()
         }
     }
 
+    if (answeredFromCache)
+    {
+        ReturnErrorCodeIf(mSystemLayer == nullptr, CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(mSystemLayer->StartTimer(System::Clock::kZero, &ReportCachedResolvesCallback, this));
+    }
+
     return ScheduleRetries();
 }
 
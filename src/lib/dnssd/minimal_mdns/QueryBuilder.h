@@ -20,6 +20,7 @@
 #include <system/SystemPacketBuffer.h>
 
 #include <lib/dnssd/minimal_mdns/Query.h>
+#include <lib/dnssd/minimal_mdns/RecordCache.h>
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
 
 namespace mdns {
@@ -81,6 +82,31 @@ public:
         return *this;
     }
 
+    /// Lists a record the querier already has, so that responders do not send
+    /// it again (known-answer suppression, RFC 6762 section 7.1).
+    ///
+    /// Known answers MUST be added after all the queries.
+    QueryBuilder & AddKnownAnswer(const RecordCacheBase::Record & record, chip::System::Clock::Timestamp now)
+    {
+        if (!mQueryBuildOk)
+        {
+            return *this;
+        }
+
+        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
+        RecordWriter writer(&out);
+
+        if (!record.Append(mHeader, ResourceType::kAnswer, writer, now))
+        {
+            mQueryBuildOk = false;
+        }
+        else
+        {
+            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+        }
+        return *this;
+    }
+
     bool Ok() const { return mQueryBuildOk; }
 
 private:
@@ -0,0 +1,263 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "RecordCache.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/support/BufferWriter.h>
+
+namespace mdns {
+namespace Minimal {
+
+using chip::System::Clock::Timestamp;
+
+namespace {
+
+// How long records evicted by a cache-flush record remain (RFC 6762, section 10.2).
+constexpr chip::System::Clock::Milliseconds64 kFlushedRecordLifetime = chip::System::Clock::Seconds16(1);
+
+} // namespace
+
+bool RecordCacheBase::Record::IsFresh(Timestamp now) const
+{
+    const Timestamp halfLife = mReceivedTime + chip::System::Clock::Milliseconds64(mTtlSeconds * 500ull);
+    return (now < halfLife) && (now < mExpiryTime);
+}
+
+bool RecordCacheBase::Record::Append(HeaderRef & hdr, ResourceType asType, RecordWriter & out, Timestamp now) const
+{
+    // Same ordering rules as ResourceRecord::Append: answers, then authority, then additional.
+    if ((asType == ResourceType::kAuthority) && (hdr.GetAdditionalCount() != 0))
+    {
+        return false;
+    }
+    if ((asType == ResourceType::kAnswer) && ((hdr.GetAdditionalCount() != 0) || (hdr.GetAuthorityCount() != 0)))
+    {
+        return false;
+    }
+    if (!IsLive(now))
+    {
+        return false;
+    }
+
+    // Rounded up, so that a live record is never sent with a TTL of 0 (a goodbye).
+    const uint64_t remainingMs = (mExpiryTime - now).count();
+    const uint32_t ttlSeconds  = static_cast<uint32_t>((remainingMs + 999) / 1000);
+
+    out.WriteQName(GetName())
+        .Put16(static_cast<uint16_t>(mType))
+        .Put16(static_cast<uint16_t>(QClass::IN))
+        .Put32(ttlSeconds)
+        .Put16(mDataSize)
+        .Put(GetData());
+
+    if (!out.Fit())
+    {
+        return false;
+    }
+
+    switch (asType)
+    {
+    case ResourceType::kAdditional:
+        hdr.SetAdditionalCount(static_cast<uint16_t>(hdr.GetAdditionalCount() + 1));
+        break;
+    case ResourceType::kAuthority:
+        hdr.SetAuthorityCount(static_cast<uint16_t>(hdr.GetAuthorityCount() + 1));
+        break;
+    case ResourceType::kAnswer:
+        hdr.SetAnswerCount(static_cast<uint16_t>(hdr.GetAnswerCount() + 1));
+        break;
+    }
+    return true;
+}
+
+bool RecordCacheBase::Record::IsSameRecord(const Record & other) const
+{
+    return (mType == other.mType) && (mNameSize == other.mNameSize) && (mDataSize == other.mDataSize) &&
+        (GetName() == other.GetName()) && (memcmp(mData, other.mData, mDataSize) == 0);
+}
+
+bool RecordCacheBase::Add(const ResourceData & data, const BytesRange & packet, chip::Inet::InterfaceId interfaceId)
+{
+    Record record;
+
+    {
+        chip::Encoding::BigEndian::BufferWriter nameOut(record.mName, sizeof(record.mName));
+        RecordWriter nameWriter(&nameOut);
+        if (!nameWriter.WriteQName(data.GetName()).Fit())
+        {
+            return false;
+        }
+        record.mNameSize = static_cast<uint16_t>(nameOut.Needed());
+    }
+
+    {
+        // Names within the data may point anywhere in the packet: store them expanded.
+        chip::Encoding::BigEndian::BufferWriter dataOut(record.mData, sizeof(record.mData));
+        RecordWriter dataWriter(&dataOut);
+
+        switch (data.GetType())
+        {
+        case QType::SRV: {
+            SrvRecord srv;
+            if (!srv.Parse(data.GetData(), packet))
+            {
+                return false;
+            }
+            dataWriter.Put16(srv.GetPriority()).Put16(srv.GetWeight()).Put16(srv.GetPort()).WriteQName(srv.GetName());
+            break;
+        }
+        case QType::PTR: {
+            SerializedQNameIterator name;
+            if (!ParsePtrRecord(data.GetData(), packet, &name))
+            {
+                return false;
+            }
+            dataWriter.WriteQName(name);
+            break;
+        }
+        default:
+            dataWriter.Put(data.GetData());
+            break;
+        }
+
+        if (!dataWriter.Fit())
+        {
+            return false;
+        }
+        record.mDataSize = static_cast<uint16_t>(dataOut.Needed());
+    }
+
+    const Timestamp now   = mClock->GetMonotonicTimestamp();
+    const uint32_t ttl    = static_cast<uint32_t>(data.GetTtlSeconds());
+    const bool cacheFlush = (static_cast<uint16_t>(data.GetClass()) & kQClassResponseFlushBit) != 0;
+
+    record.mType         = data.GetType();
+    record.mInterfaceId  = interfaceId;
+    record.mTtlSeconds   = ttl;
+    record.mReceivedTime = now;
+    record.mExpiryTime   = now + chip::System::Clock::Seconds32(ttl);
+
+    Record * existingRecord = nullptr;
+
+    for (size_t i = 0; i < mRecordCount; i++)
+    {
+        Record & other = mRecords[i];
+        if (!other.IsLive(now))
+        {
+            continue;
+        }
+        if (other.IsSameRecord(record))
+        {
+            existingRecord = &other;
+        }
+        else if (cacheFlush && (other.mType == record.mType) && (other.mReceivedTime + kFlushedRecordLifetime <= now) &&
+                 (other.GetName() == record.GetName()))
+        {
+            other.mExpiryTime = std::min(other.mExpiryTime, now + kFlushedRecordLifetime);
+        }
+    }
+
+    if (ttl == 0)
+    {
+        // Goodbye: the record is no longer valid
+        if (existingRecord != nullptr)
+        {
+            existingRecord->Clear();
+        }
+        return true;
+    }
+
+    Record & slot = (existingRecord != nullptr) ? *existingRecord : AllocateRecord(now);
+    slot          = record;
+    return true;
+}
+
+RecordCacheBase::Record & RecordCacheBase::AllocateRecord(Timestamp now)
+{
+    Record * oldest = &mRecords[0];
+    for (size_t i = 0; i < mRecordCount; i++)
+    {
+        Record & record = mRecords[i];
+        if (!record.IsLive(now))
+        {
+            return record;
+        }
+        if (record.mExpiryTime < oldest->mExpiryTime)
+        {
+            oldest = &record;
+        }
+    }
+    return *oldest;
+}
+
+template <class Name>
+const RecordCacheBase::Record * RecordCacheBase::FindRecord(const Name & name, QType type, const Record * previous) const
+{
+    const Timestamp now = mClock->GetMonotonicTimestamp();
+    const size_t start  = (previous == nullptr) ? 0 : static_cast<size_t>(previous - mRecords) + 1;
+
+    for (size_t i = start; i < mRecordCount; i++)
+    {
+        const Record & record = mRecords[i];
+        if (record.IsLive(now) && (record.mType == type) && (record.GetName() == name))
+        {
+            return &record;
+        }
+    }
+    return nullptr;
+}
+
+const RecordCacheBase::Record * RecordCacheBase::Find(const FullQName & name, QType type, const Record * previous) const
+{
+    return FindRecord(name, type, previous);
+}
+
+const RecordCacheBase::Record * RecordCacheBase::Find(const SerializedQNameIterator & name, QType type,
+                                                      const Record * previous) const
+{
+    return FindRecord(name, type, previous);
+}
+
+size_t RecordCacheBase::GetRecordCount() const
+{
+    const Timestamp now = mClock->GetMonotonicTimestamp();
+    size_t count        = 0;
+    for (size_t i = 0; i < mRecordCount; i++)
+    {
+        if (mRecords[i].IsLive(now))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void RecordCacheBase::Clear()
+{
+    for (size_t i = 0; i < mRecordCount; i++)
+    {
+        mRecords[i].Clear();
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,142 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <inet/InetInterface.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/core/BytesRange.h>
+#include <lib/dnssd/minimal_mdns/core/Constants.h>
+#include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
+#include <lib/dnssd/minimal_mdns/core/QName.h>
+#include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
+#include <system/SystemClock.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Remembers the resource records received in mDNS responses until their TTL
+/// runs out.
+///
+/// Allows putting together answers that arrive in separate packets, and
+/// answering lookups without going back on the wire.
+///
+/// Names within record data (SRV targets, PTR names) are stored uncompressed,
+/// so that record data can be parsed on its own: pass GetData() as both the
+/// data and the packet range to the RecordData.h parsers.
+///
+/// When full, adding a record evicts the one closest to its expiry.
+class RecordCacheBase
+{
+public:
+    /// Records with a larger name or data are not cached.
+    ///
+    /// Operational TXT records (SII, SAI, T...) take at most about 50 bytes,
+    /// but commissionable ones often exceed kMaxDataSize: Add() rejects them.
+    static constexpr size_t kMaxNameSize = 64; // serialized
+    static constexpr size_t kMaxDataSize = 96;
+
+    class Record
+    {
+    public:
+        QType GetType() const { return mType; }
+        SerializedQNameIterator GetName() const { return SerializedQNameIterator(BytesRange(mName, mName + mNameSize), mName); }
+        BytesRange GetData() const { return BytesRange(mData, mData + mDataSize); }
+        chip::Inet::InterfaceId GetInterfaceId() const { return mInterfaceId; }
+        chip::System::Clock::Timestamp GetExpiryTime() const { return mExpiryTime; }
+
+        /// Whether less than half of the TTL went by, in which case the record
+        /// may be listed as a known answer (RFC 6762, section 7.1).
+        bool IsFresh(chip::System::Clock::Timestamp now) const;
+
+        /// Append the record, with its remaining TTL, to the given output.
+        /// Updates header item count on success, does NOT update header on failure.
+        bool Append(HeaderRef & hdr, ResourceType asType, RecordWriter & out, chip::System::Clock::Timestamp now) const;
+
+    private:
+        friend class RecordCacheBase;
+
+        bool IsUsed() const { return mNameSize != 0; }
+        bool IsLive(chip::System::Clock::Timestamp now) const { return IsUsed() && (now < mExpiryTime); }
+        bool IsSameRecord(const Record & other) const;
+        void Clear() { mNameSize = 0; }
+
+        chip::System::Clock::Timestamp mReceivedTime;
+        chip::System::Clock::Timestamp mExpiryTime;
+        chip::Inet::InterfaceId mInterfaceId;
+        uint32_t mTtlSeconds = 0;
+        QType mType          = QType::ANY;
+        uint16_t mNameSize   = 0; // 0 for an unused record
+        uint16_t mDataSize   = 0;
+        uint8_t mName[kMaxNameSize];
+        uint8_t mData[kMaxDataSize];
+    };
+
+    /// Adds the record, received within [packet] on the given interface, or
+    /// refreshes its TTL if already known.
+    ///
+    /// A record with a TTL of 0 (a goodbye) is removed instead. A record with
+    /// the cache-flush bit set expires the other records of the same name and
+    /// type received more than a second before (RFC 6762, section 10.2).
+    ///
+    /// Returns false if the record could not be cached.
+    bool Add(const ResourceData & data, const BytesRange & packet, chip::Inet::InterfaceId interfaceId);
+
+    /// Finds the next record of the given name and type that did not expire,
+    /// starting after [previous], or at the beginning if null.
+    const Record * Find(const FullQName & name, QType type, const Record * previous = nullptr) const;
+    const Record * Find(const SerializedQNameIterator & name, QType type, const Record * previous = nullptr) const;
+
+    /// Number of records that did not expire.
+    size_t GetRecordCount() const;
+
+    void Clear();
+
+protected:
+    RecordCacheBase(Record * records, size_t recordCount, chip::System::Clock::ClockBase * clock) :
+        mRecords(records), mRecordCount(recordCount), mClock(clock)
+    {}
+
+private:
+    template <class Name>
+    const Record * FindRecord(const Name & name, QType type, const Record * previous) const;
+
+    /// Picks the record to overwrite with a new one
+    Record & AllocateRecord(chip::System::Clock::Timestamp now);
+
+    Record * mRecords;
+    const size_t mRecordCount;
+    chip::System::Clock::ClockBase * mClock;
+};
+
+template <size_t kCacheSize>
+class RecordCache : public RecordCacheBase
+{
+public:
+    static_assert(kCacheSize > 0, "A record cache must be able to hold records");
+
+    RecordCache(chip::System::Clock::ClockBase * clock) : RecordCacheBase(mData, kCacheSize, clock) {}
+
+private:
+    Record mData[kCacheSize];
+};
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,395 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/minimal_mdns/RecordCache.h>
+
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/dnssd/minimal_mdns/records/Txt.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using namespace mdns::Minimal;
+
+const QNamePart kInstanceName[] = { "ABCD-1234", "_matter", "_tcp", "local" };
+const QNamePart kHostName[]     = { "AABBCCDDEEFF", "local" };
+const char * kTxtEntries[]      = { "SII=5000", "T=0" };
+
+/// Builds a response packet out of resource records
+class TestPacket
+{
+public:
+    TestPacket() : mOut(mBuffer, sizeof(mBuffer)), mWriter(&mOut), mHeader(mBuffer)
+    {
+        mHeader.Clear();
+        mHeader.SetFlags(mHeader.GetFlags().SetResponse());
+        mOut.Skip(HeaderRef::kSizeBytes);
+    }
+
+    TestPacket & Add(ResourceRecord & record, uint32_t ttl, bool cacheFlush = false)
+    {
+        record.SetTtl(ttl).SetCacheFlush(cacheFlush);
+        mOk = mOk && record.Append(mHeader, ResourceType::kAnswer, mWriter);
+        return *this;
+    }
+
+    bool Ok() const { return mOk && mOut.Fit(); }
+    BytesRange Range() const { return BytesRange(mBuffer, mBuffer + mOut.Needed()); }
+
+private:
+    uint8_t mBuffer[512];
+    Encoding::BigEndian::BufferWriter mOut;
+    RecordWriter mWriter;
+    HeaderRef mHeader;
+    bool mOk = true;
+};
+
+/// Adds every record of a packet to a cache
+class CacheFiller : public ParserDelegate
+{
+public:
+    CacheFiller(RecordCacheBase & cache, const BytesRange & packet) : mCache(cache), mPacket(packet) {}
+
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        if (mCache.Add(data, mPacket, Inet::InterfaceId::Null()))
+        {
+            mAddedCount++;
+        }
+    }
+
+    size_t mAddedCount = 0;
+
+private:
+    RecordCacheBase & mCache;
+    BytesRange mPacket;
+};
+
+size_t Receive(nlTestSuite * inSuite, RecordCacheBase & cache, const TestPacket & packet)
+{
+    NL_TEST_ASSERT(inSuite, packet.Ok());
+    CacheFiller filler(cache, packet.Range());
+    NL_TEST_ASSERT(inSuite, ParsePacket(packet.Range(), &filler));
+    return filler.mAddedCount;
+}
+
+Inet::IPAddress MakeAddress(const char * text)
+{
+    Inet::IPAddress address;
+    Inet::IPAddress::FromString(text, address);
+    return address;
+}
+
+void TestAddAndFind(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    TxtResourceRecord txt(kInstanceName, kTxtEntries);
+    IPResourceRecord ip(kHostName, MakeAddress("fe80::1"));
+
+    // Host name is compressed in the packet
+    TestPacket packet;
+    packet.Add(srv, 120).Add(txt, 4500).Add(ip, 120);
+    NL_TEST_ASSERT(inSuite, Receive(inSuite, cache, packet) == 3);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 3);
+
+    const RecordCacheBase::Record * srvRecord = cache.Find(FullQName(kInstanceName), QType::SRV);
+    NL_TEST_ASSERT(inSuite, srvRecord != nullptr);
+    VerifyOrReturn(srvRecord != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV, srvRecord) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::A) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::SRV) == nullptr);
+
+    // Cached data parses on its own
+    SrvRecord parsedSrv;
+    NL_TEST_ASSERT(inSuite, parsedSrv.Parse(srvRecord->GetData(), srvRecord->GetData()));
+    NL_TEST_ASSERT(inSuite, parsedSrv.GetPort() == 5540);
+    NL_TEST_ASSERT(inSuite, parsedSrv.GetName() == FullQName(kHostName));
+
+    const RecordCacheBase::Record * ipRecord = cache.Find(parsedSrv.GetName(), QType::AAAA);
+    NL_TEST_ASSERT(inSuite, ipRecord != nullptr);
+    VerifyOrReturn(ipRecord != nullptr);
+    NL_TEST_ASSERT(inSuite, ipRecord->GetName() == FullQName(kHostName));
+
+    Inet::IPAddress address;
+    NL_TEST_ASSERT(inSuite, ParseAAAARecord(ipRecord->GetData(), &address));
+    NL_TEST_ASSERT(inSuite, address == MakeAddress("fe80::1"));
+
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::TXT) != nullptr);
+
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 0);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV) == nullptr);
+}
+
+void TestAnswersAcrossPackets(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    IPResourceRecord ip1(kHostName, MakeAddress("fe80::1"));
+    IPResourceRecord ip2(kHostName, MakeAddress("fd00::1"));
+
+    TestPacket first;
+    first.Add(srv, 120);
+    NL_TEST_ASSERT(inSuite, Receive(inSuite, cache, first) == 1);
+
+    TestPacket second;
+    second.Add(ip1, 120).Add(ip2, 120);
+    NL_TEST_ASSERT(inSuite, Receive(inSuite, cache, second) == 2);
+
+    const RecordCacheBase::Record * ipRecord = cache.Find(FullQName(kHostName), QType::AAAA);
+    NL_TEST_ASSERT(inSuite, ipRecord != nullptr);
+    VerifyOrReturn(ipRecord != nullptr);
+    ipRecord = cache.Find(FullQName(kHostName), QType::AAAA, ipRecord);
+    NL_TEST_ASSERT(inSuite, ipRecord != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::AAAA, ipRecord) == nullptr);
+
+    // Receiving the same records again only refreshes them
+    NL_TEST_ASSERT(inSuite, Receive(inSuite, cache, second) == 2);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 3);
+}
+
+void TestExpiry(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    IPResourceRecord ip(kHostName, MakeAddress("fe80::1"));
+
+    TestPacket packet;
+    packet.Add(srv, 120).Add(ip, 10);
+    Receive(inSuite, cache, packet);
+
+    clock.AdvanceMonotonic(9999_ms64);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::AAAA) != nullptr);
+
+    clock.AdvanceMonotonic(1_ms64);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::AAAA) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 1);
+
+    // Refreshing a record extends its lifetime
+    clock.AdvanceMonotonic(100_ms64 * 1000);
+    TestPacket refresh;
+    refresh.Add(srv, 120);
+    Receive(inSuite, cache, refresh);
+
+    clock.AdvanceMonotonic(100_ms64 * 1000);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 1);
+}
+
+void TestGoodbye(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    IPResourceRecord ip(kHostName, MakeAddress("fe80::1"));
+
+    TestPacket packet;
+    packet.Add(srv, 120).Add(ip, 120);
+    Receive(inSuite, cache, packet);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 2);
+
+    TestPacket goodbye;
+    goodbye.Add(srv, 0);
+    Receive(inSuite, cache, goodbye);
+
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::AAAA) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 1);
+}
+
+void TestCacheFlush(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    IPResourceRecord oldIp(kHostName, MakeAddress("fe80::1"));
+    IPResourceRecord newIp1(kHostName, MakeAddress("fe80::2"));
+    IPResourceRecord newIp2(kHostName, MakeAddress("fe80::3"));
+
+    TestPacket packet;
+    packet.Add(oldIp, 120);
+    Receive(inSuite, cache, packet);
+
+    // The host changed addresses. Records of the same packet do not flush each other.
+    clock.AdvanceMonotonic(5000_ms64);
+    TestPacket update;
+    update.Add(newIp1, 120, /* cacheFlush = */ true).Add(newIp2, 120, /* cacheFlush = */ true);
+    Receive(inSuite, cache, update);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 3);
+
+    clock.AdvanceMonotonic(1000_ms64);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 2);
+
+    Inet::IPAddress address;
+    const RecordCacheBase::Record * record = nullptr;
+    while ((record = cache.Find(FullQName(kHostName), QType::AAAA, record)) != nullptr)
+    {
+        NL_TEST_ASSERT(inSuite, ParseAAAARecord(record->GetData(), &address));
+        NL_TEST_ASSERT(inSuite, address != MakeAddress("fe80::1"));
+    }
+}
+
+void TestEviction(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<2> cache(&clock);
+
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+    TxtResourceRecord txt(kInstanceName, kTxtEntries);
+    IPResourceRecord ip(kHostName, MakeAddress("fe80::1"));
+
+    TestPacket packet;
+    packet.Add(srv, 120).Add(txt, 4500);
+    Receive(inSuite, cache, packet);
+
+    // Full: the record closest to its expiry makes room
+    TestPacket more;
+    more.Add(ip, 120);
+    Receive(inSuite, cache, more);
+
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 2);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::TXT) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::AAAA) != nullptr);
+}
+
+void TestLargeRecords(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    // With the empty entry ending the record, these entries fill kMaxDataSize exactly: one byte more is too much.
+    const char * fittingEntries[] = { "VP=65521+32769-abcdefghijklmnop", "DN=abcdefghijklmnopqrstuvwxyz01",
+                                      "RI=0123456789ABCDEF0123456789AB" };
+    const char * largeEntries[]   = { "VP=65521+32769-abcdefghijklmnop", "DN=abcdefghijklmnopqrstuvwxyz01",
+                                      "RI=0123456789ABCDEF0123456789ABC" };
+    TxtResourceRecord fittingTxt(kInstanceName, fittingEntries);
+    TxtResourceRecord largeTxt(kHostName, largeEntries);
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+
+    TestPacket packet;
+    packet.Add(fittingTxt, 4500).Add(largeTxt, 4500).Add(srv, 120);
+    NL_TEST_ASSERT(inSuite, Receive(inSuite, cache, packet) == 2);
+
+    const RecordCacheBase::Record * record = cache.Find(FullQName(kInstanceName), QType::TXT);
+    NL_TEST_ASSERT(inSuite, record != nullptr);
+    NL_TEST_ASSERT(inSuite, (record != nullptr) && (record->GetData().Size() == RecordCacheBase::kMaxDataSize));
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kHostName), QType::TXT) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(FullQName(kInstanceName), QType::SRV) != nullptr);
+}
+
+void TestKnownAnswers(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SrvResourceRecord srv(kInstanceName, kHostName, 5540);
+
+    TestPacket packet;
+    packet.Add(srv, 120);
+    Receive(inSuite, cache, packet);
+
+    const RecordCacheBase::Record * srvRecord = cache.Find(FullQName(kInstanceName), QType::SRV);
+    NL_TEST_ASSERT(inSuite, srvRecord != nullptr);
+    VerifyOrReturn(srvRecord != nullptr);
+
+    clock.AdvanceMonotonic(30000_ms64);
+    const System::Clock::Timestamp now = clock.GetMonotonicTimestamp();
+    NL_TEST_ASSERT(inSuite, srvRecord->IsFresh(now));
+
+    QueryBuilder builder(System::PacketBufferHandle::New(512));
+    Query query(kInstanceName);
+    query.SetType(QType::ANY);
+    builder.AddQuery(query).AddKnownAnswer(*srvRecord, now);
+    NL_TEST_ASSERT(inSuite, builder.Ok());
+
+    // Queries cannot follow answers
+    builder.AddQuery(query);
+    NL_TEST_ASSERT(inSuite, !builder.Ok());
+
+    System::PacketBufferHandle buffer = builder.ReleasePacket();
+    BytesRange queryPacket(buffer->Start(), buffer->Start() + buffer->DataLength());
+
+    // The known answer carries the remaining TTL
+    RecordCache<8> received(&clock);
+    CacheFiller filler(received, queryPacket);
+    NL_TEST_ASSERT(inSuite, ParsePacket(queryPacket, &filler));
+    NL_TEST_ASSERT(inSuite, filler.mAddedCount == 1);
+
+    const RecordCacheBase::Record * answer = received.Find(FullQName(kInstanceName), QType::SRV);
+    NL_TEST_ASSERT(inSuite, answer != nullptr);
+    VerifyOrReturn(answer != nullptr);
+    NL_TEST_ASSERT(inSuite, answer->GetExpiryTime() == now + System::Clock::Seconds32(90));
+
+    clock.AdvanceMonotonic(30000_ms64);
+    NL_TEST_ASSERT(inSuite, !srvRecord->IsFresh(clock.GetMonotonicTimestamp()));
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("AddAndFind", TestAddAndFind),                       //
+    NL_TEST_DEF("AnswersAcrossPackets", TestAnswersAcrossPackets),   //
+    NL_TEST_DEF("Expiry", TestExpiry),                               //
+    NL_TEST_DEF("Goodbye", TestGoodbye),                             //
+    NL_TEST_DEF("CacheFlush", TestCacheFlush),                       //
+    NL_TEST_DEF("Eviction", TestEviction),                           //
+    NL_TEST_DEF("LargeRecords", TestLargeRecords),                   //
+    NL_TEST_DEF("KnownAnswers", TestKnownAnswers),                   //
+    NL_TEST_SENTINEL()                                               //
+};
+
+int TestSetup(void * inContext)
+{
+    return Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestRecordCache(void)
+{
+    nlTestSuite theSuite = { "RecordCache", sTests, &TestSetup, &TestTeardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestRecordCache)
@@ -382,6 +382,41 @@ void TestCombination(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !attempts.NextScheduled().HasValue());
 }
 
+void TestPendingResolves(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock mockClock;
+    mdns::Minimal::ActiveResolveAttempts attempts(&mockClock);
+
+    Dnssd::DiscoveryFilter filter(Dnssd::DiscoveryFilterType::kLongDiscriminator, 1234);
+
+    attempts.MarkPending(MakePeerId(1));
+    attempts.MarkPending(filter, Dnssd::DiscoveryType::kCommissionableNode);
+    attempts.MarkPending(MakePeerId(2));
+
+    unsigned found = 0;
+    for (size_t i = 0; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        Optional<PeerId> peerId = attempts.GetPendingResolve(i);
+        if (peerId.HasValue())
+        {
+            NL_TEST_ASSERT(inSuite, (peerId.Value() == MakePeerId(1)) || (peerId.Value() == MakePeerId(2)));
+            found++;
+        }
+    }
+    NL_TEST_ASSERT(inSuite, found == 2);
+    NL_TEST_ASSERT(inSuite, !attempts.GetPendingResolve(ActiveResolveAttempts::kRetryQueueSize).HasValue());
+
+    // Going through pending resolves does not affect their schedule
+    NL_TEST_ASSERT(inSuite, attempts.NextScheduled() == ScheduledPeer(1, true));
+
+    attempts.Complete(MakePeerId(1));
+    attempts.Complete(MakePeerId(2));
+    for (size_t i = 0; i < ActiveResolveAttempts::kRetryQueueSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, !attempts.GetPendingResolve(i).HasValue());
+    }
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("TestSinglePeerAddRemove", TestSinglePeerAddRemove),     //
     NL_TEST_DEF("TestSingleBrowseAddRemove", TestSingleBrowseAddRemove), //
@@ -390,6 +425,7 @@ const nlTest sTests[] = {
     NL_TEST_DEF("TestLRU", TestLRU),                                     //
     NL_TEST_DEF("TestNextPeerOrdering", TestNextPeerOrdering),           //
     NL_TEST_DEF("TestCombination", TestCombination),                     //
+    NL_TEST_DEF("TestPendingResolves", TestPendingResolves),             //
     NL_TEST_SENTINEL()                                                   //
 };
 
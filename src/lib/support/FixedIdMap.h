@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Fixed-capacity hash map keyed by integer identifiers.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace chip {
+
+/**
+ * @brief
+ *   Maps integer identifiers (endpoint ids, session ids, ...) to values in constant expected time,
+ *   without any dynamic allocation.
+ *
+ *   The table holds up to kCapacity entries in a power-of-two array of at least twice that size, so
+ *   the load factor never exceeds one half. Collisions are resolved by linear probing and removal
+ *   shifts the following entries back, so lookups never have to skip deleted slots.
+ */
+template <typename Id, typename Value, size_t kCapacity>
+class FixedIdMap
+{
+    static_assert(std::is_integral<Id>::value, "FixedIdMap keys must be integers");
+    static_assert(kCapacity > 0, "FixedIdMap must hold at least one entry");
+
+    static constexpr size_t TableBits(size_t minSize, size_t bits = 1)
+    {
+        return ((static_cast<size_t>(1) << bits) >= minSize) ? bits : TableBits(minSize, bits + 1);
+    }
+
+public:
+    static constexpr size_t kTableBits = TableBits(2 * kCapacity);
+    static constexpr size_t kTableSize = static_cast<size_t>(1) << kTableBits;
+
+    FixedIdMap() { Clear(); }
+
+    void Clear()
+    {
+        for (auto & slot : mSlots)
+        {
+            slot.used = false;
+        }
+        mSize = 0;
+    }
+
+    size_t Size() const { return mSize; }
+    static constexpr size_t Capacity() { return kCapacity; }
+
+    /**
+     * Inserts a value or replaces the value already associated with the id.
+     *
+     * @return false if the id is not present and the map already holds kCapacity entries.
+     */
+    bool Put(Id id, const Value & value)
+    {
+        size_t index = Probe(id);
+        if (mSlots[index].used)
+        {
+            mSlots[index].value = value;
+            return true;
+        }
+        if (mSize >= kCapacity)
+        {
+            return false;
+        }
+        mSlots[index].id    = id;
+        mSlots[index].value = value;
+        mSlots[index].used  = true;
+        mSize++;
+        return true;
+    }
+
+    /**
+     * @return a pointer to the value associated with the id, or nullptr if the id is not present.
+     *         The pointer is invalidated by any subsequent Put, Remove or Clear.
+     */
+    const Value * Get(Id id) const
+    {
+        size_t index = Probe(id);
+        return mSlots[index].used ? &mSlots[index].value : nullptr;
+    }
+
+    Value * Get(Id id)
+    {
+        size_t index = Probe(id);
+        return mSlots[index].used ? &mSlots[index].value : nullptr;
+    }
+
+    bool Contains(Id id) const { return Get(id) != nullptr; }
+
+    /**
+     * @return false if the id was not present.
+     */
+    bool Remove(Id id)
+    {
+        size_t hole = Probe(id);
+        if (!mSlots[hole].used)
+        {
+            return false;
+        }
+
+        // Move back every entry of the probe sequence that would no longer be reachable
+        for (size_t next = (hole + 1) & kMask; mSlots[next].used; next = (next + 1) & kMask)
+        {
+            size_t home = Hash(mSlots[next].id);
+            if (((next - home) & kMask) >= ((next - hole) & kMask))
+            {
+                mSlots[hole] = mSlots[next];
+                hole         = next;
+            }
+        }
+        mSlots[hole].used = false;
+        mSize--;
+        return true;
+    }
+
+private:
+    static constexpr size_t kMask = kTableSize - 1;
+
+    struct Slot
+    {
+        Id id;
+        Value value;
+        bool used;
+    };
+
+    static size_t Hash(Id id)
+    {
+        // Fibonacci hashing: keeps consecutive ids (the common case) well spread over the table.
+        return static_cast<size_t>((static_cast<uint64_t>(id) * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - kTableBits));
+    }
+
+    // Returns the slot holding the id, or the empty slot that ends its probe sequence.
+    size_t Probe(Id id) const
+    {
+        size_t index = Hash(id);
+        while (mSlots[index].used && mSlots[index].id != id)
+        {
+            index = (index + 1) & kMask;
+        }
+        return index;
+    }
+
+    Slot mSlots[kTableSize];
+    size_t mSize = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Fixed-capacity, lock-free queue with many producers and a single consumer.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * @brief
+ *   Passes values from any number of threads to a single consuming thread, without locks and without any
+ *   dynamic allocation.
+ *
+ *   Each of the kCapacity cells carries a sequence number telling whether it is free for the producer claiming
+ *   that position, or holds a value published for the consumer. Producers claim positions with a compare and
+ *   swap, so a producer never waits for another one, and a full queue is reported rather than waited on.
+ *
+ *   Push() may be called from any thread. Pop() must only ever be called from one thread at a time.
+ */
+template <typename T, size_t kCapacity>
+class MpscQueue
+{
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "MpscQueue capacity must be a power of two");
+
+public:
+    MpscQueue()
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mCells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue & operator=(const MpscQueue &) = delete;
+
+    static constexpr size_t Capacity() { return kCapacity; }
+
+    /**
+     * Appends a value to the queue. Thread-safe.
+     *
+     * @return false if the queue is full.
+     */
+    bool Push(const T & value)
+    {
+        size_t position = mPushPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell & cell     = mCells[position & kMask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto lag        = static_cast<intptr_t>(sequence - position);
+
+            if (lag == 0)
+            {
+                // The cell is free: claim the position, or retry from wherever another producer moved it to.
+                if (mPushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    cell.value = value;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (lag < 0)
+            {
+                // The consumer has not popped the value pushed kCapacity positions ago yet.
+                return false;
+            }
+            else
+            {
+                position = mPushPosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Removes the oldest value of the queue. Must only be called from the consuming thread.
+     *
+     * @return false if the queue is empty, or the producer of the oldest value has not finished pushing it.
+     */
+    bool Pop(T & value)
+    {
+        Cell & cell = mCells[mPopPosition & kMask];
+        if (cell.sequence.load(std::memory_order_acquire) != mPopPosition + 1)
+        {
+            return false;
+        }
+
+        value = cell.value;
+        cell.sequence.store(mPopPosition + kCapacity, std::memory_order_release);
+        mPopPosition++;
+        return true;
+    }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+    // Keeps the positions producers and the consumer update out of each other's cache lines.
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    alignas(kCacheLineSize) std::atomic<size_t> mPushPosition{ 0 };
+    alignas(kCacheLineSize) size_t mPopPosition = 0;
+    alignas(kCacheLineSize) Cell mCells[kCapacity];
+};
+
+} // namespace chip
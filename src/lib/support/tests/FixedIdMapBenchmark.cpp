@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares FixedIdMap lookups with the linear scan over an endpoint array that the ember attribute storage used to
+ *      do in findIndexFromEndpoint, for 10, 100 and 1000 endpoints.
+ */
+
+#include <lib/support/FixedIdMap.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+
+using namespace chip;
+
+struct ScanEndpoint
+{
+    uint16_t endpoint;
+    uint16_t attributeOffset;
+    uint8_t bitmask;
+};
+
+constexpr size_t kMaxEndpoints = 1000;
+constexpr uint32_t kIterations = 200000;
+
+ScanEndpoint sScanEndpoints[kMaxEndpoints];
+FixedIdMap<uint16_t, uint16_t, kMaxEndpoints> sEndpointIndex;
+
+uint16_t ScanLookup(uint16_t endpointCount, uint16_t endpoint)
+{
+    for (uint16_t i = 0; i < endpointCount; i++)
+    {
+        if (sScanEndpoints[i].endpoint == endpoint)
+        {
+            return i;
+        }
+    }
+    return 0xFFFF;
+}
+
+uint16_t IndexLookup(uint16_t endpoint)
+{
+    const uint16_t * index = sEndpointIndex.Get(endpoint);
+    return (index == nullptr) ? 0xFFFF : *index;
+}
+
+template <typename Lookup>
+uint64_t TimeLookups(uint16_t endpointCount, uint32_t & checksum, Lookup lookup)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        // Wildcard reads and reports walk every endpoint, so query all of them uniformly.
+        checksum += lookup(sScanEndpoints[i % endpointCount].endpoint);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+} // namespace
+
+int main()
+{
+    const uint16_t endpointCounts[] = { 10, 100, 1000 };
+
+    for (uint16_t endpointCount : endpointCounts)
+    {
+        sEndpointIndex.Clear();
+        for (uint16_t i = 0; i < endpointCount; i++)
+        {
+            // Bridges typically number their dynamic endpoints sparsely after the fixed ones.
+            sScanEndpoints[i] = { static_cast<uint16_t>(i < 2 ? i : 2 + (i - 2) * 3), i, 0 };
+            sEndpointIndex.Put(sScanEndpoints[i].endpoint, i);
+        }
+
+        auto scanLookup = [endpointCount](uint16_t endpoint) { return ScanLookup(endpointCount, endpoint); };
+
+        uint32_t scanChecksum  = 0;
+        uint32_t indexChecksum = 0;
+        uint64_t scanNs        = TimeLookups(endpointCount, scanChecksum, scanLookup);
+        uint64_t indexNs       = TimeLookups(endpointCount, indexChecksum, IndexLookup);
+
+        if (scanChecksum != indexChecksum)
+        {
+            fprintf(stderr, "FixedIdMap lookups disagree with the linear scan for %u endpoints\n", endpointCount);
+            return EXIT_FAILURE;
+        }
+        printf("%4u endpoints: linear scan %6.1f ns/lookup, indexed %6.1f ns/lookup\n", endpointCount,
+               static_cast<double>(scanNs) / kIterations, static_cast<double>(indexNs) / kIterations);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/FixedIdMap.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+
+void TestBasic(nlTestSuite * inSuite, void * inContext)
+{
+    FixedIdMap<uint16_t, uint16_t, 4> map;
+
+    NL_TEST_ASSERT(inSuite, map.Size() == 0);
+    NL_TEST_ASSERT(inSuite, map.Get(1) == nullptr);
+
+    NL_TEST_ASSERT(inSuite, map.Put(1, 10));
+    NL_TEST_ASSERT(inSuite, map.Put(2, 20));
+    NL_TEST_ASSERT(inSuite, map.Put(0xFFFF, 30));
+    NL_TEST_ASSERT(inSuite, map.Put(0, 40));
+    NL_TEST_ASSERT(inSuite, map.Size() == 4);
+
+    // Full: new ids are rejected, existing ones can still be updated
+    NL_TEST_ASSERT(inSuite, !map.Put(3, 50));
+    NL_TEST_ASSERT(inSuite, map.Put(2, 21));
+    NL_TEST_ASSERT(inSuite, map.Size() == 4);
+
+    NL_TEST_ASSERT(inSuite, map.Get(1) != nullptr && *map.Get(1) == 10);
+    NL_TEST_ASSERT(inSuite, map.Get(2) != nullptr && *map.Get(2) == 21);
+    NL_TEST_ASSERT(inSuite, map.Get(0xFFFF) != nullptr && *map.Get(0xFFFF) == 30);
+    NL_TEST_ASSERT(inSuite, map.Get(0) != nullptr && *map.Get(0) == 40);
+    NL_TEST_ASSERT(inSuite, !map.Contains(3));
+
+    NL_TEST_ASSERT(inSuite, map.Remove(1));
+    NL_TEST_ASSERT(inSuite, !map.Remove(1));
+    NL_TEST_ASSERT(inSuite, !map.Contains(1));
+    NL_TEST_ASSERT(inSuite, map.Size() == 3);
+    NL_TEST_ASSERT(inSuite, map.Put(3, 50));
+    NL_TEST_ASSERT(inSuite, *map.Get(3) == 50);
+
+    map.Clear();
+    NL_TEST_ASSERT(inSuite, map.Size() == 0);
+    NL_TEST_ASSERT(inSuite, !map.Contains(2));
+    NL_TEST_ASSERT(inSuite, !map.Contains(3));
+}
+
+// Small deterministic generator, so that a failure can be reproduced.
+uint32_t NextRandom(uint32_t & state)
+{
+    state = state * 1103515245u + 12345u;
+    return state >> 8;
+}
+
+void TestRandom(nlTestSuite * inSuite, void * inContext)
+{
+    // Small id range relative to the capacity so that collisions and removals within a probe
+    // sequence happen frequently.
+    constexpr size_t kCapacity = 32;
+    constexpr size_t kIdRange  = 128;
+    FixedIdMap<uint16_t, uint32_t, kCapacity> map;
+
+    // Reference contents, indexed by id.
+    bool present[kIdRange]    = {};
+    uint32_t values[kIdRange] = {};
+    size_t size               = 0;
+    uint32_t state            = 1;
+
+    for (int i = 0; i < 2000; i++)
+    {
+        uint16_t id    = static_cast<uint16_t>(NextRandom(state) % kIdRange);
+        uint32_t value = NextRandom(state);
+
+        if (NextRandom(state) % 3 == 0)
+        {
+            NL_TEST_ASSERT(inSuite, map.Remove(id) == present[id]);
+            if (present[id])
+            {
+                present[id] = false;
+                size--;
+            }
+        }
+        else
+        {
+            bool expected = size < kCapacity || present[id];
+            NL_TEST_ASSERT(inSuite, map.Put(id, value) == expected);
+            if (expected && !present[id])
+            {
+                present[id] = true;
+                size++;
+            }
+            if (expected)
+            {
+                values[id] = value;
+            }
+        }
+
+        NL_TEST_ASSERT(inSuite, map.Size() == size);
+    }
+
+    for (uint16_t id = 0; id < kIdRange; id++)
+    {
+        const uint32_t * value = map.Get(id);
+        if (!present[id])
+        {
+            NL_TEST_ASSERT(inSuite, value == nullptr);
+        }
+        else
+        {
+            NL_TEST_ASSERT(inSuite, value != nullptr && *value == values[id]);
+        }
+    }
+}
+
+int Setup(void * inContext)
+{
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    return SUCCESS;
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF_FN(TestBasic),  //
+    NL_TEST_DEF_FN(TestRandom), //
+    NL_TEST_SENTINEL(),         //
+};
+
+int TestFixedIdMap()
+{
+    nlTestSuite theSuite = { "CHIP FixedIdMap tests", &sTests[0], Setup, Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestFixedIdMap);
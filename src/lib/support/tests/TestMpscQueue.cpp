@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <lib/support/MpscQueue.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+
+void TestBasic(nlTestSuite * inSuite, void * inContext)
+{
+    MpscQueue<uint32_t, 4> queue;
+    uint32_t value = 0;
+
+    NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+
+    // Go around the cells a few times, filling the queue up each time.
+    for (uint32_t round = 0; round < 3; round++)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Push(round * 10 + i));
+        }
+        NL_TEST_ASSERT(inSuite, !queue.Push(99));
+
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Pop(value));
+            NL_TEST_ASSERT(inSuite, value == round * 10 + i);
+        }
+        NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+    }
+
+    // Interleaved pushes and pops.
+    NL_TEST_ASSERT(inSuite, queue.Push(1));
+    NL_TEST_ASSERT(inSuite, queue.Push(2));
+    NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == 1);
+    NL_TEST_ASSERT(inSuite, queue.Push(3));
+    NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == 2);
+    NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == 3);
+    NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+}
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+// Several producers race a consumer: every value arrives exactly once, in the order its producer pushed it.
+void TestProducers(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kProducers         = 4;
+    constexpr uint32_t kValuesPerProducer = 100000;
+
+    static MpscQueue<uint32_t, 256> queue;
+    std::atomic<uint32_t> producersDone{ 0 };
+    std::atomic<uint64_t> fullCount{ 0 };
+    std::vector<std::thread> producers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t producer = 0; producer < kProducers; producer++)
+    {
+        producers.emplace_back([&, producer]() {
+            for (uint32_t i = 0; i < kValuesPerProducer; i++)
+            {
+                while (!queue.Push((producer << 24) | i))
+                {
+                    fullCount++;
+                    std::this_thread::yield();
+                }
+            }
+            producersDone++;
+        });
+    }
+
+    uint32_t nextValue[kProducers] = {};
+    uint32_t received              = 0;
+    bool inOrder                   = true;
+    uint32_t value;
+    while (true)
+    {
+        // Once all the producers are done, one last pass gets whatever they pushed.
+        bool done   = producersDone.load() == kProducers;
+        bool popped = false;
+        while (queue.Pop(value))
+        {
+            popped = true;
+            // The producer index is in the top byte.
+            uint32_t producer = value >> 24;
+            inOrder           = inOrder && producer < kProducers && (value & 0xFFFFFF) == nextValue[producer];
+            if (producer < kProducers)
+            {
+                nextValue[producer]++;
+            }
+            received++;
+        }
+        if (done)
+        {
+            break;
+        }
+        if (!popped)
+        {
+            // Let the producers run on single core machines.
+            std::this_thread::yield();
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    NL_TEST_ASSERT(inSuite, inOrder);
+    NL_TEST_ASSERT(inSuite, received == kProducers * kValuesPerProducer);
+
+    auto elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    printf("%" PRIu32 " producers: %.1f ns per value, queue full %" PRIu64 " times\n", kProducers,
+           static_cast<double>(elapsedNs) / (kProducers * kValuesPerProducer), fullCount.load());
+}
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+int Setup(void * inContext)
+{
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    return SUCCESS;
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    NL_TEST_DEF_FN(TestBasic), //
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    NL_TEST_DEF_FN(TestProducers), //
+#endif
+    NL_TEST_SENTINEL(), //
+};
+
+int TestMpscQueue()
+{
+    nlTestSuite theSuite = { "CHIP MpscQueue tests", &sTests[0], Setup, Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMpscQueue);
@@ -130,6 +130,13 @@ public:
      */
     void WillSendMessage() { mFlags.Set(Flags::kFlagWillSendMessage); }
 
+    /**
+     * Determine whether we are expecting our consumer to send a message on
+     * this exchange (i.e. WillSendMessage was called and the message has not
+     * yet been sent).
+     */
+    bool IsSendExpected() const { return mFlags.Has(Flags::kFlagWillSendMessage); }
+
     /**
      *  Handle a received CHIP message on this exchange.
      *
@@ -189,13 +196,6 @@ private:
      */
     bool IsResponseExpected() const;
 
-    /**
-     * Determine whether we are expecting our consumer to send a message on
-     * this exchange (i.e. WillSendMessage was called and the message has not
-     * yet been sent).
-     */
-    bool IsSendExpected() const { return mFlags.Has(Flags::kFlagWillSendMessage); }
-
     /**
      *  Track whether we are now expecting a response to a message sent via this exchange (because that
      *  message had the kExpectResponse flag set in its sendFlags).
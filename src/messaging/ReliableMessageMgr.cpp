@@ -40,14 +40,15 @@ using namespace chip::System::Clock::Literals;
 namespace chip {
 namespace Messaging {
 
-ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) : ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
 {
     ec->SetMessageNotAcked(true);
+    rc->mRetransEntry = this;
 }
 
-ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
+RetransTableEntry::~RetransTableEntry()
 {
+    ec->GetReliableMessageContext()->mRetransEntry = nullptr;
     ec->SetMessageNotAcked(false);
 }
 
@@ -67,6 +68,7 @@ void ReliableMessageMgr::Shutdown()
     StopTimer();
 
     // Clear the retransmit table
+    mRetransHeap = nullptr;
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
@@ -113,10 +115,12 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired, earliest first. Each
+    // entry is rescheduled before being sent, so bound the loop in case the backoff did not move it past now.
+    for (size_t remaining = mRetransTable.Allocated();
+         remaining > 0 && mRetransHeap != nullptr && mRetransHeap->nextRetransTime <= now; remaining--)
+    {
+        RetransTableEntry * entry = mRetransHeap;
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -133,8 +137,8 @@ void ReliableMessageMgr::ExecuteActions()
                          messageCounter, ChipLogValueExchange(&entry->ec.Get()), sendCount, CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS);
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
-            return Loop::Continue;
+            ReleaseRetransTableEntry(entry);
+            continue;
         }
 
         ChipLogDetail(ExchangeManager,
@@ -145,11 +149,11 @@ void ReliableMessageMgr::ExecuteActions()
         // Choose active/idle timeout from PeerActiveMode of session per 4.11.2.1. Retransmissions.
         System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
         System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
-        entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+        RemoveFromRetransHeap(entry);
+        entry->nextRetransTime = System::SystemClock().GetMonotonicTimestamp() + backoff;
+        InsertIntoRetransHeap(entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -175,7 +179,12 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
 {
     VerifyOrDie(!rc->IsMessageNotAcked());
 
-    *rEntry = mRetransTable.CreateObject(rc);
+    // A heap-allocated pool does not enforce its size: keep the table within CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE either way.
+    *rEntry = nullptr;
+    if (mRetransTable.Allocated() < static_cast<size_t>(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE))
+    {
+        *rEntry = mRetransTable.CreateObject(rc);
+    }
     if (*rEntry == nullptr)
     {
         ChipLogError(ExchangeManager, "mRetransTable Already Full");
@@ -227,29 +236,26 @@ void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
     System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
     System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
     entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    InsertIntoRetransHeap(entry);
     StartTimer();
 }
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    RetransTableEntry * entry = rc->mRetransEntry;
+    if (entry == nullptr || entry->retainedBuf.GetMessageCounter() != ackMessageCounter)
+    {
+        return false;
+    }
 
-    return removed;
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
+
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -302,23 +308,129 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mRetransEntry != nullptr)
+    {
+        ClearRetransTable(*rc->mRetransEntry);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransTableEntry(&entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+void ReliableMessageMgr::ReleaseRetransTableEntry(RetransTableEntry * entry)
+{
+    if (IsInRetransHeap(entry))
+    {
+        RemoveFromRetransHeap(entry);
+    }
+    mRetransTable.ReleaseObject(entry);
+}
+
+RetransTableEntry * ReliableMessageMgr::MeldRetransHeaps(RetransTableEntry * a, RetransTableEntry * b)
+{
+    if (a == nullptr)
+    {
+        return b;
+    }
+    if (b == nullptr)
+    {
+        return a;
+    }
+    if (b->nextRetransTime < a->nextRetransTime)
+    {
+        RetransTableEntry * tmp = a;
+        a                       = b;
+        b                       = tmp;
+    }
+    b->heapPrev    = a;
+    b->heapSibling = a->heapChild;
+    if (a->heapChild != nullptr)
+    {
+        a->heapChild->heapPrev = b;
+    }
+    a->heapChild = b;
+    return a;
+}
+
+// Standard two-pass pairing of a list of siblings into a single heap, returning its root.
+RetransTableEntry * ReliableMessageMgr::MergeRetransHeapPairs(RetransTableEntry * first)
+{
+    RetransTableEntry * pairs = nullptr;
+    while (first != nullptr)
+    {
+        RetransTableEntry * a = first;
+        RetransTableEntry * b = a->heapSibling;
+        first                 = (b != nullptr) ? b->heapSibling : nullptr;
+
+        a->heapSibling = nullptr;
+        a->heapPrev    = nullptr;
+        if (b != nullptr)
+        {
+            b->heapSibling = nullptr;
+            b->heapPrev    = nullptr;
+            a              = MeldRetransHeaps(a, b);
+        }
+        a->heapSibling = pairs;
+        pairs          = a;
+    }
+
+    RetransTableEntry * root = nullptr;
+    while (pairs != nullptr)
+    {
+        RetransTableEntry * next = pairs->heapSibling;
+        pairs->heapSibling       = nullptr;
+        root                     = MeldRetransHeaps(root, pairs);
+        pairs                    = next;
+    }
+    return root;
+}
+
+bool ReliableMessageMgr::IsInRetransHeap(const RetransTableEntry * entry) const
+{
+    // An entry that is in the heap is either its root or has a parent or previous sibling.
+    return entry == mRetransHeap || entry->heapPrev != nullptr;
+}
+
+void ReliableMessageMgr::InsertIntoRetransHeap(RetransTableEntry * entry)
+{
+    VerifyOrDie(!IsInRetransHeap(entry));
+    entry->heapChild   = nullptr;
+    entry->heapSibling = nullptr;
+    mRetransHeap       = MeldRetransHeaps(mRetransHeap, entry);
+}
+
+void ReliableMessageMgr::RemoveFromRetransHeap(RetransTableEntry * entry)
+{
+    if (entry == mRetransHeap)
+    {
+        mRetransHeap = MergeRetransHeapPairs(entry->heapChild);
+    }
+    else
+    {
+        if (entry->heapPrev->heapChild == entry)
+        {
+            entry->heapPrev->heapChild = entry->heapSibling;
+        }
+        else
+        {
+            entry->heapPrev->heapSibling = entry->heapSibling;
+        }
+        if (entry->heapSibling != nullptr)
+        {
+            entry->heapSibling->heapPrev = entry->heapPrev;
+        }
+        mRetransHeap = MeldRetransHeaps(mRetransHeap, MergeRetransHeapPairs(entry->heapChild));
+    }
+
+    entry->heapChild   = nullptr;
+    entry->heapSibling = nullptr;
+    entry->heapPrev    = nullptr;
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -332,13 +444,10 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    if (mRetransHeap != nullptr && mRetransHeap->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransHeap->nextRetransTime;
+    }
 
     if (nextWakeTime != System::Clock::Timestamp::max())
     {
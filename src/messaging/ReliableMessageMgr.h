@@ -43,31 +43,44 @@ using ExchangeHandle = ReferenceCountedHandle<ExchangeContext>;
 
 enum class SendMessageFlags : uint16_t;
 class ReliableMessageContext;
+class ReliableMessageMgr;
+
+/**
+ *  @class RetransTableEntry
+ *
+ *  @brief
+ *    This class is part of the CHIP Reliable Messaging Protocol and is used
+ *    to keep track of CHIP messages that have been sent and are expecting an
+ *    acknowledgment back. If the acknowledgment is not received within a
+ *    specific timeout, the message would be retransmitted from this table.
+ *
+ *    An exchange has at most one entry, which it points to while the entry exists.
+ *    Scheduled entries are kept in a pairing heap ordered by next retransmission time.
+ *
+ */
+struct RetransTableEntry
+{
+    RetransTableEntry(ReliableMessageContext * rc);
+    ~RetransTableEntry();
+
+    ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
+    EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
+    System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+    uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
+                                                   including both successfully and failure send. */
+
+private:
+    friend class ReliableMessageMgr;
+
+    RetransTableEntry * heapChild   = nullptr; /**< Leftmost child in the retransmission heap. */
+    RetransTableEntry * heapSibling = nullptr; /**< Next sibling in the retransmission heap. */
+    RetransTableEntry * heapPrev    = nullptr; /**< Parent if this is the leftmost child, else the previous sibling. */
+};
 
 class ReliableMessageMgr
 {
 public:
-    /**
-     *  @class RetransTableEntry
-     *
-     *  @brief
-     *    This class is part of the CHIP Reliable Messaging Protocol and is used
-     *    to keep track of CHIP messages that have been sent and are expecting an
-     *    acknowledgment back. If the acknowledgment is not received within a
-     *    specific timeout, the message would be retransmitted from this table.
-     *
-     */
-    struct RetransTableEntry
-    {
-        RetransTableEntry(ReliableMessageContext * rc);
-        ~RetransTableEntry();
-
-        ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
-        System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
-                                                       including both successfully and failure send. */
-    };
+    using RetransTableEntry = Messaging::RetransTableEntry;
 
     ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
     ~ReliableMessageMgr();
@@ -124,8 +137,8 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry of the specified ExchangeContext from the retransmision table, if it holds
+     *  the message ID.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -160,7 +173,7 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
+     * Iterate through active exchange contexts and look up the earliest retrans table entry.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
      * need to physically wake the CPU to perform an action.  Set a timer to go off
      * when we next need to wake the system.
@@ -195,8 +208,20 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
-    // ReliableMessageProtocol Global tables for timer context
-    BitMapObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    // Pairing heap of the scheduled entries of mRetransTable, by next retransmission time.
+    static RetransTableEntry * MeldRetransHeaps(RetransTableEntry * a, RetransTableEntry * b);
+    static RetransTableEntry * MergeRetransHeapPairs(RetransTableEntry * first);
+    bool IsInRetransHeap(const RetransTableEntry * entry) const;
+    void InsertIntoRetransHeap(RetransTableEntry * entry);
+    void RemoveFromRetransHeap(RetransTableEntry * entry);
+
+    // Releases an entry, whether scheduled or not.
+    void ReleaseRetransTableEntry(RetransTableEntry * entry);
+
+    // ReliableMessageProtocol Global tables for timer context. Allocated from the heap on large systems, but never holds more
+    // than CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE entries.
+    ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    RetransTableEntry * mRetransHeap = nullptr; // Entry with the earliest next retransmission time
 };
 
 } // namespace Messaging
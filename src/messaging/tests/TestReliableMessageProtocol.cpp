@@ -199,6 +199,50 @@ void CheckAddClearRetrans(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckClearRetransByExchange(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr size_t kExchangeCount = 4;
+    MockAppDelegate mockAppDelegate;
+    ExchangeContext * exchanges[kExchangeCount];
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    // Schedule one entry per exchange, so that the retransmission heap holds several of them.
+    for (auto & exchange : exchanges)
+    {
+        exchange = ctx.NewExchangeToAlice(&mockAppDelegate);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+        ReliableMessageMgr::RetransTableEntry * entry;
+        NL_TEST_ASSERT(inSuite, rm->AddToRetransTable(exchange->GetReliableMessageContext(), &entry) == CHIP_NO_ERROR);
+        rm->StartRetransmision(entry);
+    }
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == static_cast<int>(kExchangeCount));
+
+    // Clearing an exchange only removes its own entry, wherever it sits in the heap.
+    const size_t order[kExchangeCount] = { 2, 0, 3, 1 };
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        ReliableMessageContext * rc = exchanges[order[i]]->GetReliableMessageContext();
+        NL_TEST_ASSERT(inSuite, rc->IsMessageNotAcked());
+        rm->ClearRetransTable(rc);
+        NL_TEST_ASSERT(inSuite, !rc->IsMessageNotAcked());
+        NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == static_cast<int>(kExchangeCount - i - 1));
+
+        // Clearing again is a no-op.
+        rm->ClearRetransTable(rc);
+        NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == static_cast<int>(kExchangeCount - i - 1));
+    }
+
+    for (auto & exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
 void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -1561,6 +1605,7 @@ int InitializeTestCase(void * inContext)
 const nlTest sTests[] =
 {
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckClearRetransByExchange", CheckClearRetransByExchange),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage", CheckResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckCloseExchangeAndResendApplicationMessage", CheckCloseExchangeAndResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailedMessageRetainOnSend", CheckFailedMessageRetainOnSend),
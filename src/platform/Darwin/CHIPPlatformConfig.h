@@ -50,10 +50,23 @@
 #define CHIP_LOG_FILTERING 1
 #endif // CHIP_LOG_FILTERING
 
+// Every group-key mapping of every fabric, with each of the 3 epoch keys of its key set
+#ifndef CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE (CHIP_CONFIG_MAX_FABRICS * CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC * 3)
+#endif // CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE
+
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS 4096
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
+
+#ifndef CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+#define CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE 1
+#endif // CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+
 // TODO - Fine tune MRP default parameters for Darwin platform
 #define CHIP_CONFIG_MRP_DEFAULT_INITIAL_RETRY_INTERVAL (15000)
 #define CHIP_CONFIG_MRP_DEFAULT_ACTIVE_RETRY_INTERVAL (2000_ms32)
@@ -0,0 +1,1068 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Implements asynchronous log output for Linux platforms: per-thread
+ *          rings of captured log calls, and the background thread writing them.
+ */
+
+#include <platform/Linux/AsyncLogging.h>
+
+#include <lib/support/CHIPMemString.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <pthread.h>
+#include <stddef.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <thread>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+void OnLogOutput();
+} // namespace DeviceLayer
+
+namespace Logging {
+namespace Platform {
+
+namespace {
+
+constexpr size_t kRingSize = CHIP_DEVICE_CONFIG_LINUX_ASYNC_LOG_BUFFER_SIZE;
+static_assert(kRingSize >= 1024 && (kRingSize & (kRingSize - 1)) == 0,
+              "CHIP_DEVICE_CONFIG_LINUX_ASYNC_LOG_BUFFER_SIZE must be a power of two, of at least 1024");
+
+// Largest record a log call may capture; messages with more argument data are written synchronously.
+constexpr size_t kMaxRecordSize = 512;
+// Conversion specifications longer than this, e.g. with absurd widths, are not captured.
+constexpr size_t kMaxConversionLength = 32;
+// How long the background thread sleeps when there is nothing to write.
+constexpr auto kFlushInterval = std::chrono::milliseconds(10);
+// How many lines the background thread writes before flushing stdout, when logs keep coming.
+constexpr size_t kMaxLinesPerFlush = 256;
+
+constexpr size_t AlignRecordSize(size_t size)
+{
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
+// ===== Conversion specifications =====
+
+enum class LengthModifier : uint8_t
+{
+    kNone,
+    kChar,
+    kShort,
+    kLong,
+    kLongLong,
+    kIntMax,
+    kSize,
+    kPtrDiff,
+    kLongDouble,
+};
+
+struct Conversion
+{
+    const char * start; // The '%'.
+    const char * end;   // One past the conversion specifier.
+    uint8_t starCount;  // Width and precision read from int arguments.
+    bool starPrecision;
+    int precision; // -1 if none.
+    LengthModifier length;
+    char specifier;
+};
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Parses the conversion specification starting at the '%' at p.
+ *
+ * @return false if the specification is malformed, or uses a length modifier or specifier that is not supported.
+ */
+bool ParseConversion(const char * p, Conversion & conversion)
+{
+    conversion.start         = p++;
+    conversion.starCount     = 0;
+    conversion.starPrecision = false;
+    conversion.precision     = -1;
+    conversion.length        = LengthModifier::kNone;
+
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0' || *p == '\'')
+    {
+        p++;
+    }
+
+    if (*p == '*')
+    {
+        conversion.starCount++;
+        p++;
+    }
+    while (IsDigit(*p))
+    {
+        p++;
+    }
+
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            conversion.starCount++;
+            conversion.starPrecision = true;
+            p++;
+        }
+        else
+        {
+            conversion.precision = 0;
+            while (IsDigit(*p) && conversion.precision < 0xFFFF)
+            {
+                conversion.precision = conversion.precision * 10 + (*p++ - '0');
+            }
+        }
+    }
+
+    switch (*p)
+    {
+    case 'h':
+        p++;
+        conversion.length = (*p == 'h') ? LengthModifier::kChar : LengthModifier::kShort;
+        p += (*p == 'h') ? 1 : 0;
+        break;
+    case 'l':
+        p++;
+        conversion.length = (*p == 'l') ? LengthModifier::kLongLong : LengthModifier::kLong;
+        p += (*p == 'l') ? 1 : 0;
+        break;
+    case 'j':
+        conversion.length = LengthModifier::kIntMax;
+        p++;
+        break;
+    case 'z':
+        conversion.length = LengthModifier::kSize;
+        p++;
+        break;
+    case 't':
+        conversion.length = LengthModifier::kPtrDiff;
+        p++;
+        break;
+    case 'L':
+        conversion.length = LengthModifier::kLongDouble;
+        p++;
+        break;
+    default:
+        break;
+    }
+
+    conversion.specifier = *p;
+    if (*p == '\0')
+    {
+        return false;
+    }
+    conversion.end = p + 1;
+
+    if (static_cast<size_t>(conversion.end - conversion.start) >= kMaxConversionLength)
+    {
+        return false;
+    }
+
+    switch (conversion.specifier)
+    {
+    case 'd':
+    case 'i':
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        return conversion.length != LengthModifier::kLongDouble;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        return conversion.length == LengthModifier::kNone || conversion.length == LengthModifier::kLong ||
+            conversion.length == LengthModifier::kLongDouble;
+    case 'c':
+    case 's':
+    case 'p':
+        return conversion.length == LengthModifier::kNone;
+    case '%':
+        return conversion.starCount == 0 && conversion.end == conversion.start + 2;
+    default:
+        // %n, %m and wide characters are not supported.
+        return false;
+    }
+}
+
+bool IsFloatingPoint(char specifier)
+{
+    return strchr("eEfFgGaA", specifier) != nullptr;
+}
+
+bool IsSigned(char specifier)
+{
+    return specifier == 'd' || specifier == 'i';
+}
+
+// ===== Records =====
+
+struct RecordHeader
+{
+    uint32_t size; // Of the whole record, arguments and alignment padding included.
+    uint8_t category;
+    char module[chip::Logging::kMaxModuleNameLen + 1];
+    uint64_t timestampUs;
+    const char * format;
+};
+
+// Category of the records that only pad the ring up to its end, when a record does not fit there.
+constexpr uint8_t kPaddingCategory = 0xFF;
+
+class RecordWriter
+{
+public:
+    RecordWriter(uint8_t * buffer, size_t size) : mBuffer(buffer), mSize(size), mLength(AlignRecordSize(sizeof(RecordHeader))) {}
+
+    template <typename T>
+    void Put(T value)
+    {
+        if (Reserve(sizeof(value)))
+        {
+            memcpy(mBuffer + mLength, &value, sizeof(value));
+            mLength += AlignRecordSize(sizeof(value));
+        }
+    }
+
+    void PutString(const char * string, size_t length)
+    {
+        uint32_t length32 = static_cast<uint32_t>(length);
+        Put(length32);
+        if (Reserve(length + 1))
+        {
+            memcpy(mBuffer + mLength, string, length);
+            mBuffer[mLength + length] = '\0';
+            mLength += AlignRecordSize(length + 1);
+        }
+    }
+
+    bool IsValid() const { return mValid; }
+    size_t Length() const { return mLength; }
+
+private:
+    bool Reserve(size_t size)
+    {
+        mValid = mValid && size <= mSize - mLength;
+        return mValid;
+    }
+
+    uint8_t * mBuffer;
+    size_t mSize;
+    size_t mLength;
+    bool mValid = true;
+};
+
+class RecordReader
+{
+public:
+    explicit RecordReader(const uint8_t * record) : mCursor(record + AlignRecordSize(sizeof(RecordHeader))) {}
+
+    template <typename T>
+    T Get()
+    {
+        T value;
+        memcpy(&value, mCursor, sizeof(value));
+        mCursor += AlignRecordSize(sizeof(value));
+        return value;
+    }
+
+    const char * GetString()
+    {
+        uint32_t length      = Get<uint32_t>();
+        const char * string = reinterpret_cast<const char *>(mCursor);
+        mCursor += AlignRecordSize(length + 1);
+        return string;
+    }
+
+private:
+    const uint8_t * mCursor;
+};
+
+/**
+ * Copies the arguments of format into record, in the order they are passed.
+ *
+ * Integers are widened to 64 bits, and strings are copied, honoring their precision.
+ *
+ * @return false if format has a conversion that cannot be captured, or the arguments do not fit in record.
+ */
+bool CaptureArguments(const char * format, va_list args, RecordWriter & record)
+{
+    for (const char * p = strchr(format, '%'); p != nullptr; p = strchr(p, '%'))
+    {
+        Conversion conversion;
+        if (!ParseConversion(p, conversion))
+        {
+            return false;
+        }
+        p = conversion.end;
+
+        for (uint8_t i = 0; i < conversion.starCount; i++)
+        {
+            int star = va_arg(args, int);
+            record.Put(static_cast<int64_t>(star));
+            if (conversion.starPrecision && i + 1 == conversion.starCount)
+            {
+                conversion.precision = star;
+            }
+        }
+
+        if (IsFloatingPoint(conversion.specifier))
+        {
+            if (conversion.length == LengthModifier::kLongDouble)
+            {
+                record.Put(va_arg(args, long double));
+            }
+            else
+            {
+                record.Put(va_arg(args, double));
+            }
+            continue;
+        }
+
+        switch (conversion.specifier)
+        {
+        case '%':
+            break;
+        case 'c':
+            record.Put(static_cast<int64_t>(va_arg(args, int)));
+            break;
+        case 'p':
+            record.Put(va_arg(args, void *));
+            break;
+        case 's': {
+            const char * string = va_arg(args, const char *);
+            if (string == nullptr)
+            {
+                string = "(null)";
+            }
+            size_t length = (conversion.precision >= 0) ? strnlen(string, static_cast<size_t>(conversion.precision)) : strlen(string);
+            record.PutString(string, length);
+            break;
+        }
+        default: {
+            // The integer conversions. Values are read with the type their length modifier gives, as printf would.
+            uint64_t value;
+            switch (conversion.length)
+            {
+            case LengthModifier::kLong:
+                value = static_cast<uint64_t>(va_arg(args, long));
+                break;
+            case LengthModifier::kLongLong:
+                value = static_cast<uint64_t>(va_arg(args, long long));
+                break;
+            case LengthModifier::kIntMax:
+                value = static_cast<uint64_t>(va_arg(args, intmax_t));
+                break;
+            case LengthModifier::kSize:
+                value = static_cast<uint64_t>(va_arg(args, size_t));
+                break;
+            case LengthModifier::kPtrDiff:
+                value = static_cast<uint64_t>(va_arg(args, ptrdiff_t));
+                break;
+            default:
+                // char and short are promoted to int.
+                value = IsSigned(conversion.specifier) ? static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int)))
+                                                       : static_cast<uint64_t>(va_arg(args, unsigned int));
+                break;
+            }
+            record.Put(value);
+            break;
+        }
+        }
+    }
+
+    return record.IsValid();
+}
+
+// ===== Line formatting =====
+
+class LineBuffer
+{
+public:
+    void Clear() { mLength = 0; }
+    const char * Data() const { return mData; }
+    size_t Length() const { return mLength; }
+
+    void Append(const char * data, size_t length)
+    {
+        length = std::min(length, kCapacity - mLength);
+        memcpy(mData + mLength, data, length);
+        mLength += length;
+    }
+
+    // The new line goes in the byte kept for the terminator, so that it survives truncation.
+    void EndLine() { mData[mLength++] = '\n'; }
+
+    void ENFORCE_FORMAT(2, 3) Printf(const char * format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(mData + mLength, kCapacity - mLength + 1, format, args);
+        va_end(args);
+        if (written > 0)
+        {
+            mLength += std::min(static_cast<size_t>(written), kCapacity - mLength);
+        }
+    }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    // conversion was checked by ParseConversion() when its arguments were captured.
+    template <typename T>
+    void Format(const char * conversion, const int * stars, uint8_t starCount, T value)
+    {
+        char * out   = mData + mLength;
+        size_t space = kCapacity - mLength + 1;
+        int written;
+        switch (starCount)
+        {
+        case 0:
+            written = snprintf(out, space, conversion, value);
+            break;
+        case 1:
+            written = snprintf(out, space, conversion, stars[0], value);
+            break;
+        default:
+            written = snprintf(out, space, conversion, stars[0], stars[1], value);
+            break;
+        }
+        if (written > 0)
+        {
+            mLength += std::min(static_cast<size_t>(written), kCapacity - mLength);
+        }
+    }
+#pragma GCC diagnostic pop
+
+private:
+    // Room for the line prefix and a message.
+    static constexpr size_t kCapacity = CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE + 64;
+
+    // One more byte for the terminator snprintf writes, or the new line.
+    char mData[kCapacity + 1];
+    size_t mLength = 0;
+};
+
+template <typename Signed, typename Unsigned>
+void FormatInteger(LineBuffer & line, const char * spec, const int * stars, const Conversion & conversion, uint64_t value)
+{
+    if (IsSigned(conversion.specifier))
+    {
+        line.Format(spec, stars, conversion.starCount, static_cast<Signed>(value));
+    }
+    else
+    {
+        line.Format(spec, stars, conversion.starCount, static_cast<Unsigned>(value));
+    }
+}
+
+/**
+ * Formats the message of a record whose arguments were captured by CaptureArguments().
+ */
+void FormatMessage(const char * format, RecordReader & record, LineBuffer & line)
+{
+    const char * p = format;
+    for (const char * percent = strchr(p, '%'); percent != nullptr; percent = strchr(p, '%'))
+    {
+        line.Append(p, static_cast<size_t>(percent - p));
+
+        Conversion conversion;
+        ParseConversion(percent, conversion);
+        p = conversion.end;
+
+        if (conversion.specifier == '%')
+        {
+            line.Append("%", 1);
+            continue;
+        }
+
+        char spec[kMaxConversionLength];
+        size_t specLength = static_cast<size_t>(conversion.end - conversion.start);
+        memcpy(spec, conversion.start, specLength);
+        spec[specLength] = '\0';
+
+        int stars[2] = {};
+        for (uint8_t i = 0; i < conversion.starCount; i++)
+        {
+            stars[i] = static_cast<int>(record.Get<int64_t>());
+        }
+
+        if (IsFloatingPoint(conversion.specifier))
+        {
+            if (conversion.length == LengthModifier::kLongDouble)
+            {
+                line.Format(spec, stars, conversion.starCount, record.Get<long double>());
+            }
+            else
+            {
+                line.Format(spec, stars, conversion.starCount, record.Get<double>());
+            }
+            continue;
+        }
+
+        switch (conversion.specifier)
+        {
+        case 'c':
+            line.Format(spec, stars, conversion.starCount, static_cast<int>(record.Get<int64_t>()));
+            break;
+        case 'p':
+            line.Format(spec, stars, conversion.starCount, record.Get<void *>());
+            break;
+        case 's':
+            line.Format(spec, stars, conversion.starCount, record.GetString());
+            break;
+        default: {
+            uint64_t value = record.Get<uint64_t>();
+            switch (conversion.length)
+            {
+            case LengthModifier::kLong:
+                FormatInteger<long, unsigned long>(line, spec, stars, conversion, value);
+                break;
+            case LengthModifier::kLongLong:
+                FormatInteger<long long, unsigned long long>(line, spec, stars, conversion, value);
+                break;
+            case LengthModifier::kIntMax:
+                FormatInteger<intmax_t, uintmax_t>(line, spec, stars, conversion, value);
+                break;
+            case LengthModifier::kSize:
+                FormatInteger<ssize_t, size_t>(line, spec, stars, conversion, value);
+                break;
+            case LengthModifier::kPtrDiff:
+                FormatInteger<ptrdiff_t, std::make_unsigned<ptrdiff_t>::type>(line, spec, stars, conversion, value);
+                break;
+            default:
+                FormatInteger<int, unsigned int>(line, spec, stars, conversion, value);
+                break;
+            }
+            break;
+        }
+        }
+    }
+    line.Append(p, strlen(p));
+}
+
+void AppendLinePrefix(LineBuffer & line, uint64_t timestampUs, long long pid, long long tid, const char * module)
+{
+    line.Printf("[%" PRIu64 ".%06" PRIu64 "][%lld:%lld] CHIP:%s: ", timestampUs / 1000000, timestampUs % 1000000, pid, tid, module);
+}
+
+uint64_t GetTimestampUs()
+{
+    struct timeval tv;
+
+    // Should not fail per man page of gettimeofday(), but failed to get time is not a fatal error in log. The bad time value will
+    // indicate the error occurred during getting time.
+    gettimeofday(&tv, nullptr);
+    return static_cast<uint64_t>(tv.tv_sec) * 1000000 + static_cast<uint64_t>(tv.tv_usec);
+}
+
+// ===== Per-thread rings =====
+
+/**
+ * Records logged by one thread, for the background thread to write. Only the owning thread pushes records, and only the
+ * thread holding the write mutex of the logger removes them, so the ring needs no lock of its own.
+ */
+class ThreadRing
+{
+public:
+    explicit ThreadRing(long long tid) : mTid(tid) {}
+
+    /**
+     * Appends a record. Must only be called by the owning thread.
+     *
+     * @return false, counting a dropped line, if the ring is full.
+     */
+    bool Push(const uint8_t * record, size_t size)
+    {
+        size_t head       = mHead.load(std::memory_order_relaxed);
+        size_t offset     = head & (kRingSize - 1);
+        size_t contiguous = kRingSize - offset;
+        // A record that does not fit before the end of the ring starts over at the beginning.
+        size_t needed = size + ((size > contiguous) ? contiguous : 0);
+
+        if (needed > kRingSize - (head - mTail.load(std::memory_order_acquire)))
+        {
+            mDropped.store(mDropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (size > contiguous)
+        {
+            RecordHeader padding = {};
+            padding.size         = static_cast<uint32_t>(contiguous);
+            padding.category     = kPaddingCategory;
+            memcpy(mData + offset, &padding, std::min(contiguous, sizeof(padding)));
+            offset = 0;
+        }
+        memcpy(mData + offset, record, size);
+        mHead.store(head + needed, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Whether more than half of the ring is in use, as seen from the owning thread.
+     */
+    bool IsFilling() const
+    {
+        return mHead.load(std::memory_order_relaxed) - mTail.load(std::memory_order_relaxed) > kRingSize / 2;
+    }
+
+    /**
+     * Returns the oldest record and its header, or nullptr if the ring is empty. Must only be called by the thread writing records.
+     */
+    const uint8_t * Front(RecordHeader & header)
+    {
+        while (true)
+        {
+            size_t tail = mTail.load(std::memory_order_relaxed);
+            if (tail == mHead.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+
+            const uint8_t * record = mData + (tail & (kRingSize - 1));
+            memcpy(&header, record, std::min(kRingSize - (tail & (kRingSize - 1)), sizeof(header)));
+            if (header.category != kPaddingCategory)
+            {
+                return record;
+            }
+            mTail.store(tail + header.size, std::memory_order_release);
+        }
+    }
+
+    /**
+     * Removes the record returned by Front(). Must only be called by the thread writing records.
+     */
+    void Pop(const RecordHeader & header)
+    {
+        mTail.store(mTail.load(std::memory_order_relaxed) + header.size, std::memory_order_release);
+    }
+
+    long long Tid() const { return mTid; }
+    uint64_t DroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+    // Set once the owning thread has exited; the thread writing records then deletes the ring once it is empty.
+    std::atomic<bool> mOwnerExited{ false };
+    // Drops already reported in the log, by the thread writing records.
+    uint64_t mReportedDrops = 0;
+
+private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    const long long mTid;
+    alignas(kCacheLineSize) std::atomic<size_t> mHead{ 0 };
+    std::atomic<uint64_t> mDropped{ 0 };
+    alignas(kCacheLineSize) std::atomic<size_t> mTail{ 0 };
+    alignas(kCacheLineSize) uint8_t mData[kRingSize];
+};
+
+// ===== Background thread =====
+
+class AsyncLogger
+{
+public:
+    static AsyncLogger & Instance()
+    {
+        static AsyncLogger sInstance;
+        return sInstance;
+    }
+
+    CHIP_ERROR Start()
+    {
+        std::lock_guard<std::mutex> lock(mStartMutex);
+        if (mRunning)
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        if (!mExitHandlerRegistered)
+        {
+            // Write the pending lines when the process exits without stopping the backend.
+            atexit([]() { StopAsyncLogging(); });
+            pthread_key_create(&mThreadExitKey, OnLoggingThreadExit);
+            mExitHandlerRegistered = true;
+        }
+
+        mPid      = static_cast<long long>(syscall(SYS_getpid));
+        mStopping = false;
+        int err   = pthread_create(&mThread, nullptr, WriterMain, this);
+        if (err != 0)
+        {
+            return CHIP_ERROR_POSIX(err);
+        }
+        mRunning = true;
+        sEnabled.store(true, std::memory_order_release);
+        return CHIP_NO_ERROR;
+    }
+
+    void Stop()
+    {
+        std::lock_guard<std::mutex> lock(mStartMutex);
+        if (!mRunning)
+        {
+            return;
+        }
+
+        sEnabled.store(false);
+        {
+            std::lock_guard<std::mutex> wakeLock(mWakeMutex);
+            mStopping = true;
+        }
+        mWakeCondition.notify_one();
+        pthread_join(mThread, nullptr);
+        mRunning = false;
+
+        // A log call that found logging enabled before it was disabled may push its record after the last pass of the background
+        // thread: wait for such calls to return, and write what they pushed.
+        while (mActiveLogCalls.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+        WritePendingRecords();
+    }
+
+    /**
+     * Whether log calls may be captured. A relaxed load that does not touch the instance, so that log calls cost no more than
+     * this while the backend is stopped. It is only a hint: Log() checks again.
+     */
+    static bool IsEnabled() { return sEnabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Captures a log call into the ring of the calling thread.
+     *
+     * @return false if the message could not be captured, and must be written synchronously.
+     */
+    bool Log(const char * module, uint8_t category, const char * msg, va_list v)
+    {
+        mActiveLogCalls.fetch_add(1);
+        bool logged = sEnabled.load() && Capture(module, category, msg, v);
+        mActiveLogCalls.fetch_sub(1);
+        return logged;
+    }
+
+    uint64_t DroppedCount()
+    {
+        std::lock_guard<std::mutex> lock(mRingsMutex);
+        uint64_t dropped = mDroppedByExitedThreads;
+        for (ThreadRing * ring : mRings)
+        {
+            dropped += ring->DroppedCount();
+        }
+        return dropped;
+    }
+
+private:
+    static thread_local ThreadRing * tRing;
+    static thread_local bool tIsWriterThread;
+    static std::atomic<bool> sEnabled;
+
+    bool Capture(const char * module, uint8_t category, const char * msg, va_list v)
+    {
+        if (tIsWriterThread)
+        {
+            return false;
+        }
+
+        ThreadRing * ring = CurrentThreadRing();
+        if (ring == nullptr)
+        {
+            WritePendingRecords();
+            return false;
+        }
+
+        alignas(8) uint8_t buffer[kMaxRecordSize];
+        RecordWriter record(buffer, sizeof(buffer));
+        va_list args;
+        va_copy(args, v);
+        bool captured = CaptureArguments(msg, args, record);
+        va_end(args);
+        if (!captured)
+        {
+            // The message is written synchronously: write the older lines first.
+            WritePendingRecords();
+            return false;
+        }
+
+        RecordHeader header = {};
+        header.size         = static_cast<uint32_t>(record.Length());
+        header.category     = category;
+        chip::Platform::CopyString(header.module, module);
+        header.timestampUs = GetTimestampUs();
+        header.format      = msg;
+        memcpy(buffer, &header, sizeof(header));
+
+        // A full ring drops the line: blocking here is what asynchronous logging is meant to avoid.
+        if (ring->Push(buffer, record.Length()) && ring->IsFilling())
+        {
+            mWakeCondition.notify_one();
+        }
+        return true;
+    }
+
+    ThreadRing * CurrentThreadRing()
+    {
+        if (tRing != nullptr)
+        {
+            return tRing;
+        }
+
+        // The first asynchronous log call of a thread allocates its ring.
+        ThreadRing * ring = new (std::nothrow) ThreadRing(static_cast<long long>(syscall(SYS_gettid)));
+        if (ring == nullptr)
+        {
+            return nullptr;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mRingsMutex);
+            mRings.push_back(ring);
+        }
+        pthread_setspecific(mThreadExitKey, ring);
+        tRing = ring;
+        return ring;
+    }
+
+    static void OnLoggingThreadExit(void * ring)
+    {
+        static_cast<ThreadRing *>(ring)->mOwnerExited.store(true, std::memory_order_release);
+        tRing = nullptr;
+    }
+
+    static void * WriterMain(void * context)
+    {
+        tIsWriterThread = true;
+        static_cast<AsyncLogger *>(context)->WriterLoop();
+        return nullptr;
+    }
+
+    void WriterLoop()
+    {
+        while (true)
+        {
+            bool stopping;
+            {
+                std::unique_lock<std::mutex> lock(mWakeMutex);
+                mWakeCondition.wait_for(lock, kFlushInterval, [this]() { return mStopping; });
+                stopping = mStopping;
+            }
+
+            WritePendingRecords();
+
+            if (stopping)
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Writes all the records pushed so far, and reports the dropped lines. Called by the background thread, by a thread about
+     * to write a line synchronously, and by Stop() once the background thread has exited.
+     */
+    void WritePendingRecords()
+    {
+        std::lock_guard<std::mutex> writeLock(mWriteMutex);
+        {
+            std::lock_guard<std::mutex> lock(mRingsMutex);
+            mWriteRings = mRings;
+        }
+
+        while (WriteRecords(mWriteRings) == kMaxLinesPerFlush)
+        {
+        }
+        ReportDrops(mWriteRings);
+        DeleteExitedThreadRings();
+    }
+
+    /**
+     * Writes up to kMaxLinesPerFlush records, the oldest first across all the rings.
+     *
+     * @return The number of lines written.
+     */
+    size_t WriteRecords(std::vector<ThreadRing *> & rings)
+    {
+        size_t lines = 0;
+        flockfile(stdout);
+        for (; lines < kMaxLinesPerFlush; lines++)
+        {
+            ThreadRing * oldestRing       = nullptr;
+            const uint8_t * oldestRecord  = nullptr;
+            RecordHeader oldestHeader     = {};
+            for (ThreadRing * ring : rings)
+            {
+                RecordHeader header;
+                const uint8_t * record = ring->Front(header);
+                if (record != nullptr && (oldestRing == nullptr || header.timestampUs < oldestHeader.timestampUs))
+                {
+                    oldestRing   = ring;
+                    oldestRecord = record;
+                    oldestHeader = header;
+                }
+            }
+            if (oldestRing == nullptr)
+            {
+                break;
+            }
+
+            RecordReader reader(oldestRecord);
+            mLine.Clear();
+            AppendLinePrefix(mLine, oldestHeader.timestampUs, mPid, oldestRing->Tid(), oldestHeader.module);
+            FormatMessage(oldestHeader.format, reader, mLine);
+            mLine.EndLine();
+            fwrite(mLine.Data(), 1, mLine.Length(), stdout);
+            oldestRing->Pop(oldestHeader);
+        }
+        if (lines > 0)
+        {
+            fflush(stdout);
+        }
+        funlockfile(stdout);
+
+        // Let the application know that log messages have been emitted.
+        for (size_t i = 0; i < lines; i++)
+        {
+            DeviceLayer::OnLogOutput();
+        }
+        return lines;
+    }
+
+    void ReportDrops(std::vector<ThreadRing *> & rings)
+    {
+        for (ThreadRing * ring : rings)
+        {
+            uint64_t dropped = ring->DroppedCount();
+            if (dropped != ring->mReportedDrops)
+            {
+                mLine.Clear();
+                AppendLinePrefix(mLine, GetTimestampUs(), mPid, ring->Tid(), "DL");
+                mLine.Printf("%" PRIu64 " log lines dropped: asynchronous log buffer full", dropped - ring->mReportedDrops);
+                mLine.EndLine();
+                flockfile(stdout);
+                fwrite(mLine.Data(), 1, mLine.Length(), stdout);
+                fflush(stdout);
+                funlockfile(stdout);
+                ring->mReportedDrops = dropped;
+            }
+        }
+    }
+
+    void DeleteExitedThreadRings()
+    {
+        std::lock_guard<std::mutex> lock(mRingsMutex);
+        for (auto it = mRings.begin(); it != mRings.end();)
+        {
+            RecordHeader header;
+            ThreadRing * ring = *it;
+            // Checking for records after the exit flag: the owner pushed its last record before setting it.
+            if (ring->mOwnerExited.load(std::memory_order_acquire) && ring->Front(header) == nullptr &&
+                ring->DroppedCount() == ring->mReportedDrops)
+            {
+                mDroppedByExitedThreads += ring->DroppedCount();
+                delete ring;
+                it = mRings.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    std::mutex mStartMutex;
+    bool mRunning               = false;
+    bool mExitHandlerRegistered = false;
+    pthread_t mThread;
+    pthread_key_t mThreadExitKey;
+    long long mPid = 0;
+
+    std::mutex mWakeMutex;
+    std::condition_variable mWakeCondition;
+    bool mStopping = false;
+
+    std::mutex mRingsMutex;
+    std::vector<ThreadRing *> mRings;
+    uint64_t mDroppedByExitedThreads = 0;
+
+    // Log calls between their check of sEnabled and the push of their record.
+    std::atomic<uint32_t> mActiveLogCalls{ 0 };
+
+    // Held by the thread removing records from the rings; only that thread uses the members below.
+    std::mutex mWriteMutex;
+    std::vector<ThreadRing *> mWriteRings;
+    LineBuffer mLine;
+};
+
+thread_local ThreadRing * AsyncLogger::tRing    = nullptr;
+thread_local bool AsyncLogger::tIsWriterThread = false;
+std::atomic<bool> AsyncLogger::sEnabled{ false };
+
+} // namespace
+
+CHIP_ERROR StartAsyncLogging()
+{
+    return AsyncLogger::Instance().Start();
+}
+
+void StopAsyncLogging()
+{
+    AsyncLogger::Instance().Stop();
+}
+
+uint64_t GetAsyncLoggingDropCount()
+{
+    return AsyncLogger::Instance().DroppedCount();
+}
+
+namespace Internal {
+
+bool LogVAsync(const char * module, uint8_t category, const char * msg, va_list v)
+{
+    return AsyncLogger::IsEnabled() && AsyncLogger::Instance().Log(module, category, msg, v);
+}
+
+} // namespace Internal
+
+} // namespace Platform
+} // namespace Logging
+} // namespace chip
@@ -0,0 +1,79 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Asynchronous log output for Linux platforms.
+ *
+ *          Once started, Logging::Platform::LogV() no longer formats and writes
+ *          log lines on the calling thread. It copies the format string pointer,
+ *          a timestamp and the arguments into a lock-free ring buffer owned by
+ *          the calling thread, and a background thread formats and writes them
+ *          to stdout. Lines that do not fit in the ring are dropped and counted.
+ *
+ *          Formats are kept by pointer, so they must remain valid for as long as
+ *          the process runs, as the string literals of ChipLog* calls do.
+ *          Messages whose format or arguments cannot be captured (e.g. %n, wide
+ *          strings, or very long strings) are written synchronously instead,
+ *          once the lines logged before them have been written.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <stdarg.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Logging {
+namespace Platform {
+
+/**
+ * Starts the background thread and makes subsequent log calls asynchronous.
+ *
+ * Pending lines are flushed at process exit, or by StopAsyncLogging(). Starting
+ * an already started backend does nothing.
+ */
+CHIP_ERROR StartAsyncLogging();
+
+/**
+ * Makes subsequent log calls synchronous again, writes all the pending lines and
+ * stops the background thread.
+ */
+void StopAsyncLogging();
+
+/**
+ * Returns the number of log lines dropped because the ring of the logging thread
+ * was full, since the process started.
+ */
+uint64_t GetAsyncLoggingDropCount();
+
+namespace Internal {
+
+/**
+ * Captures a log call for the background thread, when asynchronous logging is started.
+ *
+ * @return false if the message was not captured, and must be written synchronously.
+ */
+bool LogVAsync(const char * module, uint8_t category, const char * msg, va_list v);
+
+} // namespace Internal
+
+} // namespace Platform
+} // namespace Logging
+} // namespace chip
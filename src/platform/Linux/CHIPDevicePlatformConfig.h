@@ -68,6 +68,16 @@
 #define CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG 1
 #endif // CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG
 
+/**
+ * @def CHIP_DEVICE_CONFIG_LINUX_ASYNC_LOG_BUFFER_SIZE
+ *
+ * The size (in bytes, a power of two) of the ring buffer each logging thread
+ * fills when asynchronous logging is started (see platform/Linux/AsyncLogging.h).
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_ASYNC_LOG_BUFFER_SIZE
+#define CHIP_DEVICE_CONFIG_LINUX_ASYNC_LOG_BUFFER_SIZE 16384
+#endif // CHIP_DEVICE_CONFIG_LINUX_ASYNC_LOG_BUFFER_SIZE
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -0,0 +1,438 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file implements the append-only, journaled key-value store
+ *         for the Linux platform.
+ *
+ *         Journal layout (all integers little-endian):
+ *
+ *           header:  "CHIPKVJ1"
+ *           record:  crc32 (4) | type (1) | key length (2) | value length (4) | key | value
+ *
+ *         The CRC-32 covers everything in the record after the crc field.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+#include <system/SystemError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr char kJournalMagic[]      = { 'C', 'H', 'I', 'P', 'K', 'V', 'J', '1' };
+constexpr size_t kJournalHeaderSize = sizeof(kJournalMagic);
+constexpr size_t kRecordHeaderSize  = 4 + 1 + 2 + 4;
+constexpr size_t kMaxKeyLength      = UINT16_MAX;
+constexpr size_t kMaxValueLength    = UINT32_MAX - kRecordHeaderSize - kMaxKeyLength;
+
+uint32_t Crc32(const uint8_t * data, size_t length, uint32_t crc = 0)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+size_t RecordSize(size_t keyLength, size_t valueLength)
+{
+    return kRecordHeaderSize + keyLength + valueLength;
+}
+
+void EncodeRecordHeader(uint8_t * header, uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    header[4] = type;
+    Encoding::LittleEndian::Put16(header + 5, static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(header + 7, static_cast<uint32_t>(dataLen));
+
+    uint32_t crc = Crc32(header + 4, kRecordHeaderSize - 4);
+    crc          = Crc32(reinterpret_cast<const uint8_t *>(key.data()), key.size(), crc);
+    crc          = Crc32(data, dataLen, crc);
+    Encoding::LittleEndian::Put32(header, crc);
+}
+
+CHIP_ERROR WriteFully(int fd, const void * data, size_t length, off_t offset)
+{
+    const uint8_t * p = static_cast<const uint8_t *>(data);
+    while (length > 0)
+    {
+        ssize_t written = pwrite(fd, p, length, offset);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return CHIP_ERROR_POSIX(errno);
+        }
+        p += written;
+        length -= static_cast<size_t>(written);
+        offset += written;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteRecord(int fd, off_t offset, uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    uint8_t header[kRecordHeaderSize];
+    EncodeRecordHeader(header, type, key, data, dataLen);
+
+    ReturnErrorOnFailure(WriteFully(fd, header, sizeof(header), offset));
+    offset += static_cast<off_t>(sizeof(header));
+    ReturnErrorOnFailure(WriteFully(fd, key.data(), key.size(), offset));
+    offset += static_cast<off_t>(key.size());
+    return WriteFully(fd, data, dataLen, offset);
+}
+
+// Makes a rename() within the directory of the given path durable.
+CHIP_ERROR SyncParentDirectory(const std::string & path)
+{
+    std::vector<char> pathCopy(path.begin(), path.end());
+    pathCopy.push_back('\0');
+
+    int dirFd = open(dirname(pathCopy.data()), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    VerifyOrReturnError(dirFd >= 0, CHIP_ERROR_POSIX(errno));
+    int ret = fsync(dirFd);
+    int err = errno;
+    close(dirFd);
+    return (ret == 0) ? CHIP_NO_ERROR : CHIP_ERROR_POSIX(err);
+}
+
+} // namespace
+
+ChipLinuxStorageJournal::~ChipLinuxStorageJournal()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Init(const char * journalFile)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageJournal::Init: Using KVS journal file: %s", journalFile);
+    if (mFd >= 0)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageJournal::Init: Attempt to re-initialize with KVS journal file: %s", journalFile);
+        return CHIP_NO_ERROR;
+    }
+
+    mJournalPath.assign(journalFile);
+    mFd = open(journalFile, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = Replay();
+    if (err != CHIP_NO_ERROR)
+    {
+        close(mFd);
+        mFd = -1;
+        mValues.clear();
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Replay()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd, &st) == 0, CHIP_ERROR_POSIX(errno));
+
+    if (st.st_size == 0)
+    {
+        // New journal: only write the header.
+        ReturnErrorOnFailure(WriteFully(mFd, kJournalMagic, kJournalHeaderSize, 0));
+        VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+        mJournalSize = kJournalHeaderSize;
+        mLiveSize    = kJournalHeaderSize;
+        return CHIP_NO_ERROR;
+    }
+
+    // Read the whole journal at once: it is bounded by compaction to a small multiple of the live data.
+    std::vector<uint8_t> journal(static_cast<size_t>(st.st_size));
+    size_t readSize = 0;
+    while (readSize < journal.size())
+    {
+        ssize_t n = pread(mFd, journal.data() + readSize, journal.size() - readSize, static_cast<off_t>(readSize));
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(n >= 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(n > 0, CHIP_ERROR_READ_FAILED);
+        readSize += static_cast<size_t>(n);
+    }
+
+    if (journal.size() < kJournalHeaderSize || memcmp(journal.data(), kJournalMagic, kJournalHeaderSize) != 0)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageJournal::Init: %s is not a KVS journal", mJournalPath.c_str());
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    size_t offset = kJournalHeaderSize;
+    mLiveSize     = kJournalHeaderSize;
+    while (journal.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record = journal.data() + offset;
+        size_t remaining       = journal.size() - offset - kRecordHeaderSize;
+        uint8_t type           = record[4];
+        size_t keyLen          = Encoding::LittleEndian::Get16(record + 5);
+        size_t valueLen        = Encoding::LittleEndian::Get32(record + 7);
+
+        if (keyLen > remaining || valueLen > remaining - keyLen ||
+            Crc32(record + 4, RecordSize(keyLen, valueLen) - 4) != Encoding::LittleEndian::Get32(record) ||
+            (type != static_cast<uint8_t>(RecordType::kPut) && type != static_cast<uint8_t>(RecordType::kDelete)))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), keyLen);
+        auto it = mValues.find(key);
+        if (it != mValues.end())
+        {
+            mLiveSize -= RecordSize(keyLen, it->second.size());
+        }
+
+        if (type == static_cast<uint8_t>(RecordType::kPut))
+        {
+            const uint8_t * value = record + kRecordHeaderSize + keyLen;
+            mValues[key].assign(value, value + valueLen);
+            mLiveSize += RecordSize(keyLen, valueLen);
+        }
+        else if (it != mValues.end())
+        {
+            mValues.erase(it);
+        }
+
+        offset += RecordSize(keyLen, valueLen);
+    }
+
+    if (offset != journal.size())
+    {
+        // The tail was torn by a crash (or corrupted): drop it so that new records follow the last valid one.
+        ChipLogError(DeviceLayer, "ChipLinuxStorageJournal::Init: Discarding %u invalid bytes at the end of %s",
+                     static_cast<unsigned>(journal.size() - offset), mJournalPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd, static_cast<off_t>(offset)) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+    }
+    mJournalSize = offset;
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageJournal::Init: Loaded %u keys", static_cast<unsigned>(mValues.size()));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    outLen = it->second.size();
+    if (outLen == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+    VerifyOrReturnError(buf != nullptr && bufSize >= outLen, CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(buf, it->second.data(), outLen);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(key != nullptr && (data != nullptr || dataLen == 0), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(dataLen <= kMaxValueLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyString(key);
+    ReturnErrorOnFailure(AppendRecord(RecordType::kPut, keyString, data, dataLen));
+
+    auto it = mValues.find(keyString);
+    if (it != mValues.end())
+    {
+        mLiveSize -= RecordSize(keyString.size(), it->second.size());
+        it->second.assign(data, data + dataLen);
+    }
+    else
+    {
+        mValues.emplace(keyString, std::vector<uint8_t>(data, data + dataLen));
+    }
+    mLiveSize += RecordSize(keyString.size(), dataLen);
+
+    return CompactIfNeeded();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ClearValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(RecordType::kDelete, it->first, nullptr, 0));
+    mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    mValues.erase(it);
+
+    return CompactIfNeeded();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    // RewriteJournal() writes the journal from mValues, so empty it first and put the old contents back if the disk keeps them.
+    decltype(mValues) values;
+    size_t liveSize = mLiveSize;
+    values.swap(mValues);
+    mLiveSize = kJournalHeaderSize;
+
+    CHIP_ERROR err = RewriteJournal();
+    if (err != CHIP_NO_ERROR)
+    {
+        mValues.swap(values);
+        mLiveSize = liveSize;
+        return err;
+    }
+
+    // The empty journal has replaced the old one, so memory stays empty even if the rename is not durable yet.
+    return SyncParentDirectory(mJournalPath);
+}
+
+bool ChipLinuxStorageJournal::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mValues.find(key) != mValues.end();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::AppendRecord(RecordType type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key.size() <= kMaxKeyLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR err = WriteRecord(mFd, static_cast<off_t>(mJournalSize), static_cast<uint8_t>(type), key, data, dataLen);
+    if (err == CHIP_NO_ERROR && fdatasync(mFd) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        // Do not leave a partial record behind: the next append would follow it and be lost on replay.
+        if (ftruncate(mFd, static_cast<off_t>(mJournalSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "ChipLinuxStorageJournal: Failed to truncate %s: %s", mJournalPath.c_str(), strerror(errno));
+        }
+        return err;
+    }
+
+    mJournalSize += RecordSize(key.size(), dataLen);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    ReturnErrorOnFailure(RewriteJournal());
+    return SyncParentDirectory(mJournalPath);
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::CompactIfNeeded()
+{
+    if (mJournalSize < kCompactionMinSize || mJournalSize < kCompactionRatio * mLiveSize)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // The triggering write is already durable in the journal, so a failed compaction is not reported to the caller.
+    CHIP_ERROR err = RewriteJournal();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SyncParentDirectory(mJournalPath);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageJournal: Compaction of %s failed: %" CHIP_ERROR_FORMAT, mJournalPath.c_str(),
+                     err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::RewriteJournal()
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    std::string tmpPath = mJournalPath + ".tmp";
+    int tmpFd           = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(tmpFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = WriteFully(tmpFd, kJournalMagic, kJournalHeaderSize, 0);
+    off_t offset   = static_cast<off_t>(kJournalHeaderSize);
+    for (auto it = mValues.begin(); it != mValues.end() && err == CHIP_NO_ERROR; ++it)
+    {
+        err = WriteRecord(tmpFd, offset, static_cast<uint8_t>(RecordType::kPut), it->first, it->second.data(), it->second.size());
+        offset += static_cast<off_t>(RecordSize(it->first.size(), it->second.size()));
+    }
+    if (err == CHIP_NO_ERROR && fsync(tmpFd) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    // The new journal must be complete on disk before it replaces the old one.
+    if (err == CHIP_NO_ERROR && rename(tmpPath.c_str(), mJournalPath.c_str()) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        close(tmpFd);
+        unlink(tmpPath.c_str());
+        return err;
+    }
+
+    close(mFd);
+    mFd          = tmpFd;
+    mJournalSize = static_cast<size_t>(offset);
+    mLiveSize    = mJournalSize;
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
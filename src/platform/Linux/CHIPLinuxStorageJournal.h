@@ -0,0 +1,93 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines an append-only, journaled key-value store used
+ *         as an alternative backend for the Linux KeyValueStoreManager.
+ *
+ *         Every write or delete appends one checksummed record to the
+ *         journal and syncs it, instead of rewriting the whole INI file.
+ *         Values are indexed in memory; the journal is replayed once at
+ *         Init(), discarding any record torn by a crash, and is compacted
+ *         into a fresh file (atomically renamed over the old one) when it
+ *         holds mostly stale records.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <lib/core/CHIPError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageJournal
+{
+public:
+    ChipLinuxStorageJournal() = default;
+    ~ChipLinuxStorageJournal();
+
+    CHIP_ERROR Init(const char * journalFile);
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    // Records are synced as they are written, so there is nothing left to commit.
+    CHIP_ERROR Commit() { return CHIP_NO_ERROR; }
+
+    // Rewrites the journal with only the live values.
+    CHIP_ERROR Compact();
+
+    // Journal files smaller than this are never compacted.
+    static constexpr size_t kCompactionMinSize = 64 * 1024;
+    // Compaction is triggered once the journal is this many times larger than its live values.
+    static constexpr size_t kCompactionRatio = 2;
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+    };
+
+    CHIP_ERROR Replay();
+    CHIP_ERROR AppendRecord(RecordType type, const std::string & key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR CompactIfNeeded();
+    // Renames a journal holding only mValues over the current one. The caller holds mLock, and syncs the parent directory
+    // to make the rename durable.
+    CHIP_ERROR RewriteJournal();
+
+    std::mutex mLock;
+    std::string mJournalPath;
+    int mFd = -1;
+    size_t mJournalSize = 0; // Bytes of valid records in the journal, including the header.
+    size_t mLiveSize    = 0; // Bytes the journal would take if it only held the current values.
+    std::unordered_map<std::string, std::vector<uint8_t>> mValues;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
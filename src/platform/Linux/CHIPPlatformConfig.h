@@ -55,10 +55,39 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_LOG_FILTERING 0
 #endif // CHIP_LOG_FILTERING
 
+// Every group-key mapping of every fabric, with each of the 3 epoch keys of its key set
+#ifndef CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE (CHIP_CONFIG_MAX_FABRICS * CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC * 3)
+#endif // CHIP_CONFIG_MAX_GROUP_SESSION_INDEX_SIZE
+
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS 4096
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_PATHS
+
+#ifndef CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE 128
+#endif // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+
+#ifndef CHIP_IM_MAX_PATHS_PER_INVOKE
+#define CHIP_IM_MAX_PATHS_PER_INVOKE 64
+#endif // CHIP_IM_MAX_PATHS_PER_INVOKE
+
+#ifndef CHIP_IM_MAX_REPORT_CHAIN_BUFFERS
+#define CHIP_IM_MAX_REPORT_CHAIN_BUFFERS 8
+#endif // CHIP_IM_MAX_REPORT_CHAIN_BUFFERS
+
+#ifndef CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE
+#define CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE 1024
+#endif // CHIP_IM_ATTRIBUTE_CHANGE_QUEUE_SIZE
+
+#ifndef CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+#define CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE 1
+#endif // CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -46,3 +46,6 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+// recvmmsg() is available since Linux 2.6.33
+#define HAVE_RECVMMSG 1
@@ -23,7 +23,11 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
+#if CHIP_DEVICE_CONFIG_LINUX_JOURNALED_KVS
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -43,7 +47,11 @@ public:
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_JOURNALED_KVS
+    DeviceLayer::Internal::ChipLinuxStorageJournal mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
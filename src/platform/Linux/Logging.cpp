@@ -2,6 +2,7 @@
 
 #include <lib/support/EnforceFormat.h>
 #include <lib/support/logging/Constants.h>
+#include <platform/Linux/AsyncLogging.h>
 #include <platform/logging/LogV.h>
 
 #include <cinttypes>
@@ -31,6 +32,12 @@ namespace Platform {
  */
 void ENFORCE_FORMAT(3, 0) LogV(const char * module, uint8_t category, const char * msg, va_list v)
 {
+    // Once started, the asynchronous backend writes the line from its own thread.
+    if (Internal::LogVAsync(module, category, msg, v))
+    {
+        return;
+    }
+
     struct timeval tv;
 
     // Should not fail per man page of gettimeofday(), but failed to get time is not a fatal error in log. The bad time value will
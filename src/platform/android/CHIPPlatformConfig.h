@@ -54,3 +54,7 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
+
+#ifndef CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
+#define CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE 1
+#endif // CHIP_CONFIG_IM_ORDERED_STRUCT_DECODE
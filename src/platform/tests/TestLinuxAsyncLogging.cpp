@@ -0,0 +1,254 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the asynchronous Linux
+ *      log backend, and compares the cost of a log call with and without it.
+ *
+ */
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/Constants.h>
+#include <nlunit-test.h>
+#include <platform/Linux/AsyncLogging.h>
+#include <platform/logging/LogV.h>
+
+using namespace chip;
+using namespace chip::Logging;
+
+namespace {
+
+char sLogPath[] = "/tmp/chip_async_logging_test_XXXXXX";
+int sSavedStdout = -1;
+
+void ENFORCE_FORMAT(1, 2) LogLine(const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    Platform::LogV("DL", kLogCategory_Progress, format, args);
+    va_end(args);
+}
+
+// Sends stdout, where log lines go, to an empty log file.
+void CaptureLogs()
+{
+    fflush(stdout);
+    FILE * file = fopen(sLogPath, "w");
+    if (file != nullptr)
+    {
+        sSavedStdout = dup(STDOUT_FILENO);
+        dup2(fileno(file), STDOUT_FILENO);
+        fclose(file);
+    }
+}
+
+// Restores stdout, and returns the messages logged since CaptureLogs(), without their prefixes.
+std::string EndCaptureLogs()
+{
+    fflush(stdout);
+    if (sSavedStdout >= 0)
+    {
+        dup2(sSavedStdout, STDOUT_FILENO);
+        close(sSavedStdout);
+        sSavedStdout = -1;
+    }
+
+    std::string messages;
+    FILE * file = fopen(sLogPath, "r");
+    if (file == nullptr)
+    {
+        return messages;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        const char * message = strstr(line, "CHIP:DL: ");
+        messages += (message != nullptr) ? message + strlen("CHIP:DL: ") : line;
+    }
+    fclose(file);
+    return messages;
+}
+
+size_t CountLines(const std::string & text, const char * prefix)
+{
+    size_t count = 0;
+    for (size_t pos = 0; pos < text.size(); pos = text.find('\n', pos) + 1)
+    {
+        count += (text.compare(pos, strlen(prefix), prefix) == 0) ? 1 : 0;
+        if (text.find('\n', pos) == std::string::npos)
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+void TestAsyncLogging_Formatting(nlTestSuite * inSuite, void * inContext)
+{
+    char transient[] = "transient";
+    int written      = 0;
+
+    CaptureLogs();
+    NL_TEST_ASSERT(inSuite, Platform::StartAsyncLogging() == CHIP_NO_ERROR);
+    LogLine("integers %d %5u %-4x| %02hhX %ld %lld %zu %" PRIu64, -7, 42u, 0xabu, 0x1ff, -123456789l, -1234567890123ll,
+            static_cast<size_t>(99), static_cast<uint64_t>(UINT64_MAX));
+    LogLine("floats %.2f %e %Lg", 3.14159, 1e-3, static_cast<long double>(0.5));
+    LogLine("strings %s %.3s %8s|%-*.*s|", transient, "abcdef", "right", 6, 2, "left");
+    // The string is copied when logging: changing it afterwards must not change the line.
+    transient[0] = 'X';
+    LogLine("others %c %% %*d %p", 'Z', 5, 1, reinterpret_cast<void *>(0x1234));
+    // Not captured, hence written synchronously, but still after the lines above.
+    LogLine("written %n synchronously", &written);
+    LogLine("last");
+    Platform::StopAsyncLogging();
+    std::string messages = EndCaptureLogs();
+
+    NL_TEST_ASSERT(inSuite,
+                   messages ==
+                       "integers -7    42 ab  | FF -123456789 -1234567890123 99 18446744073709551615\n"
+                       "floats 3.14 1.000000e-03 0.5\n"
+                       "strings transient abc    right|le    |\n"
+                       "others Z %     1 0x1234\n"
+                       "written  synchronously\n"
+                       "last\n");
+}
+
+void TestAsyncLogging_StopWhileLogging(nlTestSuite * inSuite, void * inContext)
+{
+    // Lines logged while the backend stops are either captured before it stops, or written synchronously: none is lost.
+    constexpr int kThreads        = 4;
+    constexpr int kLinesPerThread = 2000;
+
+    uint64_t droppedBefore = Platform::GetAsyncLoggingDropCount();
+
+    CaptureLogs();
+    NL_TEST_ASSERT(inSuite, Platform::StartAsyncLogging() == CHIP_NO_ERROR);
+    std::thread threads[kThreads];
+    for (auto & thread : threads)
+    {
+        thread = std::thread([]() {
+            for (int i = 0; i < kLinesPerThread; i++)
+            {
+                LogLine("stopping line %d", i);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    Platform::StopAsyncLogging();
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    std::string messages = EndCaptureLogs();
+
+    uint64_t dropped = Platform::GetAsyncLoggingDropCount() - droppedBefore;
+    NL_TEST_ASSERT(inSuite, CountLines(messages, "stopping line ") + dropped == kThreads * kLinesPerThread);
+}
+
+void TestAsyncLogging_CallCost(nlTestSuite * inSuite, void * inContext)
+{
+    // Bursts stay well within a ring, and the pauses let the background thread write them, so nothing should be dropped.
+    constexpr int kBursts        = 20;
+    constexpr int kLinesPerBurst = 100;
+    constexpr int kLines         = kBursts * kLinesPerBurst;
+
+    std::chrono::steady_clock::duration syncDuration{}, asyncDuration{};
+    uint64_t droppedBefore = Platform::GetAsyncLoggingDropCount();
+
+    CaptureLogs();
+    for (int burst = 0; burst < kBursts; burst++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kLinesPerBurst; i++)
+        {
+            LogLine("sync line %d of burst %d: %s", i, burst, "payload");
+        }
+        syncDuration += std::chrono::steady_clock::now() - start;
+    }
+
+    NL_TEST_ASSERT(inSuite, Platform::StartAsyncLogging() == CHIP_NO_ERROR);
+    for (int burst = 0; burst < kBursts; burst++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kLinesPerBurst; i++)
+        {
+            LogLine("async line %d of burst %d: %s", i, burst, "payload");
+        }
+        asyncDuration += std::chrono::steady_clock::now() - start;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    Platform::StopAsyncLogging();
+    std::string messages = EndCaptureLogs();
+
+    uint64_t dropped = Platform::GetAsyncLoggingDropCount() - droppedBefore;
+    NL_TEST_ASSERT(inSuite, CountLines(messages, "sync line ") == kLines);
+    NL_TEST_ASSERT(inSuite, CountLines(messages, "async line ") + dropped == kLines);
+
+    auto syncNs  = std::chrono::duration_cast<std::chrono::nanoseconds>(syncDuration).count();
+    auto asyncNs = std::chrono::duration_cast<std::chrono::nanoseconds>(asyncDuration).count();
+    printf("Log call cost: %.1f ns synchronous, %.1f ns asynchronous, %" PRIu64 " lines dropped\n",
+           static_cast<double>(syncNs) / kLines, static_cast<double>(asyncNs) / kLines, dropped);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test AsyncLogging::Formatting", TestAsyncLogging_Formatting),
+    NL_TEST_DEF("Test AsyncLogging::StopWhileLogging", TestAsyncLogging_StopWhileLogging),
+    NL_TEST_DEF("Test AsyncLogging::CallCost", TestAsyncLogging_CallCost),
+    NL_TEST_SENTINEL()
+};
+
+int TestLinuxAsyncLogging_Setup(void * inContext)
+{
+    int fd = mkstemp(sLogPath);
+    if (fd < 0)
+        return FAILURE;
+    close(fd);
+    return SUCCESS;
+}
+
+int TestLinuxAsyncLogging_Teardown(void * inContext)
+{
+    unlink(sLogPath);
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestLinuxAsyncLogging()
+{
+    nlTestSuite theSuite = { "LinuxAsyncLogging tests", &sTests[0], TestLinuxAsyncLogging_Setup, TestLinuxAsyncLogging_Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestLinuxAsyncLogging)
@@ -0,0 +1,226 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the journaled Linux
+ *      key-value store.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+char sJournalPath[] = "/tmp/chip_kvs_journal_test_XXXXXX";
+
+off_t JournalFileSize()
+{
+    struct stat st;
+    return (stat(sJournalPath, &st) == 0) ? st.st_size : -1;
+}
+
+bool ValueEquals(ChipLinuxStorageJournal & journal, const char * key, const char * expected)
+{
+    uint8_t buf[64];
+    size_t len = 0;
+    return journal.ReadValueBin(key, buf, sizeof(buf), len) == CHIP_NO_ERROR && len == strlen(expected) &&
+        memcmp(buf, expected, len) == 0;
+}
+
+CHIP_ERROR WriteString(ChipLinuxStorageJournal & journal, const char * key, const char * value)
+{
+    return journal.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), strlen(value));
+}
+
+void TestJournal_PutGetDelete(nlTestSuite * inSuite, void * inContext)
+{
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, WriteString(journal, "a", "alpha") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WriteString(journal, "b", "beta") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WriteString(journal, "a", "alpha2") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.WriteValueBin("empty", nullptr, 0) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "a", "alpha2"));
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "b", "beta"));
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "empty", ""));
+    NL_TEST_ASSERT(inSuite, journal.HasValue("empty"));
+
+    // Size query, as done by KeyValueStoreManagerImpl::_Get
+    size_t len = 0;
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("a", nullptr, 0, len) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, len == 6);
+
+    NL_TEST_ASSERT(inSuite, journal.ClearValue("b") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, journal.ClearValue("b") == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, !journal.HasValue("b"));
+    NL_TEST_ASSERT(inSuite, journal.ReadValueBin("b", nullptr, 0, len) == CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+void TestJournal_Reopen(nlTestSuite * inSuite, void * inContext)
+{
+    // Continues from the state left by TestJournal_PutGetDelete.
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "a", "alpha2"));
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "empty", ""));
+    NL_TEST_ASSERT(inSuite, !journal.HasValue("b"));
+}
+
+void TestJournal_TornTail(nlTestSuite * inSuite, void * inContext)
+{
+    off_t sizeBefore;
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+        sizeBefore = JournalFileSize();
+        NL_TEST_ASSERT(inSuite, WriteString(journal, "c", "lost in a crash") == CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of the last append.
+    NL_TEST_ASSERT(inSuite, truncate(sJournalPath, JournalFileSize() - 3) == 0);
+
+    {
+        ChipLinuxStorageJournal journal;
+        NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !journal.HasValue("c"));
+        NL_TEST_ASSERT(inSuite, ValueEquals(journal, "a", "alpha2"));
+        NL_TEST_ASSERT(inSuite, JournalFileSize() == sizeBefore);
+
+        // New records are appended after the last valid one.
+        NL_TEST_ASSERT(inSuite, WriteString(journal, "d", "delta") == CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "d", "delta"));
+}
+
+void TestJournal_Compaction(nlTestSuite * inSuite, void * inContext)
+{
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+
+    // Overwriting the same few keys must not grow the journal without bound.
+    char value[32];
+    for (int i = 0; i < 10000; i++)
+    {
+        snprintf(value, sizeof(value), "counter-%d", i);
+        NL_TEST_ASSERT(inSuite, WriteString(journal, (i % 2) ? "odd" : "even", value) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, JournalFileSize() < static_cast<off_t>(ChipLinuxStorageJournal::kCompactionMinSize + 64));
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "even", "counter-9998"));
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "odd", "counter-9999"));
+
+    NL_TEST_ASSERT(inSuite, journal.Compact() == CHIP_NO_ERROR);
+
+    ChipLinuxStorageJournal reopened;
+    NL_TEST_ASSERT(inSuite, reopened.Init(sJournalPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueEquals(reopened, "a", "alpha2"));
+    NL_TEST_ASSERT(inSuite, ValueEquals(reopened, "d", "delta"));
+    NL_TEST_ASSERT(inSuite, ValueEquals(reopened, "odd", "counter-9999"));
+}
+
+void TestJournal_ClearAllFailure(nlTestSuite * inSuite, void * inContext)
+{
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WriteString(journal, "kept", "value") == CHIP_NO_ERROR);
+
+    // A directory in the way of the compacted journal makes ClearAll fail; the values are still there, as on disk.
+    std::string tmpPath = std::string(sJournalPath) + ".tmp";
+    NL_TEST_ASSERT(inSuite, mkdir(tmpPath.c_str(), S_IRWXU) == 0);
+    NL_TEST_ASSERT(inSuite, journal.ClearAll() != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ValueEquals(journal, "kept", "value"));
+    rmdir(tmpPath.c_str());
+
+    NL_TEST_ASSERT(inSuite, journal.ClearAll() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !journal.HasValue("kept"));
+
+    ChipLinuxStorageJournal reopened;
+    NL_TEST_ASSERT(inSuite, reopened.Init(sJournalPath) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !reopened.HasValue("kept"));
+}
+
+void TestJournal_RejectsForeignFile(nlTestSuite * inSuite, void * inContext)
+{
+    FILE * file = fopen(sJournalPath, "w");
+    NL_TEST_ASSERT(inSuite, file != nullptr);
+    if (file != nullptr)
+    {
+        fputs("[DEFAULT]\nkey=value\n", file);
+        fclose(file);
+    }
+
+    ChipLinuxStorageJournal journal;
+    NL_TEST_ASSERT(inSuite, journal.Init(sJournalPath) == CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test ChipLinuxStorageJournal::PutGetDelete", TestJournal_PutGetDelete),
+    NL_TEST_DEF("Test ChipLinuxStorageJournal::Reopen", TestJournal_Reopen),
+    NL_TEST_DEF("Test ChipLinuxStorageJournal::TornTail", TestJournal_TornTail),
+    NL_TEST_DEF("Test ChipLinuxStorageJournal::Compaction", TestJournal_Compaction),
+    NL_TEST_DEF("Test ChipLinuxStorageJournal::ClearAllFailure", TestJournal_ClearAllFailure),
+    NL_TEST_DEF("Test ChipLinuxStorageJournal::RejectsForeignFile", TestJournal_RejectsForeignFile),
+    NL_TEST_SENTINEL()
+};
+
+int TestLinuxStorageJournal_Setup(void * inContext)
+{
+    int fd = mkstemp(sJournalPath);
+    if (fd < 0)
+        return FAILURE;
+    close(fd);
+    return SUCCESS;
+}
+
+int TestLinuxStorageJournal_Teardown(void * inContext)
+{
+    unlink(sJournalPath);
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestLinuxStorageJournal()
+{
+    nlTestSuite theSuite = { "LinuxStorageJournal tests", &sTests[0], TestLinuxStorageJournal_Setup,
+                             TestLinuxStorageJournal_Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestLinuxStorageJournal)
@@ -0,0 +1,241 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/BdxFileSource.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * An open file, shared by the sources reading it.
+ *
+ * Blocks are read with pread(), which leaves the file offset alone: sources read the same descriptor, each at its own pace.
+ */
+class FileBlockSource::SharedFile
+{
+public:
+    SharedFile(int fd, const struct stat & status) : mFd(fd), mDevice(status.st_dev), mInode(status.st_ino) {}
+
+    /**
+     * Gets the shared file described by [status], sharing [fd] if it is not open yet.
+     *
+     * Takes ownership of [fd], setting it to -1, when the file is newly shared.
+     */
+    static CHIP_ERROR Acquire(int & fd, const struct stat & status, SharedFile *& file);
+
+    void Release();
+
+    int GetFd() const { return mFd; }
+
+private:
+    // A file replaced since it was opened has a new inode.
+    bool IsFile(const struct stat & status) const { return (mDevice == status.st_dev) && (mInode == status.st_ino); }
+
+    static SharedFile * sFiles;
+
+    SharedFile * mNext = nullptr;
+    const int mFd;
+    const dev_t mDevice;
+    const ino_t mInode;
+    uint32_t mRefCount = 0;
+};
+
+FileBlockSource::SharedFile * FileBlockSource::SharedFile::sFiles = nullptr;
+
+CHIP_ERROR FileBlockSource::SharedFile::Acquire(int & fd, const struct stat & status, SharedFile *& file)
+{
+    for (file = sFiles; file != nullptr; file = file->mNext)
+    {
+        if (file->IsFile(status))
+        {
+            file->mRefCount++;
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    file = Platform::New<SharedFile>(fd, status);
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Only a hint: blocks are read in order, so have the kernel read ahead aggressively.
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    fd              = -1;
+    file->mRefCount = 1;
+    file->mNext     = sFiles;
+    sFiles          = file;
+    return CHIP_NO_ERROR;
+}
+
+void FileBlockSource::SharedFile::Release()
+{
+    VerifyOrDie(mRefCount > 0);
+    if (--mRefCount > 0)
+    {
+        return;
+    }
+
+    for (SharedFile ** link = &sFiles; *link != nullptr; link = &(*link)->mNext)
+    {
+        if (*link == this)
+        {
+            *link = mNext;
+            break;
+        }
+    }
+
+    close(mFd);
+    Platform::Delete(this);
+}
+
+uint32_t FileBlockSource::Stats::GetBlocksPerSecond() const
+{
+    if (blockCount == 0)
+    {
+        return 0;
+    }
+    const uint64_t elapsedMs = std::max<uint64_t>(duration.count(), 1);
+    return static_cast<uint32_t>(std::min<uint64_t>(blockCount * 1000ull / elapsedMs, UINT32_MAX));
+}
+
+CHIP_ERROR FileBlockSource::Open(const char * path)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mFile == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    else if (!S_ISREG(status.st_mode))
+    {
+        err = CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    else if (!CanCastTo<size_t>(status.st_size))
+    {
+        err = CHIP_ERROR_MESSAGE_TOO_LONG;
+    }
+    else
+    {
+        err = SharedFile::Acquire(fd, status, mFile);
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    ReturnErrorOnFailure(err);
+
+    mSize     = static_cast<uint64_t>(status.st_size);
+    mStats    = Stats();
+    mOpenTime = System::SystemClock().GetMonotonicTimestamp();
+    return CHIP_NO_ERROR;
+}
+
+FileBlockSource::~FileBlockSource()
+{
+    Close();
+    Platform::MemoryFree(mBuffer);
+}
+
+void FileBlockSource::Close()
+{
+    if (mFile != nullptr)
+    {
+        mFile->Release();
+        mFile = nullptr;
+    }
+}
+
+uint64_t FileBlockSource::GetSize() const
+{
+    return (mFile != nullptr) ? mSize : 0;
+}
+
+CHIP_ERROR FileBlockSource::GetBlock(uint64_t offset, size_t maxLength, ByteSpan & block, bool & isEof)
+{
+    VerifyOrReturnError(mFile != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(offset <= mSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Casts are safe: the size of the file fits in a size_t, and offset is no greater
+    const size_t start  = static_cast<size_t>(offset);
+    const size_t length = std::min(maxLength, static_cast<size_t>(mSize) - start);
+
+    // Allocated once per transfer in practice, as the block size does not change. Never empty, so that even an empty block
+    // points somewhere.
+    if ((mBuffer == nullptr) || (length > mBufferSize))
+    {
+        const size_t bufferSize = std::max<size_t>(length, 1);
+        uint8_t * buffer        = static_cast<uint8_t *>(Platform::MemoryRealloc(mBuffer, bufferSize));
+        VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_NO_MEMORY);
+        mBuffer     = buffer;
+        mBufferSize = bufferSize;
+    }
+
+    size_t readLength = 0;
+    while (readLength < length)
+    {
+        ssize_t result = pread(mFile->GetFd(), mBuffer + readLength, length - readLength, static_cast<off_t>(start + readLength));
+        if ((result < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        VerifyOrReturnError(result >= 0, CHIP_ERROR_POSIX(errno));
+        if (result == 0)
+        {
+            ChipLogError(BDX, "File truncated while being served");
+            return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+        }
+        readLength += static_cast<size_t>(result);
+    }
+
+    block = ByteSpan(mBuffer, length);
+    isEof = (start + length == mSize);
+
+    mStats.blockCount++;
+    mStats.byteCount += length;
+    mStats.duration = System::SystemClock().GetMonotonicTimestamp() - mOpenTime;
+
+    return CHIP_NO_ERROR;
+}
+
+void FileBlockSource::LogStats() const
+{
+    ChipLogProgress(BDX, "Served %" PRIu32 " blocks (%" PRIu64 " bytes) in %" PRIu64 " ms: %" PRIu32 " blocks/s",
+                    mStats.blockCount, mStats.byteCount, static_cast<uint64_t>(mStats.duration.count()),
+                    mStats.GetBlocksPerSecond());
+}
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,120 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file BdxFileSource.h
+ *
+ *  This file defines a source of BDX blocks backed by a file, for senders running on a POSIX file system.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Serves the blocks of a BDX transfer out of a file.
+ *
+ * The file is opened once, with sequential read-ahead, and the open file is shared by all the FileBlockSource objects reading
+ * it: concurrent transfers of an image neither reopen it nor keep a copy of it, and read it through the same page cache. Each
+ * block is read with a single pread() into a buffer of the source, that TransferSession::PrepareBlock() copies into the
+ * outgoing message.
+ *
+ * A file replaced while open (e.g. by a new image of the same name) is opened anew by the sources opened afterwards, while the
+ * transfers in progress keep reading the previous contents. Served files must therefore be replaced by renaming a new file over
+ * them, never modified in place: GetBlock() fails once the file is shorter than when it was opened, which aborts the transfers
+ * in progress, but other changes made in place are served as they are, and only caught by the image digest check of the
+ * receiver.
+ *
+ * Not thread safe: all sources must be used from the same thread, typically the CHIP event loop.
+ */
+class FileBlockSource
+{
+public:
+    struct Stats
+    {
+        uint32_t blockCount = 0;
+        uint64_t byteCount  = 0;
+        System::Clock::Milliseconds64 duration{ 0 }; ///< Time from Open() to the last block
+
+        /// Average block rate over the transfer, 0 until a block has been served.
+        uint32_t GetBlocksPerSecond() const;
+    };
+
+    FileBlockSource() = default;
+    ~FileBlockSource();
+
+    FileBlockSource(const FileBlockSource &) = delete;
+    FileBlockSource & operator=(const FileBlockSource &) = delete;
+
+    /**
+     * Opens the file at the given null-terminated path, sharing it if another source already has it open.
+     *
+     * Resets the statistics. The source must not already be open.
+     */
+    CHIP_ERROR Open(const char * path);
+
+    /**
+     * Releases the file. It is closed along with the last source using it.
+     */
+    void Close();
+
+    bool IsOpen() const { return mFile != nullptr; }
+
+    /// Size of the file, in bytes. The source must be open.
+    uint64_t GetSize() const;
+
+    /**
+     * Gets the block starting at the given offset of the file.
+     *
+     * @param[in]  offset     Offset of the block in the file, no greater than the file size.
+     * @param[in]  maxLength  Maximum block size. The block is shorter if the file ends first.
+     * @param[out] block      Contents of the block, valid until the next call or until the source is closed.
+     * @param[out] isEof      Whether the block reaches the end of the file.
+     *
+     * @retval CHIP_ERROR_INTEGRITY_CHECK_FAILED  The file was truncated since it was opened.
+     */
+    CHIP_ERROR GetBlock(uint64_t offset, size_t maxLength, ByteSpan & block, bool & isEof);
+
+    /// Statistics of the blocks served since the source was opened.
+    const Stats & GetStats() const { return mStats; }
+
+    /**
+     * Logs the statistics of the blocks served since the source was opened.
+     */
+    void LogStats() const;
+
+private:
+    class SharedFile;
+
+    SharedFile * mFile = nullptr;
+    uint64_t mSize     = 0;
+    uint8_t * mBuffer  = nullptr;
+    size_t mBufferSize = 0;
+    Stats mStats;
+    System::Clock::Timestamp mOpenTime;
+};
+
+} // namespace bdx
+} // namespace chip
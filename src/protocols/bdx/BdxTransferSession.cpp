@@ -1,7 +1,6 @@
 /**
  *    @file
  *      Implementation for the TransferSession class.
- *      // TODO: Support Asynchronous mode. Currently, only Synchronous mode is supported.
  */
 
 #include <protocols/bdx/BdxTransferSession.h>
@@ -201,11 +200,14 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     VerifyOrReturnError(mState == TransferState::kNegotiateTransferParams, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
-    // Don't allow a Control method that wasn't supported by the initiator
+    // Don't allow a Control method that wasn't supported by both the initiator and this object
     // MaxBlockSize can't be larger than the proposed value
     VerifyOrReturnError(proposedControlOpts.Has(acceptData.ControlMode), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mSuppportedXferOpts.Has(acceptData.ControlMode), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
 
+    // The application chooses the mode when several were common to both peers
+    mControlMode          = acceptData.ControlMode;
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
 
     if (mRole == TransferRole::kSender)
@@ -250,7 +252,9 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mState = TransferState::kTransferInProgress;
 
-    if ((mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive) ||
+    // In asynchronous mode, the Sender starts sending Blocks right away
+    if ((mRole == TransferRole::kReceiver &&
+         (mControlMode == TransferControlFlags::kSenderDrive || mControlMode == TransferControlFlags::kAsync)) ||
         (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kReceiverDrive))
     {
         mAwaitingResponse = true;
@@ -321,7 +325,15 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // Blocks are sent without waiting for a query, as long as the window is not full
+        VerifyOrReturnError(GetNumBlocksInFlight() < mMaxBlocksInFlight, CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -354,15 +366,32 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 }
 
 CHIP_ERROR TransferSession::PrepareBlockAck()
+{
+    return PrepareBlockAck(mLastBlockNum);
+}
+
+CHIP_ERROR TransferSession::PrepareBlockAck(uint32_t blockCounter)
 {
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError((mState == TransferState::kTransferInProgress) || (mState == TransferState::kReceivedEOF),
                         CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
+    // Only in asynchronous mode may a Block other than the last one received be acknowledged, as long as it is in flight
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        VerifyOrReturnError((blockCounter >= mNextAckNum) && (blockCounter < mLastQueryNum), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    else
+    {
+        VerifyOrReturnError(blockCounter == mLastBlockNum, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    const bool isEofAck = (mState == TransferState::kReceivedEOF) && (blockCounter == mLastBlockNum);
+
     CounterMessage ackMsg;
-    ackMsg.BlockCounter       = mLastBlockNum;
-    const MessageType msgType = (mState == TransferState::kReceivedEOF) ? MessageType::BlockAckEOF : MessageType::BlockAck;
+    ackMsg.BlockCounter       = blockCounter;
+    const MessageType msgType = isEofAck ? MessageType::BlockAckEOF : MessageType::BlockAck;
 
     ReturnErrorOnFailure(WriteToPacketBuffer(ackMsg, mPendingMsgHandle));
 
@@ -381,12 +410,14 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
             mAwaitingResponse = true;
         }
     }
-    else if (mState == TransferState::kReceivedEOF)
+    else if (isEofAck)
     {
         mState            = TransferState::kTransferDone;
         mAwaitingResponse = false;
     }
 
+    mNextAckNum = blockCounter + 1;
+
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
     return CHIP_NO_ERROR;
@@ -421,6 +452,7 @@ void TransferSession::Reset()
     mNextBlockNum      = 0;
     mLastQueryNum      = 0;
     mNextQueryNum      = 0;
+    mNextAckNum        = 0;
 
     mTimeout                = System::Clock::kZero;
     mTimeoutStartTime       = System::Clock::kZero;
@@ -598,7 +630,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
+    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive) || (mControlMode == TransferControlFlags::kAsync);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -696,6 +728,7 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     VerifyOrReturn(blockMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn(IsBlockWithinWindow(), PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn((blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
                    PrepareStatusReport(StatusCode::kBadMessageContents));
 
@@ -716,7 +749,12 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
-    mAwaitingResponse = false;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // Blocks are not queried: the next one is expected right away
+        mLastQueryNum = mNextQueryNum = blockMsg.BlockCounter + 1;
+    }
+    mAwaitingResponse = (mControlMode == TransferControlFlags::kAsync);
 
 #if CHIP_AUTOMATION_LOGGING
     blockMsg.LogMessage(MessageType::Block);
@@ -734,6 +772,7 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     VerifyOrReturn(blockEOFMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn(IsBlockWithinWindow(), PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn(blockEOFMsg.DataLength <= mTransferMaxBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     mBlockEventData.Data         = blockEOFMsg.Data;
@@ -747,6 +786,11 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockEOFMsg.DataLength;
     mLastBlockNum = blockEOFMsg.BlockCounter;
 
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        mLastQueryNum = mNextQueryNum = blockEOFMsg.BlockCounter + 1;
+    }
+
     mAwaitingResponse = false;
     mState            = TransferState::kReceivedEOF;
 
@@ -758,19 +802,36 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // In asynchronous mode, the Blocks sent before BlockEOF may still be acknowledged while awaiting BlockAckEOF
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) ||
+                       ((mState == TransferState::kAwaitingEOFAck) && (mControlMode == TransferControlFlags::kAsync)),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAck ackMsg;
     const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
-    VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    mPendingOutput = OutputEventType::kAckReceived;
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // Acknowledges all the Blocks in flight up to the given one. BlockEOF is acknowledged by BlockAckEOF only.
+        const uint32_t endBlockNum = (mState == TransferState::kAwaitingEOFAck) ? mLastBlockNum : mNextBlockNum;
+        VerifyOrReturn((ackMsg.BlockCounter >= mNextAckNum) && (ackMsg.BlockCounter < endBlockNum),
+                       PrepareStatusReport(StatusCode::kBadBlockCounter));
 
-    // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
-    // In this case, the Sender should wait to receive a BlockQuery next.
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+        mNextAckNum       = ackMsg.BlockCounter + 1;
+        mAwaitingResponse = (GetNumBlocksInFlight() > 0);
+    }
+    else
+    {
+        VerifyOrReturn(ackMsg.BlockCounter == mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+        // In Receiver Drive, the Receiver can send a BlockAck to indicate receipt of the message and reset the timeout.
+        // In this case, the Sender should wait to receive a BlockQuery next.
+        mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
+    }
+
+    mPendingOutput = OutputEventType::kAckReceived;
 
 #if CHIP_AUTOMATION_LOGGING
     ackMsg.LogMessage(MessageType::BlockAck);
@@ -790,6 +851,7 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
+    mNextAckNum       = mNextBlockNum;
     mAwaitingResponse = false;
 
     mState = TransferState::kTransferDone;
@@ -899,6 +961,36 @@ bool TransferSession::IsTransferLengthDefinite() const
     return (mTransferLength > 0);
 }
 
+bool TransferSession::IsBlockWithinWindow() const
+{
+    return (mControlMode != TransferControlFlags::kAsync) || (GetNumBlocksInFlight() < mMaxBlocksInFlight);
+}
+
+CHIP_ERROR TransferSession::SetMaxBlocksInFlight(uint16_t maxBlocksInFlight)
+{
+    VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(maxBlocksInFlight > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mMaxBlocksInFlight = maxBlocksInFlight;
+
+    return CHIP_NO_ERROR;
+}
+
+uint32_t TransferSession::GetNumBlocksInFlight() const
+{
+    // Only counted once the control mode is known, and only asynchronous mode has Blocks in flight
+    const bool isInProgress = (mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck) ||
+        (mState == TransferState::kReceivedEOF);
+    if (!isInProgress || (mControlMode != TransferControlFlags::kAsync))
+    {
+        return 0;
+    }
+
+    // Up to the next Block to send, or to the next Block expected
+    const uint32_t endBlockNum = (mRole == TransferRole::kSender) ? mNextBlockNum : mLastQueryNum;
+    return endBlockNum - mNextAckNum;
+}
+
 const char * TransferSession::OutputEvent::ToString(OutputEventType outputEventType)
 {
     switch (outputEventType)
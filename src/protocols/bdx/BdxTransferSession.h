@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemPacketBuffer.h>
@@ -244,6 +245,9 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In asynchronous mode, Blocks may be prepared without waiting for a BlockQuery or BlockAck, as long as fewer than
+     *   GetMaxBlocksInFlight() Blocks are awaiting acknowledgement.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -260,6 +264,20 @@ public:
      */
     CHIP_ERROR PrepareBlockAck();
 
+    /**
+     * @brief
+     *   Prepare a BlockAck message acknowledging the given Block and all the Blocks received before it.
+     *
+     *   Outside of asynchronous mode, only the last Block received may be acknowledged. In asynchronous mode, any Block in flight
+     *   may be, so that a Receiver can acknowledge Blocks as it processes them rather than as they arrive.
+     *
+     * @param blockCounter The counter of the Block to acknowledge
+     *
+     * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
+     *                    is unable to handle this request.
+     */
+    CHIP_ERROR PrepareBlockAck(uint32_t blockCounter);
+
     /**
      * @brief
      *   Prematurely end a transfer with a StatusReport. Must still call Reset() to prepare the TransferSession for another
@@ -293,12 +311,28 @@ public:
     CHIP_ERROR HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
                                      System::Clock::Timestamp curTime);
 
+    /**
+     * @brief
+     *   Set the window of an asynchronous transfer: the maximum number of Blocks in flight, that is sent and not acknowledged
+     *   yet for a Sender, or received and not acknowledged yet for a Receiver. Defaults to CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT.
+     *
+     *   The window is not negotiated: a Receiver rejects the Blocks beyond its own window, so a Sender's window must be no larger
+     *   than the Receiver's. It is kept across Reset(), and may only be set before StartTransfer() or WaitForTransfer().
+     *
+     * @param maxBlocksInFlight The maximum number of Blocks in flight, at least 1
+     *
+     * @return CHIP_ERROR May indicate an invalid window or a transfer in progress.
+     */
+    CHIP_ERROR SetMaxBlocksInFlight(uint16_t maxBlocksInFlight);
+
     TransferControlFlags GetControlMode() const { return mControlMode; }
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
+    uint16_t GetMaxBlocksInFlight() const { return mMaxBlocksInFlight; }
+    uint32_t GetNumBlocksInFlight() const; ///< Always 0 outside of asynchronous mode
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
     const uint8_t * GetFileDesignator(uint16_t & fileDesignatorLen) const
     {
@@ -350,6 +384,7 @@ private:
 
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
+    bool IsBlockWithinWindow() const;
 
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
@@ -381,6 +416,9 @@ private:
     uint32_t mNextBlockNum = 0;
     uint32_t mLastQueryNum = 0;
     uint32_t mNextQueryNum = 0;
+    uint32_t mNextAckNum   = 0; ///< Oldest Block not acknowledged yet, in asynchronous mode
+
+    uint16_t mMaxBlocksInFlight = CHIP_CONFIG_BDX_MAX_BLOCKS_IN_FLIGHT;
 
     System::Clock::Timeout mTimeout            = System::Clock::kZero;
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
@@ -55,6 +55,10 @@ CHIP_ERROR TransferFacilitator::OnMessageReceived(chip::Messaging::ExchangeConte
     // transfer is finished.
     mExchangeCtx->WillSendMessage();
 
+    // Have the application react to the message right away rather than at the next regular poll: in asynchronous mode, this
+    // keeps Blocks flowing as soon as acknowledgements arrive.
+    ScheduleImmediatePoll();
+
     return err;
 }
 
@@ -73,12 +77,19 @@ void TransferFacilitator::PollTimerHandler(chip::System::Layer * systemLayer, vo
 
 void TransferFacilitator::PollForOutput()
 {
+    // Restart the regular timer first, so that the output handler may still call ScheduleImmediatePoll()
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
+    }
+    else
+    {
+        ChipLogError(BDX, "%s mSystemLayer is null", __FUNCTION__);
+    }
+
     TransferSession::OutputEvent outEvent;
     mTransfer.PollOutput(outEvent, System::SystemClock().GetMonotonicTimestamp());
     HandleTransferSessionOutput(outEvent);
-
-    VerifyOrReturn(mSystemLayer != nullptr, ChipLogError(BDX, "%s mSystemLayer is null", __FUNCTION__));
-    mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
 }
 
 void TransferFacilitator::ScheduleImmediatePoll()
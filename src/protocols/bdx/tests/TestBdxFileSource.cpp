@@ -0,0 +1,253 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <protocols/bdx/BdxFileSource.h>
+
+#include <nlunit-test.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+using namespace ::chip;
+using chip::bdx::FileBlockSource;
+
+namespace {
+
+constexpr size_t kFileSize  = 1000;
+constexpr size_t kBlockSize = 256;
+
+/// A temporary file holding a known pattern, removed on destruction
+class TestFile
+{
+public:
+    ~TestFile()
+    {
+        if (mPath[0] != '\0')
+        {
+            unlink(mPath);
+        }
+    }
+
+    bool Write(size_t size, uint8_t seed)
+    {
+        // Written to a new file and renamed, the way images are replaced
+        char tempPath[sizeof(mPath)];
+        strcpy(tempPath, "/tmp/TestBdxFileSource.XXXXXX");
+        int fd = mkstemp(tempPath);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        bool ok = true;
+        for (size_t i = 0; (i < size) && ok; i++)
+        {
+            uint8_t byte = static_cast<uint8_t>(i + seed);
+            ok           = (write(fd, &byte, 1) == 1);
+        }
+        close(fd);
+
+        if (mPath[0] == '\0')
+        {
+            strcpy(mPath, tempPath);
+            return ok;
+        }
+        return ok && (rename(tempPath, mPath) == 0);
+    }
+
+    const char * GetPath() const { return mPath; }
+
+private:
+    char mPath[64] = {};
+};
+
+bool HasPattern(const ByteSpan & block, size_t offset, uint8_t seed)
+{
+    for (size_t i = 0; i < block.size(); i++)
+    {
+        if (block.data()[i] != static_cast<uint8_t>(offset + i + seed))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TestReadBlocks(nlTestSuite * inSuite, void * inContext)
+{
+    TestFile file;
+    NL_TEST_ASSERT(inSuite, file.Write(kFileSize, 0));
+
+    FileBlockSource source;
+    NL_TEST_ASSERT(inSuite, source.Open(file.GetPath()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, source.IsOpen());
+    NL_TEST_ASSERT(inSuite, source.GetSize() == kFileSize);
+    NL_TEST_ASSERT(inSuite, source.Open(file.GetPath()) == CHIP_ERROR_INCORRECT_STATE);
+
+    size_t offset = 0;
+    bool isEof    = false;
+    while (!isEof)
+    {
+        ByteSpan block;
+        NL_TEST_ASSERT(inSuite, source.GetBlock(offset, kBlockSize, block, isEof) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, block.size() == std::min(kBlockSize, kFileSize - offset));
+        NL_TEST_ASSERT(inSuite, HasPattern(block, offset, 0));
+        offset += block.size();
+        VerifyOrReturn(offset <= kFileSize);
+    }
+    NL_TEST_ASSERT(inSuite, offset == kFileSize);
+
+    NL_TEST_ASSERT(inSuite, source.GetStats().blockCount == 4);
+    NL_TEST_ASSERT(inSuite, source.GetStats().byteCount == kFileSize);
+    NL_TEST_ASSERT(inSuite, source.GetStats().GetBlocksPerSecond() > 0);
+
+    // Past the end
+    ByteSpan block;
+    NL_TEST_ASSERT(inSuite, source.GetBlock(kFileSize + 1, kBlockSize, block, isEof) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    source.Close();
+    NL_TEST_ASSERT(inSuite, !source.IsOpen());
+    NL_TEST_ASSERT(inSuite, source.GetBlock(0, kBlockSize, block, isEof) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestSharedFile(nlTestSuite * inSuite, void * inContext)
+{
+    TestFile file;
+    NL_TEST_ASSERT(inSuite, file.Write(kFileSize, 0));
+
+    FileBlockSource first;
+    FileBlockSource second;
+    NL_TEST_ASSERT(inSuite, first.Open(file.GetPath()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, second.Open(file.GetPath()) == CHIP_NO_ERROR);
+
+    // Both transfers read the same file, each at its own pace and into its own buffer
+    ByteSpan firstBlock;
+    ByteSpan secondBlock;
+    bool isEof;
+    NL_TEST_ASSERT(inSuite, first.GetBlock(kBlockSize, kBlockSize, firstBlock, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, second.GetBlock(0, kBlockSize, secondBlock, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, HasPattern(firstBlock, kBlockSize, 0));
+    NL_TEST_ASSERT(inSuite, HasPattern(secondBlock, 0, 0));
+    NL_TEST_ASSERT(inSuite, first.GetStats().blockCount == 1);
+    NL_TEST_ASSERT(inSuite, second.GetStats().blockCount == 1);
+
+    // The file remains open for the second source
+    first.Close();
+    NL_TEST_ASSERT(inSuite, second.GetBlock(kBlockSize, kBlockSize, secondBlock, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, HasPattern(secondBlock, kBlockSize, 0));
+
+    // A replaced file is opened anew, without affecting the transfer in progress
+    NL_TEST_ASSERT(inSuite, file.Write(kFileSize, 7));
+    NL_TEST_ASSERT(inSuite, first.Open(file.GetPath()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, first.GetBlock(0, kBlockSize, firstBlock, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, HasPattern(firstBlock, 0, 7));
+    NL_TEST_ASSERT(inSuite, second.GetBlock(0, kBlockSize, secondBlock, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, HasPattern(secondBlock, 0, 0));
+}
+
+void TestModifiedFile(nlTestSuite * inSuite, void * inContext)
+{
+    TestFile file;
+    NL_TEST_ASSERT(inSuite, file.Write(kFileSize, 0));
+
+    FileBlockSource source;
+    ByteSpan block;
+    bool isEof;
+    NL_TEST_ASSERT(inSuite, source.Open(file.GetPath()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, source.GetBlock(0, kBlockSize, block, isEof) == CHIP_NO_ERROR);
+
+    // Truncated in place: the blocks past the new end are gone, and fail rather than being served short
+    NL_TEST_ASSERT(inSuite, truncate(file.GetPath(), kBlockSize) == 0);
+    NL_TEST_ASSERT(inSuite, source.GetBlock(kBlockSize * 2, kBlockSize, block, isEof) == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    NL_TEST_ASSERT(inSuite, source.GetBlock(kBlockSize / 2, kBlockSize, block, isEof) == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    NL_TEST_ASSERT(inSuite, source.GetBlock(0, kBlockSize, block, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, HasPattern(block, 0, 0) && !isEof);
+    NL_TEST_ASSERT(inSuite, source.GetStats().blockCount == 2);
+
+    // Sources opened afterwards get the new size
+    FileBlockSource other;
+    NL_TEST_ASSERT(inSuite, other.Open(file.GetPath()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, other.GetSize() == kBlockSize);
+    NL_TEST_ASSERT(inSuite, other.GetBlock(0, kBlockSize, block, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, HasPattern(block, 0, 0) && isEof);
+}
+
+void TestEmptyFile(nlTestSuite * inSuite, void * inContext)
+{
+    TestFile file;
+    NL_TEST_ASSERT(inSuite, file.Write(0, 0));
+
+    FileBlockSource source;
+    NL_TEST_ASSERT(inSuite, source.Open(file.GetPath()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, source.GetSize() == 0);
+
+    ByteSpan block;
+    bool isEof = false;
+    NL_TEST_ASSERT(inSuite, source.GetBlock(0, kBlockSize, block, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, block.empty() && (block.data() != nullptr));
+    NL_TEST_ASSERT(inSuite, isEof);
+}
+
+void TestOpenErrors(nlTestSuite * inSuite, void * inContext)
+{
+    FileBlockSource source;
+    NL_TEST_ASSERT(inSuite, source.Open(nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, source.Open("/tmp/TestBdxFileSource.does-not-exist") != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, source.Open("/tmp") != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !source.IsOpen());
+}
+
+int TestSetup(void * inContext)
+{
+    return Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestReadBlocks", TestReadBlocks),
+    NL_TEST_DEF("TestSharedFile", TestSharedFile),
+    NL_TEST_DEF("TestModifiedFile", TestModifiedFile),
+    NL_TEST_DEF("TestEmptyFile", TestEmptyFile),
+    NL_TEST_DEF("TestOpenErrors", TestOpenErrors),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+nlTestSuite sSuite = { "Test BDX file source", &sTests[0], TestSetup, TestTeardown };
+} // namespace
+
+int TestBdxFileSource()
+{
+    nlTestRunner(&sSuite, nullptr);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBdxFileSource)
@@ -2,6 +2,9 @@
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <algorithm>
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 
 #include <nlunit-test.h>
@@ -724,6 +727,377 @@ void TestDuplicateBlockError(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Helper method for sending a BlockAck or BlockAckEOF for a given Block, in asynchronous mode.
+void SendAndVerifyAsyncBlockAck(nlTestSuite * inSuite, void * inContext, TransferSession & ackReceiver,
+                                TransferSession & ackSender, TransferSession::OutputEvent & outEvent, uint32_t blockCounter,
+                                bool expectEOF)
+{
+    TransferSession::OutputEventType expectedEventType =
+        expectEOF ? TransferSession::OutputEventType::kAckEOFReceived : TransferSession::OutputEventType::kAckReceived;
+    MessageType expectedMsgType = expectEOF ? MessageType::BlockAckEOF : MessageType::BlockAck;
+
+    CHIP_ERROR err = ackSender.PrepareBlockAck(blockCounter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ackSender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(inSuite, inContext, outEvent, expectedMsgType);
+    VerifyNoMoreOutput(inSuite, inContext, ackSender);
+
+    err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), ackReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ackReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == expectedEventType);
+    VerifyNoMoreOutput(inSuite, inContext, ackReceiver);
+}
+
+// Helper method for negotiating an asynchronous transfer between an initiating receiver and a responding sender, each with its
+// own window.
+void NegotiateAsyncTransfer(nlTestSuite * inSuite, void * inContext, TransferSession & initiatingReceiver,
+                            uint16_t receiverWindow, TransferSession & respondingSender, uint16_t senderWindow,
+                            TransferSession::TransferInitData & initOptions, uint16_t blockSize)
+{
+    TransferSession::OutputEvent outEvent;
+    System::Clock::Timeout timeout = System::Clock::Seconds16(24);
+
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.SetMaxBlocksInFlight(receiverWindow) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, respondingSender.SetMaxBlocksInFlight(senderWindow) == CHIP_NO_ERROR);
+
+    // Both modes are common to the peers, so the sender picks
+    BitFlags<TransferControlFlags> modes(TransferControlFlags::kReceiverDrive, TransferControlFlags::kAsync);
+    initOptions.TransferCtlFlags = modes;
+    initOptions.MaxBlockSize     = blockSize;
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeout, initiatingReceiver, TransferRole::kReceiver, initOptions,
+                              respondingSender, modes, blockSize);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kAsync;
+    acceptData.MaxBlockSize = blockSize;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, respondingSender, TransferRole::kSender, acceptData, initiatingReceiver,
+                           initOptions);
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetControlMode() == TransferControlFlags::kAsync);
+    NL_TEST_ASSERT(inSuite, respondingSender.GetControlMode() == TransferControlFlags::kAsync);
+}
+
+// Test a full asynchronous transfer: Blocks are sent without queries, up to the window, and acknowledged cumulatively.
+void TestInitiatingReceiverAsync(nlTestSuite * inSuite, void * inContext)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    // Chosen arbitrarily for this test
+    constexpr uint16_t kWindow    = 3;
+    constexpr uint16_t kBlockSize = 64;
+
+    TransferSession::TransferInitData initOptions;
+    char testFileDes[9]        = { "test.txt" };
+    initOptions.FileDesLength  = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator = reinterpret_cast<uint8_t *>(testFileDes);
+
+    // The window cannot change during a transfer
+    NegotiateAsyncTransfer(inSuite, inContext, initiatingReceiver, kWindow, respondingSender, kWindow, initOptions, kBlockSize);
+    NL_TEST_ASSERT(inSuite, respondingSender.SetMaxBlocksInFlight(kWindow + 1) == CHIP_ERROR_INCORRECT_STATE);
+
+    // Queries are not used in asynchronous mode
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.PrepareBlockQuery() != CHIP_NO_ERROR);
+
+    // Fill the window
+    uint32_t numBlocksSent = 0;
+    for (; numBlocksSent < kWindow; numBlocksSent++)
+    {
+        SendAndVerifyArbitraryBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, numBlocksSent);
+    }
+    NL_TEST_ASSERT(inSuite, respondingSender.GetNumBlocksInFlight() == kWindow);
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetNumBlocksInFlight() == kWindow);
+
+    // No more Blocks until some are acknowledged
+    uint8_t fakeData[kBlockSize] = { 0 };
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    NL_TEST_ASSERT(inSuite, respondingSender.PrepareBlock(blockData) == CHIP_ERROR_INCORRECT_STATE);
+    VerifyNoMoreOutput(inSuite, inContext, respondingSender);
+
+    // Only Blocks in flight may be acknowledged
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.PrepareBlockAck(kWindow) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Acknowledging the second Block also acknowledges the first one
+    SendAndVerifyAsyncBlockAck(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, 1, false);
+    NL_TEST_ASSERT(inSuite, respondingSender.GetNumBlocksInFlight() == 1);
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetNumBlocksInFlight() == 1);
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.PrepareBlockAck(0) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Two more Blocks fit, the last one being BlockEOF
+    SendAndVerifyArbitraryBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, numBlocksSent++);
+    SendAndVerifyArbitraryBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, true, numBlocksSent++);
+    NL_TEST_ASSERT(inSuite, respondingSender.GetNumBlocksInFlight() == kWindow);
+
+    // Blocks before BlockEOF are still acknowledged with BlockAck, and BlockEOF with BlockAckEOF
+    SendAndVerifyAsyncBlockAck(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, numBlocksSent - 2, false);
+    SendAndVerifyAsyncBlockAck(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, numBlocksSent - 1, true);
+    NL_TEST_ASSERT(inSuite, respondingSender.GetNumBlocksInFlight() == 0);
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.GetNumBlocksInFlight() == 0);
+}
+
+// Test that a receiver rejects the Blocks beyond its window.
+void TestAsyncWindowExceeded(nlTestSuite * inSuite, void * inContext)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    constexpr uint16_t kReceiverWindow = 2;
+    constexpr uint16_t kBlockSize      = 64;
+
+    TransferSession::TransferInitData initOptions;
+    char testFileDes[9]        = { "test.txt" };
+    initOptions.FileDesLength  = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator = reinterpret_cast<uint8_t *>(testFileDes);
+
+    NL_TEST_ASSERT(inSuite, initiatingReceiver.SetMaxBlocksInFlight(0) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The sender's window is larger than the receiver's
+    NegotiateAsyncTransfer(inSuite, inContext, initiatingReceiver, kReceiverWindow, respondingSender, kReceiverWindow + 1,
+                           initOptions, kBlockSize);
+
+    for (uint32_t i = 0; i < kReceiverWindow; i++)
+    {
+        SendAndVerifyArbitraryBlock(inSuite, inContext, respondingSender, initiatingReceiver, outEvent, false, i);
+    }
+
+    uint8_t fakeData[kBlockSize] = { 0 };
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = sizeof(fakeData);
+    NL_TEST_ASSERT(inSuite, respondingSender.PrepareBlock(blockData) == CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(inSuite, inContext, outEvent, MessageType::Block);
+
+    CHIP_ERROR err = AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+    VerifyStatusReport(inSuite, inContext, outEvent.MsgData, StatusCode::kBadBlockCounter);
+}
+
+// Transfers an image between two TransferSession objects over a simulated link with a fixed latency, and measures the time taken.
+class LoopbackTransfer
+{
+public:
+    static constexpr uint16_t kBlockSize = 64;
+    static constexpr System::Clock::Milliseconds64 kLatency{ 50 };
+
+    LoopbackTransfer(nlTestSuite * inSuite, TransferControlFlags mode, uint16_t window, uint32_t numBlocks) :
+        mSuite(inSuite), mMode(mode), mNumBlocks(numBlocks)
+    {
+        NL_TEST_ASSERT(mSuite, mReceiver.SetMaxBlocksInFlight(window) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(mSuite, mSender.SetMaxBlocksInFlight(window) == CHIP_NO_ERROR);
+    }
+
+    // Returns the time taken by the whole transfer, from the ReceiveInit message to the BlockAckEOF message.
+    System::Clock::Milliseconds64 Run()
+    {
+        const System::Clock::Timeout timeout = System::Clock::Seconds16(60);
+        const BitFlags<TransferControlFlags> modes(TransferControlFlags::kReceiverDrive, TransferControlFlags::kAsync);
+
+        TransferSession::TransferInitData initOptions;
+        char testFileDes[9]          = { "test.txt" };
+        initOptions.TransferCtlFlags = BitFlags<TransferControlFlags>(TransferControlFlags::kReceiverDrive, mMode);
+        initOptions.MaxBlockSize     = kBlockSize;
+        initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+        initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+        NL_TEST_ASSERT(mSuite, mSender.WaitForTransfer(TransferRole::kSender, modes, kBlockSize, timeout) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(mSuite, mReceiver.StartTransfer(TransferRole::kReceiver, initOptions, timeout) == CHIP_NO_ERROR);
+
+        while (!mDone && !mFailed)
+        {
+            Pump(mReceiver, mSender);
+            Pump(mSender, mReceiver);
+            FillWindow();
+
+            if (mInFlightCount == 0)
+            {
+                // Nothing left to deliver: the transfer must be over
+                if (!mDone)
+                {
+                    Fail();
+                }
+                break;
+            }
+            Deliver();
+        }
+
+        NL_TEST_ASSERT(mSuite, !mFailed);
+        NL_TEST_ASSERT(mSuite, mNumBlocksReceived == mNumBlocks);
+        return mNow;
+    }
+
+private:
+    struct Message
+    {
+        TransferSession::MessageTypeData type;
+        System::PacketBufferHandle data;
+        TransferSession * destination;
+        System::Clock::Timestamp deliveryTime;
+    };
+
+    // Handles all the output of a session, as an application would
+    void Pump(TransferSession & session, TransferSession & peer)
+    {
+        TransferSession::OutputEvent event;
+        do
+        {
+            session.PollOutput(event, mNow);
+            Handle(session, peer, event);
+        } while (event.EventType != TransferSession::OutputEventType::kNone && !mFailed);
+    }
+
+    void Handle(TransferSession & session, TransferSession & peer, TransferSession::OutputEvent & event)
+    {
+        switch (event.EventType)
+        {
+        case TransferSession::OutputEventType::kNone:
+            break;
+        case TransferSession::OutputEventType::kMsgToSend:
+            VerifyOrReturn(mInFlightCount < ArraySize(mInFlight), Fail());
+            mInFlight[mInFlightCount++] = { event.msgTypeData, std::move(event.MsgData), &peer, mNow + kLatency };
+            break;
+        case TransferSession::OutputEventType::kInitReceived: {
+            TransferSession::TransferAcceptData acceptData;
+            acceptData.ControlMode  = mMode;
+            acceptData.MaxBlockSize = kBlockSize;
+            VerifyOrReturn(session.AcceptTransfer(acceptData) == CHIP_NO_ERROR, Fail());
+            mAccepted = true;
+            break;
+        }
+        case TransferSession::OutputEventType::kAcceptReceived:
+            if (mMode != TransferControlFlags::kAsync)
+            {
+                VerifyOrReturn(session.PrepareBlockQuery() == CHIP_NO_ERROR, Fail());
+            }
+            break;
+        case TransferSession::OutputEventType::kQueryReceived:
+            SendBlock();
+            break;
+        case TransferSession::OutputEventType::kBlockReceived:
+            mNumBlocksReceived++;
+            if (event.blockdata.IsEof || mMode == TransferControlFlags::kAsync)
+            {
+                VerifyOrReturn(session.PrepareBlockAck(event.blockdata.BlockCounter) == CHIP_NO_ERROR, Fail());
+            }
+            else
+            {
+                VerifyOrReturn(session.PrepareBlockQuery() == CHIP_NO_ERROR, Fail());
+            }
+            break;
+        case TransferSession::OutputEventType::kAckReceived:
+            break;
+        case TransferSession::OutputEventType::kAckEOFReceived:
+            mDone = true;
+            break;
+        default:
+            Fail();
+            break;
+        }
+    }
+
+    // In asynchronous mode, the sender sends Blocks as long as the window allows
+    void FillWindow()
+    {
+        while ((mMode == TransferControlFlags::kAsync) && mAccepted && (mNumBlocksSent < mNumBlocks) && !mFailed &&
+               (mSender.GetNumBlocksInFlight() < mSender.GetMaxBlocksInFlight()))
+        {
+            SendBlock();
+            Pump(mSender, mReceiver);
+        }
+    }
+
+    void SendBlock()
+    {
+        TransferSession::BlockData blockData;
+        blockData.Data   = mBlockData;
+        blockData.Length = sizeof(mBlockData);
+        blockData.IsEof  = (mNumBlocksSent == mNumBlocks - 1);
+        VerifyOrReturn(mSender.PrepareBlock(blockData) == CHIP_NO_ERROR, Fail());
+        mNumBlocksSent++;
+    }
+
+    // Delivers the oldest message in flight, advancing the time to its arrival
+    void Deliver()
+    {
+        Message message = std::move(mInFlight[0]);
+        for (size_t i = 1; i < mInFlightCount; i++)
+        {
+            mInFlight[i - 1] = std::move(mInFlight[i]);
+        }
+        mInFlightCount--;
+
+        mNow = std::max(mNow, message.deliveryTime);
+
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(message.type.ProtocolId, message.type.MessageType);
+        VerifyOrReturn(message.destination->HandleMessageReceived(payloadHeader, std::move(message.data), mNow) == CHIP_NO_ERROR,
+                       Fail());
+    }
+
+    void Fail()
+    {
+        NL_TEST_ASSERT(mSuite, false);
+        mFailed = true;
+    }
+
+    nlTestSuite * mSuite;
+    const TransferControlFlags mMode;
+    const uint32_t mNumBlocks;
+
+    TransferSession mReceiver;
+    TransferSession mSender;
+    uint8_t mBlockData[kBlockSize] = { 0 };
+
+    Message mInFlight[16];
+    size_t mInFlightCount = 0;
+
+    System::Clock::Timestamp mNow = System::Clock::kZero;
+    uint32_t mNumBlocksSent       = 0;
+    uint32_t mNumBlocksReceived   = 0;
+    bool mAccepted                = false;
+    bool mDone                    = false;
+    bool mFailed                  = false;
+};
+
+constexpr System::Clock::Milliseconds64 LoopbackTransfer::kLatency;
+
+// Compare the time taken by synchronous and asynchronous transfers of the same image, over a link with latency.
+void TestLoopbackThroughput(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kNumBlocks = 32;
+    constexpr uint16_t kWindow    = 4;
+
+    LoopbackTransfer syncTransfer(inSuite, TransferControlFlags::kReceiverDrive, kWindow, kNumBlocks);
+    LoopbackTransfer asyncTransfer(inSuite, TransferControlFlags::kAsync, kWindow, kNumBlocks);
+    // Over MRP, a Block is only sent once the previous one is acknowledged: a window of one Block
+    LoopbackTransfer mrpTransfer(inSuite, TransferControlFlags::kAsync, 1, kNumBlocks);
+    const System::Clock::Milliseconds64 syncDuration  = syncTransfer.Run();
+    const System::Clock::Milliseconds64 asyncDuration = asyncTransfer.Run();
+    const System::Clock::Milliseconds64 mrpDuration   = mrpTransfer.Run();
+
+    printf("%" PRIu32 " blocks with %u ms latency: synchronous %u ms, asynchronous (window of %u) %u ms, asynchronous over MRP "
+           "(window of 1) %u ms\n",
+           kNumBlocks, static_cast<unsigned>(LoopbackTransfer::kLatency.count()), static_cast<unsigned>(syncDuration.count()),
+           kWindow, static_cast<unsigned>(asyncDuration.count()), static_cast<unsigned>(mrpDuration.count()));
+
+    // Each synchronous Block takes a round trip, when the asynchronous window covers several Blocks per round trip
+    NL_TEST_ASSERT(inSuite, syncDuration >= LoopbackTransfer::kLatency * (2 * kNumBlocks));
+    NL_TEST_ASSERT(inSuite, asyncDuration * 2 < syncDuration);
+
+    // With a window of one Block, a BlockAck replaces the BlockQuery: still a round trip per Block, which saves nothing but
+    // the first BlockQuery
+    NL_TEST_ASSERT(inSuite, mrpDuration >= LoopbackTransfer::kLatency * (2 * kNumBlocks - 1));
+    NL_TEST_ASSERT(inSuite, mrpDuration < syncDuration);
+}
+
 // Test Suite
 
 /**
@@ -737,6 +1111,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestBadAcceptMessageFields", TestBadAcceptMessageFields),
     NL_TEST_DEF("TestTimeout", TestTimeout),
     NL_TEST_DEF("TestDuplicateBlockError", TestDuplicateBlockError),
+    NL_TEST_DEF("TestInitiatingReceiverAsync", TestInitiatingReceiverAsync),
+    NL_TEST_DEF("TestAsyncWindowExceeded", TestAsyncWindowExceeded),
+    NL_TEST_DEF("TestLoopbackThroughput", TestLoopbackThroughput),
     NL_TEST_SENTINEL()
 };
 // clang-format on
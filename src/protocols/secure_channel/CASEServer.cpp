@@ -26,6 +26,7 @@
 using namespace ::chip::Inet;
 using namespace ::chip::Transport;
 using namespace ::chip::Credentials;
+using namespace ::chip::System::Clock::Literals;
 
 namespace chip {
 
@@ -43,76 +44,116 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mExchangeManager          = exchangeManager;
     mGroupDataProvider        = responderGroupDataProvider;
 
-    Cleanup();
-    return CHIP_NO_ERROR;
+    for (auto & handshake : mHandshakes)
+    {
+        handshake.mServer = this;
+        if (handshake.mActive)
+        {
+            ReleaseHandshake(handshake);
+        }
+    }
+
+    ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
+    return mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+CHIP_ERROR CASEServer::OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, Messaging::ExchangeDelegate *& newDelegate)
 {
-    ReturnErrorCodeIf(ec == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    Handshake * handshake = AllocateHandshake();
+    VerifyOrReturnError(handshake != nullptr, CHIP_ERROR_NO_MEMORY);
 
     // Setup CASE state machine using the credentials for the current fabric.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
-    ReturnErrorOnFailure(
-        GetSession().ListenForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage, this,
-                                                   Optional<ReliableMessageProtocolConfig>::Value(GetLocalMRPConfig())));
+    CASESession & session = handshake->mSession;
+    session.SetGroupDataProvider(mGroupDataProvider);
+    session.SetCryptoWorker(mCryptoWorker);
+    CHIP_ERROR err = session.ListenForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage, handshake,
+                                                           Optional<ReliableMessageProtocolConfig>::Value(GetLocalMRPConfig()));
+    if (err != CHIP_NO_ERROR)
+    {
+        ReleaseHandshake(*handshake);
+        return err;
+    }
 
-    // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ChipLogProgress(Inet, "CASE Server received Sigma1 message. Starting handshake %u/%u",
+                    static_cast<unsigned>(handshake - mHandshakes + 1), static_cast<unsigned>(ArraySize(mHandshakes)));
 
+    // The session handles the exchange of the Sigma1 from now on.
+    newDelegate = &session;
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate)
+void CASEServer::OnExchangeCreationFailed(Messaging::ExchangeDelegate * delegate)
 {
-    // TODO: assign newDelegate to CASESession, let CASESession handle future messages.
-    newDelegate = this;
-    return CHIP_NO_ERROR;
+    for (auto & handshake : mHandshakes)
+    {
+        if (handshake.mActive && delegate == &handshake.mSession)
+        {
+            ReleaseHandshake(handshake);
+            return;
+        }
+    }
 }
 
-CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
-                                         System::PacketBufferHandle && payload)
+size_t CASEServer::GetActiveHandshakeCount() const
 {
-    ChipLogProgress(Inet, "CASE Server received Sigma1 message. Starting handshake. EC %p", ec);
-    CHIP_ERROR err = InitCASEHandshake(ec);
-    SuccessOrExit(err);
+    size_t count = 0;
+    for (const auto & handshake : mHandshakes)
+    {
+        count += handshake.mActive ? 1 : 0;
+    }
+    return count;
+}
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-    ChipLogProgress(Inet, "CASE Server disabling CASE session setups");
-    mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+CASEServer::Handshake * CASEServer::AllocateHandshake()
+{
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    Handshake * stalest                = nullptr;
 
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
-    SuccessOrExit(err);
+    for (auto & handshake : mHandshakes)
+    {
+        if (!handshake.mActive)
+        {
+            handshake.mActive    = true;
+            handshake.mStartTime = now;
+            return &handshake;
+        }
+        if (now - handshake.mStartTime >= CHIP_CONFIG_CASE_SERVER_STALE_HANDSHAKE_TIMEOUT &&
+            (stalest == nullptr || handshake.mStartTime < stalest->mStartTime))
+        {
+            stalest = &handshake;
+        }
+    }
 
-exit:
-    if (err != CHIP_NO_ERROR)
+    if (stalest == nullptr)
     {
-        Cleanup();
+        ChipLogError(Inet, "CASE Server busy, dropping Sigma1 message");
+        return nullptr;
     }
-    return err;
+
+    ChipLogProgress(Inet, "CASE Server evicting a stale CASE session setup");
+    ReleaseHandshake(*stalest);
+    stalest->mActive    = true;
+    stalest->mStartTime = now;
+    return stalest;
 }
 
-void CASEServer::Cleanup()
+void CASEServer::ReleaseHandshake(Handshake & handshake)
 {
-    // Let's re-register for CASE Sigma1 message, so that the next CASE session setup request can be processed.
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-    ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
-    mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
-
-    GetSession().Clear();
+    // Aborts the exchange of the handshake, if it still has one.
+    handshake.mSession.Clear();
+    handshake.mActive = false;
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::Handshake::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     ChipLogError(Inet, "CASE Session establishment failed: %s", ErrorStr(err));
-    Cleanup();
+    mServer->ReleaseHandshake(*this);
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::Handshake::OnSessionEstablished(const SessionHandle & session)
 {
     ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(session->GetPeer()));
-    Cleanup();
+    mServer->ReleaseHandshake(*this);
 }
 } // namespace chip
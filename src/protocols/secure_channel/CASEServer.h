@@ -21,12 +21,18 @@
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/CASESession.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+/**
+ * Responds to incoming CASE session establishments, up to CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES of them at a
+ * time. Each Sigma1 gets its own CASESession, which becomes the delegate of the exchange that carries it.
+ *
+ * When all the sessions are in use, a new Sigma1 evicts the oldest establishment that has been in progress for at least
+ * CHIP_CONFIG_CASE_SERVER_STALE_HANDSHAKE_TIMEOUT, or is dropped (and retransmitted by its initiator) if there is none.
+ */
+class CASEServer : public Messaging::UnsolicitedMessageHandler
 {
 public:
     CASEServer() {}
@@ -42,34 +48,45 @@ public:
                                              FabricTable * fabrics, SessionResumptionStorage * sessionResumptionStorage,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
+    // Worker that the handshakes run their expensive crypto on, or nullptr to run it on the event loop.
+    void SetCryptoWorker(SessionCryptoWorker * cryptoWorker) { mCryptoWorker = cryptoWorker; }
 
     //// UnsolicitedMessageHandler Implementation ////
-    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader,
+                                            Messaging::ExchangeDelegate *& newDelegate) override;
+    void OnExchangeCreationFailed(Messaging::ExchangeDelegate * delegate) override;
 
-    //// ExchangeDelegate Implementation ////
-    CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
-                                 System::PacketBufferHandle && payload) override;
-    void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
-    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
-
-    virtual CASESession & GetSession() { return mPairingSession; }
+    // Number of session establishments in progress.
+    size_t GetActiveHandshakeCount() const;
 
 private:
+    // A session establishment in progress.
+    class Handshake : public SessionEstablishmentDelegate
+    {
+    public:
+        //////////// SessionEstablishmentDelegate Implementation ///////////////
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        CASEServer * mServer = nullptr;
+        CASESession mSession;
+        System::Clock::Timestamp mStartTime;
+        bool mActive = false;
+    };
+
     Messaging::ExchangeManager * mExchangeManager        = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage = nullptr;
 
-    CASESession mPairingSession;
+    Handshake mHandshakes[CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES];
     SessionManager * mSessionManager = nullptr;
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    SessionCryptoWorker * mCryptoWorker                 = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
-
-    void Cleanup();
+    // Returns a free handshake, evicting a stale one if needed, or nullptr if all are busy.
+    Handshake * AllocateHandshake();
+    void ReleaseHandshake(Handshake & handshake);
 };
 
 } // namespace chip
@@ -121,6 +121,99 @@ using HKDF_sha_crypto = HKDF_sha;
 // The session establishment fails if the response is not received within timeout window.
 static constexpr ExchangeContext::Timeout kSigma_Response_Timeout = System::Clock::Seconds16(30);
 
+/**
+ * Work of a CASESession that may run on its crypto worker. The session detaches the job if it is cleared
+ * before the job completes, in which case the results are dropped.
+ */
+class CASESession::CryptoJob : public SessionCryptoWorker::Job
+{
+public:
+    explicit CryptoJob(CASESession & session) : mSession(&session) {}
+
+    void Detach() { mSession = nullptr; }
+
+    void Cancel() final { mError = CHIP_ERROR_CANCELLED; }
+
+    void Complete() final
+    {
+        if (mSession != nullptr)
+        {
+            mSession->OnCryptoJobComplete(*this);
+        }
+        chip::Platform::Delete(this);
+    }
+
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+
+private:
+    CASESession * mSession;
+};
+
+// Generates the responder's ephemeral key and the shared secret of Sigma2.
+class CASESession::EphemeralKeyJob : public CASESession::CryptoJob
+{
+public:
+    EphemeralKeyJob(CASESession & session, const P256PublicKey & remotePubKey) : CryptoJob(session), mRemotePubKey(remotePubKey) {}
+
+    void Run() override
+    {
+        P256Keypair ephemeralKey;
+        mError = ephemeralKey.Initialize();
+        VerifyOrReturn(mError == CHIP_NO_ERROR);
+        mError = ephemeralKey.ECDH_derive_secret(mRemotePubKey, mSharedSecret);
+        VerifyOrReturn(mError == CHIP_NO_ERROR);
+        mError = ephemeralKey.Serialize(mEphemeralKey);
+    }
+
+    const P256PublicKey mRemotePubKey;
+    P256SerializedKeypair mEphemeralKey;
+    P256ECDHDerivedSecret mSharedSecret;
+};
+
+// Validates the peer's operational credentials against the root of our fabric, then the peer's signature
+// of the Sigma2 or Sigma3 TBS data.
+class CASESession::PeerValidationJob : public CASESession::CryptoJob
+{
+public:
+    using CryptoJob::CryptoJob;
+
+    void Run() override;
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> mTBEData; // Decrypted TBE data, which mPeerNOC and mPeerICAC point into
+    ByteSpan mPeerNOC;
+    ByteSpan mPeerICAC;
+    P256ECDSASignature mSignature;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> mTBSData;
+    size_t mTBSDataLength = 0;
+    uint8_t mRootCertBuffer[kMaxCHIPCertLength];
+    ByteSpan mRootCert;
+    FabricId mFabricId = kUndefinedFabricId;
+    ValidationContext mValidContext;
+
+    NodeId mPeerNodeId = kUndefinedNodeId;
+};
+
+void CASESession::PeerValidationJob::Run()
+{
+    FabricId peerFabricId;
+    P256PublicKey peerPublicKey;
+    mError = FabricInfo::VerifyCredentials(mRootCert, mPeerNOC, mPeerICAC, mValidContext, mPeerNodeId, peerFabricId, peerPublicKey);
+    VerifyOrReturn(mError == CHIP_NO_ERROR);
+    VerifyOrReturn(peerFabricId == mFabricId, mError = CHIP_ERROR_INVALID_CASE_PARAMETER);
+
+    // TODO - Validate message signature prior to validating the received operational credentials.
+    //        The op cert check requires traversal of cert chain, that is a more expensive operation.
+    //        If message signature check fails, the cert chain check will be unnecessary, but with the
+    //        current flow of code, a malicious node can trigger a DoS style attack on the device.
+#ifdef ENABLE_HSM_ECDSA_VERIFY
+    P256PublicKeyHSM peerPublicKeyHSM;
+    memcpy(Uint8::to_uchar(peerPublicKeyHSM), peerPublicKey.Bytes(), peerPublicKey.Length());
+    mError = peerPublicKeyHSM.ECDSA_validate_msg_signature(mTBSData.Get(), mTBSDataLength, mSignature);
+#else
+    mError = peerPublicKey.ECDSA_validate_msg_signature(mTBSData.Get(), mTBSDataLength, mSignature);
+#endif
+}
+
 CASESession::~CASESession()
 {
     // Let's clear out any security state stored in the object, before destroying it.
@@ -149,6 +242,12 @@ void CASESession::Clear()
 {
     // This function zeroes out and resets the memory used by the object.
     // It's done so that no security related information will be leaked.
+    if (mPendingCryptoJob != nullptr)
+    {
+        mPendingCryptoJob->Detach();
+        mPendingCryptoJob = nullptr;
+    }
+
     mCommissioningHash.Clear();
     PairingSession::Clear();
 
@@ -177,6 +276,13 @@ void CASESession::AbortExchange()
 
 void CASESession::DiscardExchange()
 {
+    if (mExchangeCtxt != nullptr && mExchangeCtxt->IsSendExpected())
+    {
+        // The exchange was kept open for a message that the crypto worker was
+        // to let us send. Nobody will send it now, so close the exchange.
+        mExchangeCtxt->Close();
+        mExchangeCtxt = nullptr;
+    }
     if (mExchangeCtxt != nullptr)
     {
         // Make sure the exchange doesn't try to notify us when it closes,
@@ -612,6 +718,31 @@ CHIP_ERROR CASESession::HandleSigma1(System::PacketBufferHandle && msg)
     // mRemotePubKey.Length() == initiatorPubKey.size() == kP256_PublicKey_Length.
     memcpy(mRemotePubKey.Bytes(), initiatorPubKey.data(), mRemotePubKey.Length());
 
+    VerifyOrExit(mFabricInfo != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+#ifndef ENABLE_HSM_CASE_EPHEMERAL_KEY
+    if (mCryptoWorker != nullptr)
+    {
+        chip::Platform::UniquePtr<EphemeralKeyJob> job(chip::Platform::New<EphemeralKeyJob>(*this, mRemotePubKey));
+        VerifyOrExit(job, err = CHIP_ERROR_NO_MEMORY);
+        SuccessOrExit(err = PostCryptoJob(*job, State::kGeneratingSigma2));
+        job.release();
+
+        // Sigma2 is sent once the job completes, see SendSigma2WithEphemeralKey.
+        mDelegate->OnSessionEstablishmentStarted();
+        return CHIP_NO_ERROR;
+    }
+#endif
+
+    // Generate an ephemeral keypair
+#ifdef ENABLE_HSM_CASE_EPHEMERAL_KEY
+    mEphemeralKey.SetKeyId(CASE_EPHEMERAL_KEY);
+#endif
+    SuccessOrExit(err = mEphemeralKey.Initialize());
+
+    // Generate a Shared Secret
+    SuccessOrExit(err = mEphemeralKey.ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+
     SuccessOrExit(err = SendSigma2());
 
     mDelegate->OnSessionEstablishmentStarted();
@@ -703,15 +834,6 @@ CHIP_ERROR CASESession::SendSigma2()
     uint8_t msg_rand[kSigmaParamRandomNumberSize];
     ReturnErrorOnFailure(DRBG_get_bytes(&msg_rand[0], sizeof(msg_rand)));
 
-    // Generate an ephemeral keypair
-#ifdef ENABLE_HSM_CASE_EPHEMERAL_KEY
-    mEphemeralKey.SetKeyId(CASE_EPHEMERAL_KEY);
-#endif
-    ReturnErrorOnFailure(mEphemeralKey.Initialize());
-
-    // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey.ECDH_derive_secret(mRemotePubKey, mSharedSecret));
-
     uint8_t msg_salt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
 
     MutableByteSpan saltSpan(msg_salt);
@@ -815,6 +937,28 @@ CHIP_ERROR CASESession::SendSigma2()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::SendSigma2WithEphemeralKey(EphemeralKeyJob & job)
+{
+    MATTER_TRACE_EVENT_SCOPE("SendSigma2WithEphemeralKey", "CASESession");
+    CHIP_ERROR err = job.mError;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mEphemeralKey.Deserialize(job.mEphemeralKey);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        mSharedSecret = job.mSharedSecret;
+        err           = SendSigma2();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
+
 CHIP_ERROR CASESession::HandleSigma2Resume(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_EVENT_SCOPE("HandleSigma2Resume", "CASESession");
@@ -884,6 +1028,12 @@ CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle &
 {
     MATTER_TRACE_EVENT_SCOPE("HandleSigma2_and_SendSigma3", "CASESession");
     ReturnErrorOnFailure(HandleSigma2(std::move(msg)));
+
+    if (mState == State::kValidatingSigma2)
+    {
+        // Sigma3 is sent once the crypto worker has validated Sigma2, see OnCryptoJobComplete.
+        return CHIP_NO_ERROR;
+    }
     ReturnErrorOnFailure(SendSigma3());
 
     return CHIP_NO_ERROR;
@@ -902,25 +1052,16 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
 
     uint8_t msg_salt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R2_Encrypted;
+    chip::Platform::UniquePtr<PeerValidationJob> job;
     size_t msg_r2_encrypted_len          = 0;
     size_t msg_r2_encrypted_len_with_tag = 0;
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R2_Signed;
-    size_t msg_r2_signed_len;
     size_t max_msg_r2_signed_enc_len;
     constexpr size_t kCaseOverheadForFutureTbeData = 128;
 
     uint8_t sr2k[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
 
-    P256ECDSASignature tbsData2Signature;
-
-    NodeId responderNodeId;
-    P256PublicKey responderPublicKey;
-
     uint8_t responderRandom[kSigmaParamRandomNumberSize];
-    ByteSpan responderNOC;
-    ByteSpan responderICAC;
 
     uint16_t responderSessionId;
 
@@ -928,6 +1069,9 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
 
     ChipLogProgress(SecureChannel, "Received Sigma2 msg");
 
+    job.reset(chip::Platform::New<PeerValidationJob>(*this));
+    VerifyOrExit(job, err = CHIP_ERROR_NO_MEMORY);
+
     tlvReader.Init(std::move(msg));
     SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag()));
     SuccessOrExit(err = tlvReader.EnterContainer(containerType));
@@ -968,78 +1112,88 @@ CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
     SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma2_Encrypted2)));
 
     max_msg_r2_signed_enc_len =
-        TLV::EstimateStructOverhead(Credentials::kMaxCHIPCertLength, Credentials::kMaxCHIPCertLength, tbsData2Signature.Length(),
+        TLV::EstimateStructOverhead(Credentials::kMaxCHIPCertLength, Credentials::kMaxCHIPCertLength, job->mSignature.Length(),
                                     SessionResumptionStorage::kResumptionIdSize, kCaseOverheadForFutureTbeData);
     msg_r2_encrypted_len_with_tag = tlvReader.GetLength();
 
     // Validate we did not receive a buffer larger than legal
     VerifyOrExit(msg_r2_encrypted_len_with_tag <= max_msg_r2_signed_enc_len, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
     VerifyOrExit(msg_r2_encrypted_len_with_tag > CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    VerifyOrExit(msg_R2_Encrypted.Alloc(msg_r2_encrypted_len_with_tag), err = CHIP_ERROR_NO_MEMORY);
+    VerifyOrExit(job->mTBEData.Alloc(msg_r2_encrypted_len_with_tag), err = CHIP_ERROR_NO_MEMORY);
 
-    SuccessOrExit(err = tlvReader.GetBytes(msg_R2_Encrypted.Get(), static_cast<uint32_t>(msg_r2_encrypted_len_with_tag)));
+    SuccessOrExit(err = tlvReader.GetBytes(job->mTBEData.Get(), static_cast<uint32_t>(msg_r2_encrypted_len_with_tag)));
     msg_r2_encrypted_len = msg_r2_encrypted_len_with_tag - CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
 
-    SuccessOrExit(err = AES_CCM_decrypt(msg_R2_Encrypted.Get(), msg_r2_encrypted_len, nullptr, 0,
-                                        msg_R2_Encrypted.Get() + msg_r2_encrypted_len, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, sr2k,
+    SuccessOrExit(err = AES_CCM_decrypt(job->mTBEData.Get(), msg_r2_encrypted_len, nullptr, 0,
+                                        job->mTBEData.Get() + msg_r2_encrypted_len, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, sr2k,
                                         CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES, kTBEData2_Nonce, kTBEDataNonceLength,
-                                        msg_R2_Encrypted.Get()));
+                                        job->mTBEData.Get()));
 
-    decryptedDataTlvReader.Init(msg_R2_Encrypted.Get(), msg_r2_encrypted_len);
+    decryptedDataTlvReader.Init(job->mTBEData.Get(), msg_r2_encrypted_len);
     containerType = TLV::kTLVType_Structure;
     SuccessOrExit(err = decryptedDataTlvReader.Next(containerType, TLV::AnonymousTag()));
     SuccessOrExit(err = decryptedDataTlvReader.EnterContainer(containerType));
 
     SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
-    SuccessOrExit(err = decryptedDataTlvReader.Get(responderNOC));
+    SuccessOrExit(err = decryptedDataTlvReader.Get(job->mPeerNOC));
 
     SuccessOrExit(err = decryptedDataTlvReader.Next());
     if (TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_SenderICAC)
     {
         VerifyOrExit(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, err = CHIP_ERROR_WRONG_TLV_TYPE);
-        SuccessOrExit(err = decryptedDataTlvReader.Get(responderICAC));
+        SuccessOrExit(err = decryptedDataTlvReader.Get(job->mPeerICAC));
         SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
     }
 
-    // Validate responder identity located in msg_r2_encrypted
-    // Constructing responder identity
-    SuccessOrExit(err = ValidatePeerIdentity(responderNOC, responderICAC, responderNodeId, responderPublicKey));
-
-    // Verify that responderNodeId (from responderNOC) matches one that was included
-    // in the computation of the Destination Identifier when generating Sigma1.
-    VerifyOrReturnError(mPeerNodeId == responderNodeId, CHIP_ERROR_INVALID_CASE_PARAMETER);
-
-    // Construct msg_R2_Signed and validate the signature in msg_r2_encrypted
-    msg_r2_signed_len = TLV::EstimateStructOverhead(sizeof(uint16_t), responderNOC.size(), responderICAC.size(),
-                                                    kP256_PublicKey_Length, kP256_PublicKey_Length);
-
-    VerifyOrExit(msg_R2_Signed.Alloc(msg_r2_signed_len), err = CHIP_ERROR_NO_MEMORY);
-
-    SuccessOrExit(err = ConstructTBSData(responderNOC, responderICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                         ByteSpan(mEphemeralKey.Pubkey(), mEphemeralKey.Pubkey().Length()), msg_R2_Signed.Get(),
-                                         msg_r2_signed_len));
-
     VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature, err = CHIP_ERROR_INVALID_TLV_TAG);
-    VerifyOrExit(tbsData2Signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    tbsData2Signature.SetLength(decryptedDataTlvReader.GetLength());
-    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(tbsData2Signature, tbsData2Signature.Length()));
-
-    // Validate signature
-    SuccessOrExit(err = responderPublicKey.ECDSA_validate_msg_signature(msg_R2_Signed.Get(), msg_r2_signed_len, tbsData2Signature));
+    VerifyOrExit(job->mSignature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+    job->mSignature.SetLength(decryptedDataTlvReader.GetLength());
+    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(job->mSignature, job->mSignature.Length()));
 
     // Retrieve session resumption ID
     SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_ResumptionID)));
     SuccessOrExit(err = decryptedDataTlvReader.GetBytes(mNewResumptionId.data(), mNewResumptionId.size()));
 
-    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
-    SuccessOrExit(err = ExtractCATsFromOpCert(responderNOC, mPeerCATs));
-
     // Retrieve responderMRPParams if present
     if (tlvReader.Next() != CHIP_END_OF_TLV)
     {
         SuccessOrExit(err = DecodeMRPParametersIfPresent(TLV::ContextTag(kTag_Sigma2_ResponderMRPParams), tlvReader));
     }
 
+    // Validate responder identity located in msg_r2_encrypted, and the signature of msg_R2_Signed
+    SuccessOrExit(err = PreparePeerValidation(*job));
+
+    if (mCryptoWorker != nullptr)
+    {
+        SuccessOrExit(err = PostCryptoJob(*job, State::kValidatingSigma2));
+        job.release();
+        return CHIP_NO_ERROR;
+    }
+
+    job->Run();
+    return HandleSigma2Validated(*job);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+    }
+    return err;
+}
+
+CHIP_ERROR CASESession::HandleSigma2Validated(PeerValidationJob & job)
+{
+    MATTER_TRACE_EVENT_SCOPE("HandleSigma2Validated", "CASESession");
+    CHIP_ERROR err = job.mError;
+    SuccessOrExit(err);
+
+    // Verify that responderNodeId (from responderNOC) matches one that was included
+    // in the computation of the Destination Identifier when generating Sigma1.
+    VerifyOrExit(mPeerNodeId == job.mPeerNodeId, err = CHIP_ERROR_INVALID_CASE_PARAMETER);
+
+    // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
+    SuccessOrExit(err = ExtractCATsFromOpCert(job.mPeerNOC, mPeerCATs));
+
 exit:
     if (err != CHIP_NO_ERROR)
     {
@@ -1184,7 +1338,6 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_EVENT_SCOPE("HandleSigma3", "CASESession");
     CHIP_ERROR err = CHIP_NO_ERROR;
-    MutableByteSpan messageDigestSpan(mMessageDigest);
     System::PacketBufferTLVReader tlvReader;
     TLV::TLVReader decryptedDataTlvReader;
     TLV::TLVType containerType = TLV::kTLVType_Structure;
@@ -1194,34 +1347,27 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
 
     constexpr size_t kCaseOverheadForFutureTbeData = 128;
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R3_Encrypted;
+    chip::Platform::UniquePtr<PeerValidationJob> job;
     size_t msg_r3_encrypted_len          = 0;
     size_t msg_r3_encrypted_len_with_tag = 0;
     size_t max_msg_r3_signed_enc_len;
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R3_Signed;
-    size_t msg_r3_signed_len;
 
     uint8_t sr3k[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
 
-    P256ECDSASignature tbsData3Signature;
-
-    NodeId initiatorNodeId;
-    P256PublicKey initiatorPublicKey;
-
-    ByteSpan initiatorNOC;
-    ByteSpan initiatorICAC;
-
     uint8_t msg_salt[kIPKSize + kSHA256_Hash_Length];
 
     ChipLogProgress(SecureChannel, "Received Sigma3 msg");
 
+    job.reset(chip::Platform::New<PeerValidationJob>(*this));
+    VerifyOrExit(job, err = CHIP_ERROR_NO_MEMORY);
+
     tlvReader.Init(std::move(msg));
     SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag()));
     SuccessOrExit(err = tlvReader.EnterContainer(containerType));
 
     // Fetch encrypted data
     max_msg_r3_signed_enc_len = TLV::EstimateStructOverhead(Credentials::kMaxCHIPCertLength, Credentials::kMaxCHIPCertLength,
-                                                            tbsData3Signature.Length(), kCaseOverheadForFutureTbeData);
+                                                            job->mSignature.Length(), kCaseOverheadForFutureTbeData);
 
     SuccessOrExit(err = tlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_Sigma3_Encrypted3)));
 
@@ -1231,8 +1377,8 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
     VerifyOrExit(msg_r3_encrypted_len_with_tag <= max_msg_r3_signed_enc_len, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
     VerifyOrExit(msg_r3_encrypted_len_with_tag > CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-    VerifyOrExit(msg_R3_Encrypted.Alloc(msg_r3_encrypted_len_with_tag), err = CHIP_ERROR_NO_MEMORY);
-    SuccessOrExit(err = tlvReader.GetBytes(msg_R3_Encrypted.Get(), static_cast<uint32_t>(msg_r3_encrypted_len_with_tag)));
+    VerifyOrExit(job->mTBEData.Alloc(msg_r3_encrypted_len_with_tag), err = CHIP_ERROR_NO_MEMORY);
+    SuccessOrExit(err = tlvReader.GetBytes(job->mTBEData.Get(), static_cast<uint32_t>(msg_r3_encrypted_len_with_tag)));
     msg_r3_encrypted_len = msg_r3_encrypted_len_with_tag - CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
 
     // Step 1
@@ -1250,70 +1396,67 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
     SuccessOrExit(err = mCommissioningHash.AddData(ByteSpan{ buf, bufLen }));
 
     // Step 2 - Decrypt data blob
-    SuccessOrExit(err = AES_CCM_decrypt(msg_R3_Encrypted.Get(), msg_r3_encrypted_len, nullptr, 0,
-                                        msg_R3_Encrypted.Get() + msg_r3_encrypted_len, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, sr3k,
+    SuccessOrExit(err = AES_CCM_decrypt(job->mTBEData.Get(), msg_r3_encrypted_len, nullptr, 0,
+                                        job->mTBEData.Get() + msg_r3_encrypted_len, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, sr3k,
                                         CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES, kTBEData3_Nonce, kTBEDataNonceLength,
-                                        msg_R3_Encrypted.Get()));
+                                        job->mTBEData.Get()));
 
-    decryptedDataTlvReader.Init(msg_R3_Encrypted.Get(), msg_r3_encrypted_len);
+    decryptedDataTlvReader.Init(job->mTBEData.Get(), msg_r3_encrypted_len);
     containerType = TLV::kTLVType_Structure;
     SuccessOrExit(err = decryptedDataTlvReader.Next(containerType, TLV::AnonymousTag()));
     SuccessOrExit(err = decryptedDataTlvReader.EnterContainer(containerType));
 
     SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
-    SuccessOrExit(err = decryptedDataTlvReader.Get(initiatorNOC));
+    SuccessOrExit(err = decryptedDataTlvReader.Get(job->mPeerNOC));
 
     SuccessOrExit(err = decryptedDataTlvReader.Next());
     if (TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_SenderICAC)
     {
         VerifyOrExit(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, err = CHIP_ERROR_WRONG_TLV_TYPE);
-        SuccessOrExit(err = decryptedDataTlvReader.Get(initiatorICAC));
+        SuccessOrExit(err = decryptedDataTlvReader.Get(job->mPeerICAC));
         SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
     }
 
-    // Step 5/6
-    // Validate initiator identity located in msg->Start()
-    // Constructing responder identity
-    SuccessOrExit(err = ValidatePeerIdentity(initiatorNOC, initiatorICAC, initiatorNodeId, initiatorPublicKey));
-    mPeerNodeId = initiatorNodeId;
-
-    // Step 4 - Construct Sigma3 TBS Data
-    msg_r3_signed_len = TLV::EstimateStructOverhead(sizeof(uint16_t), initiatorNOC.size(), initiatorICAC.size(),
-                                                    kP256_PublicKey_Length, kP256_PublicKey_Length);
+    VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature, err = CHIP_ERROR_INVALID_TLV_TAG);
+    VerifyOrExit(job->mSignature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+    job->mSignature.SetLength(decryptedDataTlvReader.GetLength());
+    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(job->mSignature, job->mSignature.Length()));
 
-    VerifyOrExit(msg_R3_Signed.Alloc(msg_r3_signed_len), err = CHIP_ERROR_NO_MEMORY);
+    // Step 4 to 7 - Validate initiator identity located in msg->Start(), and the signature of the Sigma3 TBS data
+    SuccessOrExit(err = PreparePeerValidation(*job));
 
-    SuccessOrExit(err = ConstructTBSData(initiatorNOC, initiatorICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                         ByteSpan(mEphemeralKey.Pubkey(), mEphemeralKey.Pubkey().Length()), msg_R3_Signed.Get(),
-                                         msg_r3_signed_len));
+    if (mCryptoWorker != nullptr)
+    {
+        SuccessOrExit(err = PostCryptoJob(*job, State::kValidatingSigma3));
+        job.release();
+        return CHIP_NO_ERROR;
+    }
 
-    VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature, err = CHIP_ERROR_INVALID_TLV_TAG);
-    VerifyOrExit(tbsData3Signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    tbsData3Signature.SetLength(decryptedDataTlvReader.GetLength());
-    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(tbsData3Signature, tbsData3Signature.Length()));
+    job->Run();
+    return HandleSigma3Validated(*job);
 
-    // TODO - Validate message signature prior to validating the received operational credentials.
-    //        The op cert check requires traversal of cert chain, that is a more expensive operation.
-    //        If message signature check fails, the cert chain check will be unnecessary, but with the
-    //        current flow of code, a malicious node can trigger a DoS style attack on the device.
-    //        The same change should be made in Sigma2 processing.
-    // Step 7 - Validate Signature
-#ifdef ENABLE_HSM_ECDSA_VERIFY
+exit:
+    if (err != CHIP_NO_ERROR)
     {
-        P256PublicKeyHSM initiatorPublicKeyHSM;
-        memcpy(Uint8::to_uchar(initiatorPublicKeyHSM), initiatorPublicKey.Bytes(), initiatorPublicKey.Length());
-        SuccessOrExit(
-            err = initiatorPublicKeyHSM.ECDSA_validate_msg_signature(msg_R3_Signed.Get(), msg_r3_signed_len, tbsData3Signature));
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
     }
-#else
-    SuccessOrExit(err = initiatorPublicKey.ECDSA_validate_msg_signature(msg_R3_Signed.Get(), msg_r3_signed_len, tbsData3Signature));
-#endif
+    return err;
+}
+
+CHIP_ERROR CASESession::HandleSigma3Validated(PeerValidationJob & job)
+{
+    MATTER_TRACE_EVENT_SCOPE("HandleSigma3Validated", "CASESession");
+    MutableByteSpan messageDigestSpan(mMessageDigest);
+    CHIP_ERROR err = job.mError;
+    SuccessOrExit(err);
+
+    mPeerNodeId = job.mPeerNodeId;
 
     SuccessOrExit(err = mCommissioningHash.Finish(messageDigestSpan));
 
     // Retrieve peer CASE Authenticated Tags (CATs) from peer's NOC.
     {
-        SuccessOrExit(err = ExtractCATsFromOpCert(initiatorNOC, mPeerCATs));
+        SuccessOrExit(err = ExtractCATsFromOpCert(job.mPeerNOC, mPeerCATs));
     }
 
     if (mSessionResumptionStorage != nullptr)
@@ -1432,24 +1575,91 @@ CHIP_ERROR CASESession::ValidateSigmaResumeMIC(const ByteSpan & resumeMIC, const
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASESession::ValidatePeerIdentity(const ByteSpan & peerNOC, const ByteSpan & peerICAC, NodeId & peerNodeId,
-                                             Crypto::P256PublicKey & peerPublicKey)
+CHIP_ERROR CASESession::PreparePeerValidation(PeerValidationJob & job)
 {
     ReturnErrorCodeIf(mFabricInfo == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
     ReturnErrorOnFailure(SetEffectiveTime());
+    job.mValidContext = mValidContext;
+    job.mFabricId     = mFabricInfo->GetFabricId();
+
+    // Copy the root certificate, since the fabric may change while the job runs on the crypto worker.
+    ByteSpan rootCert;
+    ReturnErrorOnFailure(mFabricInfo->GetRootCert(rootCert));
+    MutableByteSpan rootCertCopy(job.mRootCertBuffer);
+    ReturnErrorOnFailure(CopySpanToMutableSpan(rootCert, rootCertCopy));
+    job.mRootCert = rootCertCopy;
+
+    // Construct the TBS data signed by the peer
+    job.mTBSDataLength = TLV::EstimateStructOverhead(sizeof(uint16_t), job.mPeerNOC.size(), job.mPeerICAC.size(),
+                                                     kP256_PublicKey_Length, kP256_PublicKey_Length);
+    VerifyOrReturnError(job.mTBSData.Alloc(job.mTBSDataLength), CHIP_ERROR_NO_MEMORY);
+
+    return ConstructTBSData(job.mPeerNOC, job.mPeerICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
+                            ByteSpan(mEphemeralKey.Pubkey(), mEphemeralKey.Pubkey().Length()), job.mTBSData.Get(),
+                            job.mTBSDataLength);
+}
 
-    PeerId peerId;
-    FabricId peerNOCFabricId;
-    ReturnErrorOnFailure(mFabricInfo->VerifyCredentials(peerNOC, peerICAC, mValidContext, peerId, peerNOCFabricId, peerPublicKey));
-
-    VerifyOrReturnError(mFabricInfo->GetFabricId() == peerNOCFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
+CHIP_ERROR CASESession::PostCryptoJob(CryptoJob & job, State pendingState)
+{
+    ReturnErrorOnFailure(mCryptoWorker->Post(job));
 
-    peerNodeId = peerId.GetNodeId();
+    mPendingCryptoJob = &job;
+    mState            = pendingState;
 
+    // Keep the exchange open until the job completes and the handshake sends its next message.
+    mExchangeCtxt->WillSendMessage();
     return CHIP_NO_ERROR;
 }
 
+void CASESession::OnCryptoJobComplete(CryptoJob & job)
+{
+    MATTER_TRACE_EVENT_SCOPE("OnCryptoJobComplete", "CASESession");
+    mPendingCryptoJob = nullptr;
+
+    if (mExchangeCtxt == nullptr)
+    {
+        ChipLogError(SecureChannel, "CASESession exchange went away while the crypto worker was running");
+        Clear();
+        // Do this last in case the delegate frees us.
+        mDelegate->OnSessionEstablishmentError(CHIP_ERROR_INCORRECT_STATE);
+        return;
+    }
+
+    // Hold on to the exchange while the handshake resumes, as ExchangeContext::HandleMessage does for the
+    // message handlers: sending the last message of the handshake closes it.
+    ExchangeHandle exchange(*mExchangeCtxt);
+
+    CHIP_ERROR err = CHIP_ERROR_INCORRECT_STATE;
+    switch (mState)
+    {
+    case State::kGeneratingSigma2:
+        err = SendSigma2WithEphemeralKey(static_cast<EphemeralKeyJob &>(job));
+        break;
+    case State::kValidatingSigma2:
+        err = HandleSigma2Validated(static_cast<PeerValidationJob &>(job));
+        if (err == CHIP_NO_ERROR)
+        {
+            err = SendSigma3();
+        }
+        break;
+    case State::kValidatingSigma3:
+        err = HandleSigma3Validated(static_cast<PeerValidationJob &>(job));
+        break;
+    default:
+        break;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "CASESession failed after crypto worker completion: %" CHIP_ERROR_FORMAT, err.Format());
+        DiscardExchange();
+        Clear();
+        // Do this last in case the delegate frees us.
+        mDelegate->OnSessionEstablishmentError(err);
+    }
+}
+
 CHIP_ERROR CASESession::ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
                                          const ByteSpan & receiverPubKey, uint8_t * tbsData, size_t & tbsDataLen)
 {
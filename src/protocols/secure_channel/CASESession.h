@@ -39,6 +39,7 @@
 #include <protocols/secure_channel/CASEDestinationId.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/SessionEstablishmentDelegate.h>
+#include <protocols/secure_channel/SessionCryptoWorker.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <protocols/secure_channel/SessionResumptionStorage.h>
 #include <system/SystemPacketBuffer.h>
@@ -111,6 +112,17 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+    /**
+     * @brief Set the worker that runs the expensive crypto of the handshake off the event loop.
+     *
+     * With a worker, the ephemeral key generation and ECDH of Sigma2, and the validation of the peer's
+     * credentials and signature in Sigma2 and Sigma3, run on the worker while the event loop goes on. The
+     * handshake resumes once the worker is done.
+     *
+     * @param cryptoWorker - Pointer to the worker, or nullptr (the default) to run everything synchronously.
+     */
+    void SetCryptoWorker(SessionCryptoWorker * cryptoWorker) { mCryptoWorker = cryptoWorker; }
+
     /**
      * Parse a sigma1 message.  This function will return success only if the
      * message passes schema checks.  Specifically:
@@ -173,8 +185,17 @@ private:
         kSentSigma2Resume  = 5,
         kFinished          = 6,
         kFinishedViaResume = 7,
+        // Waiting for the crypto worker
+        kGeneratingSigma2 = 8,
+        kValidatingSigma2 = 9,
+        kValidatingSigma3 = 10,
     };
 
+    // Work handed to the crypto worker, defined in CASESession.cpp.
+    class CryptoJob;
+    class EphemeralKeyJob;
+    class PeerValidationJob;
+
     CHIP_ERROR Init(SessionManager & sessionManager, SessionEstablishmentDelegate * delegate);
 
     // On success, sets mIpk to the correct value for outgoing Sigma1 based on internal state
@@ -191,16 +212,19 @@ private:
     CHIP_ERROR SendSigma2();
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma2Validated(PeerValidationJob & job);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
     CHIP_ERROR SendSigma3();
     CHIP_ERROR HandleSigma3(System::PacketBufferHandle && msg);
+    CHIP_ERROR HandleSigma3Validated(PeerValidationJob & job);
 
     CHIP_ERROR SendSigma2Resume();
+    CHIP_ERROR SendSigma2WithEphemeralKey(EphemeralKeyJob & job);
 
     CHIP_ERROR ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
                                    MutableByteSpan & salt);
-    CHIP_ERROR ValidatePeerIdentity(const ByteSpan & peerNOC, const ByteSpan & peerICAC, NodeId & peerNodeId,
-                                    Crypto::P256PublicKey & peerPublicKey);
+    // Fills in the root certificate, validation context and signed data of a job whose peer credentials are set.
+    CHIP_ERROR PreparePeerValidation(PeerValidationJob & job);
     CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
                                 const ByteSpan & receiverPubKey, uint8_t * tbsData, size_t & tbsDataLen);
     CHIP_ERROR ConstructSaltSigma3(const ByteSpan & ipk, MutableByteSpan & salt);
@@ -213,6 +237,10 @@ private:
     CHIP_ERROR ValidateSigmaResumeMIC(const ByteSpan & resumeMIC, const ByteSpan & initiatorRandom, const ByteSpan & resumptionID,
                                       const ByteSpan & skInfo, const ByteSpan & nonce);
 
+    // Hands the job to the crypto worker. On success, the handshake waits in pendingState until OnCryptoJobComplete.
+    CHIP_ERROR PostCryptoJob(CryptoJob & job, State pendingState);
+    void OnCryptoJobComplete(CryptoJob & job);
+
     void OnSuccessStatusReport() override;
     CHIP_ERROR OnFailureStatusReport(Protocols::SecureChannel::GeneralStatusCode generalCode, uint16_t protocolCode) override;
 
@@ -246,6 +274,8 @@ private:
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    SessionCryptoWorker * mCryptoWorker                 = nullptr;
+    CryptoJob * mPendingCryptoJob                       = nullptr;
 
     uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
     uint8_t mIPK[kIPKSize];
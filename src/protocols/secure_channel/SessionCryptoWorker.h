@@ -0,0 +1,76 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the interface through which session establishment
+ *      runs its expensive asymmetric crypto away from the CHIP event loop.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/DLLUtil.h>
+
+namespace chip {
+
+/**
+ * Runs the expensive steps of session establishment (ephemeral key generation, ECDH, certificate chain and
+ * signature validation) off the CHIP event loop, so that a handshake does not stall everything else the
+ * device is doing.
+ *
+ * A session hands the worker a job holding copies of everything the step needs. The worker calls Run() on
+ * some other thread, then Complete() back on the CHIP event loop, where the session resumes.
+ */
+class DLL_EXPORT SessionCryptoWorker
+{
+public:
+    class Job
+    {
+    public:
+        virtual ~Job() = default;
+
+        /**
+         * Called on a worker thread. Must only touch the job itself: the session that posted it may be
+         * gone by then.
+         */
+        virtual void Run() = 0;
+
+        /**
+         * Called instead of Run() when the worker shuts down before running the job. The job must then
+         * report an error from Complete().
+         */
+        virtual void Cancel() = 0;
+
+        /**
+         * Called on the CHIP event loop once Run() or Cancel() has returned. The job deletes itself.
+         */
+        virtual void Complete() = 0;
+    };
+
+    virtual ~SessionCryptoWorker() = default;
+
+    /**
+     * Queues the job. On success, the worker calls Complete() exactly once, and never from within Post(),
+     * even if it shuts down first. On failure, the caller keeps the job.
+     */
+    virtual CHIP_ERROR Post(Job & job) = 0;
+};
+
+} // namespace chip
@@ -37,6 +37,11 @@
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/CASESession.h>
 #include <stdarg.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 #include "credentials/tests/CHIPCert_test_vectors.h"
 
@@ -49,6 +54,7 @@ using namespace chip::Inet;
 using namespace chip::Transport;
 using namespace chip::Messaging;
 using namespace chip::Protocols;
+using namespace chip::System::Clock::Literals;
 
 using TestContext = Test::LoopbackMessagingContext;
 
@@ -89,15 +95,6 @@ public:
     uint32_t mNumPairingComplete = 0;
 };
 
-class CASEServerForTest : public CASEServer
-{
-public:
-    CASESession & GetSession() override { return mCaseSession; }
-
-private:
-    CASESession mCaseSession;
-};
-
 CHIP_ERROR InitTestIpk(GroupDataProvider & groupDataProvider, const FabricInfo & fabricInfo, size_t numIpks)
 {
     VerifyOrReturnError((numIpks > 0) && (numIpks <= 3), CHIP_ERROR_INVALID_ARGUMENT);
@@ -292,7 +289,7 @@ void CASE_SecurePairingHandshakeTest(nlTestSuite * inSuite, void * inContext)
     CASE_SecurePairingHandshakeTestCommon(inSuite, inContext, pairingCommissioner, delegateCommissioner);
 }
 
-CASEServerForTest gPairingServer;
+CASEServer gPairingServer;
 
 void CASE_SecurePairingHandshakeServerTest(nlTestSuite * inSuite, void * inContext)
 {
@@ -345,6 +342,320 @@ void CASE_SecurePairingHandshakeServerTest(nlTestSuite * inSuite, void * inConte
     chip::Platform::Delete(pairingCommissioner1);
 }
 
+void CASE_ConcurrentHandshakesServerTest(nlTestSuite * inSuite, void * inContext)
+{
+    // One more initiator than the server can handle at once.
+    constexpr size_t kInitiatorCount = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES + 1;
+
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.ListenForSessionEstablishment(&ctx.GetExchangeManager(), &ctx.GetSecureSessionManager(),
+                                                                &gDeviceFabrics, nullptr,
+                                                                &gDeviceGroupDataProvider) == CHIP_NO_ERROR);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    CASESession * initiators[kInitiatorCount];
+    TestCASESecurePairingDelegate delegates[kInitiatorCount];
+
+    // Every Sigma1 is sent before the server handles any of them.
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kInitiatorCount; ++i)
+    {
+        initiators[i] = chip::Platform::New<CASESession>();
+        initiators[i]->SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        ExchangeContext * exchange = ctx.NewUnauthenticatedExchangeToBob(initiators[i]);
+        NL_TEST_ASSERT(inSuite,
+                       initiators[i]->EstablishSession(ctx.GetSecureSessionManager(), fabric, Node01_01, exchange, nullptr,
+                                                       &delegates[i]) == CHIP_NO_ERROR);
+    }
+    ctx.DrainAndServiceIO();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    size_t establishedCount = 0;
+    for (size_t i = 0; i < kInitiatorCount; ++i)
+    {
+        NL_TEST_ASSERT(inSuite, delegates[i].mNumPairingErrors == 0);
+        establishedCount += delegates[i].mNumPairingComplete;
+    }
+    NL_TEST_ASSERT(inSuite, establishedCount == CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveHandshakeCount() == 0);
+
+    printf("%u concurrent CASE session establishments: %.1f ms\n", static_cast<unsigned>(establishedCount),
+           static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) / 1000);
+
+    // The extra Sigma1 was dropped, and is still waiting to be retransmitted.
+    NL_TEST_ASSERT(inSuite, delegates[kInitiatorCount - 1].mNumPairingComplete == 0);
+    for (auto * initiator : initiators)
+    {
+        chip::Platform::Delete(initiator);
+    }
+}
+
+void CASE_StaleHandshakeEvictionTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.ListenForSessionEstablishment(&ctx.GetExchangeManager(), &ctx.GetSecureSessionManager(),
+                                                                &gDeviceFabrics, nullptr,
+                                                                &gDeviceGroupDataProvider) == CHIP_NO_ERROR);
+
+    System::Clock::Internal::MockClock clock;
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::SetSystemClockForTesting(&clock);
+    clock.SetMonotonic(System::Clock::Milliseconds64(1000));
+
+    // Sigma1 messages whose exchange never reaches the handshake, which then lingers until evicted.
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+    ExchangeDelegate * delegates[CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES];
+    for (auto & delegate : delegates)
+    {
+        NL_TEST_ASSERT(inSuite, gPairingServer.OnUnsolicitedMessageReceived(payloadHeader, delegate) == CHIP_NO_ERROR);
+        clock.AdvanceMonotonic(System::Clock::Milliseconds64(1));
+    }
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveHandshakeCount() == CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES);
+
+    // Too recent to be evicted.
+    ExchangeDelegate * delegate = nullptr;
+    NL_TEST_ASSERT(inSuite, gPairingServer.OnUnsolicitedMessageReceived(payloadHeader, delegate) == CHIP_ERROR_NO_MEMORY);
+
+    // The oldest handshake is evicted once stale.
+    clock.AdvanceMonotonic(CHIP_CONFIG_CASE_SERVER_STALE_HANDSHAKE_TIMEOUT);
+    NL_TEST_ASSERT(inSuite, gPairingServer.OnUnsolicitedMessageReceived(payloadHeader, delegate) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegate == delegates[0]);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveHandshakeCount() == CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES);
+
+    gPairingServer.OnExchangeCreationFailed(delegate);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveHandshakeCount() == CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES - 1);
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+
+    // Listening again releases the remaining handshakes.
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.ListenForSessionEstablishment(&ctx.GetExchangeManager(), &ctx.GetSecureSessionManager(),
+                                                                &gDeviceFabrics, nullptr,
+                                                                &gDeviceGroupDataProvider) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveHandshakeCount() == 0);
+}
+
+namespace {
+
+// Runs each job on a thread of its own when asked to, then completes it on the test thread.
+class TestCryptoWorker : public SessionCryptoWorker
+{
+public:
+    CHIP_ERROR Post(Job & job) override
+    {
+        VerifyOrReturnError(mJobCount < ArraySize(mJobs), CHIP_ERROR_NO_MEMORY);
+        mJobs[mJobCount++] = &job;
+        return CHIP_NO_ERROR;
+    }
+
+    size_t PendingJobCount() const { return mJobCount; }
+
+    // Returns the longest time the test thread spent completing a job.
+    std::chrono::steady_clock::duration RunPendingJobs()
+    {
+        std::chrono::steady_clock::duration longest{};
+        size_t jobCount = mJobCount;
+        mJobCount       = 0;
+        for (size_t i = 0; i < jobCount; ++i)
+        {
+            Job * job = mJobs[i];
+            std::thread worker([job]() { job->Run(); });
+            worker.join();
+
+            auto start = std::chrono::steady_clock::now();
+            job->Complete();
+            longest = std::max(longest, std::chrono::steady_clock::now() - start);
+        }
+        return longest;
+    }
+
+    // Cancels the pending jobs, as a worker shutting down does.
+    void CancelPendingJobs()
+    {
+        size_t jobCount = mJobCount;
+        mJobCount       = 0;
+        for (size_t i = 0; i < jobCount; ++i)
+        {
+            mJobs[i]->Cancel();
+            mJobs[i]->Complete();
+        }
+    }
+
+private:
+    Job * mJobs[2 * CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES];
+    size_t mJobCount = 0;
+};
+
+// Establishes a session with gPairingServer, and returns the longest step the event loop took.
+std::chrono::steady_clock::duration EstablishWithServer(nlTestSuite * inSuite, TestContext & ctx, TestCryptoWorker * worker)
+{
+    gPairingServer.SetCryptoWorker(worker);
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.ListenForSessionEstablishment(&ctx.GetExchangeManager(), &ctx.GetSecureSessionManager(),
+                                                                &gDeviceFabrics, nullptr,
+                                                                &gDeviceGroupDataProvider) == CHIP_NO_ERROR);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    TestCASESecurePairingDelegate delegate;
+    CASESession initiator;
+    initiator.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    initiator.SetCryptoWorker(worker);
+
+    ExchangeContext * exchange = ctx.NewUnauthenticatedExchangeToBob(&initiator);
+    NL_TEST_ASSERT(inSuite,
+                   initiator.EstablishSession(ctx.GetSecureSessionManager(), fabric, Node01_01, exchange, nullptr, &delegate) ==
+                       CHIP_NO_ERROR);
+
+    std::chrono::steady_clock::duration longest{};
+    bool ranJobs;
+    do
+    {
+        auto start = std::chrono::steady_clock::now();
+        ctx.DrainAndServiceIO();
+        longest = std::max(longest, std::chrono::steady_clock::now() - start);
+
+        ranJobs = worker != nullptr && worker->PendingJobCount() > 0;
+        if (ranJobs)
+        {
+            longest = std::max(longest, worker->RunPendingJobs());
+        }
+    } while (ranJobs);
+
+    NL_TEST_ASSERT(inSuite, delegate.mNumPairingErrors == 0);
+    NL_TEST_ASSERT(inSuite, delegate.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveHandshakeCount() == 0);
+
+    SessionHolder & holder = delegate.GetSessionHolder();
+    NL_TEST_ASSERT(inSuite, bool(holder));
+    NL_TEST_ASSERT(inSuite, holder->GetPeer() == fabric->GetScopedNodeIdForNode(Node01_01));
+
+    gPairingServer.SetCryptoWorker(nullptr);
+    return longest;
+}
+
+} // namespace
+
+void CASE_CryptoWorkerHandshakeTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    auto inlineStep = EstablishWithServer(inSuite, ctx, nullptr);
+
+    TestCryptoWorker worker;
+    auto offloadedStep = EstablishWithServer(inSuite, ctx, &worker);
+    NL_TEST_ASSERT(inSuite, worker.PendingJobCount() == 0);
+
+    printf("Longest event loop step of a CASE session establishment: %.1f ms inline, %.1f ms offloaded\n",
+           static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(inlineStep).count()) / 1000,
+           static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(offloadedStep).count()) / 1000);
+}
+
+void CASE_CryptoWorkerCancelTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingAccessory;
+    SessionManager sessionManager;
+    TestCryptoWorker worker;
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                     &pairingAccessory) == CHIP_NO_ERROR);
+
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+    pairingAccessory.SetCryptoWorker(&worker);
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.ListenForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, &delegateAccessory) ==
+                       CHIP_NO_ERROR);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    gLoopback.mSentMessageCount           = 0;
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.EstablishSession(sessionManager, fabric, Node01_01, contextCommissioner, nullptr,
+                                                        &delegateCommissioner) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    // Sigma1 was handled, and the Sigma2 ephemeral key is being generated.
+    NL_TEST_ASSERT(inSuite, worker.PendingJobCount() == 1);
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 1);
+
+    // The completion of a job whose session went away does nothing. Only the ack of Sigma1 is sent.
+    pairingAccessory.Clear();
+    worker.RunPendingJobs();
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 2);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 0);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 0);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+
+    ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+    pairingCommissioner.Clear();
+}
+
+void CASE_CryptoWorkerShutdownTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingAccessory;
+    SessionManager sessionManager;
+    TestCryptoWorker worker;
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                     &pairingAccessory) == CHIP_NO_ERROR);
+
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+    pairingAccessory.SetCryptoWorker(&worker);
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.ListenForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, &delegateAccessory) ==
+                       CHIP_NO_ERROR);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.EstablishSession(sessionManager, fabric, Node01_01, contextCommissioner, nullptr,
+                                                        &delegateCommissioner) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, worker.PendingJobCount() == 1);
+
+    // A worker shutting down with the job still queued fails the handshake of the session that is still waiting for it.
+    worker.CancelPendingJobs();
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 0);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 1);
+
+    ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+    pairingCommissioner.Clear();
+}
+
 struct Sigma1Params
 {
     // Purposefully not using constants like kSigmaParamRandomNumberSize that
@@ -623,6 +934,11 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Start",       CASE_SecurePairingStartTest),
     NL_TEST_DEF("Handshake",   CASE_SecurePairingHandshakeTest),
     NL_TEST_DEF("ServerHandshake", CASE_SecurePairingHandshakeServerTest),
+    NL_TEST_DEF("ConcurrentServerHandshakes", CASE_ConcurrentHandshakesServerTest),
+    NL_TEST_DEF("StaleHandshakeEviction", CASE_StaleHandshakeEvictionTest),
+    NL_TEST_DEF("CryptoWorkerHandshake", CASE_CryptoWorkerHandshakeTest),
+    NL_TEST_DEF("CryptoWorkerCancel", CASE_CryptoWorkerCancelTest),
+    NL_TEST_DEF("CryptoWorkerShutdown", CASE_CryptoWorkerShutdownTest),
     NL_TEST_DEF("Sigma1Parsing", CASE_Sigma1ParsingTest),
     NL_TEST_DEF("DestinationId", CASE_DestinationIdTest),
 
@@ -459,6 +459,31 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+ *
+ *  @brief
+ *      Keep pending timers in a pairing heap (1) rather than in a sorted linked list (0).
+ *
+ *      The sorted list is the smallest option but makes starting and cancelling a timer linear in the number of pending
+ *      timers. The heap makes both logarithmic (amortized), at the cost of a few more pointers per timer and a hash table
+ *      of CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS entries per timer list. Expiry order is the same for both.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS
+ *
+ *  @brief
+ *      Number of buckets, a power of two, in the hash table used to find timers by callback and application state when
+ *      CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP is enabled.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS 64
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
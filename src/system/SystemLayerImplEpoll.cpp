@@ -0,0 +1,437 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll() and timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+/**
+ *  Translate the events reported by epoll for a socket into the events its watch asked for. As with select(), errors and
+ *  hang-ups are reported as readiness, so that the pending read or write observes them.
+ */
+SocketEvents SocketEventsFromEpoll(uint32_t events, SocketEvents pendingIO)
+{
+    SocketEvents res;
+
+    if ((events & (EPOLLIN | EPOLLERR | EPOLLHUP)) && pendingIO.Has(SocketEventFlags::kRead))
+        res.Set(SocketEventFlags::kRead);
+    if ((events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && pendingIO.Has(SocketEventFlags::kWrite))
+        res.Set(SocketEventFlags::kWrite);
+
+    return res;
+}
+
+} // anonymous namespace
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    epoll_event event = {};
+
+    mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+    mArmedTime = Clock::kZero;
+
+    // The timerfd is the only entry without a SocketWatch.
+    event.events   = EPOLLIN;
+    event.data.ptr = nullptr;
+    VerifyOrExit(::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    // Create an event to allow an arbitrary thread to wake the thread in the event loop.
+    SuccessOrExit(err = mWakeEvent.Open(*this));
+
+    VerifyOrDie(mLayerState.SetInitialized());
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        // Leave the layer as it was before Init(), so that it can be initialized again.
+        if (mTimerFd >= 0)
+        {
+            ::close(mTimerFd);
+            mTimerFd = -1;
+        }
+        if (mEpollFd >= 0)
+        {
+            ::close(mEpollFd);
+            mEpollFd = -1;
+        }
+        mLayerState.ResetFromInitializing();
+    }
+    return err;
+}
+
+CHIP_ERROR LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturnError(mLayerState.SetShuttingDown(), CHIP_ERROR_INCORRECT_STATE);
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    mWakeEvent.Close(*this);
+
+    VerifyOrDie(::close(mTimerFd) == 0);
+    VerifyOrDie(::close(mEpollFd) == 0);
+    mTimerFd = -1;
+    mEpollFd = -1;
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by writing to the wake event.
+     *
+     * If this is being called from within an I/O event callback, then writing to the wake event can be skipped,
+     * since the I/O thread is already awake.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Send notification to wake up the epoll_wait call.
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the timerfd has to be re-armed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CancelTimer(onComplete, appState);
+
+    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the timerfd has to be re-armed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // The socket joins the epoll set once a read or write callback is requested.
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mInEpollSet)
+    {
+        // This can fail if the socket has already been closed, which removes it from the epoll set anyway.
+        (void) ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // Also drops any events already reported for the socket but not yet dispatched.
+    watch->Clear();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateWatch(SocketWatch * watch)
+{
+    epoll_event event = {};
+    event.data.ptr    = watch;
+    if (watch->mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        event.events |= EPOLLIN;
+    }
+    if (watch->mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    if (event.events == 0)
+    {
+        if (watch->mInEpollSet)
+        {
+            VerifyOrReturnError(::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr) == 0, CHIP_ERROR_POSIX(errno));
+            watch->mInEpollSet = false;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    const int op = watch->mInEpollSet ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, op, watch->mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    watch->mInEpollSet = true;
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime)
+{
+    if (awakenTime == mArmedTime)
+    {
+        return;
+    }
+
+    // An all-zero value disarms the timerfd.
+    itimerspec spec = {};
+    if (awakenTime != Clock::kZero)
+    {
+        // A timer that is already due still needs a non-zero value to fire immediately.
+        const Clock::Microseconds64 delay =
+            (awakenTime > currentTime) ? Clock::Microseconds64(awakenTime - currentTime) : Clock::Microseconds64(1);
+        spec.it_value.tv_sec  = static_cast<time_t>(delay.count() / 1000000);
+        spec.it_value.tv_nsec = static_cast<long>((delay.count() % 1000000) * 1000);
+    }
+
+    if (::timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        mArmedTime = Clock::kZero;
+        return;
+    }
+    mArmedTime = awakenTime;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    // With no timers pending, the timerfd is disarmed and only socket events or a wake event end the wait.
+    TimerList::Node * timer = mTimerList.Earliest();
+    ArmTimerFd((timer != nullptr) ? timer->AwakenTime() : Clock::kZero, SystemClock().GetMonotonicTimestamp());
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEventCount = ::epoll_wait(mEpollFd, mEvents, kMaxEvents, -1);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        if (errno != EINTR)
+        {
+            ChipLogError(DeviceLayer, "epoll_wait failed: %s\n", ErrorStr(CHIP_ERROR_POSIX(errno)));
+        }
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Record socket readiness before invoking any callback, so that a callback that stops watching a socket also discards
+    // the events already reported for it.
+    for (int i = 0; i < mEventCount; i++)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(mEvents[i].data.ptr);
+        if (watch == nullptr)
+        {
+            // The timerfd expired; consume the expiration so that it is not reported again, and disarm it.
+            uint64_t expirations;
+            (void) ::read(mTimerFd, &expirations, sizeof(expirations));
+            mArmedTime = Clock::kZero;
+            continue;
+        }
+        watch->mReadyIO = SocketEventsFromEpoll(mEvents[i].events, watch->mPendingIO);
+    }
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    TimerList expiredTimers = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = expiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+
+    for (int i = 0; i < mEventCount; i++)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(mEvents[i].data.ptr);
+        if (watch == nullptr)
+        {
+            continue;
+        }
+        SocketEvents events = watch->mReadyIO;
+        watch->mReadyIO.ClearAll();
+        if (events.HasAny() && watch->mCallback != nullptr)
+        {
+            watch->mCallback(events, watch->mCallbackData);
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mReadyIO.ClearAll();
+    mInEpollSet   = false;
+    mCallback     = nullptr;
+    mCallbackData = 0;
+}
+
+} // namespace System
+} // namespace chip
@@ -38,6 +38,213 @@
 namespace chip {
 namespace System {
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+bool TimerList::IsEarlier(const Node * a, const Node * b)
+{
+    if (a->AwakenTime() != b->AwakenTime())
+    {
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    return static_cast<int32_t>(a->mSequence - b->mSequence) < 0;
+}
+
+// Join two heap roots, returning the new root. Both must be detached from any parent or sibling.
+TimerList::Node * TimerList::Meld(Node * a, Node * b)
+{
+    if (a == nullptr)
+    {
+        return b;
+    }
+    if (b == nullptr)
+    {
+        return a;
+    }
+    if (IsEarlier(b, a))
+    {
+        Node * tmp = a;
+        a          = b;
+        b          = tmp;
+    }
+    b->mPrev    = a;
+    b->mSibling = a->mChild;
+    if (a->mChild != nullptr)
+    {
+        a->mChild->mPrev = b;
+    }
+    a->mChild = b;
+    return a;
+}
+
+// Standard two-pass pairing of a list of siblings into a single heap, returning its root.
+TimerList::Node * TimerList::MergePairs(Node * first)
+{
+    Node * pairs = nullptr;
+    while (first != nullptr)
+    {
+        Node * a = first;
+        Node * b = a->mSibling;
+        first    = (b != nullptr) ? b->mSibling : nullptr;
+
+        a->mSibling = nullptr;
+        a->mPrev    = nullptr;
+        if (b != nullptr)
+        {
+            b->mSibling = nullptr;
+            b->mPrev    = nullptr;
+            a           = Meld(a, b);
+        }
+        a->mSibling = pairs;
+        pairs       = a;
+    }
+
+    Node * root = nullptr;
+    while (pairs != nullptr)
+    {
+        Node * next     = pairs->mSibling;
+        pairs->mSibling = nullptr;
+        root            = Meld(root, pairs);
+        pairs           = next;
+    }
+    return root;
+}
+
+size_t TimerList::HashBucket(const void * appState)
+{
+    uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) * UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<size_t>(hash >> 32) & (kHashBuckets - 1);
+}
+
+void TimerList::Insert(Node * timer)
+{
+    timer->mChild   = nullptr;
+    timer->mSibling = nullptr;
+    timer->mPrev    = nullptr;
+    mEarliestTimer  = Meld(mEarliestTimer, timer);
+
+    Node *& bucket   = mHashBuckets[HashBucket(timer->GetCallback().GetAppState())];
+    timer->mHashNext = bucket;
+    bucket           = timer;
+}
+
+void TimerList::Unlink(Node * timer)
+{
+    Node ** link = &mHashBuckets[HashBucket(timer->GetCallback().GetAppState())];
+    while (*link != timer)
+    {
+        VerifyOrDie(*link != nullptr);
+        link = &(*link)->mHashNext;
+    }
+    *link = timer->mHashNext;
+
+    if (timer == mEarliestTimer)
+    {
+        mEarliestTimer = MergePairs(timer->mChild);
+    }
+    else
+    {
+        if (timer->mPrev->mChild == timer)
+        {
+            timer->mPrev->mChild = timer->mSibling;
+        }
+        else
+        {
+            timer->mPrev->mSibling = timer->mSibling;
+        }
+        if (timer->mSibling != nullptr)
+        {
+            timer->mSibling->mPrev = timer->mPrev;
+        }
+        mEarliestTimer = Meld(mEarliestTimer, MergePairs(timer->mChild));
+    }
+
+    timer->mChild    = nullptr;
+    timer->mSibling  = nullptr;
+    timer->mPrev     = nullptr;
+    timer->mHashNext = nullptr;
+}
+
+TimerList::Node * TimerList::Add(TimerList::Node * add)
+{
+    VerifyOrDie(add != mEarliestTimer);
+    add->mSequence = mNextSequence++;
+    Insert(add);
+    return mEarliestTimer;
+}
+
+TimerList::Node * TimerList::Remove(TimerList::Node * remove)
+{
+    // A timer that is in the heap is either its root or has a parent or previous sibling.
+    if (remove != nullptr && (remove == mEarliestTimer || remove->mPrev != nullptr))
+    {
+        Unlink(remove);
+    }
+    return mEarliestTimer;
+}
+
+TimerList::Node * TimerList::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * found = nullptr;
+    for (Node * timer = mHashBuckets[HashBucket(aAppState)]; timer != nullptr; timer = timer->mHashNext)
+    {
+        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState &&
+            (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    if (found != nullptr)
+    {
+        Unlink(found);
+    }
+    return found;
+}
+
+TimerList::Node * TimerList::PopEarliest()
+{
+    Node * earliest = mEarliestTimer;
+    if (earliest != nullptr)
+    {
+        Unlink(earliest);
+    }
+    return earliest;
+}
+
+TimerList::Node * TimerList::PopIfEarlier(Clock::Timestamp t)
+{
+    if ((mEarliestTimer == nullptr) || !(mEarliestTimer->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+
+    // Keep the original sequence numbers, so that ties are still resolved in insertion order.
+    Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        out.Insert(timer);
+    }
+
+    return out;
+}
+
+void TimerList::Clear()
+{
+    mEarliestTimer = nullptr;
+    mNextSequence  = 0;
+    for (auto & bucket : mHashBuckets)
+    {
+        bucket = nullptr;
+    }
+}
+
+#else // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 TimerList::Node * TimerList::Add(TimerList::Node * add)
 {
     VerifyOrDie(add != mEarliestTimer);
@@ -160,5 +367,7 @@ TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
     return out;
 }
 
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 } // namespace System
 } // namespace chip
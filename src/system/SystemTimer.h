@@ -98,6 +98,115 @@ private:
     TimerData & operator=(const TimerData &) = delete;
 };
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
+/**
+ * Collection of `Timer`s ordered by expiration time, kept in a pairing heap.
+ *
+ * Timers with the same expiration time are ordered by insertion, as in the list implementation. A hash table keyed by
+ * application state finds timers by callback without walking every pending timer.
+ */
+class TimerList
+{
+public:
+    class Node : public TimerData
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerData(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerList;
+
+        Node * mChild      = nullptr; // Leftmost child in the heap.
+        Node * mSibling    = nullptr; // Next sibling in the heap.
+        Node * mPrev       = nullptr; // Parent if this is the leftmost child, else the previous sibling.
+        Node * mHashNext   = nullptr; // Next timer in the same hash bucket.
+        uint32_t mSequence = 0;       // Insertion order, to break ties between equal expiration times.
+    };
+
+    TimerList() { Clear(); }
+
+    /**
+     * Add a timer to the list
+     *
+     * @return  The new earliest timer in the list. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the list, if present. It is not an error for the timer not to be present, provided it is
+     * not in some other list.
+     *
+     * @return  The new earliest timer in the list, or nullptr if the list is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the first timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the list contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the list.
+     *
+     * @return  The earliest timer, or nullptr if the list is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the list, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the list.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return mEarliestTimer; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mEarliestTimer == nullptr; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+private:
+    static constexpr size_t kHashBuckets = CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS;
+    static_assert(kHashBuckets > 0 && (kHashBuckets & (kHashBuckets - 1)) == 0,
+                  "CHIP_SYSTEM_CONFIG_TIMER_HEAP_HASH_BUCKETS must be a power of two");
+
+    static bool IsEarlier(const Node * a, const Node * b);
+    static Node * Meld(Node * a, Node * b);
+    static Node * MergePairs(Node * first);
+    static size_t HashBucket(const void * appState);
+
+    void Insert(Node * timer);
+    void Unlink(Node * timer);
+
+    Node * mEarliestTimer;
+    uint32_t mNextSequence;
+    Node * mHashBuckets[kHashBuckets];
+};
+
+#else // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 /**
  * List of `Timer`s ordered by expiration time.
  */
@@ -177,6 +286,8 @@ private:
     Node * mEarliestTimer;
 };
 
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -23,6 +23,7 @@
 
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 
 namespace chip {
@@ -39,7 +40,16 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNextBuffer(chip::TLV::TLVReader & rea
 {
     if (mUseChainedBuffers)
     {
-        mCurrentBuffer.Advance();
+        // Readers sharing this store, such as copies of a reader, may each be in a different buffer of the chain: move on
+        // from the buffer this reader has reached the end of. Empty buffers would read as the end of the data, so skip them.
+        mCurrentBuffer = FindBufferEndingAt(reader.GetReadPoint());
+        do
+        {
+            if (!mCurrentBuffer.IsNull())
+            {
+                mCurrentBuffer.Advance();
+            }
+        } while (!mCurrentBuffer.IsNull() && mCurrentBuffer->DataLength() == 0);
     }
     else
     {
@@ -69,6 +79,13 @@ CHIP_ERROR TLVPacketBufferBackingStore::OnInit(chip::TLV::TLVWriter & writer, ui
 
 CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t dataLen)
 {
+    if (mUseChainedBuffers)
+    {
+        // The writer may have been rolled back to a buffer before the one it last got from GetNewBuffer().
+        mCurrentBuffer = FindBufferHolding(bufStart);
+        VerifyOrReturnError(!mCurrentBuffer.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    }
+
     uint8_t * endPtr = bufStart + dataLen;
 
     intptr_t length = endPtr - mCurrentBuffer->Start();
@@ -78,6 +95,15 @@ CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & wr
     }
     mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length));
 
+    if (mUseChainedBuffers)
+    {
+        // Whatever follows in the chain was written before a rollback.  Empty those buffers, for GetNewBuffer() to reuse them.
+        for (PacketBufferHandle buffer = mCurrentBuffer->Next(); !buffer.IsNull(); buffer.Advance())
+        {
+            buffer->SetDataLength(0);
+        }
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -91,6 +117,16 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     mCurrentBuffer.Advance();
     if (mCurrentBuffer.IsNull())
     {
+        if (mMaxChainedBuffers != kUnlimitedChainedBuffers)
+        {
+            size_t chainedBuffers = 0;
+            for (PacketBufferHandle buffer = mHeadBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+            {
+                chainedBuffers++;
+            }
+            VerifyOrReturnError(chainedBuffers < mMaxChainedBuffers, CHIP_ERROR_NO_MEMORY);
+        }
+
         mCurrentBuffer = PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
         if (mCurrentBuffer.IsNull())
         {
@@ -113,5 +149,39 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     return CHIP_NO_ERROR;
 }
 
+PacketBufferHandle TLVPacketBufferBackingStore::FindBufferHolding(const uint8_t * aPoint) const
+{
+    if (mHeadBuffer.IsNull())
+    {
+        return nullptr;
+    }
+
+    for (PacketBufferHandle buffer = mHeadBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        if (aPoint >= buffer->Start() && aPoint <= buffer->Start() + buffer->MaxDataLength())
+        {
+            return buffer;
+        }
+    }
+    return nullptr;
+}
+
+PacketBufferHandle TLVPacketBufferBackingStore::FindBufferEndingAt(const uint8_t * aPoint) const
+{
+    if (mHeadBuffer.IsNull())
+    {
+        return nullptr;
+    }
+
+    for (PacketBufferHandle buffer = mHeadBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        if (aPoint == buffer->Start() + buffer->DataLength())
+        {
+            return buffer;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace System
 } // namespace chip
@@ -37,10 +37,18 @@ namespace System {
 class TLVPacketBufferBackingStore : public chip::TLV::TLVBackingStore
 {
 public:
-    TLVPacketBufferBackingStore() : mHeadBuffer(nullptr), mCurrentBuffer(nullptr), mUseChainedBuffers(false) {}
-    TLVPacketBufferBackingStore(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    /**
+     * Value of maxChainedBuffers for chains that may grow without limit.
+     */
+    static constexpr size_t kUnlimitedChainedBuffers = 0;
+
+    TLVPacketBufferBackingStore() :
+        mHeadBuffer(nullptr), mCurrentBuffer(nullptr), mUseChainedBuffers(false), mMaxChainedBuffers(kUnlimitedChainedBuffers)
+    {}
+    TLVPacketBufferBackingStore(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false,
+                                size_t maxChainedBuffers = kUnlimitedChainedBuffers)
     {
-        Init(std::move(buffer), useChainedBuffers);
+        Init(std::move(buffer), useChainedBuffers, maxChainedBuffers);
     }
     ~TLVPacketBufferBackingStore() override {}
 
@@ -52,16 +60,29 @@ public:
      *                       If true, advance to the next buffer in the chain once all data or space
      *                       in the current buffer has been consumed; a write will allocate new
      *                       packet buffers if necessary.
+     * @param[in]    maxChainedBuffers
+     *                       The number of buffers, including the head, beyond which a write will not grow
+     *                       the chain, and fail with #CHIP_ERROR_NO_MEMORY instead.
      *
      * @note This must take place before initializing a TLV class with this backing store.
+     *
+     * @note Chained buffers are located from the position of the TLV class rather than from where this store
+     *       last left off, so a writer may be rolled back across buffers, and several readers may share the chain.
      */
-    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false,
+              size_t maxChainedBuffers = kUnlimitedChainedBuffers)
     {
         mHeadBuffer        = std::move(buffer);
         mCurrentBuffer     = mHeadBuffer.Retain();
         mUseChainedBuffers = useChainedBuffers;
+        mMaxChainedBuffers = maxChainedBuffers;
     }
-    void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers); }
+    void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers, mMaxChainedBuffers); }
+
+    /**
+     * Whether this store has no backing packet buffer.
+     */
+    bool IsNull() const { return mHeadBuffer.IsNull(); }
 
     /**
      * Release ownership of the backing packet buffer.
@@ -82,9 +103,15 @@ public:
     CHIP_ERROR FinalizeBuffer(chip::TLV::TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override;
 
 protected:
+    // Returns the buffer of the chain whose space holds aPoint, or a null handle.
+    PacketBufferHandle FindBufferHolding(const uint8_t * aPoint) const;
+    // Returns the buffer of the chain whose data ends at aPoint, or a null handle.
+    PacketBufferHandle FindBufferEndingAt(const uint8_t * aPoint) const;
+
     chip::System::PacketBufferHandle mHeadBuffer;
     chip::System::PacketBufferHandle mCurrentBuffer;
     bool mUseChainedBuffers;
+    size_t mMaxChainedBuffers;
 };
 
 class DLL_EXPORT PacketBufferTLVReader : public TLV::ContiguousBufferTLVReader
@@ -107,6 +134,42 @@ private:
     PacketBufferHandle mBuffer;
 };
 
+class DLL_EXPORT ChainedPacketBufferTLVReader : public TLV::TLVReader
+{
+public:
+    using TLV::TLVReader::Init;
+
+    /**
+     * Initializes a TLVReader object to read from a chain of PacketBuffers, such as the one written by a
+     * PacketBufferTLVWriter using chained buffers.
+     *
+     * @param[in]    buffer  A handle to the head of the chain, to be used as backing store for a TLV class.
+     *
+     * @note Copies of this reader, made with TLVReader::Init(const TLVReader &), read from the same chain; they
+     *       must not be used once this reader is reset or re-initialized.
+     */
+    CHIP_ERROR Init(chip::System::PacketBufferHandle && buffer)
+    {
+        mBackingStore.Init(std::move(buffer), /* useChainedBuffers = */ true);
+        return chip::TLV::TLVReader::Init(mBackingStore);
+    }
+
+    /**
+     * Free the underlying chain of PacketBuffers.
+     *
+     * @note No further TLV operations may be performed, unless or until this ChainedPacketBufferTLVReader is re-initialized.
+     */
+    void Reset() { static_cast<void>(mBackingStore.Release()); }
+
+    /**
+     * Whether this reader has no underlying chain of PacketBuffers.
+     */
+    bool IsNull() const { return mBackingStore.IsNull(); }
+
+private:
+    TLVPacketBufferBackingStore mBackingStore;
+};
+
 class DLL_EXPORT PacketBufferTLVWriter : public chip::TLV::TLVWriter
 {
 public:
@@ -118,10 +181,13 @@ public:
      *                       If true, advance to the next buffer in the chain once all space
      *                       in the current buffer has been consumed. Once all existing buffers
      *                       have been used, new PacketBuffers will be allocated as necessary.
+     * @param[in]    maxChainedBuffers
+     *                       The number of buffers, including the head, the chain may grow to.
      */
-    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
+    void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false,
+              size_t maxChainedBuffers = TLVPacketBufferBackingStore::kUnlimitedChainedBuffers)
     {
-        mBackingStore.Init(std::move(buffer), useChainedBuffers);
+        mBackingStore.Init(std::move(buffer), useChainedBuffers, maxChainedBuffers);
         chip::TLV::TLVWriter::Init(mBackingStore);
     }
     /**
@@ -62,24 +62,28 @@ CHIP_ERROR WakeEvent::Open(LayerSockets & systemLayer)
         FD_WRITE = 1
     };
     int fds[2];
+    CHIP_ERROR err = CHIP_NO_ERROR;
 
     if (::pipe(fds) < 0)
         return CHIP_ERROR_POSIX(errno);
 
-    if (SetNonBlockingMode(fds[FD_READ]) < 0)
-        return CHIP_ERROR_POSIX(errno);
-
-    if (SetNonBlockingMode(fds[FD_WRITE]) < 0)
-        return CHIP_ERROR_POSIX(errno);
+    mReadFD    = fds[FD_READ];
+    mWriteFD   = fds[FD_WRITE];
+    mReadWatch = systemLayer.InvalidSocketWatchToken();
 
-    mReadFD  = fds[FD_READ];
-    mWriteFD = fds[FD_WRITE];
+    VerifyOrExit(SetNonBlockingMode(mReadFD) >= 0, err = CHIP_ERROR_POSIX(errno));
+    VerifyOrExit(SetNonBlockingMode(mWriteFD) >= 0, err = CHIP_ERROR_POSIX(errno));
 
-    ReturnErrorOnFailure(systemLayer.StartWatchingSocket(mReadFD, &mReadWatch));
-    ReturnErrorOnFailure(systemLayer.SetCallback(mReadWatch, Confirm, reinterpret_cast<intptr_t>(this)));
-    ReturnErrorOnFailure(systemLayer.RequestCallbackOnPendingRead(mReadWatch));
+    SuccessOrExit(err = systemLayer.StartWatchingSocket(mReadFD, &mReadWatch));
+    SuccessOrExit(err = systemLayer.SetCallback(mReadWatch, Confirm, reinterpret_cast<intptr_t>(this)));
+    SuccessOrExit(err = systemLayer.RequestCallbackOnPendingRead(mReadWatch));
 
-    return CHIP_NO_ERROR;
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Close(systemLayer);
+    }
+    return err;
 }
 
 void WakeEvent::Close(LayerSockets & systemLayer)
@@ -123,17 +127,25 @@ CHIP_ERROR WakeEvent::Notify() const
 
 CHIP_ERROR WakeEvent::Open(LayerSockets & systemLayer)
 {
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
     mReadFD = ::eventfd(0, 0);
     if (mReadFD == -1)
     {
         return CHIP_ERROR_POSIX(errno);
     }
+    mReadWatch = systemLayer.InvalidSocketWatchToken();
 
-    ReturnErrorOnFailure(systemLayer.StartWatchingSocket(mReadFD, &mReadWatch));
-    ReturnErrorOnFailure(systemLayer.SetCallback(mReadWatch, Confirm, reinterpret_cast<intptr_t>(this)));
-    ReturnErrorOnFailure(systemLayer.RequestCallbackOnPendingRead(mReadWatch));
+    SuccessOrExit(err = systemLayer.StartWatchingSocket(mReadFD, &mReadWatch));
+    SuccessOrExit(err = systemLayer.SetCallback(mReadWatch, Confirm, reinterpret_cast<intptr_t>(this)));
+    SuccessOrExit(err = systemLayer.RequestCallbackOnPendingRead(mReadWatch));
 
-    return CHIP_NO_ERROR;
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Close(systemLayer);
+    }
+    return err;
 }
 
 void WakeEvent::Close(LayerSockets & systemLayer)
@@ -43,8 +43,10 @@
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
 #include <errno.h>
+#include <memory>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
 
 using chip::ErrorStr;
 using namespace chip::System;
@@ -404,6 +406,71 @@ void chip::System::TestTimer::CheckTimerPool(nlTestSuite * inSuite, void * aCont
     NL_TEST_ASSERT(suite, SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+// Checks that the expiry order (by time, then by insertion) is preserved through cancel and restart churn, as
+// StartTimer does for a timer that is already running. The timer list benchmark measures the same workload at scale.
+void CheckTimerListChurn(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & testContext = *static_cast<TestContext *>(aContext);
+    Layer & systemLayer       = *testContext.mLayer;
+
+    using Timer = TimerList::Node;
+    struct TestState
+    {
+        static void Complete(Layer * layer, void * state) {}
+    };
+
+    constexpr size_t kNumTimers = 32;
+    std::vector<std::unique_ptr<Timer>> timers;
+    std::vector<uint32_t> insertionOrder(kNumTimers);
+    std::vector<int> appStates(kNumTimers);
+    uint32_t nextInsertion = 0;
+
+    // Deterministic pseudo-random expiration times over a range small enough to produce ties.
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        timers.emplace_back(new Timer(systemLayer, Clock::Timestamp((seed >> 8) % 8), TestState::Complete, &appStates[i]));
+    }
+
+    TimerList list;
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        list.Add(timers[i].get());
+        insertionOrder[i] = nextInsertion++;
+    }
+
+    // Cancel and restart every timer, in an order unrelated to the insertion order.
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        size_t index = (i * 7919) % kNumTimers;
+        NL_TEST_ASSERT(inSuite, list.Remove(TestState::Complete, &appStates[index]) == timers[index].get());
+        list.Add(timers[index].get());
+        insertionOrder[index] = nextInsertion++;
+    }
+
+    size_t count       = 0;
+    const Timer * last = nullptr;
+    size_t lastIndex   = 0;
+    Timer * timer;
+    while ((timer = list.PopEarliest()) != nullptr)
+    {
+        size_t index = static_cast<size_t>(static_cast<int *>(timer->GetCallback().GetAppState()) - appStates.data());
+        if (last != nullptr)
+        {
+            NL_TEST_ASSERT(inSuite,
+                           last->AwakenTime() < timer->AwakenTime() ||
+                               (last->AwakenTime() == timer->AwakenTime() && insertionOrder[lastIndex] < insertionOrder[index]));
+        }
+        last      = timer;
+        lastIndex = index;
+        count++;
+    }
+
+    NL_TEST_ASSERT(inSuite, count == kNumTimers);
+    NL_TEST_ASSERT(inSuite, list.Empty());
+}
+
 // Test Suite
 
 /**
@@ -416,6 +483,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Timer::TestTimerStarvation",      CheckStarvation),
     NL_TEST_DEF("Timer::TestTimerOrder",           CheckOrder),
     NL_TEST_DEF("Timer::TestTimerPool",            chip::System::TestTimer::CheckTimerPool),
+    NL_TEST_DEF("Timer::TestTimerListChurn",       CheckTimerListChurn),
     NL_TEST_SENTINEL()
 };
 // clang-format on
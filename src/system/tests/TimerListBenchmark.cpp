@@ -0,0 +1,114 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Measures TimerList with many concurrent timers, as held by a controller with thousands of subscriptions: adding
+ *      every timer, cancelling and restarting each of them as StartTimer does for a running timer, then draining the
+ *      list. Build with chip_system_config_use_timer_heap to measure the heap instead of the sorted list.
+ */
+
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+namespace {
+
+using namespace chip::System;
+using Timer = TimerList::Node;
+
+void Complete(Layer * layer, void * state) {}
+
+bool Run(Layer & systemLayer, size_t numTimers)
+{
+    std::vector<std::unique_ptr<Timer>> timers;
+    std::vector<int> appStates(numTimers);
+
+    // Deterministic pseudo-random expiration times over a range small enough to produce ties.
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < numTimers; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        timers.emplace_back(new Timer(systemLayer, Clock::Timestamp((seed >> 8) % 5000), Complete, &appStates[i]));
+    }
+
+    TimerList list;
+
+    Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < numTimers; i++)
+    {
+        list.Add(timers[i].get());
+    }
+    Clock::Microseconds64 addTime = SystemClock().GetMonotonicMicroseconds64() - start;
+
+    start = SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < numTimers; i++)
+    {
+        size_t index = (i * 7919) % numTimers;
+        if (list.Remove(Complete, &appStates[index]) != timers[index].get())
+        {
+            return false;
+        }
+        list.Add(timers[index].get());
+    }
+    Clock::Microseconds64 churnTime = SystemClock().GetMonotonicMicroseconds64() - start;
+
+    start        = SystemClock().GetMonotonicMicroseconds64();
+    size_t count = 0;
+    while (list.PopEarliest() != nullptr)
+    {
+        count++;
+    }
+    Clock::Microseconds64 drainTime = SystemClock().GetMonotonicMicroseconds64() - start;
+
+    printf("%8u timers: add %.3f us/op, cancel+restart %.3f us/op, pop %.3f us/op\n", static_cast<unsigned>(numTimers),
+           static_cast<double>(addTime.count()) / static_cast<double>(numTimers),
+           static_cast<double>(churnTime.count()) / static_cast<double>(numTimers),
+           static_cast<double>(drainTime.count()) / static_cast<double>(numTimers));
+    return count == numTimers;
+}
+
+} // namespace
+
+int main()
+{
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+    printf("TimerList implementation: heap\n");
+#else
+    printf("TimerList implementation: sorted list\n");
+#endif
+
+    // The timers only keep a reference to the layer, which is never initialized.
+    LayerImpl systemLayer;
+
+    // The number of timers is a power of 10 and prime to the cancel stride, which then visits every timer once.
+    for (size_t numTimers = 10; numTimers <= 10000; numTimers *= 10)
+    {
+        if (!Run(systemLayer, numTimers))
+        {
+            fprintf(stderr, "TimerList lost a timer with %u timers\n", static_cast<unsigned>(numTimers));
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -112,6 +112,12 @@ CHIP_ERROR CryptoContext::InitFromSecret(const ByteSpan & secret, const ByteSpan
 
 #endif
 
+    for (KeyUsage usage : { kI2RKey, kR2IKey })
+    {
+        // On failure the key still works, only without a cached cipher context.
+        (void) mMessageKeys[usage].Init(AesCcm128KeySpan(mKeys[usage]));
+    }
+
     mKeyAvailable = true;
     mSessionRole  = role;
 
@@ -197,8 +203,8 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
             usage = kI2RKey;
         }
 
-        ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], Crypto::kAES_CCM128_Key_Length,
-                                             nonce.data(), nonce.size(), output, tag, taglen));
+        ReturnErrorOnFailure(
+            mMessageKeys[usage].Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
     }
 
     mac.SetTag(&header, tag, taglen);
@@ -242,8 +248,8 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
             usage = kR2IKey;
         }
 
-        ReturnErrorOnFailure(AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mKeys[usage],
-                                             Crypto::kAES_CCM128_Key_Length, nonce.data(), nonce.size(), output));
+        ReturnErrorOnFailure(
+            mMessageKeys[usage].Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
     }
     return CHIP_NO_ERROR;
 }
@@ -147,10 +147,19 @@ private:
         kNumCryptoKeys           = 3
     };
 
+    // The keys that encrypt messages, which come first in KeyUsage.
+    static constexpr size_t kNumMessageKeys = 2;
+    static_assert(kI2RKey < kNumMessageKeys && kR2IKey < kNumMessageKeys && kAttestationChallengeKey >= kNumMessageKeys,
+                  "Only the message keys may index mMessageKeys");
+
     SessionRole mSessionRole;
 
     bool mKeyAvailable;
     CryptoKey mKeys[KeyUsage::kNumCryptoKeys];
+    // Message keys prepared once per session, indexed by kI2RKey and kR2IKey. Encrypt() and Decrypt() update their cipher
+    // contexts, hence mutable: like the session that owns it, a CryptoContext must not be used from several threads at once.
+    // Group sessions use mKeyContext instead, and are not cached here.
+    mutable Crypto::AesCcm128Context mMessageKeys[kNumMessageKeys];
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
 
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
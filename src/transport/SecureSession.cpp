@@ -16,6 +16,7 @@
 
 #include <access/AuthMode.h>
 #include <transport/SecureSession.h>
+#include <transport/SecureSessionIndex.h>
 
 namespace chip {
 namespace Transport {
@@ -43,5 +44,13 @@ Access::SubjectDescriptor SecureSession::GetSubjectDescriptor() const
     return subjectDescriptor;
 }
 
+void SecureSession::NotifyPeerChanged(const ScopedNodeId & oldPeer)
+{
+    if (mIndex != nullptr && oldPeer != GetPeer())
+    {
+        mIndex->OnPeerChanged(*this, oldPeer);
+    }
+}
+
 } // namespace Transport
 } // namespace chip
@@ -36,6 +36,8 @@ namespace Transport {
 
 static constexpr uint32_t kUndefinedMessageIndex = UINT32_MAX;
 
+class SecureSessionIndex;
+
 /**
  * Defines state of a peer connection at a transport layer.
  *
@@ -112,6 +114,8 @@ public:
         VerifyOrDie(!((secureSessionType == Type::kCASE) &&
                       (!IsOperationalNodeId(peerNode.GetNodeId()) || !IsOperationalNodeId(localNode.GetNodeId()))));
 
+        ScopedNodeId oldPeer = GetPeer();
+
         mSecureSessionType = secureSessionType;
         mPeerNodeId        = peerNode.GetNodeId();
         mLocalNodeId       = localNode.GetNodeId();
@@ -119,6 +123,7 @@ public:
         mPeerSessionId     = peerSessionId;
         mMRPConfig         = config;
         SetFabricIndex(peerNode.GetFabricIndex());
+        NotifyPeerChanged(oldPeer);
     }
     ~SecureSession() override { NotifySessionReleased(); }
 
@@ -182,7 +187,9 @@ public:
         {
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
+        ScopedNodeId oldPeer = GetPeer();
         SetFabricIndex(fabricIndex);
+        NotifyPeerChanged(oldPeer);
         return CHIP_NO_ERROR;
     }
 
@@ -207,6 +214,11 @@ public:
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
 private:
+    friend class SecureSessionIndex;
+
+    // Keeps the index of the owning table current when the peer changes.
+    void NotifyPeerChanged(const ScopedNodeId & oldPeer);
+
     Type mSecureSessionType;
     const uint16_t mLocalSessionId;
     NodeId mLocalNodeId;
@@ -220,6 +232,7 @@ private:
     ReliableMessageProtocolConfig mMRPConfig;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+    SecureSessionIndex * mIndex = nullptr; ///< Index holding this session, if any
 };
 
 } // namespace Transport
@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/SecureSessionIndex.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Transport {
+
+namespace {
+
+constexpr uint64_t kFibonacciMultiplier = UINT64_C(0x9E3779B97F4A7C15);
+
+size_t Log2(size_t powerOfTwo)
+{
+    size_t log = 0;
+    for (; powerOfTwo > 1; powerOfTwo >>= 1)
+    {
+        log++;
+    }
+    return log;
+}
+
+bool IsIndexedByPeer(const ScopedNodeId & peer)
+{
+    return peer.GetNodeId() != kUndefinedNodeId;
+}
+
+} // namespace
+
+SecureSessionIndex::SecureSessionIndex(SecureSession ** localSessionIdSlots, SecureSession ** peerSlots, size_t slotCount) :
+    mLocalSessionIdSlots(localSessionIdSlots), mPeerSlots(peerSlots), mMask(slotCount - 1), mShift(64 - Log2(slotCount))
+{
+    VerifyOrDie(slotCount >= 2 && (slotCount & mMask) == 0);
+}
+
+size_t SecureSessionIndex::LocalSessionIdHome(uint16_t localSessionId) const
+{
+    return static_cast<size_t>((localSessionId * kFibonacciMultiplier) >> mShift);
+}
+
+size_t SecureSessionIndex::PeerHome(const ScopedNodeId & peer) const
+{
+    uint64_t hash = (peer.GetNodeId() ^ peer.GetFabricIndex()) * kFibonacciMultiplier;
+    hash          = (hash ^ (hash >> 32)) * kFibonacciMultiplier;
+    return static_cast<size_t>(hash >> mShift);
+}
+
+void SecureSessionIndex::Add(SecureSession & session)
+{
+    VerifyOrDie(session.mIndex == nullptr);
+
+    size_t index = LocalSessionIdHome(session.GetLocalSessionId());
+    while (mLocalSessionIdSlots[index] != nullptr)
+    {
+        index = (index + 1) & mMask;
+    }
+    mLocalSessionIdSlots[index] = &session;
+
+    if (IsIndexedByPeer(session.GetPeer()))
+    {
+        AddPeer(session);
+    }
+    session.mIndex = this;
+}
+
+void SecureSessionIndex::Remove(SecureSession & session)
+{
+    VerifyOrDie(session.mIndex == this);
+
+    size_t index = LocalSessionIdHome(session.GetLocalSessionId());
+    while (mLocalSessionIdSlots[index] != &session)
+    {
+        VerifyOrDie(mLocalSessionIdSlots[index] != nullptr);
+        index = (index + 1) & mMask;
+    }
+    RemoveSlot(mLocalSessionIdSlots, index,
+               [this](const SecureSession & other) { return LocalSessionIdHome(other.GetLocalSessionId()); });
+
+    if (IsIndexedByPeer(session.GetPeer()))
+    {
+        RemovePeer(session, session.GetPeer());
+    }
+    session.mIndex = nullptr;
+}
+
+SecureSession * SecureSessionIndex::FindByLocalSessionId(uint16_t localSessionId) const
+{
+    for (size_t index = LocalSessionIdHome(localSessionId); mLocalSessionIdSlots[index] != nullptr; index = (index + 1) & mMask)
+    {
+        if (mLocalSessionIdSlots[index]->GetLocalSessionId() == localSessionId)
+        {
+            return mLocalSessionIdSlots[index];
+        }
+    }
+    return nullptr;
+}
+
+void SecureSessionIndex::OnPeerChanged(SecureSession & session, const ScopedNodeId & oldPeer)
+{
+    if (IsIndexedByPeer(oldPeer))
+    {
+        RemovePeer(session, oldPeer);
+    }
+    if (IsIndexedByPeer(session.GetPeer()))
+    {
+        AddPeer(session);
+    }
+}
+
+void SecureSessionIndex::AddPeer(SecureSession & session)
+{
+    size_t index = PeerHome(session.GetPeer());
+    while (mPeerSlots[index] != nullptr)
+    {
+        index = (index + 1) & mMask;
+    }
+    mPeerSlots[index] = &session;
+}
+
+void SecureSessionIndex::RemovePeer(SecureSession & session, const ScopedNodeId & peer)
+{
+    // The session may already carry its new peer: look it up from where the old one put it.
+    size_t index = PeerHome(peer);
+    while (mPeerSlots[index] != &session)
+    {
+        VerifyOrDie(mPeerSlots[index] != nullptr);
+        index = (index + 1) & mMask;
+    }
+    RemoveSlot(mPeerSlots, index, [this](const SecureSession & other) { return PeerHome(other.GetPeer()); });
+}
+
+template <typename HomeFunction>
+void SecureSessionIndex::RemoveSlot(SecureSession ** slots, size_t index, HomeFunction && homeOf)
+{
+    // Shift back every following entry of the probe sequence that would no longer be reachable from
+    // its home slot once this one is empty.
+    size_t hole = index;
+    for (size_t next = (hole + 1) & mMask; slots[next] != nullptr; next = (next + 1) & mMask)
+    {
+        size_t home = homeOf(*slots[next]);
+        if (((next - home) & mMask) >= ((next - hole) & mMask))
+        {
+            slots[hole] = slots[next];
+            hole        = next;
+        }
+    }
+    slots[hole] = nullptr;
+}
+
+} // namespace Transport
+} // namespace chip
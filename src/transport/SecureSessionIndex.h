@@ -0,0 +1,103 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/Iterators.h>
+#include <transport/SecureSession.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Hash indexes of the sessions of a SecureSessionTable, by local session id and by peer.
+ *
+ * The slot arrays belong to the owning table, which sizes them with SlotCountFor(). Both indexes use
+ * linear probing with backward-shift deletion, so that sessions can come and go without leaving
+ * tombstones behind. Several sessions may share a peer. Sessions without a peer node id (i.e. pending
+ * ones) are only indexed by local session id.
+ *
+ * A session keeps a pointer to the index it was added to, so that its peer entry follows it through
+ * SecureSession::Activate and SecureSession::AdoptFabricIndex.
+ */
+class SecureSessionIndex
+{
+public:
+    SecureSessionIndex(SecureSession ** localSessionIdSlots, SecureSession ** peerSlots, size_t slotCount);
+
+    SecureSessionIndex(const SecureSessionIndex &) = delete;
+    SecureSessionIndex & operator=(const SecureSessionIndex &) = delete;
+
+    /**
+     * Number of slots each index needs for the given number of sessions: the smallest power of two
+     * that keeps the indexes at most half full.
+     */
+    static constexpr size_t SlotCountFor(size_t maxSessionCount)
+    {
+        size_t slotCount = 2;
+        while (slotCount < 2 * maxSessionCount)
+        {
+            slotCount *= 2;
+        }
+        return slotCount;
+    }
+
+    void Add(SecureSession & session);
+    void Remove(SecureSession & session);
+
+    SecureSession * FindByLocalSessionId(uint16_t localSessionId) const;
+
+    /**
+     * Calls function on each session with the given peer, until it returns Loop::Break. The peer
+     * must have a node id: sessions without one are not indexed by peer.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function) const
+    {
+        for (size_t index = PeerHome(peer); mPeerSlots[index] != nullptr; index = (index + 1) & mMask)
+        {
+            if (mPeerSlots[index]->GetPeer() == peer && function(mPeerSlots[index]) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+private:
+    friend class SecureSession;
+
+    // Called by the session once its peer has changed from oldPeer.
+    void OnPeerChanged(SecureSession & session, const ScopedNodeId & oldPeer);
+
+    size_t LocalSessionIdHome(uint16_t localSessionId) const;
+    size_t PeerHome(const ScopedNodeId & peer) const;
+
+    void AddPeer(SecureSession & session);
+    void RemovePeer(SecureSession & session, const ScopedNodeId & peer);
+
+    template <typename HomeFunction>
+    void RemoveSlot(SecureSession ** slots, size_t index, HomeFunction && homeOf);
+
+    SecureSession ** const mLocalSessionIdSlots;
+    SecureSession ** const mPeerSlots;
+    const size_t mMask;  // Slot count - 1
+    const size_t mShift; // 64 - log2(slot count)
+};
+
+} // namespace Transport
+} // namespace chip
@@ -21,6 +21,7 @@
 #include <lib/support/Pool.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
+#include <transport/SecureSessionIndex.h>
 
 namespace chip {
 namespace Transport {
@@ -33,13 +34,20 @@ constexpr uint16_t kUnsecuredSessionId = 0;
  *
  * Intended for:
  *   - handle session active time and expiration
- *   - allocate and free space for sessions.
+ *   - allocate and free space for sessions
+ *   - find sessions by local session id or by peer in constant time.
  */
 template <size_t kMaxSessionCount>
 class SecureSessionTable
 {
 public:
-    ~SecureSessionTable() { mEntries.ReleaseAll(); }
+    ~SecureSessionTable()
+    {
+        mEntries.ForEachActiveObject([&](auto session) {
+            ReleaseSession(session);
+            return Loop::Continue;
+        });
+    }
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
 
@@ -91,7 +99,9 @@ public:
 
         SecureSession * result = mEntries.CreateObject(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
                                                        peerSessionId, fabricIndex, config);
-        return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+        VerifyOrReturnError(result != nullptr, Optional<SessionHandle>::Missing());
+        mIndex.Add(*result);
+        return MakeOptional<SessionHandle>(*result);
     }
 
     /**
@@ -116,6 +126,7 @@ public:
         VerifyOrExit(!FindSecureSessionByLocalKey(localSessionId).HasValue(), rv = NullOptional);
         allocated = mEntries.CreateObject(localSessionId);
         VerifyOrExit(allocated != nullptr, rv = Optional<SessionHandle>::Missing());
+        mIndex.Add(*allocated);
         rv = MakeOptional<SessionHandle>(*allocated);
     exit:
         return rv;
@@ -138,6 +149,7 @@ public:
         VerifyOrExit(sessionId.HasValue(), rv = Optional<SessionHandle>::Missing());
         allocated = mEntries.CreateObject(sessionId.Value());
         VerifyOrExit(allocated != nullptr, rv = Optional<SessionHandle>::Missing());
+        mIndex.Add(*allocated);
         rv             = MakeOptional<SessionHandle>(*allocated);
         mNextSessionId = sessionId.Value() == kMaxSessionID ? static_cast<uint16_t>(kUnsecuredSessionId + 1)
                                                             : static_cast<uint16_t>(sessionId.Value() + 1);
@@ -145,7 +157,11 @@ public:
         return rv;
     }
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        mIndex.Remove(*session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -162,16 +178,41 @@ public:
      */
     CHECK_RETURN_VALUE
     Optional<SessionHandle> FindSecureSessionByLocalKey(uint16_t localSessionId)
+    {
+        SecureSession * result = mIndex.FindByLocalSessionId(localSessionId);
+        return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+    }
+
+    /**
+     * Get a secure session with the given peer.
+     *
+     * @param peerNodeId the peer node and its fabric
+     * @param type if present, only sessions of this type are considered
+     *
+     * @return a matching session if any, NullOptional if not found
+     */
+    CHECK_RETURN_VALUE
+    Optional<SessionHandle> FindSecureSessionForNode(const ScopedNodeId & peerNodeId, const Optional<SecureSession::Type> & type)
     {
         SecureSession * result = nullptr;
-        mEntries.ForEachActiveObject([&](auto session) {
-            if (session->GetLocalSessionId() == localSessionId)
+        auto match             = [&](SecureSession * session) {
+            if (session->GetPeer() == peerNodeId && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
             {
                 result = session;
                 return Loop::Break;
             }
             return Loop::Continue;
-        });
+        };
+
+        // Sessions without a peer node id yet are not indexed by peer.
+        if (peerNodeId.GetNodeId() != kUndefinedNodeId)
+        {
+            mIndex.ForEachSessionWithPeer(peerNodeId, match);
+        }
+        else
+        {
+            mEntries.ForEachActiveObject([&](SecureSession * session) { return match(session); });
+        }
         return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
     }
 
@@ -199,70 +240,32 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(kMaxSessionCount^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Candidates are tried in order from the mNextSessionId clue. As at most kMaxSessionCount IDs are
+     * in use, at most kMaxSessionCount + 1 lookups are needed, each in constant time.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId()
     {
-        uint16_t candidate_base = 0;
-        uint64_t candidate_mask = 0;
-        for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+        for (uint32_t i = 0; i <= kMaxSessionID; i++)
         {
-            // candidate_base is the base session ID we are searching from.
-            // We have a 64-bit mask anchored at this ID and iterate over the
-            // whole session table, setting bits in the mask for in-use IDs.
-            // If we can iterate through the entire session table and have
-            // any bits clear in the mask, we have available session IDs.
-            candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-            candidate_mask = 0;
+            uint16_t candidate = static_cast<uint16_t>(mNextSessionId + i);
+            if (candidate != kUnsecuredSessionId && mIndex.FindByLocalSessionId(candidate) == nullptr)
             {
-                uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-                if (shift <= 63)
-                {
-                    candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-                }
-            }
-            mEntries.ForEachActiveObject([&](auto session) {
-                uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-                if (shift <= 63)
-                {
-                    candidate_mask |= (1ULL << shift);
-                }
-                if (candidate_mask == UINT64_MAX)
-                {
-                    return Loop::Break; // No bits clear means this bucket is full.
-                }
-                return Loop::Continue;
-            });
-            if (candidate_mask != UINT64_MAX)
-            {
-                break; // Any bit clear means we have an available ID in this bucket.
+                return MakeOptional(candidate);
             }
         }
-        if (candidate_mask != UINT64_MAX)
-        {
-            uint16_t offset = 0;
-            while (candidate_mask & 1)
-            {
-                candidate_mask >>= 1;
-                ++offset;
-            }
-            uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-            return MakeOptional<uint16_t>(available);
-        }
 
         return NullOptional;
     }
 
+    static constexpr size_t kIndexSlotCount = SecureSessionIndex::SlotCountFor(kMaxSessionCount);
+
     BitMapObjectPool<SecureSession, kMaxSessionCount> mEntries;
+    SecureSession * mLocalSessionIdSlots[kIndexSlotCount] = {};
+    SecureSession * mPeerSlots[kIndexSlotCount]           = {};
+    SecureSessionIndex mIndex{ mLocalSessionIdSlots, mPeerSlots, kIndexSlotCount };
     uint16_t mNextSessionId = 0;
 };
 
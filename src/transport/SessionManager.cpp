@@ -789,17 +789,7 @@ void SessionManager::ExpiryTimerCallback(System::Layer * layer, void * param)
 Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId peerNodeId,
                                                                  const Optional<Transport::SecureSession::Type> & type)
 {
-    SecureSession * found = nullptr;
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &found](auto session) {
-        if (session->GetPeer() == peerNodeId && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
-        {
-            found = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-
-    return found != nullptr ? MakeOptional<SessionHandle>(*found) : Optional<SessionHandle>::Missing();
+    return mSecureSessions.FindSecureSessionForNode(peerNodeId, type);
 }
 
 /**
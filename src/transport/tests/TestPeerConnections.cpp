@@ -29,6 +29,9 @@
 
 #include <nlunit-test.h>
 
+#include <chrono>
+#include <stdio.h>
+
 namespace {
 
 using namespace chip;
@@ -233,6 +236,154 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     System::Clock::Internal::SetSystemClockForTesting(realClock);
 }
 
+
+void TestFindForNode(nlTestSuite * inSuite, void * inContext)
+{
+    SecureSessionTable<4> connections;
+    const ScopedNodeId peer1(kCasePeer1NodeId, kFabricIndex);
+    const ScopedNodeId peer2(kCasePeer2NodeId, kFabricIndex);
+    const Optional<SecureSession::Type> anyType;
+    const Optional<SecureSession::Type> caseType = MakeOptional(SecureSession::Type::kCASE);
+    const Optional<SecureSession::Type> paseType = MakeOptional(SecureSession::Type::kPASE);
+
+    auto optionalSession = connections.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 2, kLocalNodeId, kCasePeer1NodeId,
+                                                                     kPeer1CATs, 1, kFabricIndex, GetLocalMRPConfig());
+    NL_TEST_ASSERT(inSuite, optionalSession.HasValue());
+    SecureSession * session1 = optionalSession.Value()->AsSecureSession();
+
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer1, anyType).Value()->AsSecureSession() == session1);
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer1, caseType).Value()->AsSecureSession() == session1);
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionForNode(peer1, paseType).HasValue());
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionForNode(peer2, anyType).HasValue());
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionForNode(ScopedNodeId(kCasePeer1NodeId, 1), anyType).HasValue());
+
+    // A pending session is only found by peer once activated.
+    optionalSession = connections.CreateNewSecureSession(4);
+    NL_TEST_ASSERT(inSuite, optionalSession.HasValue());
+    SecureSession * session2 = optionalSession.Value()->AsSecureSession();
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionForNode(peer2, anyType).HasValue());
+    session2->Activate(SecureSession::Type::kCASE, ScopedNodeId(kLocalNodeId, kFabricIndex), peer2, kPeer2CATs, 3,
+                       GetLocalMRPConfig());
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer2, anyType).Value()->AsSecureSession() == session2);
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionByLocalKey(4).Value()->AsSecureSession() == session2);
+
+    // A PASE session follows the fabric it adopts.
+    optionalSession = connections.CreateNewSecureSession(6);
+    NL_TEST_ASSERT(inSuite, optionalSession.HasValue());
+    SecureSession * session3 = optionalSession.Value()->AsSecureSession();
+    session3->Activate(SecureSession::Type::kPASE, ScopedNodeId(), ScopedNodeId(kPasePeerNodeId, kUndefinedFabricIndex),
+                       kPeer3CATs, 5, GetLocalMRPConfig());
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(ScopedNodeId(), anyType).Value()->AsSecureSession() == session3);
+    NL_TEST_ASSERT(inSuite, session3->AdoptFabricIndex(kFabricIndex) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionForNode(ScopedNodeId(), anyType).HasValue());
+    optionalSession = connections.FindSecureSessionForNode(ScopedNodeId(kPasePeerNodeId, kFabricIndex), anyType);
+    NL_TEST_ASSERT(inSuite, optionalSession.Value()->AsSecureSession() == session3);
+
+    // Several sessions with the same peer can be found by type.
+    optionalSession = connections.CreateNewSecureSessionForTest(SecureSession::Type::kPASE, 8, kLocalNodeId, kCasePeer1NodeId,
+                                                                kPeer3CATs, 7, kFabricIndex, GetLocalMRPConfig());
+    NL_TEST_ASSERT(inSuite, optionalSession.HasValue());
+    SecureSession * session4 = optionalSession.Value()->AsSecureSession();
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer1, paseType).Value()->AsSecureSession() == session4);
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer1, caseType).Value()->AsSecureSession() == session1);
+
+    // Released sessions are no longer found, the others still are.
+    connections.ReleaseSession(session1);
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionForNode(peer1, caseType).HasValue());
+    NL_TEST_ASSERT(inSuite, !connections.FindSecureSessionByLocalKey(2).HasValue());
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer1, anyType).Value()->AsSecureSession() == session4);
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionForNode(peer2, anyType).Value()->AsSecureSession() == session2);
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionByLocalKey(8).Value()->AsSecureSession() == session4);
+
+    // Released session ids are handed out again.
+    optionalSession = connections.CreateNewSecureSession(2);
+    NL_TEST_ASSERT(inSuite, optionalSession.HasValue());
+    NL_TEST_ASSERT(inSuite, connections.FindSecureSessionByLocalKey(2).HasValue());
+}
+
+// Linear scan by local session id and by peer, as done before sessions were indexed.
+template <size_t kMaxSessionCount>
+SecureSession * ScanForLocalSessionId(SecureSessionTable<kMaxSessionCount> & connections, uint16_t localSessionId)
+{
+    SecureSession * result = nullptr;
+    connections.ForEachSession([&](auto session) {
+        if (session->GetLocalSessionId() == localSessionId)
+        {
+            result = session;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return result;
+}
+
+template <size_t kMaxSessionCount>
+SecureSession * ScanForNode(SecureSessionTable<kMaxSessionCount> & connections, const ScopedNodeId & peer)
+{
+    SecureSession * result = nullptr;
+    connections.ForEachSession([&](auto session) {
+        if (session->GetPeer() == peer)
+        {
+            result = session;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return result;
+}
+
+template <size_t kMaxSessionCount>
+void RunLookupScaling(nlTestSuite * inSuite)
+{
+    constexpr size_t kLookupCount = 20000;
+
+    // Too large for the stack with the biggest session counts.
+    auto * connections = new SecureSessionTable<kMaxSessionCount>();
+    connections->Init();
+    for (size_t i = 0; i < kMaxSessionCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       connections
+                           ->CreateNewSecureSessionForTest(SecureSession::Type::kCASE, static_cast<uint16_t>(i + 1), kLocalNodeId,
+                                                           static_cast<NodeId>(i + 1), kPeer1CATs, static_cast<uint16_t>(i + 1),
+                                                           kFabricIndex, GetLocalMRPConfig())
+                           .HasValue());
+    }
+
+    size_t found = 0;
+    auto start   = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookupCount; i++)
+    {
+        uint16_t localSessionId = static_cast<uint16_t>(i % kMaxSessionCount + 1);
+        found += connections->FindSecureSessionByLocalKey(localSessionId).HasValue() ? 1 : 0;
+        found += connections->FindSecureSessionForNode(ScopedNodeId(localSessionId, kFabricIndex), NullOptional).HasValue() ? 1 : 0;
+    }
+    auto indexed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kLookupCount; i++)
+    {
+        uint16_t localSessionId = static_cast<uint16_t>(i % kMaxSessionCount + 1);
+        found += ScanForLocalSessionId(*connections, localSessionId) != nullptr ? 1 : 0;
+        found += ScanForNode(*connections, ScopedNodeId(localSessionId, kFabricIndex)) != nullptr ? 1 : 0;
+    }
+    auto scanned = std::chrono::steady_clock::now() - start;
+    NL_TEST_ASSERT(inSuite, found == 4 * kLookupCount);
+
+    printf("%5u sessions: indexed %6.1f ns/lookup, scan %8.1f ns/lookup\n", static_cast<unsigned>(kMaxSessionCount),
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(indexed).count()) / (2 * kLookupCount),
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(scanned).count()) / (2 * kLookupCount));
+
+    delete connections;
+}
+
+void TestLookupScaling(nlTestSuite * inSuite, void * inContext)
+{
+    RunLookupScaling<16>(inSuite);
+    RunLookupScaling<128>(inSuite);
+    RunLookupScaling<1024>(inSuite);
+}
+
 } // namespace
 
 // clang-format off
@@ -241,6 +392,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("BasicFunctionality", TestBasicFunctionality),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
     NL_TEST_DEF("ExpireConnections", TestExpireConnections),
+    NL_TEST_DEF("FindForNode", TestFindForNode),
+    NL_TEST_DEF("LookupScaling", TestLookupScaling),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -39,18 +39,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLabel), label));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLabel):
             ReturnErrorOnFailure(DataModel::Decode(reader, label));
@@ -63,10 +60,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace LabelStruct
@@ -360,17 +354,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIdentifyTime), identifyTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIdentifyTime):
             ReturnErrorOnFailure(DataModel::Decode(reader, identifyTime));
@@ -380,9 +371,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Identify.
 namespace IdentifyQueryResponse {
@@ -397,17 +386,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeout), timeout));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTimeout):
             ReturnErrorOnFailure(DataModel::Decode(reader, timeout));
@@ -417,9 +403,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace IdentifyQueryResponse.
 namespace IdentifyQuery {
@@ -433,26 +417,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace IdentifyQuery.
 namespace TriggerEffect {
@@ -468,17 +446,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEffectIdentifier), effectIdentifier));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEffectVariant), effectVariant));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEffectIdentifier):
             ReturnErrorOnFailure(DataModel::Decode(reader, effectIdentifier));
@@ -491,9 +467,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TriggerEffect.
 } // namespace Commands
@@ -552,17 +526,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupName), groupName));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -575,9 +547,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddGroup.
 namespace AddGroupResponse {
@@ -593,17 +563,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -616,9 +584,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddGroupResponse.
 namespace ViewGroup {
@@ -633,17 +599,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -653,9 +616,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ViewGroup.
 namespace ViewGroupResponse {
@@ -672,17 +633,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupName), groupName));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -698,9 +658,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ViewGroupResponse.
 namespace GetGroupMembership {
@@ -715,17 +673,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupList), groupList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupList):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupList));
@@ -735,9 +690,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetGroupMembership.
 namespace GetGroupMembershipResponse {
@@ -753,17 +706,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCapacity), capacity));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupList), groupList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCapacity):
             ReturnErrorOnFailure(DataModel::Decode(reader, capacity));
@@ -776,9 +727,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetGroupMembershipResponse.
 namespace RemoveGroup {
@@ -793,17 +742,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -813,9 +759,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveGroup.
 namespace RemoveGroupResponse {
@@ -831,17 +775,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -854,9 +796,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveGroupResponse.
 namespace RemoveAllGroups {
@@ -870,26 +810,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveAllGroups.
 namespace AddGroupIfIdentifying {
@@ -905,17 +839,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupName), groupName));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -928,9 +860,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddGroupIfIdentifying.
 } // namespace Commands
@@ -986,18 +916,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kClusterId), clusterId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLength), length));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kClusterId):
             ReturnErrorOnFailure(DataModel::Decode(reader, clusterId));
@@ -1013,10 +941,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace SceneExtensionFieldSet
@@ -1040,17 +965,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneName), sceneName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtensionFieldSets), extensionFieldSets));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1072,9 +998,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddScene.
 namespace AddSceneResponse {
@@ -1091,17 +1015,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1117,9 +1040,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddSceneResponse.
 namespace ViewScene {
@@ -1135,17 +1056,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1158,9 +1077,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ViewScene.
 namespace ViewSceneResponse {
@@ -1181,17 +1098,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneName), sceneName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtensionFieldSets), extensionFieldSets));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1216,9 +1135,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ViewSceneResponse.
 namespace RemoveScene {
@@ -1234,17 +1151,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1257,9 +1172,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveScene.
 namespace RemoveSceneResponse {
@@ -1276,17 +1189,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1302,9 +1214,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveSceneResponse.
 namespace RemoveAllScenes {
@@ -1319,17 +1229,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1339,9 +1246,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveAllScenes.
 namespace RemoveAllScenesResponse {
@@ -1357,17 +1262,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1380,9 +1283,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveAllScenesResponse.
 namespace StoreScene {
@@ -1398,17 +1299,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1421,9 +1320,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StoreScene.
 namespace StoreSceneResponse {
@@ -1440,17 +1337,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1466,9 +1362,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StoreSceneResponse.
 namespace RecallScene {
@@ -1485,17 +1379,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1511,9 +1404,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RecallScene.
 namespace GetSceneMembership {
@@ -1528,17 +1419,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1548,9 +1436,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetSceneMembership.
 namespace GetSceneMembershipResponse {
@@ -1569,17 +1455,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCapacity), capacity));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneCount), sceneCount));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneList), sceneList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1601,9 +1488,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetSceneMembershipResponse.
 namespace EnhancedAddScene {
@@ -1623,17 +1508,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneName), sceneName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtensionFieldSets), extensionFieldSets));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1655,9 +1541,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedAddScene.
 namespace EnhancedAddSceneResponse {
@@ -1674,17 +1558,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1700,9 +1583,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedAddSceneResponse.
 namespace EnhancedViewScene {
@@ -1718,17 +1599,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -1741,9 +1620,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedViewScene.
 namespace EnhancedViewSceneResponse {
@@ -1764,17 +1641,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneId), sceneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneName), sceneName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtensionFieldSets), extensionFieldSets));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1799,9 +1678,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedViewSceneResponse.
 namespace CopyScene {
@@ -1820,17 +1697,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMode), mode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupIdFrom), groupIdFrom));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneIdFrom), sceneIdFrom));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupIdTo), groupIdTo));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneIdTo), sceneIdTo));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, mode));
@@ -1852,9 +1730,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CopyScene.
 namespace CopySceneResponse {
@@ -1871,17 +1747,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupIdFrom), groupIdFrom));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSceneIdFrom), sceneIdFrom));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -1897,9 +1772,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CopySceneResponse.
 } // namespace Commands
@@ -1968,26 +1841,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Off.
 namespace On {
@@ -2001,26 +1868,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace On.
 namespace Toggle {
@@ -2034,26 +1895,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Toggle.
 namespace OffWithEffect {
@@ -2069,17 +1924,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEffectId), effectId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEffectVariant), effectVariant));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEffectId):
             ReturnErrorOnFailure(DataModel::Decode(reader, effectId));
@@ -2092,9 +1945,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OffWithEffect.
 namespace OnWithRecallGlobalScene {
@@ -2108,26 +1959,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OnWithRecallGlobalScene.
 namespace OnWithTimedOff {
@@ -2144,17 +1989,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOnOffControl), onOffControl));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOnTime), onTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOffWaitTime), offWaitTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOnOffControl):
             ReturnErrorOnFailure(DataModel::Decode(reader, onOffControl));
@@ -2170,9 +2014,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OnWithTimedOff.
 } // namespace Commands
@@ -2285,17 +2127,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLevel), level));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionMask), optionMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionOverride), optionOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLevel):
             ReturnErrorOnFailure(DataModel::Decode(reader, level));
@@ -2314,9 +2156,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToLevel.
 namespace Move {
@@ -2334,17 +2174,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMoveMode), moveMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRate), rate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionMask), optionMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionOverride), optionOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMoveMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, moveMode));
@@ -2363,9 +2203,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Move.
 namespace Step {
@@ -2384,17 +2222,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepMode), stepMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepSize), stepSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionMask), optionMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionOverride), optionOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepMode));
@@ -2416,9 +2255,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Step.
 namespace Stop {
@@ -2434,17 +2271,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionMask), optionMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionOverride), optionOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOptionMask):
             ReturnErrorOnFailure(DataModel::Decode(reader, optionMask));
@@ -2457,9 +2292,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Stop.
 namespace MoveToLevelWithOnOff {
@@ -2475,17 +2308,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLevel), level));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLevel):
             ReturnErrorOnFailure(DataModel::Decode(reader, level));
@@ -2498,9 +2329,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToLevelWithOnOff.
 namespace MoveWithOnOff {
@@ -2516,17 +2345,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMoveMode), moveMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRate), rate));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMoveMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, moveMode));
@@ -2539,9 +2366,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveWithOnOff.
 namespace StepWithOnOff {
@@ -2558,17 +2383,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepMode), stepMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepSize), stepSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepMode));
@@ -2584,9 +2408,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StepWithOnOff.
 namespace StopWithOnOff {
@@ -2600,26 +2422,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StopWithOnOff.
 } // namespace Commands
@@ -2714,17 +2530,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlarmCode), alarmCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kClusterId), clusterId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAlarmCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, alarmCode));
@@ -2737,9 +2551,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetAlarm.
 namespace Alarm {
@@ -2755,17 +2567,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlarmCode), alarmCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kClusterId), clusterId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAlarmCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, alarmCode));
@@ -2778,9 +2588,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Alarm.
 namespace ResetAllAlarms {
@@ -2794,26 +2602,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetAllAlarms.
 namespace GetAlarmResponse {
@@ -2831,17 +2633,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlarmCode), alarmCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kClusterId), clusterId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeStamp), timeStamp));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -2860,9 +2662,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetAlarmResponse.
 namespace GetAlarm {
@@ -2876,26 +2676,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetAlarm.
 namespace ResetAlarmLog {
@@ -2909,26 +2703,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetAlarmLog.
 } // namespace Commands
@@ -3117,18 +2905,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnergyPhaseId), energyPhaseId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileRemoteControl), powerProfileRemoteControl));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileState), powerProfileState));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3147,10 +2934,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace PowerProfileRecord
@@ -3167,18 +2951,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnergyPhaseId), energyPhaseId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kScheduledTime), scheduledTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEnergyPhaseId):
             ReturnErrorOnFailure(DataModel::Decode(reader, energyPhaseId));
@@ -3191,10 +2972,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ScheduledPhase
@@ -3216,18 +2994,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnergyPhaseId), energyPhaseId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMacroPhaseId), macroPhaseId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExpectedDuration), expectedDuration));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPeakPower), peakPower));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnergy), energy));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMaxActivationDelay), maxActivationDelay));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEnergyPhaseId):
             ReturnErrorOnFailure(DataModel::Decode(reader, energyPhaseId));
@@ -3252,10 +3031,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace TransferredPhase
@@ -3274,17 +3050,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3294,9 +3067,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileRequest.
 namespace PowerProfileNotification {
@@ -3315,17 +3086,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTotalProfileNum), totalProfileNum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumOfTransferredPhases), numOfTransferredPhases));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransferredPhases), transferredPhases));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTotalProfileNum):
             ReturnErrorOnFailure(DataModel::Decode(reader, totalProfileNum));
@@ -3344,9 +3115,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileNotification.
 namespace PowerProfileStateRequest {
@@ -3360,26 +3129,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileStateRequest.
 namespace PowerProfileResponse {
@@ -3398,17 +3161,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTotalProfileNum), totalProfileNum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumOfTransferredPhases), numOfTransferredPhases));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransferredPhases), transferredPhases));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTotalProfileNum):
             ReturnErrorOnFailure(DataModel::Decode(reader, totalProfileNum));
@@ -3427,9 +3190,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileResponse.
 namespace GetPowerProfilePriceResponse {
@@ -3448,17 +3209,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrency), currency));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrice), price));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPriceTrailingDigit), priceTrailingDigit));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3477,9 +3238,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPowerProfilePriceResponse.
 namespace PowerProfileStateResponse {
@@ -3496,17 +3255,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileCount), powerProfileCount));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileRecords), powerProfileRecords));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileCount):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileCount));
@@ -3519,9 +3276,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileStateResponse.
 namespace GetOverallSchedulePriceResponse {
@@ -3539,17 +3294,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrency), currency));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrice), price));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPriceTrailingDigit), priceTrailingDigit));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrency):
             ReturnErrorOnFailure(DataModel::Decode(reader, currency));
@@ -3565,9 +3319,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetOverallSchedulePriceResponse.
 namespace GetPowerProfilePrice {
@@ -3582,17 +3334,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3602,9 +3351,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPowerProfilePrice.
 namespace EnergyPhasesScheduleNotification {
@@ -3622,17 +3369,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumOfScheduledPhases), numOfScheduledPhases));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kScheduledPhases), scheduledPhases));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3648,9 +3394,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnergyPhasesScheduleNotification.
 namespace PowerProfilesStateNotification {
@@ -3667,17 +3411,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileCount), powerProfileCount));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileRecords), powerProfileRecords));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileCount):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileCount));
@@ -3690,9 +3432,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfilesStateNotification.
 namespace EnergyPhasesScheduleResponse {
@@ -3710,17 +3450,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumOfScheduledPhases), numOfScheduledPhases));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kScheduledPhases), scheduledPhases));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3736,9 +3475,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnergyPhasesScheduleResponse.
 namespace GetOverallSchedulePrice {
@@ -3752,26 +3489,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetOverallSchedulePrice.
 namespace PowerProfileScheduleConstraintsRequest {
@@ -3786,17 +3517,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3806,9 +3534,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileScheduleConstraintsRequest.
 namespace EnergyPhasesScheduleRequest {
@@ -3823,17 +3549,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3843,9 +3566,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnergyPhasesScheduleRequest.
 namespace EnergyPhasesScheduleStateRequest {
@@ -3860,17 +3581,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3880,9 +3598,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnergyPhasesScheduleStateRequest.
 namespace EnergyPhasesScheduleStateResponse {
@@ -3900,17 +3616,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumOfScheduledPhases), numOfScheduledPhases));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kScheduledPhases), scheduledPhases));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3926,9 +3641,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnergyPhasesScheduleStateResponse.
 namespace GetPowerProfilePriceExtendedResponse {
@@ -3947,17 +3660,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrency), currency));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrice), price));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPriceTrailingDigit), priceTrailingDigit));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -3976,9 +3689,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPowerProfilePriceExtendedResponse.
 namespace EnergyPhasesScheduleStateNotification {
@@ -3996,17 +3707,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumOfScheduledPhases), numOfScheduledPhases));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kScheduledPhases), scheduledPhases));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -4022,9 +3732,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnergyPhasesScheduleStateNotification.
 namespace PowerProfileScheduleConstraintsNotification {
@@ -4041,17 +3749,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartAfter), startAfter));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStopBefore), stopBefore));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -4067,9 +3774,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileScheduleConstraintsNotification.
 namespace PowerProfileScheduleConstraintsResponse {
@@ -4086,17 +3791,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartAfter), startAfter));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStopBefore), stopBefore));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPowerProfileId):
             ReturnErrorOnFailure(DataModel::Decode(reader, powerProfileId));
@@ -4112,9 +3816,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerProfileScheduleConstraintsResponse.
 namespace GetPowerProfilePriceExtended {
@@ -4132,17 +3834,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptions), options));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileId), powerProfileId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPowerProfileStartTime), powerProfileStartTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOptions):
             ReturnErrorOnFailure(DataModel::Decode(reader, options));
@@ -4158,9 +3859,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPowerProfilePriceExtended.
 } // namespace Commands
@@ -4227,17 +3926,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCommandId), commandId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCommandId):
             ReturnErrorOnFailure(DataModel::Decode(reader, commandId));
@@ -4247,9 +3943,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ExecutionOfACommand.
 namespace SignalStateResponse {
@@ -4267,17 +3961,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplianceStatus), applianceStatus));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kRemoteEnableFlagsAndDeviceStatus2), remoteEnableFlagsAndDeviceStatus2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplianceStatus2), applianceStatus2));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kApplianceStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, applianceStatus));
@@ -4293,9 +3987,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SignalStateResponse.
 namespace SignalState {
@@ -4309,26 +4001,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SignalState.
 namespace SignalStateNotification {
@@ -4346,17 +4032,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplianceStatus), applianceStatus));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kRemoteEnableFlagsAndDeviceStatus2), remoteEnableFlagsAndDeviceStatus2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplianceStatus2), applianceStatus2));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kApplianceStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, applianceStatus));
@@ -4372,9 +4058,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SignalStateNotification.
 namespace WriteFunctions {
@@ -4391,17 +4075,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFunctionId), functionId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFunctionDataType), functionDataType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFunctionData), functionData));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kFunctionId):
             ReturnErrorOnFailure(DataModel::Decode(reader, functionId));
@@ -4417,9 +4100,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace WriteFunctions.
 namespace OverloadPauseResume {
@@ -4433,26 +4114,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OverloadPauseResume.
 namespace OverloadPause {
@@ -4466,26 +4141,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OverloadPause.
 namespace OverloadWarning {
@@ -4500,17 +4169,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWarningEvent), warningEvent));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWarningEvent):
             ReturnErrorOnFailure(DataModel::Decode(reader, warningEvent));
@@ -4520,9 +4186,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OverloadWarning.
 } // namespace Commands
@@ -4620,18 +4284,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kType), type));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRevision), revision));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kType):
             ReturnErrorOnFailure(DataModel::Decode(reader, type));
@@ -4644,10 +4305,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace DeviceType
@@ -4731,18 +4389,18 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNode), node));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroup), group));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoint), endpoint));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCluster), cluster));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNode):
             ReturnErrorOnFailure(DataModel::Decode(reader, node));
@@ -4764,10 +4422,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace TargetStruct
@@ -4827,18 +4482,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCluster), cluster));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoint), endpoint));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDeviceType), deviceType));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCluster):
             ReturnErrorOnFailure(DataModel::Decode(reader, cluster));
@@ -4854,10 +4507,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace Target
@@ -4903,18 +4553,18 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrivilege), privilege));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAuthMode), authMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSubjects), subjects));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTargets), targets));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPrivilege):
             ReturnErrorOnFailure(DataModel::Decode(reader, privilege));
@@ -4936,10 +4586,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace AccessControlEntry
@@ -4973,18 +4620,15 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kData):
             ReturnErrorOnFailure(DataModel::Decode(reader, data));
@@ -4997,10 +4641,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ExtensionEntry
@@ -5070,17 +4711,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminNodeID), adminNodeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminPasscodeID), adminPasscodeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kChangeType), changeType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLatestValue), latestValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminFabricIndex), adminFabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAdminNodeID):
             ReturnErrorOnFailure(DataModel::Decode(reader, adminNodeID));
@@ -5102,9 +4744,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AccessControlEntryChanged.
 namespace AccessControlExtensionChanged {
@@ -5124,17 +4764,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminNodeID), adminNodeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminPasscodeID), adminPasscodeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kChangeType), changeType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLatestValue), latestValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminFabricIndex), adminFabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAdminNodeID):
             ReturnErrorOnFailure(DataModel::Decode(reader, adminNodeID));
@@ -5156,9 +4797,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AccessControlExtensionChanged.
 } // namespace Events
@@ -5178,26 +4817,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CheckIn.
 namespace CheckInResponse {
@@ -5213,17 +4846,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartFastPolling), startFastPolling));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFastPollTimeout), fastPollTimeout));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStartFastPolling):
             ReturnErrorOnFailure(DataModel::Decode(reader, startFastPolling));
@@ -5236,9 +4867,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CheckInResponse.
 namespace FastPollStop {
@@ -5252,26 +4881,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace FastPollStop.
 namespace SetLongPollInterval {
@@ -5287,17 +4910,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewLongPollInterval), newLongPollInterval));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewLongPollInterval):
             ReturnErrorOnFailure(DataModel::Decode(reader, newLongPollInterval));
@@ -5307,9 +4927,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetLongPollInterval.
 namespace SetShortPollInterval {
@@ -5325,17 +4943,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewShortPollInterval), newShortPollInterval));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewShortPollInterval):
             ReturnErrorOnFailure(DataModel::Decode(reader, newShortPollInterval));
@@ -5345,9 +4960,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetShortPollInterval.
 } // namespace Commands
@@ -5424,18 +5037,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kType), type));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpointListID), endpointListID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSupportedCommands), supportedCommands));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5460,11 +5074,8 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
-}
+    return decoder.Exit(err);
+}
 
 } // namespace ActionStruct
 namespace EndpointListStruct {
@@ -5482,18 +5093,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpointListID), endpointListID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kType), type));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoints), endpoints));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEndpointListID):
             ReturnErrorOnFailure(DataModel::Decode(reader, endpointListID));
@@ -5512,10 +5122,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace EndpointListStruct
@@ -5535,17 +5142,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5558,9 +5163,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InstantAction.
 namespace InstantActionWithTransition {
@@ -5577,17 +5180,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5603,9 +5205,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InstantActionWithTransition.
 namespace StartAction {
@@ -5621,17 +5221,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5644,9 +5242,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StartAction.
 namespace StartActionWithDuration {
@@ -5663,17 +5259,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDuration), duration));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5689,9 +5284,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StartActionWithDuration.
 namespace StopAction {
@@ -5707,17 +5300,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5730,9 +5321,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StopAction.
 namespace PauseAction {
@@ -5748,17 +5337,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5771,9 +5358,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PauseAction.
 namespace PauseActionWithDuration {
@@ -5790,17 +5375,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDuration), duration));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5816,9 +5400,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PauseActionWithDuration.
 namespace ResumeAction {
@@ -5834,17 +5416,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5857,9 +5437,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResumeAction.
 namespace EnableAction {
@@ -5875,17 +5453,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5898,9 +5474,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnableAction.
 namespace EnableActionWithDuration {
@@ -5917,17 +5491,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDuration), duration));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5943,9 +5516,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnableActionWithDuration.
 namespace DisableAction {
@@ -5961,17 +5532,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -5984,9 +5553,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DisableAction.
 namespace DisableActionWithDuration {
@@ -6003,17 +5570,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDuration), duration));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -6029,9 +5595,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DisableActionWithDuration.
 } // namespace Commands
@@ -6088,17 +5652,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewState), newState));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -6114,9 +5677,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StateChanged.
 namespace ActionFailed {
@@ -6134,17 +5695,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActionID), actionID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInvokeID), invokeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewState), newState));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kError), error));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActionID):
             ReturnErrorOnFailure(DataModel::Decode(reader, actionID));
@@ -6163,9 +5724,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ActionFailed.
 } // namespace Events
@@ -6188,18 +5747,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCaseSessionsPerFabric), caseSessionsPerFabric));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSubscriptionsPerFabric), subscriptionsPerFabric));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCaseSessionsPerFabric):
             ReturnErrorOnFailure(DataModel::Decode(reader, caseSessionsPerFabric));
@@ -6212,10 +5768,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace CapabilityMinimaStruct
@@ -6233,26 +5786,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MfgSpecificPing.
 } // namespace Commands
@@ -6358,17 +5905,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSoftwareVersion):
             ReturnErrorOnFailure(DataModel::Decode(reader, softwareVersion));
@@ -6378,9 +5922,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StartUp.
 namespace ShutDown {
@@ -6394,26 +5936,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ShutDown.
 namespace Leave {
@@ -6427,26 +5963,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Leave.
 namespace ReachableChanged {
@@ -6461,17 +5991,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReachableNewValue), reachableNewValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kReachableNewValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, reachableNewValue));
@@ -6481,9 +6008,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ReachableChanged.
 } // namespace Events
@@ -6514,17 +6039,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kVendorId), vendorId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProductId), productId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProtocolsSupported), protocolsSupported));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHardwareVersion), hardwareVersion));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocation), location));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRequestorCanConsent), requestorCanConsent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMetadataForProvider), metadataForProvider));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kVendorId):
             ReturnErrorOnFailure(DataModel::Decode(reader, vendorId));
@@ -6555,9 +6084,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace QueryImage.
 namespace QueryImageResponse {
@@ -6581,17 +6108,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDelayedActionTime), delayedActionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kImageURI), imageURI));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersionString), softwareVersionString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUpdateToken), updateToken));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserConsentNeeded), userConsentNeeded));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMetadataForRequestor), metadataForRequestor));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -6622,9 +6153,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace QueryImageResponse.
 namespace ApplyUpdateRequest {
@@ -6640,17 +6169,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUpdateToken), updateToken));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewVersion), newVersion));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUpdateToken):
             ReturnErrorOnFailure(DataModel::Decode(reader, updateToken));
@@ -6663,9 +6190,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ApplyUpdateRequest.
 namespace ApplyUpdateResponse {
@@ -6681,17 +6206,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAction), action));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDelayedActionTime), delayedActionTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAction):
             ReturnErrorOnFailure(DataModel::Decode(reader, action));
@@ -6704,9 +6227,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ApplyUpdateResponse.
 namespace NotifyUpdateApplied {
@@ -6722,17 +6243,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUpdateToken), updateToken));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUpdateToken):
             ReturnErrorOnFailure(DataModel::Decode(reader, updateToken));
@@ -6745,9 +6264,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace NotifyUpdateApplied.
 } // namespace Commands
@@ -6813,18 +6330,16 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProviderNodeID), providerNodeID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoint), endpoint));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kProviderNodeID):
             ReturnErrorOnFailure(DataModel::Decode(reader, providerNodeID));
@@ -6840,10 +6355,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ProviderLocation
@@ -6867,17 +6379,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProviderNodeId), providerNodeId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kVendorId), vendorId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAnnouncementReason), announcementReason));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMetadataForNode), metadataForNode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoint), endpoint));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kProviderNodeId):
             ReturnErrorOnFailure(DataModel::Decode(reader, providerNodeId));
@@ -6899,9 +6412,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AnnounceOtaProvider.
 } // namespace Commands
@@ -6963,17 +6474,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPreviousState), previousState));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewState), newState));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReason), reason));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTargetSoftwareVersion), targetSoftwareVersion));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPreviousState):
             ReturnErrorOnFailure(DataModel::Decode(reader, previousState));
@@ -6992,9 +6503,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StateTransition.
 namespace VersionApplied {
@@ -7010,17 +6519,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProductID), productID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSoftwareVersion):
             ReturnErrorOnFailure(DataModel::Decode(reader, softwareVersion));
@@ -7033,9 +6540,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace VersionApplied.
 namespace DownloadError {
@@ -7053,17 +6558,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBytesDownloaded), bytesDownloaded));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProgressPercent), progressPercent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPlatformCode), platformCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSoftwareVersion):
             ReturnErrorOnFailure(DataModel::Decode(reader, softwareVersion));
@@ -7082,9 +6587,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DownloadError.
 } // namespace Events
@@ -7274,18 +6777,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrent), current));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrevious), previous));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrent):
             ReturnErrorOnFailure(DataModel::Decode(reader, current));
@@ -7298,10 +6798,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace BatChargeFaultChangeType
@@ -7318,18 +6815,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrent), current));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrevious), previous));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrent):
             ReturnErrorOnFailure(DataModel::Decode(reader, current));
@@ -7342,10 +6836,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace BatFaultChangeType
@@ -7362,18 +6853,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrent), current));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrevious), previous));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrent):
             ReturnErrorOnFailure(DataModel::Decode(reader, current));
@@ -7386,10 +6874,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace WiredFaultChangeType
@@ -7538,18 +7023,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFailSafeExpiryLengthSeconds), failSafeExpiryLengthSeconds));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kFailSafeExpiryLengthSeconds):
             ReturnErrorOnFailure(DataModel::Decode(reader, failSafeExpiryLengthSeconds));
@@ -7559,10 +7040,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace BasicCommissioningInfo
@@ -7583,17 +7061,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExpiryLengthSeconds), expiryLengthSeconds));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kExpiryLengthSeconds):
             ReturnErrorOnFailure(DataModel::Decode(reader, expiryLengthSeconds));
@@ -7606,9 +7082,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ArmFailSafe.
 namespace ArmFailSafeResponse {
@@ -7624,17 +7098,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kErrorCode), errorCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kErrorCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, errorCode));
@@ -7647,9 +7119,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ArmFailSafeResponse.
 namespace SetRegulatoryConfig {
@@ -7667,17 +7137,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewRegulatoryConfig), newRegulatoryConfig));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCountryCode), countryCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewRegulatoryConfig):
             ReturnErrorOnFailure(DataModel::Decode(reader, newRegulatoryConfig));
@@ -7693,9 +7162,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetRegulatoryConfig.
 namespace SetRegulatoryConfigResponse {
@@ -7711,17 +7178,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kErrorCode), errorCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kErrorCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, errorCode));
@@ -7734,9 +7199,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetRegulatoryConfigResponse.
 namespace CommissioningComplete {
@@ -7750,26 +7213,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CommissioningComplete.
 namespace CommissioningCompleteResponse {
@@ -7785,17 +7242,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kErrorCode), errorCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kErrorCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, errorCode));
@@ -7808,9 +7263,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CommissioningCompleteResponse.
 } // namespace Commands
@@ -7877,18 +7330,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkID), networkID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kConnected), connected));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkID):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkID));
@@ -7901,10 +7351,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NetworkInfo
@@ -7927,18 +7374,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPanId), panId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtendedPanId), extendedPanId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkName), networkName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kChannel), channel));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kVersion), version));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtendedAddress), extendedAddress));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRssi), rssi));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLqi), lqi));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPanId):
             ReturnErrorOnFailure(DataModel::Decode(reader, panId));
@@ -7969,10 +7419,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ThreadInterfaceScanResult
@@ -7993,18 +7440,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSecurity), security));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSsid), ssid));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBssid), bssid));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kChannel), channel));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWiFiBand), wiFiBand));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRssi), rssi));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSecurity):
             ReturnErrorOnFailure(DataModel::Decode(reader, security));
@@ -8029,10 +7477,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace WiFiInterfaceScanResult
@@ -8052,17 +7497,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSsid), ssid));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSsid):
             ReturnErrorOnFailure(DataModel::Decode(reader, ssid));
@@ -8075,9 +7518,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ScanNetworks.
 namespace ScanNetworksResponse {
@@ -8095,17 +7536,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkingStatus), networkingStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWiFiScanResults), wiFiScanResults));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kThreadScanResults), threadScanResults));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkingStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkingStatus));
@@ -8124,9 +7565,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ScanNetworksResponse.
 namespace AddOrUpdateWiFiNetwork {
@@ -8143,17 +7582,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSsid), ssid));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentials), credentials));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSsid):
             ReturnErrorOnFailure(DataModel::Decode(reader, ssid));
@@ -8169,9 +7607,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddOrUpdateWiFiNetwork.
 namespace AddOrUpdateThreadNetwork {
@@ -8188,17 +7624,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationalDataset), operationalDataset));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOperationalDataset):
             ReturnErrorOnFailure(DataModel::Decode(reader, operationalDataset));
@@ -8211,9 +7645,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddOrUpdateThreadNetwork.
 namespace RemoveNetwork {
@@ -8229,17 +7661,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkID), networkID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkID):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkID));
@@ -8252,9 +7682,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveNetwork.
 namespace NetworkConfigResponse {
@@ -8271,17 +7699,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkingStatus), networkingStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkIndex), networkIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkingStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkingStatus));
@@ -8297,9 +7724,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace NetworkConfigResponse.
 namespace ConnectNetwork {
@@ -8315,17 +7740,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkID), networkID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkID):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkID));
@@ -8338,9 +7761,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ConnectNetwork.
 namespace ConnectNetworkResponse {
@@ -8357,17 +7778,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkingStatus), networkingStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kErrorValue), errorValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkingStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkingStatus));
@@ -8383,9 +7803,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ConnectNetworkResponse.
 namespace ReorderNetwork {
@@ -8402,17 +7820,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkID), networkID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkIndex), networkIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBreadcrumb), breadcrumb));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNetworkID):
             ReturnErrorOnFailure(DataModel::Decode(reader, networkID));
@@ -8428,9 +7845,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ReorderNetwork.
 } // namespace Commands
@@ -8509,17 +7924,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIntent), intent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRequestedProtocol), requestedProtocol));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransferFileDesignator), transferFileDesignator));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIntent):
             ReturnErrorOnFailure(DataModel::Decode(reader, intent));
@@ -8535,9 +7949,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RetrieveLogsRequest.
 namespace RetrieveLogsResponse {
@@ -8555,17 +7967,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kContent), content));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeStamp), timeStamp));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeSinceBoot), timeSinceBoot));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -8584,9 +7996,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RetrieveLogsResponse.
 } // namespace Commands
@@ -8646,18 +8056,23 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIsOperational), isOperational));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kOffPremiseServicesReachableIPv4), offPremiseServicesReachableIPv4));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kOffPremiseServicesReachableIPv6), offPremiseServicesReachableIPv6));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHardwareAddress), hardwareAddress));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIPv4Addresses), IPv4Addresses));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIPv6Addresses), IPv6Addresses));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kType), type));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kName):
             ReturnErrorOnFailure(DataModel::Decode(reader, name));
@@ -8688,10 +8103,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NetworkInterfaceType
@@ -8766,17 +8178,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrent), current));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrevious), previous));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrent):
             ReturnErrorOnFailure(DataModel::Decode(reader, current));
@@ -8789,9 +8199,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace HardwareFaultChange.
 namespace RadioFaultChange {
@@ -8807,17 +8215,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrent), current));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrevious), previous));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrent):
             ReturnErrorOnFailure(DataModel::Decode(reader, current));
@@ -8830,9 +8236,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RadioFaultChange.
 namespace NetworkFaultChange {
@@ -8848,17 +8252,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrent), current));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPrevious), previous));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCurrent):
             ReturnErrorOnFailure(DataModel::Decode(reader, current));
@@ -8871,9 +8273,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace NetworkFaultChange.
 namespace BootReason {
@@ -8888,17 +8288,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBootReason), bootReason));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kBootReason):
             ReturnErrorOnFailure(DataModel::Decode(reader, bootReason));
@@ -8908,9 +8305,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace BootReason.
 } // namespace Events
@@ -8932,18 +8327,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kId), id));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFaultRecording), faultRecording));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kId):
             ReturnErrorOnFailure(DataModel::Decode(reader, id));
@@ -8959,10 +8352,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace SoftwareFaultStruct
@@ -8982,18 +8372,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kId), id));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStackFreeCurrent), stackFreeCurrent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStackFreeMinimum), stackFreeMinimum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStackSize), stackSize));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kId):
             ReturnErrorOnFailure(DataModel::Decode(reader, id));
@@ -9015,10 +8405,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ThreadMetrics
@@ -9036,26 +8423,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetWatermarks.
 } // namespace Commands
@@ -9113,17 +8494,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareFault), softwareFault));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSoftwareFault):
             ReturnErrorOnFailure(DataModel::Decode(reader, softwareFault));
@@ -9133,9 +8511,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SoftwareFault.
 } // namespace Events
@@ -9168,18 +8544,27 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtAddress), extAddress));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAge), age));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRloc16), rloc16));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLinkFrameCounter), linkFrameCounter));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMleFrameCounter), mleFrameCounter));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLqi), lqi));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAverageRssi), averageRssi));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLastRssi), lastRssi));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFrameErrorRate), frameErrorRate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageErrorRate), messageErrorRate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRxOnWhenIdle), rxOnWhenIdle));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFullThreadDevice), fullThreadDevice));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFullNetworkData), fullNetworkData));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIsChild), isChild));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kExtAddress):
             ReturnErrorOnFailure(DataModel::Decode(reader, extAddress));
@@ -9228,10 +8613,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NeighborTable
@@ -9265,18 +8647,25 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kActiveTimestampPresent), activeTimestampPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPendingTimestampPresent), pendingTimestampPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMasterKeyPresent), masterKeyPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNetworkNamePresent), networkNamePresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtendedPanIdPresent), extendedPanIdPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMeshLocalPrefixPresent), meshLocalPrefixPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDelayPresent), delayPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPanIdPresent), panIdPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kChannelPresent), channelPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPskcPresent), pskcPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSecurityPolicyPresent), securityPolicyPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kChannelMaskPresent), channelMaskPresent));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kActiveTimestampPresent):
             ReturnErrorOnFailure(DataModel::Decode(reader, activeTimestampPresent));
@@ -9319,10 +8708,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace OperationalDatasetComponents
@@ -9347,18 +8733,23 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtAddress), extAddress));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRloc16), rloc16));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRouterId), routerId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNextHop), nextHop));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPathCost), pathCost));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLQIIn), LQIIn));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLQIOut), LQIOut));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAge), age));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAllocated), allocated));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLinkEstablished), linkEstablished));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kExtAddress):
             ReturnErrorOnFailure(DataModel::Decode(reader, extAddress));
@@ -9395,10 +8786,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace RouteTable
@@ -9415,18 +8803,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRotationTime), rotationTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFlags), flags));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kRotationTime):
             ReturnErrorOnFailure(DataModel::Decode(reader, rotationTime));
@@ -9439,10 +8824,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace SecurityPolicy
@@ -9460,26 +8842,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetCounts.
 } // namespace Commands
@@ -9714,17 +9090,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kConnectionStatus), connectionStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kConnectionStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, connectionStatus));
@@ -9734,9 +9107,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ConnectionStatus.
 } // namespace Events
@@ -9756,26 +9127,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetCounts.
 } // namespace Commands
@@ -9860,17 +9225,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReasonCode), reasonCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kReasonCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, reasonCode));
@@ -9880,9 +9242,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Disconnection.
 namespace AssociationFailure {
@@ -9899,17 +9259,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAssociationFailure), associationFailure));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAssociationFailure):
             ReturnErrorOnFailure(DataModel::Decode(reader, associationFailure));
@@ -9922,9 +9280,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AssociationFailure.
 namespace ConnectionStatus {
@@ -9939,17 +9295,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kConnectionStatus), connectionStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kConnectionStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, connectionStatus));
@@ -9959,9 +9312,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ConnectionStatus.
 } // namespace Events
@@ -9981,26 +9332,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ResetCounts.
 } // namespace Commands
@@ -10192,17 +9537,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSoftwareVersion), softwareVersion));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSoftwareVersion):
             ReturnErrorOnFailure(DataModel::Decode(reader, softwareVersion));
@@ -10212,9 +9554,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StartUp.
 namespace ShutDown {
@@ -10228,26 +9568,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ShutDown.
 namespace Leave {
@@ -10261,26 +9595,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Leave.
 namespace ReachableChanged {
@@ -10295,17 +9623,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReachableNewValue), reachableNewValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kReachableNewValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, reachableNewValue));
@@ -10315,9 +9640,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ReachableChanged.
 } // namespace Events
@@ -10378,17 +9701,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewPosition), newPosition));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, newPosition));
@@ -10398,9 +9718,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SwitchLatched.
 namespace InitialPress {
@@ -10415,17 +9733,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewPosition), newPosition));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, newPosition));
@@ -10435,9 +9750,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InitialPress.
 namespace LongPress {
@@ -10452,17 +9765,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewPosition), newPosition));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, newPosition));
@@ -10472,9 +9782,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LongPress.
 namespace ShortRelease {
@@ -10489,17 +9797,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPreviousPosition), previousPosition));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPreviousPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, previousPosition));
@@ -10509,9 +9814,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ShortRelease.
 namespace LongRelease {
@@ -10526,17 +9829,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPreviousPosition), previousPosition));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPreviousPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, previousPosition));
@@ -10546,9 +9846,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LongRelease.
 namespace MultiPressOngoing {
@@ -10565,17 +9863,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewPosition), newPosition));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kCurrentNumberOfPressesCounted), currentNumberOfPressesCounted));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, newPosition));
@@ -10588,9 +9885,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MultiPressOngoing.
 namespace MultiPressComplete {
@@ -10607,17 +9902,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewPosition), newPosition));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTotalNumberOfPressesCounted), totalNumberOfPressesCounted));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, newPosition));
@@ -10630,9 +9923,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MultiPressComplete.
 } // namespace Events
@@ -10658,17 +9949,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCommissioningTimeout), commissioningTimeout));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPAKEVerifier), PAKEVerifier));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDiscriminator), discriminator));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIterations), iterations));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSalt), salt));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCommissioningTimeout):
             ReturnErrorOnFailure(DataModel::Decode(reader, commissioningTimeout));
@@ -10690,9 +9982,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OpenCommissioningWindow.
 namespace OpenBasicCommissioningWindow {
@@ -10708,17 +9998,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCommissioningTimeout), commissioningTimeout));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCommissioningTimeout):
             ReturnErrorOnFailure(DataModel::Decode(reader, commissioningTimeout));
@@ -10728,9 +10015,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OpenBasicCommissioningWindow.
 namespace RevokeCommissioning {
@@ -10744,26 +10029,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RevokeCommissioning.
 } // namespace Commands
@@ -10841,18 +10120,19 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRootPublicKey), rootPublicKey));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kVendorId), vendorId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricId), fabricId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNodeId), nodeId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLabel), label));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kRootPublicKey):
             ReturnErrorOnFailure(DataModel::Decode(reader, rootPublicKey));
@@ -10877,10 +10157,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace FabricDescriptor
@@ -10918,18 +10195,16 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNoc), noc));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIcac), icac));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNoc):
             ReturnErrorOnFailure(DataModel::Decode(reader, noc));
@@ -10945,10 +10220,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NOCStruct
@@ -10967,17 +10239,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAttestationNonce), attestationNonce));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAttestationNonce):
             ReturnErrorOnFailure(DataModel::Decode(reader, attestationNonce));
@@ -10987,9 +10256,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AttestationRequest.
 namespace AttestationResponse {
@@ -11006,17 +10273,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAttestationElements), attestationElements));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSignature), signature));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAttestationElements):
             ReturnErrorOnFailure(DataModel::Decode(reader, attestationElements));
@@ -11029,9 +10294,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AttestationResponse.
 namespace CertificateChainRequest {
@@ -11046,17 +10309,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCertificateType), certificateType));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCertificateType):
             ReturnErrorOnFailure(DataModel::Decode(reader, certificateType));
@@ -11066,9 +10326,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CertificateChainRequest.
 namespace CertificateChainResponse {
@@ -11083,17 +10341,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCertificate), certificate));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCertificate):
             ReturnErrorOnFailure(DataModel::Decode(reader, certificate));
@@ -11103,9 +10358,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CertificateChainResponse.
 namespace CSRRequest {
@@ -11120,17 +10373,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCSRNonce), CSRNonce));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCSRNonce):
             ReturnErrorOnFailure(DataModel::Decode(reader, CSRNonce));
@@ -11140,9 +10390,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CSRRequest.
 namespace CSRResponse {
@@ -11159,17 +10407,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNOCSRElements), NOCSRElements));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAttestationSignature), attestationSignature));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNOCSRElements):
             ReturnErrorOnFailure(DataModel::Decode(reader, NOCSRElements));
@@ -11182,9 +10428,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CSRResponse.
 namespace AddNOC {
@@ -11203,17 +10447,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNOCValue), NOCValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kICACValue), ICACValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIPKValue), IPKValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCaseAdminNode), caseAdminNode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAdminVendorId), adminVendorId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNOCValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, NOCValue));
@@ -11235,9 +10480,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddNOC.
 namespace UpdateNOC {
@@ -11253,17 +10496,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNOCValue), NOCValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kICACValue), ICACValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNOCValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, NOCValue));
@@ -11276,9 +10517,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace UpdateNOC.
 namespace NOCResponse {
@@ -11295,17 +10534,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatusCode), statusCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDebugText), debugText));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatusCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, statusCode));
@@ -11321,9 +10559,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace NOCResponse.
 namespace UpdateFabricLabel {
@@ -11338,17 +10574,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLabel), label));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLabel):
             ReturnErrorOnFailure(DataModel::Decode(reader, label));
@@ -11358,9 +10591,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace UpdateFabricLabel.
 namespace RemoveFabric {
@@ -11375,17 +10606,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kFabricIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, fabricIndex));
@@ -11395,9 +10623,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveFabric.
 namespace AddTrustedRootCertificate {
@@ -11412,17 +10638,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRootCertificate), rootCertificate));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kRootCertificate):
             ReturnErrorOnFailure(DataModel::Decode(reader, rootCertificate));
@@ -11432,9 +10655,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AddTrustedRootCertificate.
 namespace RemoveTrustedRootCertificate {
@@ -11450,17 +10671,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTrustedRootIdentifier), trustedRootIdentifier));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTrustedRootIdentifier):
             ReturnErrorOnFailure(DataModel::Decode(reader, trustedRootIdentifier));
@@ -11470,9 +10688,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RemoveTrustedRootCertificate.
 } // namespace Commands
@@ -11557,18 +10773,17 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoints), endpoints));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupName), groupName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -11587,10 +10802,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace GroupInfoMapStruct
@@ -11621,18 +10833,16 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupId), groupId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySetID), groupKeySetID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupId):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupId));
@@ -11648,10 +10858,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace GroupKeyMapStruct
@@ -11675,18 +10882,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySetID), groupKeySetID));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySecurityPolicy), groupKeySecurityPolicy));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEpochKey0), epochKey0));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEpochStartTime0), epochStartTime0));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEpochKey1), epochKey1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEpochStartTime1), epochStartTime1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEpochKey2), epochKey2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEpochStartTime2), epochStartTime2));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySetID):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySetID));
@@ -11717,10 +10927,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace GroupKeySetStruct
@@ -11739,17 +10946,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySet), groupKeySet));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySet):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySet));
@@ -11759,9 +10963,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace KeySetWrite.
 namespace KeySetRead {
@@ -11776,17 +10978,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySetID), groupKeySetID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySetID):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySetID));
@@ -11796,9 +10995,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace KeySetRead.
 namespace KeySetReadResponse {
@@ -11813,17 +11010,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySet), groupKeySet));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySet):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySet));
@@ -11833,9 +11027,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace KeySetReadResponse.
 namespace KeySetRemove {
@@ -11850,17 +11042,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySetID), groupKeySetID));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySetID):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySetID));
@@ -11870,9 +11059,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace KeySetRemove.
 namespace KeySetReadAllIndices {
@@ -11887,17 +11074,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySetIDs), groupKeySetIDs));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySetIDs):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySetIDs));
@@ -11907,9 +11091,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace KeySetReadAllIndices.
 namespace KeySetReadAllIndicesResponse {
@@ -11924,17 +11106,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kGroupKeySetIDs), groupKeySetIDs));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kGroupKeySetIDs):
             ReturnErrorOnFailure(DataModel::Decode(reader, groupKeySetIDs));
@@ -11944,9 +11123,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace KeySetReadAllIndicesResponse.
 } // namespace Commands
@@ -12239,17 +11416,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStateValue), stateValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStateValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, stateValue));
@@ -12259,9 +11433,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StateChange.
 } // namespace Events
@@ -12283,18 +11455,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLabel), label));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMode), mode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSemanticTag), semanticTag));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLabel):
             ReturnErrorOnFailure(DataModel::Decode(reader, label));
@@ -12310,10 +11480,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ModeOptionStruct
@@ -12330,18 +11497,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMfgCode), mfgCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMfgCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, mfgCode));
@@ -12354,10 +11518,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace SemanticTag
@@ -12376,17 +11537,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNewMode), newMode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNewMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, newMode));
@@ -12396,9 +11554,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ChangeToMode.
 } // namespace Commands
@@ -12520,18 +11676,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentialType), credentialType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentialIndex), credentialIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCredentialType):
             ReturnErrorOnFailure(DataModel::Decode(reader, credentialType));
@@ -12544,10 +11697,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace DlCredential
@@ -12566,17 +11716,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPinCode), pinCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPinCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, pinCode));
@@ -12586,9 +11733,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LockDoor.
 namespace UnlockDoor {
@@ -12603,17 +11748,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPinCode), pinCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPinCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, pinCode));
@@ -12623,9 +11765,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace UnlockDoor.
 namespace UnlockWithTimeout {
@@ -12641,17 +11781,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeout), timeout));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPinCode), pinCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTimeout):
             ReturnErrorOnFailure(DataModel::Decode(reader, timeout));
@@ -12664,9 +11802,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace UnlockWithTimeout.
 namespace GetLogRecord {
@@ -12681,17 +11817,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogIndex), logIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLogIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, logIndex));
@@ -12701,9 +11834,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetLogRecord.
 namespace GetLogRecordResponse {
@@ -12725,17 +11856,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogEntryId), logEntryId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimestamp), timestamp));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEventType), eventType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSource), source));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEventIdOrAlarmCode), eventIdOrAlarmCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPin), pin));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLogEntryId):
             ReturnErrorOnFailure(DataModel::Decode(reader, logEntryId));
@@ -12763,9 +11897,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetLogRecordResponse.
 namespace SetPINCode {
@@ -12783,17 +11915,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPin), pin));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -12812,9 +11944,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetPINCode.
 namespace GetPINCode {
@@ -12829,17 +11959,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -12849,9 +11976,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPINCode.
 namespace GetPINCodeResponse {
@@ -12869,17 +11994,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPin), pin));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -12898,9 +12023,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPINCodeResponse.
 namespace ClearPINCode {
@@ -12915,17 +12038,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPinSlotIndex), pinSlotIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPinSlotIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, pinSlotIndex));
@@ -12935,9 +12055,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearPINCode.
 namespace ClearAllPINCodes {
@@ -12951,26 +12069,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearAllPINCodes.
 namespace SetUserStatus {
@@ -12986,17 +12098,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13009,9 +12119,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetUserStatus.
 namespace GetUserStatus {
@@ -13026,17 +12134,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13046,9 +12151,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetUserStatus.
 namespace GetUserStatusResponse {
@@ -13064,17 +12167,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13087,9 +12188,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetUserStatusResponse.
 namespace SetWeekDaySchedule {
@@ -13110,17 +12209,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWeekDayIndex), weekDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDaysMask), daysMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartHour), startHour));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartMinute), startMinute));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndHour), endHour));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndMinute), endMinute));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWeekDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, weekDayIndex));
@@ -13148,9 +12250,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetWeekDaySchedule.
 namespace GetWeekDaySchedule {
@@ -13166,17 +12266,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWeekDayIndex), weekDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWeekDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, weekDayIndex));
@@ -13189,9 +12287,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetWeekDaySchedule.
 namespace GetWeekDayScheduleResponse {
@@ -13213,17 +12309,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWeekDayIndex), weekDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDaysMask), daysMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartHour), startHour));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartMinute), startMinute));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndHour), endHour));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndMinute), endMinute));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWeekDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, weekDayIndex));
@@ -13254,9 +12354,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetWeekDayScheduleResponse.
 namespace ClearWeekDaySchedule {
@@ -13272,17 +12370,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWeekDayIndex), weekDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWeekDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, weekDayIndex));
@@ -13295,9 +12391,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearWeekDaySchedule.
 namespace SetYearDaySchedule {
@@ -13315,17 +12409,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kYearDayIndex), yearDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalStartTime), localStartTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalEndTime), localEndTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kYearDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, yearDayIndex));
@@ -13344,9 +12438,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetYearDaySchedule.
 namespace GetYearDaySchedule {
@@ -13362,17 +12454,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kYearDayIndex), yearDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kYearDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, yearDayIndex));
@@ -13385,9 +12475,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetYearDaySchedule.
 namespace GetYearDayScheduleResponse {
@@ -13406,17 +12494,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kYearDayIndex), yearDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalStartTime), localStartTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalEndTime), localEndTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kYearDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, yearDayIndex));
@@ -13438,9 +12527,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetYearDayScheduleResponse.
 namespace ClearYearDaySchedule {
@@ -13456,17 +12543,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kYearDayIndex), yearDayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kYearDayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, yearDayIndex));
@@ -13479,9 +12564,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearYearDaySchedule.
 namespace SetHolidaySchedule {
@@ -13499,17 +12582,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHolidayIndex), holidayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalStartTime), localStartTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalEndTime), localEndTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperatingMode), operatingMode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kHolidayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, holidayIndex));
@@ -13528,9 +12611,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetHolidaySchedule.
 namespace GetHolidaySchedule {
@@ -13545,17 +12626,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHolidayIndex), holidayIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kHolidayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, holidayIndex));
@@ -13565,9 +12643,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetHolidaySchedule.
 namespace GetHolidayScheduleResponse {
@@ -13586,17 +12662,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHolidayIndex), holidayIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalStartTime), localStartTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalEndTime), localEndTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperatingMode), operatingMode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kHolidayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, holidayIndex));
@@ -13618,9 +12695,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetHolidayScheduleResponse.
 namespace ClearHolidaySchedule {
@@ -13635,17 +12710,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHolidayIndex), holidayIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kHolidayIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, holidayIndex));
@@ -13655,9 +12727,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearHolidaySchedule.
 namespace SetUserType {
@@ -13673,17 +12743,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13696,9 +12764,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetUserType.
 namespace GetUserType {
@@ -13713,17 +12779,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13733,9 +12796,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetUserType.
 namespace GetUserTypeResponse {
@@ -13751,17 +12812,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13774,9 +12833,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetUserTypeResponse.
 namespace SetRFIDCode {
@@ -13794,17 +12851,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRfidCode), rfidCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13823,9 +12880,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetRFIDCode.
 namespace GetRFIDCode {
@@ -13840,17 +12895,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13860,9 +12912,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetRFIDCode.
 namespace GetRFIDCodeResponse {
@@ -13880,17 +12930,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRfidCode), rfidCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserId):
             ReturnErrorOnFailure(DataModel::Decode(reader, userId));
@@ -13909,9 +12959,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetRFIDCodeResponse.
 namespace ClearRFIDCode {
@@ -13926,17 +12974,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRfidSlotIndex), rfidSlotIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kRfidSlotIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, rfidSlotIndex));
@@ -13946,9 +12991,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearRFIDCode.
 namespace ClearAllRFIDCodes {
@@ -13962,26 +13005,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearAllRFIDCodes.
 namespace SetUser {
@@ -14002,17 +13039,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationType), operationType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserName), userName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserUniqueId), userUniqueId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentialRule), credentialRule));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOperationType):
             ReturnErrorOnFailure(DataModel::Decode(reader, operationType));
@@ -14040,9 +13080,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetUser.
 namespace GetUser {
@@ -14057,17 +13095,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, userIndex));
@@ -14077,9 +13112,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetUser.
 namespace GetUserResponse {
@@ -14105,17 +13138,23 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserName), userName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserUniqueId), userUniqueId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentialRule), credentialRule));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentials), credentials));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCreatorFabricIndex), creatorFabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLastModifiedFabricIndex), lastModifiedFabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNextUserIndex), nextUserIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, userIndex));
@@ -14152,9 +13191,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetUserResponse.
 namespace ClearUser {
@@ -14169,17 +13206,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUserIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, userIndex));
@@ -14189,9 +13223,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearUser.
 namespace OperatingEventNotification {
@@ -14213,17 +13245,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationEventSource), operationEventSource));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationEventCode), operationEventCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPin), pin));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalTime), localTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOperationEventSource):
             ReturnErrorOnFailure(DataModel::Decode(reader, operationEventSource));
@@ -14248,9 +13282,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace OperatingEventNotification.
 namespace ProgrammingEventNotification {
@@ -14273,17 +13305,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProgramEventSource), programEventSource));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProgramEventCode), programEventCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserId), userId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPin), pin));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalTime), localTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kProgramEventSource):
             ReturnErrorOnFailure(DataModel::Decode(reader, programEventSource));
@@ -14314,9 +13350,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ProgrammingEventNotification.
 namespace SetCredential {
@@ -14336,17 +13370,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationType), operationType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredential), credential));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentialData), credentialData));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserStatus), userStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserType), userType));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOperationType):
             ReturnErrorOnFailure(DataModel::Decode(reader, operationType));
@@ -14371,9 +13407,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetCredential.
 namespace SetCredentialResponse {
@@ -14391,17 +13425,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNextCredentialIndex), nextCredentialIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -14417,9 +13450,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetCredentialResponse.
 namespace GetCredentialStatus {
@@ -14434,17 +13465,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredential), credential));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCredential):
             ReturnErrorOnFailure(DataModel::Decode(reader, credential));
@@ -14454,9 +13482,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetCredentialStatus.
 namespace GetCredentialStatusResponse {
@@ -14474,17 +13500,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentialExists), credentialExists));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNextCredentialIndex), nextCredentialIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCredentialExists):
             ReturnErrorOnFailure(DataModel::Decode(reader, credentialExists));
@@ -14500,9 +13525,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetCredentialStatusResponse.
 namespace ClearCredential {
@@ -14517,17 +13540,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredential), credential));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCredential):
             ReturnErrorOnFailure(DataModel::Decode(reader, credential));
@@ -14537,9 +13557,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearCredential.
 } // namespace Commands
@@ -14720,17 +13738,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlarmCode), alarmCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAlarmCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, alarmCode));
@@ -14740,9 +13755,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DoorLockAlarm.
 namespace DoorStateChange {
@@ -14757,17 +13770,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDoorState), doorState));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kDoorState):
             ReturnErrorOnFailure(DataModel::Decode(reader, doorState));
@@ -14777,9 +13787,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DoorStateChange.
 namespace LockOperation {
@@ -14799,17 +13807,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLockOperationType), lockOperationType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationSource), operationSource));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSourceNode), sourceNode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentials), credentials));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLockOperationType):
             ReturnErrorOnFailure(DataModel::Decode(reader, lockOperationType));
@@ -14834,9 +13844,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LockOperation.
 namespace LockOperationError {
@@ -14857,17 +13865,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLockOperationType), lockOperationType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationSource), operationSource));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationError), operationError));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSourceNode), sourceNode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCredentials), credentials));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLockOperationType):
             ReturnErrorOnFailure(DataModel::Decode(reader, lockOperationType));
@@ -14895,9 +13906,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LockOperationError.
 namespace LockUserChange {
@@ -14918,17 +13927,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLockDataType), lockDataType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDataOperationType), dataOperationType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationSource), operationSource));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUserIndex), userIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSourceNode), sourceNode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDataIndex), dataIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLockDataType):
             ReturnErrorOnFailure(DataModel::Decode(reader, lockDataType));
@@ -14956,9 +13968,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LockUserChange.
 } // namespace Events
@@ -14978,26 +13988,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace UpOrOpen.
 namespace DownOrClose {
@@ -15011,26 +14015,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DownOrClose.
 namespace StopMotion {
@@ -15044,26 +14042,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StopMotion.
 namespace GoToLiftValue {
@@ -15078,17 +14070,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLiftValue), liftValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLiftValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, liftValue));
@@ -15098,9 +14087,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GoToLiftValue.
 namespace GoToLiftPercentage {
@@ -15118,17 +14105,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLiftPercentageValue), liftPercentageValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLiftPercent100thsValue), liftPercent100thsValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLiftPercentageValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, liftPercentageValue));
@@ -15141,9 +14126,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GoToLiftPercentage.
 namespace GoToTiltValue {
@@ -15158,17 +14141,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTiltValue), tiltValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTiltValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, tiltValue));
@@ -15178,9 +14158,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GoToTiltValue.
 namespace GoToTiltPercentage {
@@ -15198,17 +14176,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTiltPercentageValue), tiltPercentageValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTiltPercent100thsValue), tiltPercent100thsValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTiltPercentageValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, tiltPercentageValue));
@@ -15221,9 +14197,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GoToTiltPercentage.
 } // namespace Commands
@@ -15341,17 +14315,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPercentOpen), percentOpen));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPercentOpen):
             ReturnErrorOnFailure(DataModel::Decode(reader, percentOpen));
@@ -15361,9 +14332,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace BarrierControlGoToPercent.
 namespace BarrierControlStop {
@@ -15377,26 +14346,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace BarrierControlStop.
 } // namespace Commands
@@ -15580,26 +14543,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SupplyVoltageLow.
 namespace SupplyVoltageHigh {
@@ -15613,26 +14570,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SupplyVoltageHigh.
 namespace PowerMissingPhase {
@@ -15646,26 +14597,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PowerMissingPhase.
 namespace SystemPressureLow {
@@ -15679,26 +14624,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SystemPressureLow.
 namespace SystemPressureHigh {
@@ -15712,26 +14651,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SystemPressureHigh.
 namespace DryRunning {
@@ -15745,26 +14678,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DryRunning.
 namespace MotorTemperatureHigh {
@@ -15778,26 +14705,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MotorTemperatureHigh.
 namespace PumpMotorFatalFailure {
@@ -15811,26 +14732,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PumpMotorFatalFailure.
 namespace ElectronicTemperatureHigh {
@@ -15844,26 +14759,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ElectronicTemperatureHigh.
 namespace PumpBlocked {
@@ -15877,26 +14786,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PumpBlocked.
 namespace SensorFailure {
@@ -15910,26 +14813,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SensorFailure.
 namespace ElectronicNonFatalFailure {
@@ -15943,26 +14840,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ElectronicNonFatalFailure.
 namespace ElectronicFatalFailure {
@@ -15976,26 +14867,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ElectronicFatalFailure.
 namespace GeneralFault {
@@ -16009,26 +14894,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GeneralFault.
 namespace Leakage {
@@ -16042,26 +14921,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Leakage.
 namespace AirDetection {
@@ -16075,26 +14948,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AirDetection.
 namespace TurbineOperation {
@@ -16108,26 +14975,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TurbineOperation.
 } // namespace Events
@@ -16149,17 +15010,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMode), mode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAmount), amount));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, mode));
@@ -16172,9 +15031,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetpointRaiseLower.
 namespace GetWeeklyScheduleResponse {
@@ -16194,17 +15051,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNumberOfTransitionsForSequence), numberOfTransitionsForSequence));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDayOfWeekForSequence), dayOfWeekForSequence));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kModeForSequence), modeForSequence));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPayload), payload));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNumberOfTransitionsForSequence):
             ReturnErrorOnFailure(DataModel::Decode(reader, numberOfTransitionsForSequence));
@@ -16223,9 +15081,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetWeeklyScheduleResponse.
 namespace SetWeeklySchedule {
@@ -16245,17 +15101,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNumberOfTransitionsForSequence), numberOfTransitionsForSequence));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDayOfWeekForSequence), dayOfWeekForSequence));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kModeForSequence), modeForSequence));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPayload), payload));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNumberOfTransitionsForSequence):
             ReturnErrorOnFailure(DataModel::Decode(reader, numberOfTransitionsForSequence));
@@ -16274,9 +15131,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetWeeklySchedule.
 namespace GetRelayStatusLogResponse {
@@ -16297,17 +15152,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeOfDay), timeOfDay));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRelayStatus), relayStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLocalTemperature), localTemperature));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHumidityInPercentage), humidityInPercentage));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSetpoint), setpoint));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUnreadEntries), unreadEntries));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTimeOfDay):
             ReturnErrorOnFailure(DataModel::Decode(reader, timeOfDay));
@@ -16332,9 +15189,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetRelayStatusLogResponse.
 namespace GetWeeklySchedule {
@@ -16350,17 +15205,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDaysToReturn), daysToReturn));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kModeToReturn), modeToReturn));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kDaysToReturn):
             ReturnErrorOnFailure(DataModel::Decode(reader, daysToReturn));
@@ -16373,9 +15226,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetWeeklySchedule.
 namespace ClearWeeklySchedule {
@@ -16389,26 +15240,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ClearWeeklySchedule.
 namespace GetRelayStatusLog {
@@ -16422,26 +15267,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetRelayStatusLog.
 } // namespace Commands
@@ -16803,17 +15642,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHue), hue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDirection), direction));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kHue):
             ReturnErrorOnFailure(DataModel::Decode(reader, hue));
@@ -16835,9 +15675,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToHue.
 namespace MoveHue {
@@ -16855,17 +15693,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMoveMode), moveMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRate), rate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMoveMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, moveMode));
@@ -16884,9 +15722,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveHue.
 namespace StepHue {
@@ -16905,17 +15741,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepMode), stepMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepSize), stepSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepMode));
@@ -16937,9 +15774,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StepHue.
 namespace MoveToSaturation {
@@ -16957,17 +15792,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSaturation), saturation));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSaturation):
             ReturnErrorOnFailure(DataModel::Decode(reader, saturation));
@@ -16986,9 +15821,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToSaturation.
 namespace MoveSaturation {
@@ -17006,17 +15839,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMoveMode), moveMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRate), rate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMoveMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, moveMode));
@@ -17035,9 +15868,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveSaturation.
 namespace StepSaturation {
@@ -17056,17 +15887,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepMode), stepMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepSize), stepSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepMode));
@@ -17088,9 +15920,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StepSaturation.
 namespace MoveToHueAndSaturation {
@@ -17109,17 +15939,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHue), hue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSaturation), saturation));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kHue):
             ReturnErrorOnFailure(DataModel::Decode(reader, hue));
@@ -17141,9 +15972,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToHueAndSaturation.
 namespace MoveToColor {
@@ -17162,17 +15991,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorX), colorX));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorY), colorY));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kColorX):
             ReturnErrorOnFailure(DataModel::Decode(reader, colorX));
@@ -17194,9 +16024,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToColor.
 namespace MoveColor {
@@ -17214,17 +16042,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRateX), rateX));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRateY), rateY));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kRateX):
             ReturnErrorOnFailure(DataModel::Decode(reader, rateX));
@@ -17243,9 +16071,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveColor.
 namespace StepColor {
@@ -17264,17 +16090,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepX), stepX));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepY), stepY));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepX):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepX));
@@ -17296,9 +16123,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StepColor.
 namespace MoveToColorTemperature {
@@ -17316,17 +16141,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorTemperature), colorTemperature));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kColorTemperature):
             ReturnErrorOnFailure(DataModel::Decode(reader, colorTemperature));
@@ -17345,9 +16170,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveToColorTemperature.
 namespace EnhancedMoveToHue {
@@ -17366,17 +16189,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnhancedHue), enhancedHue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDirection), direction));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEnhancedHue):
             ReturnErrorOnFailure(DataModel::Decode(reader, enhancedHue));
@@ -17398,9 +16222,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedMoveToHue.
 namespace EnhancedMoveHue {
@@ -17418,17 +16240,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMoveMode), moveMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRate), rate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMoveMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, moveMode));
@@ -17447,9 +16269,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedMoveHue.
 namespace EnhancedStepHue {
@@ -17468,17 +16288,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepMode), stepMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepSize), stepSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepMode));
@@ -17500,9 +16321,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedStepHue.
 namespace EnhancedMoveToHueAndSaturation {
@@ -17521,17 +16340,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnhancedHue), enhancedHue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSaturation), saturation));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEnhancedHue):
             ReturnErrorOnFailure(DataModel::Decode(reader, enhancedHue));
@@ -17553,9 +16373,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EnhancedMoveToHueAndSaturation.
 namespace ColorLoopSet {
@@ -17576,17 +16394,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUpdateFlags), updateFlags));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAction), action));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDirection), direction));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTime), time));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartHue), startHue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUpdateFlags):
             ReturnErrorOnFailure(DataModel::Decode(reader, updateFlags));
@@ -17614,9 +16435,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ColorLoopSet.
 namespace StopMoveStep {
@@ -17632,17 +16451,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOptionsMask):
             ReturnErrorOnFailure(DataModel::Decode(reader, optionsMask));
@@ -17655,9 +16472,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StopMoveStep.
 namespace MoveColorTemperature {
@@ -17679,17 +16494,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMoveMode), moveMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kRate), rate));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorTemperatureMinimum), colorTemperatureMinimum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorTemperatureMaximum), colorTemperatureMaximum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMoveMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, moveMode));
@@ -17714,9 +16531,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MoveColorTemperature.
 namespace StepColorTemperature {
@@ -17739,17 +16554,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepMode), stepMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStepSize), stepSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTransitionTime), transitionTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorTemperatureMinimum), colorTemperatureMinimum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColorTemperatureMaximum), colorTemperatureMaximum));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsMask), optionsMask));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionsOverride), optionsOverride));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStepMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, stepMode));
@@ -17777,9 +16595,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StepColorTemperature.
 } // namespace Commands
@@ -19880,17 +18696,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEnrollResponseCode), enrollResponseCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEnrollResponseCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, enrollResponseCode));
@@ -19903,9 +18717,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ZoneEnrollResponse.
 namespace ZoneStatusChangeNotification {
@@ -19923,17 +18735,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatus), zoneStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExtendedStatus), extendedStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDelay), delay));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneStatus));
@@ -19952,9 +18764,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ZoneStatusChangeNotification.
 namespace InitiateNormalOperationMode {
@@ -19968,26 +18778,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InitiateNormalOperationMode.
 namespace ZoneEnrollRequest {
@@ -20003,17 +18807,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneType), zoneType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kManufacturerCode), manufacturerCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneType):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneType));
@@ -20026,9 +18828,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ZoneEnrollRequest.
 namespace InitiateTestMode {
@@ -20045,17 +18845,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTestModeDuration), testModeDuration));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCurrentZoneSensitivityLevel), currentZoneSensitivityLevel));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTestModeDuration):
             ReturnErrorOnFailure(DataModel::Decode(reader, testModeDuration));
@@ -20068,9 +18866,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InitiateTestMode.
 namespace InitiateNormalOperationModeResponse {
@@ -20084,26 +18880,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InitiateNormalOperationModeResponse.
 namespace InitiateTestModeResponse {
@@ -20117,26 +18907,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace InitiateTestModeResponse.
 } // namespace Commands
@@ -20209,18 +18993,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatus), zoneStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneId):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneId));
@@ -20233,10 +19014,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace IasAceZoneStatusResult
@@ -20257,17 +19035,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArmMode), armMode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArmDisarmCode), armDisarmCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArmMode):
             ReturnErrorOnFailure(DataModel::Decode(reader, armMode));
@@ -20283,9 +19060,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Arm.
 namespace ArmResponse {
@@ -20300,17 +19075,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArmNotification), armNotification));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArmNotification):
             ReturnErrorOnFailure(DataModel::Decode(reader, armNotification));
@@ -20320,9 +19092,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ArmResponse.
 namespace Bypass {
@@ -20339,17 +19109,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumberOfZones), numberOfZones));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneIds), zoneIds));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArmDisarmCode), armDisarmCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNumberOfZones):
             ReturnErrorOnFailure(DataModel::Decode(reader, numberOfZones));
@@ -20365,9 +19134,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Bypass.
 namespace GetZoneIdMapResponse {
@@ -20397,17 +19164,29 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection0), section0));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection1), section1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection2), section2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection3), section3));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection4), section4));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection5), section5));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection6), section6));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection7), section7));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection8), section8));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection9), section9));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection10), section10));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection11), section11));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection12), section12));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection13), section13));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection14), section14));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSection15), section15));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSection0):
             ReturnErrorOnFailure(DataModel::Decode(reader, section0));
@@ -20462,9 +19241,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetZoneIdMapResponse.
 namespace Emergency {
@@ -20478,26 +19255,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Emergency.
 namespace GetZoneInformationResponse {
@@ -20515,17 +19286,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneType), zoneType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIeeeAddress), ieeeAddress));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneLabel), zoneLabel));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneId):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneId));
@@ -20544,9 +19315,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetZoneInformationResponse.
 namespace Fire {
@@ -20560,26 +19329,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Fire.
 namespace ZoneStatusChanged {
@@ -20598,17 +19361,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatus), zoneStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAudibleNotification), audibleNotification));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneLabel), zoneLabel));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneId):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneId));
@@ -20627,9 +19390,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ZoneStatusChanged.
 namespace Panic {
@@ -20643,26 +19404,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Panic.
 namespace PanelStatusChanged {
@@ -20681,17 +19436,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPanelStatus), panelStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSecondsRemaining), secondsRemaining));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAudibleNotification), audibleNotification));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlarmStatus), alarmStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPanelStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, panelStatus));
@@ -20710,9 +19465,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PanelStatusChanged.
 namespace GetZoneIdMap {
@@ -20726,26 +19479,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetZoneIdMap.
 namespace GetPanelStatusResponse {
@@ -20764,17 +19511,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPanelStatus), panelStatus));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSecondsRemaining), secondsRemaining));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAudibleNotification), audibleNotification));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlarmStatus), alarmStatus));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPanelStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, panelStatus));
@@ -20793,9 +19540,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPanelStatusResponse.
 namespace GetZoneInformation {
@@ -20810,17 +19555,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneId), zoneId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneId):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneId));
@@ -20830,9 +19572,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetZoneInformation.
 namespace SetBypassedZoneList {
@@ -20848,17 +19588,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumberOfZones), numberOfZones));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneIds), zoneIds));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNumberOfZones):
             ReturnErrorOnFailure(DataModel::Decode(reader, numberOfZones));
@@ -20871,9 +19609,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SetBypassedZoneList.
 namespace GetPanelStatus {
@@ -20887,26 +19623,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetPanelStatus.
 namespace BypassResponse {
@@ -20922,17 +19652,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumberOfZones), numberOfZones));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBypassResult), bypassResult));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNumberOfZones):
             ReturnErrorOnFailure(DataModel::Decode(reader, numberOfZones));
@@ -20945,9 +19673,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace BypassResponse.
 namespace GetBypassedZoneList {
@@ -20961,26 +19687,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetBypassedZoneList.
 namespace GetZoneStatusResponse {
@@ -20998,17 +19718,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatusComplete), zoneStatusComplete));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumberOfZones), numberOfZones));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatusResult), zoneStatusResult));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kZoneStatusComplete):
             ReturnErrorOnFailure(DataModel::Decode(reader, zoneStatusComplete));
@@ -21024,9 +19743,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetZoneStatusResponse.
 namespace GetZoneStatus {
@@ -21046,17 +19763,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartingZoneId), startingZoneId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMaxNumberOfZoneIds), maxNumberOfZoneIds));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatusMaskFlag), zoneStatusMaskFlag));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kZoneStatusMask), zoneStatusMask));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStartingZoneId):
             ReturnErrorOnFailure(DataModel::Decode(reader, startingZoneId));
@@ -21075,9 +19792,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetZoneStatus.
 } // namespace Commands
@@ -21132,17 +19847,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWarningInfo), warningInfo));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWarningDuration), warningDuration));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStrobeDutyCycle), strobeDutyCycle));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStrobeLevel), strobeLevel));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWarningInfo):
             ReturnErrorOnFailure(DataModel::Decode(reader, warningInfo));
@@ -21161,9 +19876,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StartWarning.
 namespace Squawk {
@@ -21178,17 +19891,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSquawkInfo), squawkInfo));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSquawkInfo):
             ReturnErrorOnFailure(DataModel::Decode(reader, squawkInfo));
@@ -21198,9 +19908,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Squawk.
 } // namespace Commands
@@ -21298,18 +20006,18 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMajorNumber), majorNumber));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMinorNumber), minorNumber));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCallSign), callSign));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAffiliateCallSign), affiliateCallSign));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMajorNumber):
             ReturnErrorOnFailure(DataModel::Decode(reader, majorNumber));
@@ -21331,10 +20039,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ChannelInfo
@@ -21353,18 +20058,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperatorName), operatorName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLineupName), lineupName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPostalCode), postalCode));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLineupInfoType), lineupInfoType));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kOperatorName):
             ReturnErrorOnFailure(DataModel::Decode(reader, operatorName));
@@ -21383,10 +20087,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace LineupInfo
@@ -21405,17 +20106,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMatch), match));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMatch):
             ReturnErrorOnFailure(DataModel::Decode(reader, match));
@@ -21425,9 +20123,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ChangeChannel.
 namespace ChangeChannelResponse {
@@ -21443,17 +20139,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -21466,9 +20160,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ChangeChannelResponse.
 namespace ChangeChannelByNumber {
@@ -21484,17 +20176,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMajorNumber), majorNumber));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMinorNumber), minorNumber));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMajorNumber):
             ReturnErrorOnFailure(DataModel::Decode(reader, majorNumber));
@@ -21507,9 +20197,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ChangeChannelByNumber.
 namespace SkipChannel {
@@ -21524,17 +20212,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCount), count));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCount):
             ReturnErrorOnFailure(DataModel::Decode(reader, count));
@@ -21544,9 +20229,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SkipChannel.
 } // namespace Commands
@@ -21607,18 +20290,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIdentifier), identifier));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIdentifier):
             ReturnErrorOnFailure(DataModel::Decode(reader, identifier));
@@ -21631,10 +20311,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace TargetInfo
@@ -21654,17 +20331,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTarget), target));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTarget):
             ReturnErrorOnFailure(DataModel::Decode(reader, target));
@@ -21677,9 +20352,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace NavigateTarget.
 namespace NavigateTargetResponse {
@@ -21695,17 +20368,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -21718,9 +20389,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace NavigateTargetResponse.
 } // namespace Commands
@@ -21778,18 +20447,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kUpdatedAt), updatedAt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPosition), position));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kUpdatedAt):
             ReturnErrorOnFailure(DataModel::Decode(reader, updatedAt));
@@ -21802,10 +20468,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace PlaybackPosition
@@ -21823,26 +20486,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Play.
 namespace Pause {
@@ -21856,26 +20513,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Pause.
 namespace StopPlayback {
@@ -21889,26 +20540,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StopPlayback.
 namespace StartOver {
@@ -21922,26 +20567,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StartOver.
 namespace Previous {
@@ -21955,26 +20594,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Previous.
 namespace Next {
@@ -21988,26 +20621,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Next.
 namespace Rewind {
@@ -22021,26 +20648,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Rewind.
 namespace FastForward {
@@ -22054,26 +20675,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace FastForward.
 namespace SkipForward {
@@ -22089,17 +20704,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDeltaPositionMilliseconds), deltaPositionMilliseconds));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kDeltaPositionMilliseconds):
             ReturnErrorOnFailure(DataModel::Decode(reader, deltaPositionMilliseconds));
@@ -22109,9 +20721,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SkipForward.
 namespace SkipBackward {
@@ -22127,17 +20737,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDeltaPositionMilliseconds), deltaPositionMilliseconds));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kDeltaPositionMilliseconds):
             ReturnErrorOnFailure(DataModel::Decode(reader, deltaPositionMilliseconds));
@@ -22147,9 +20754,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SkipBackward.
 namespace PlaybackResponse {
@@ -22165,17 +20770,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -22188,9 +20791,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace PlaybackResponse.
 namespace Seek {
@@ -22205,17 +20806,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kPosition), position));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kPosition):
             ReturnErrorOnFailure(DataModel::Decode(reader, position));
@@ -22225,9 +20823,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Seek.
 } // namespace Commands
@@ -22302,18 +20898,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIndex), index));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kInputType), inputType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDescription), description));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, index));
@@ -22332,10 +20927,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace InputInfo
@@ -22354,17 +20946,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIndex), index));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, index));
@@ -22374,9 +20963,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SelectInput.
 namespace ShowInputStatus {
@@ -22390,26 +20977,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace ShowInputStatus.
 namespace HideInputStatus {
@@ -22423,26 +21004,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace HideInputStatus.
 namespace RenameInput {
@@ -22458,17 +21033,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIndex), index));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, index));
@@ -22481,9 +21054,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RenameInput.
 } // namespace Commands
@@ -22540,26 +21111,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Sleep.
 } // namespace Commands
@@ -22611,17 +21176,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kKeyCode), keyCode));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kKeyCode):
             ReturnErrorOnFailure(DataModel::Decode(reader, keyCode));
@@ -22631,9 +21193,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SendKey.
 namespace SendKeyResponse {
@@ -22648,17 +21208,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -22668,9 +21225,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SendKeyResponse.
 } // namespace Commands
@@ -22723,18 +21278,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWidth), width));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kHeight), height));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMetric), metric));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWidth):
             ReturnErrorOnFailure(DataModel::Decode(reader, width));
@@ -22750,10 +21303,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace Dimension
@@ -22770,18 +21320,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kName):
             ReturnErrorOnFailure(DataModel::Decode(reader, name));
@@ -22794,10 +21341,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace AdditionalInfo
@@ -22815,18 +21359,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kType), type));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kExternalIDList), externalIDList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kType):
             ReturnErrorOnFailure(DataModel::Decode(reader, type));
@@ -22842,10 +21384,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace Parameter
@@ -22861,18 +21400,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kParameterList), parameterList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kParameterList):
             ReturnErrorOnFailure(DataModel::Decode(reader, parameterList));
@@ -22882,10 +21417,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ContentSearch
@@ -22903,18 +21435,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kImageUrl), imageUrl));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kColor), color));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSize), size));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kImageUrl):
             ReturnErrorOnFailure(DataModel::Decode(reader, imageUrl));
@@ -22930,10 +21460,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace StyleInformation
@@ -22954,18 +21481,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProviderName), providerName));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBackground), background));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogo), logo));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProgressBar), progressBar));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSplash), splash));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWaterMark), waterMark));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kProviderName):
             ReturnErrorOnFailure(DataModel::Decode(reader, providerName));
@@ -22990,10 +21518,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace BrandingInformation
@@ -23014,17 +21539,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSearch), search));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAutoPlay), autoPlay));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSearch):
             ReturnErrorOnFailure(DataModel::Decode(reader, search));
@@ -23040,9 +21564,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LaunchContent.
 namespace LaunchURL {
@@ -23060,17 +21582,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kContentURL), contentURL));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDisplayString), displayString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kBrandingInformation), brandingInformation));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kContentURL):
             ReturnErrorOnFailure(DataModel::Decode(reader, contentURL));
@@ -23086,9 +21607,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LaunchURL.
 namespace LaunchResponse {
@@ -23104,17 +21623,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -23127,9 +21644,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LaunchResponse.
 } // namespace Commands
@@ -23188,18 +21703,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIndex), index));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOutputType), outputType));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, index));
@@ -23215,10 +21728,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace OutputInfo
@@ -23237,17 +21747,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIndex), index));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, index));
@@ -23257,9 +21764,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SelectOutput.
 namespace RenameOutput {
@@ -23275,17 +21780,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIndex), index));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kName), name));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, index));
@@ -23298,9 +21801,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace RenameOutput.
 } // namespace Commands
@@ -23358,18 +21859,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCatalogVendorId), catalogVendorId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplicationId), applicationId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCatalogVendorId):
             ReturnErrorOnFailure(DataModel::Decode(reader, catalogVendorId));
@@ -23382,10 +21880,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace Application
@@ -23402,18 +21897,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplication), application));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEndpoint), endpoint));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kApplication):
             ReturnErrorOnFailure(DataModel::Decode(reader, application));
@@ -23426,10 +21918,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ApplicationEP
@@ -23449,17 +21938,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplication), application));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kApplication):
             ReturnErrorOnFailure(DataModel::Decode(reader, application));
@@ -23472,9 +21959,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LaunchApp.
 namespace StopApp {
@@ -23489,17 +21974,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplication), application));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kApplication):
             ReturnErrorOnFailure(DataModel::Decode(reader, application));
@@ -23509,9 +21991,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StopApp.
 namespace HideApp {
@@ -23526,17 +22006,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplication), application));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kApplication):
             ReturnErrorOnFailure(DataModel::Decode(reader, application));
@@ -23546,9 +22023,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace HideApp.
 namespace LauncherResponse {
@@ -23564,17 +22039,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kData), data));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStatus):
             ReturnErrorOnFailure(DataModel::Decode(reader, status));
@@ -23587,9 +22060,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LauncherResponse.
 } // namespace Commands
@@ -23647,18 +22118,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kCatalogVendorId), catalogVendorId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kApplicationId), applicationId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kCatalogVendorId):
             ReturnErrorOnFailure(DataModel::Decode(reader, catalogVendorId));
@@ -23671,10 +22139,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace ApplicationBasicApplication
@@ -23755,17 +22220,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTempAccountIdentifier), tempAccountIdentifier));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTempAccountIdentifier):
             ReturnErrorOnFailure(DataModel::Decode(reader, tempAccountIdentifier));
@@ -23775,9 +22237,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetSetupPIN.
 namespace GetSetupPINResponse {
@@ -23792,17 +22252,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSetupPIN), setupPIN));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kSetupPIN):
             ReturnErrorOnFailure(DataModel::Decode(reader, setupPIN));
@@ -23812,9 +22269,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetSetupPINResponse.
 namespace Login {
@@ -23831,17 +22286,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTempAccountIdentifier), tempAccountIdentifier));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kSetupPIN), setupPIN));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTempAccountIdentifier):
             ReturnErrorOnFailure(DataModel::Decode(reader, tempAccountIdentifier));
@@ -23854,9 +22307,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Login.
 namespace Logout {
@@ -23870,26 +22321,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Logout.
 } // namespace Commands
@@ -23947,18 +22392,21 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kA), a));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kB), b));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kC), c));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kD), d));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kE), e));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kF), f));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kG), g));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kH), h));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kA):
             ReturnErrorOnFailure(DataModel::Decode(reader, a));
@@ -23989,10 +22437,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace SimpleStruct
@@ -24058,18 +22503,22 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricSensitiveInt8u), fabricSensitiveInt8u));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalFabricSensitiveInt8u), optionalFabricSensitiveInt8u));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableFabricSensitiveInt8u), nullableFabricSensitiveInt8u));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalFabricSensitiveInt8u), nullableOptionalFabricSensitiveInt8u));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricSensitiveCharString), fabricSensitiveCharString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricSensitiveStruct), fabricSensitiveStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricSensitiveInt8uList), fabricSensitiveInt8uList));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kFabricSensitiveInt8u):
             ReturnErrorOnFailure(DataModel::Decode(reader, fabricSensitiveInt8u));
@@ -24100,10 +22549,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace TestFabricScoped
@@ -24134,18 +22580,25 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableInt), nullableInt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalInt), optionalInt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalInt), nullableOptionalInt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableString), nullableString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalString), optionalString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalString), nullableOptionalString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableStruct), nullableStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalStruct), optionalStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStruct), nullableOptionalStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableList), nullableList));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalList), optionalList));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalList), nullableOptionalList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNullableInt):
             ReturnErrorOnFailure(DataModel::Decode(reader, nullableInt));
@@ -24188,10 +22641,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NullablesAndOptionalsStruct
@@ -24209,18 +22659,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kA), a));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kB), b));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kC), c));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kA):
             ReturnErrorOnFailure(DataModel::Decode(reader, a));
@@ -24236,10 +22684,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NestedStruct
@@ -24261,18 +22706,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kA), a));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kB), b));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kC), c));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kD), d));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kE), e));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kF), f));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kG), g));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kA):
             ReturnErrorOnFailure(DataModel::Decode(reader, a));
@@ -24300,10 +22747,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace NestedStructList
@@ -24319,18 +22763,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kA), a));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kA):
             ReturnErrorOnFailure(DataModel::Decode(reader, a));
@@ -24340,10 +22780,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace DoubleNestedStructList
@@ -24360,18 +22797,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    err = reader.EnterContainer(outer);
-    ReturnErrorOnFailure(err);
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kFabricIndex), fabricIndex));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOperationalCert), operationalCert));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kFabricIndex):
             ReturnErrorOnFailure(DataModel::Decode(reader, fabricIndex));
@@ -24384,10 +22818,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 
 } // namespace TestListStructOctet
@@ -24405,26 +22836,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace Test.
 namespace TestSpecificResponse {
@@ -24439,17 +22864,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReturnValue), returnValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kReturnValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, returnValue));
@@ -24459,9 +22881,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestSpecificResponse.
 namespace TestNotHandled {
@@ -24475,26 +22895,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestNotHandled.
 namespace TestAddArgumentsResponse {
@@ -24509,17 +22923,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReturnValue), returnValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kReturnValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, returnValue));
@@ -24529,9 +22940,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestAddArgumentsResponse.
 namespace TestSpecific {
@@ -24545,26 +22954,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestSpecific.
 namespace TestSimpleArgumentResponse {
@@ -24579,17 +22982,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kReturnValue), returnValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kReturnValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, returnValue));
@@ -24599,9 +22999,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestSimpleArgumentResponse.
 namespace TestUnknownCommand {
@@ -24615,26 +23013,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestUnknownCommand.
 namespace TestStructArrayArgumentResponse {
@@ -24654,17 +23046,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg3), arg3));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg4), arg4));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg5), arg5));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg6), arg6));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24689,9 +23083,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestStructArrayArgumentResponse.
 namespace TestAddArguments {
@@ -24707,17 +23099,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24730,9 +23120,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestAddArguments.
 namespace TestListInt8UReverseResponse {
@@ -24747,17 +23135,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24767,9 +23152,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestListInt8UReverseResponse.
 namespace TestSimpleArgumentRequest {
@@ -24784,17 +23167,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24804,9 +23184,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestSimpleArgumentRequest.
 namespace TestEnumsResponse {
@@ -24822,17 +23200,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24845,9 +23221,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEnumsResponse.
 namespace TestStructArrayArgumentRequest {
@@ -24867,17 +23241,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg3), arg3));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg4), arg4));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg5), arg5));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg6), arg6));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24902,9 +23278,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestStructArrayArgumentRequest.
 namespace TestNullableOptionalResponse {
@@ -24922,17 +23296,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWasPresent), wasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kWasNull), wasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOriginalValue), originalValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kWasPresent):
             ReturnErrorOnFailure(DataModel::Decode(reader, wasPresent));
@@ -24951,9 +23325,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestNullableOptionalResponse.
 namespace TestStructArgumentRequest {
@@ -24968,17 +23340,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -24988,9 +23357,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestStructArgumentRequest.
 namespace TestComplexNullableOptionalResponse {
@@ -25056,17 +23423,47 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableIntWasNull), nullableIntWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableIntValue), nullableIntValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalIntWasPresent), optionalIntWasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalIntValue), optionalIntValue));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalIntWasPresent), nullableOptionalIntWasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalIntWasNull), nullableOptionalIntWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalIntValue), nullableOptionalIntValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableStringWasNull), nullableStringWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableStringValue), nullableStringValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalStringWasPresent), optionalStringWasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalStringValue), optionalStringValue));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStringWasPresent), nullableOptionalStringWasPresent));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStringWasNull), nullableOptionalStringWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStringValue), nullableOptionalStringValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableStructWasNull), nullableStructWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableStructValue), nullableStructValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalStructWasPresent), optionalStructWasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalStructValue), optionalStructValue));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStructWasPresent), nullableOptionalStructWasPresent));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStructWasNull), nullableOptionalStructWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStructValue), nullableOptionalStructValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableListWasNull), nullableListWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableListValue), nullableListValue));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalListWasPresent), optionalListWasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalListValue), optionalListValue));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalListWasPresent), nullableOptionalListWasPresent));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalListWasNull), nullableOptionalListWasNull));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalListValue), nullableOptionalListValue));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNullableIntWasNull):
             ReturnErrorOnFailure(DataModel::Decode(reader, nullableIntWasNull));
@@ -25157,9 +23554,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestComplexNullableOptionalResponse.
 namespace TestNestedStructArgumentRequest {
@@ -25174,17 +23569,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25194,9 +23586,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestNestedStructArgumentRequest.
 namespace BooleanResponse {
@@ -25211,17 +23601,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, value));
@@ -25231,9 +23618,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace BooleanResponse.
 namespace TestListStructArgumentRequest {
@@ -25248,17 +23633,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25268,9 +23650,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestListStructArgumentRequest.
 namespace SimpleStructResponse {
@@ -25285,17 +23665,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25305,9 +23682,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SimpleStructResponse.
 namespace TestListInt8UArgumentRequest {
@@ -25322,17 +23697,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25342,9 +23714,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestListInt8UArgumentRequest.
 namespace TestEmitTestEventResponse {
@@ -25359,17 +23729,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, value));
@@ -25379,9 +23746,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEmitTestEventResponse.
 namespace TestNestedStructListArgumentRequest {
@@ -25396,17 +23761,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25416,9 +23778,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestNestedStructListArgumentRequest.
 namespace TestEmitTestFabricScopedEventResponse {
@@ -25433,17 +23793,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kValue), value));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kValue):
             ReturnErrorOnFailure(DataModel::Decode(reader, value));
@@ -25453,9 +23810,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEmitTestFabricScopedEventResponse.
 namespace TestListNestedStructListArgumentRequest {
@@ -25470,17 +23825,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25490,9 +23842,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestListNestedStructListArgumentRequest.
 namespace TestListInt8UReverseRequest {
@@ -25507,17 +23857,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25527,9 +23874,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestListInt8UReverseRequest.
 namespace TestEnumsRequest {
@@ -25545,17 +23890,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25568,9 +23911,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEnumsRequest.
 namespace TestNullableOptionalRequest {
@@ -25585,17 +23926,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25605,9 +23943,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestNullableOptionalRequest.
 namespace TestComplexNullableOptionalRequest {
@@ -25637,17 +23973,25 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableInt), nullableInt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalInt), optionalInt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalInt), nullableOptionalInt));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableString), nullableString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalString), optionalString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalString), nullableOptionalString));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableStruct), nullableStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalStruct), optionalStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalStruct), nullableOptionalStruct));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableList), nullableList));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kOptionalList), optionalList));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNullableOptionalList), nullableOptionalList));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kNullableInt):
             ReturnErrorOnFailure(DataModel::Decode(reader, nullableInt));
@@ -25690,9 +24034,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestComplexNullableOptionalRequest.
 namespace SimpleStructEchoRequest {
@@ -25707,17 +24049,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25727,9 +24066,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace SimpleStructEchoRequest.
 namespace TimedInvokeRequest {
@@ -25743,26 +24080,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TimedInvokeRequest.
 namespace TestSimpleOptionalArgumentRequest {
@@ -25777,17 +24108,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25797,9 +24125,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestSimpleOptionalArgumentRequest.
 namespace TestEmitTestEventRequest {
@@ -25816,17 +24142,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg3), arg3));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25842,9 +24167,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEmitTestEventRequest.
 namespace TestEmitTestFabricScopedEventRequest {
@@ -25859,17 +24182,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -25879,9 +24199,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEmitTestFabricScopedEventRequest.
 } // namespace Commands
@@ -26175,17 +24493,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg2), arg2));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg3), arg3));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg4), arg4));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg5), arg5));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg6), arg6));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -26210,9 +24530,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestEvent.
 namespace TestFabricScopedEvent {
@@ -26227,17 +24545,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kArg1), arg1));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kArg1):
             ReturnErrorOnFailure(DataModel::Decode(reader, arg1));
@@ -26247,9 +24562,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace TestFabricScopedEvent.
 } // namespace Events
@@ -26276,17 +24589,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageId), messageId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageControl), messageControl));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartTime), startTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDurationInMinutes), durationInMinutes));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessage), message));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kOptionalExtendedMessageControl), optionalExtendedMessageControl));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMessageId):
             ReturnErrorOnFailure(DataModel::Decode(reader, messageId));
@@ -26311,9 +24627,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DisplayMessage.
 namespace GetLastMessage {
@@ -26327,26 +24641,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetLastMessage.
 namespace CancelMessage {
@@ -26362,17 +24670,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageId), messageId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageControl), messageControl));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMessageId):
             ReturnErrorOnFailure(DataModel::Decode(reader, messageId));
@@ -26385,9 +24691,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CancelMessage.
 namespace MessageConfirmation {
@@ -26406,17 +24710,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageId), messageId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kConfirmationTime), confirmationTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageConfirmationControl), messageConfirmationControl));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageResponse), messageResponse));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMessageId):
             ReturnErrorOnFailure(DataModel::Decode(reader, messageId));
@@ -26435,9 +24739,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace MessageConfirmation.
 namespace DisplayProtectedMessage {
@@ -26458,17 +24760,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageId), messageId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessageControl), messageControl));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartTime), startTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kDurationInMinutes), durationInMinutes));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMessage), message));
+    ReturnErrorOnFailure(
+        decoder.DecodeInOrder(to_underlying(Fields::kOptionalExtendedMessageControl), optionalExtendedMessageControl));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kMessageId):
             ReturnErrorOnFailure(DataModel::Decode(reader, messageId));
@@ -26493,9 +24798,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace DisplayProtectedMessage.
 namespace GetMessageCancellation {
@@ -26511,17 +24814,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEarliestImplementationTime), earliestImplementationTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEarliestImplementationTime):
             ReturnErrorOnFailure(DataModel::Decode(reader, earliestImplementationTime));
@@ -26531,9 +24831,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetMessageCancellation.
 namespace CancelAllMessages {
@@ -26549,17 +24847,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kImplementationDateTime), implementationDateTime));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kImplementationDateTime):
             ReturnErrorOnFailure(DataModel::Decode(reader, implementationDateTime));
@@ -26569,9 +24864,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace CancelAllMessages.
 } // namespace Commands
@@ -26768,26 +25061,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetAlerts.
 namespace GetAlertsResponse {
@@ -26803,17 +25090,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlertsCount), alertsCount));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlertStructures), alertStructures));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAlertsCount):
             ReturnErrorOnFailure(DataModel::Decode(reader, alertsCount));
@@ -26826,9 +25111,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetAlertsResponse.
 namespace AlertsNotification {
@@ -26844,17 +25127,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlertsCount), alertsCount));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAlertStructures), alertStructures));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAlertsCount):
             ReturnErrorOnFailure(DataModel::Decode(reader, alertsCount));
@@ -26867,9 +25148,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace AlertsNotification.
 namespace EventsNotification {
@@ -26885,17 +25164,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEventHeader), eventHeader));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kEventId), eventId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kEventHeader):
             ReturnErrorOnFailure(DataModel::Decode(reader, eventHeader));
@@ -26908,9 +25185,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace EventsNotification.
 } // namespace Commands
@@ -26965,17 +25240,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeStamp), timeStamp));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogId), logId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogLength), logLength));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogPayload), logPayload));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTimeStamp):
             ReturnErrorOnFailure(DataModel::Decode(reader, timeStamp));
@@ -26994,9 +25269,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LogNotification.
 namespace LogRequest {
@@ -27011,17 +25284,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogId), logId));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLogId):
             ReturnErrorOnFailure(DataModel::Decode(reader, logId));
@@ -27031,9 +25301,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LogRequest.
 namespace LogResponse {
@@ -27051,17 +25319,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kTimeStamp), timeStamp));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogId), logId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogLength), logLength));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogPayload), logPayload));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kTimeStamp):
             ReturnErrorOnFailure(DataModel::Decode(reader, timeStamp));
@@ -27080,9 +25348,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LogResponse.
 namespace LogQueueRequest {
@@ -27096,26 +25362,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LogQueueRequest.
 namespace LogQueueResponse {
@@ -27131,17 +25391,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogQueueSize), logQueueSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogIds), logIds));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLogQueueSize):
             ReturnErrorOnFailure(DataModel::Decode(reader, logQueueSize));
@@ -27154,9 +25412,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace LogQueueResponse.
 namespace StatisticsAvailable {
@@ -27172,17 +25428,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogQueueSize), logQueueSize));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kLogIds), logIds));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kLogQueueSize):
             ReturnErrorOnFailure(DataModel::Decode(reader, logQueueSize));
@@ -27195,9 +25449,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace StatisticsAvailable.
 } // namespace Commands
@@ -27260,17 +25512,17 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProfileCount), profileCount));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProfileIntervalPeriod), profileIntervalPeriod));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kMaxNumberOfIntervals), maxNumberOfIntervals));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kListOfAttributes), listOfAttributes));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kProfileCount):
             ReturnErrorOnFailure(DataModel::Decode(reader, profileCount));
@@ -27289,9 +25541,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetProfileInfoResponseCommand.
 namespace GetProfileInfoCommand {
@@ -27305,26 +25555,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         default:
             break;
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetProfileInfoCommand.
 namespace GetMeasurementProfileResponseCommand {
@@ -27346,17 +25590,19 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartTime), startTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStatus), status));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kProfileIntervalPeriod), profileIntervalPeriod));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumberOfIntervalsDelivered), numberOfIntervalsDelivered));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAttributeId), attributeId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kIntervals), intervals));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kStartTime):
             ReturnErrorOnFailure(DataModel::Decode(reader, startTime));
@@ -27381,9 +25627,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetMeasurementProfileResponseCommand.
 namespace GetMeasurementProfileCommand {
@@ -27400,17 +25644,16 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    CHIP_ERROR err = CHIP_NO_ERROR;
-    TLV::TLVType outer;
-    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-    ReturnErrorOnFailure(reader.EnterContainer(outer));
-    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    DataModel::StructDecoder decoder(reader);
+    ReturnErrorOnFailure(decoder.Enter());
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kAttributeId), attributeId));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kStartTime), startTime));
+    ReturnErrorOnFailure(decoder.DecodeInOrder(to_underlying(Fields::kNumberOfIntervals), numberOfIntervals));
+
+    CHIP_ERROR err;
+    while ((err = decoder.NextOutOfOrder()) == CHIP_NO_ERROR)
     {
-        if (!TLV::IsContextTag(reader.GetTag()))
-        {
-            continue;
-        }
-        switch (TLV::TagNumFromTag(reader.GetTag()))
+        switch (decoder.GetFieldId())
         {
         case to_underlying(Fields::kAttributeId):
             ReturnErrorOnFailure(DataModel::Decode(reader, attributeId));
@@ -27426,9 +25669,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    return decoder.Exit(err);
 }
 } // namespace GetMeasurementProfileCommand.
 } // namespace Commands
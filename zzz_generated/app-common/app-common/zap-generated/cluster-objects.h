@@ -31,6 +31,7 @@
 #include <app/data-model/Encode.h>
 #include <app/data-model/List.h>
 #include <app/data-model/NullObject.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/util/basic-types.h>
 #include <lib/core/ClusterEnums.h>
 #include <lib/support/BitFlags.h>